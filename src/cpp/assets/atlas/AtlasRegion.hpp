@@ -0,0 +1,64 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_atlas_region_hpp__
+#define __c0de4un_atlas_region_hpp__
+
+// Include opengl
+#ifndef __c0de4un_opengl_hpp__
+#include "../../cfg/opengl.hpp"
+#endif // !__c0de4un_opengl_hpp__
+
+// Include STL
+#include <cstdint> // uint32_t
+
+// AtlasRegion declared
+#define __c0de4un_atlas_region_decl__
+
+// Enable structure-data (fields, variables) alignment (by compilator) to 1 byte
+#pragma pack( push, 1 )
+
+namespace c0de4un
+{
+
+	/*
+	 * AtlasRegion - image placed in the TextureAtlas page.
+	 *
+	 * @version 1.0
+	*/
+	struct AtlasRegion final
+	{
+
+		/* Page index */
+		uint32_t page_;
+
+		/* OpenGL 2D Texture Object ID of the page */
+		GLuint textureObject_;
+
+		/* Left, in texels (padding excluded) */
+		uint32_t x_;
+
+		/* Bottom, in texels (padding excluded) */
+		uint32_t y_;
+
+		/* Image width */
+		uint32_t width_;
+
+		/* Image height */
+		uint32_t height_;
+
+		/* Texture coordinates ( u, v, width, height ), in [0; 1] */
+		float uvRect_[4];
+
+	};
+
+}
+
+// Restore structure-data alignment to default (8-byte on MSVC)
+#pragma pack( pop )
+
+#endif // !__c0de4un_atlas_region_hpp__
\ No newline at end of file
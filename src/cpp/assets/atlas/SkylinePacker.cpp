@@ -0,0 +1,251 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+// HEADER
+#ifndef __c0de4un_skyline_packer_hpp__
+#include "SkylinePacker.hpp"
+#endif // !__c0de4un_skyline_packer_hpp__
+
+namespace c0de4un
+{
+
+	// -------------------------------------------------------- \\
+
+	// ===========================================================
+	// Constructor & destructor
+	// ===========================================================
+
+	/*
+	 * SkylinePacker constructor.
+	 *
+	 * @param width_ - packing area width.
+	 * @param height_ - packing area height.
+	 * @throws - std::bad_alloc.
+	*/
+	SkylinePacker::SkylinePacker( const uint32_t width_, const uint32_t height_ )
+		: mWidth( width_ ),
+		mHeight( height_ ),
+		mNodes( ),
+		mUsedArea( 0 )
+	{
+
+		// Reserve segments
+		mNodes.reserve( 64 );
+
+		// Empty skyline
+		Reset( );
+
+	}
+
+	/* SkylinePacker destructor */
+	SkylinePacker::~SkylinePacker( )
+	{
+	}
+
+	// ===========================================================
+	// Getter & Setter
+	// ===========================================================
+
+	/* Returns packing area width */
+	const uint32_t SkylinePacker::getWidth( ) const noexcept
+	{ return( mWidth ); }
+
+	/* Returns packing area height */
+	const uint32_t SkylinePacker::getHeight( ) const noexcept
+	{ return( mHeight ); }
+
+	/* Returns area of the inserted rectangles */
+	const uint64_t SkylinePacker::getUsedArea( ) const noexcept
+	{ return( mUsedArea ); }
+
+	// ===========================================================
+	// Methods
+	// ===========================================================
+
+	/*
+	 * Checks if rectangle fits at the skyline segment.
+	 *
+	 * @param index_ - segment index, rectangle left at segment left.
+	 * @param width_ - rectangle width.
+	 * @param height_ - rectangle height.
+	 * @param y_ - output y (highest segment under rectangle).
+	 * @return - 'true' if fits.
+	*/
+	const bool SkylinePacker::fit( const std::size_t index_, const uint32_t width_, const uint32_t height_, uint32_t & y_ ) const noexcept
+	{
+
+		// Right edge out of area
+		if ( mNodes[index_].x_ + width_ > mWidth )
+			return( false );
+
+		// Width not covered yet
+		uint32_t widthLeft_( width_ );
+
+		// Rectangle rests on the highest segment under it
+		y_ = 0;
+		for ( std::size_t i = index_; widthLeft_ > 0; i++ )
+		{
+
+			// Highest segment
+			if ( mNodes[i].y_ > y_ )
+				y_ = mNodes[i].y_;
+
+			// Top edge out of area
+			if ( y_ + height_ > mHeight )
+				return( false );
+
+			// Covered width
+			widthLeft_ -= mNodes[i].width_ < widthLeft_ ? mNodes[i].width_ : widthLeft_;
+
+		}
+
+		// Return TRUE
+		return( true );
+
+	}
+
+	/* Merges neighbour segments with the same y */
+	void SkylinePacker::merge( ) noexcept
+	{
+
+		// Segments
+		for ( std::size_t i = 1; i < mNodes.size( ); )
+		{
+
+			// Different heights
+			if ( mNodes[i - 1].y_ != mNodes[i].y_ )
+			{
+				i++;
+				continue;
+			}
+
+			// Merge
+			mNodes[i - 1].width_ += mNodes[i].width_;
+			mNodes.erase( mNodes.begin( ) + i );
+
+		}
+
+	}
+
+	/*
+	 * Inserts rectangle.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @param width_ - rectangle width.
+	 * @param height_ - rectangle height.
+	 * @param x_ - output x (left).
+	 * @param y_ - output y (bottom).
+	 * @return - 'false' if no space.
+	 * @throws - std::bad_alloc.
+	*/
+	const bool SkylinePacker::Insert( const uint32_t width_, const uint32_t height_, uint32_t & x_, uint32_t & y_ )
+	{
+
+		// Cancel, if empty or larger than area
+		if ( width_ < 1 || height_ < 1 || width_ > mWidth || height_ > mHeight )
+			return( false );
+
+		// Best segment
+		std::size_t bestIndex_( mNodes.size( ) );
+		uint32_t bestTop_( 0xFFFFFFFF );
+		uint32_t bestWidth_( 0xFFFFFFFF );
+		uint32_t bestY_( 0 );
+
+		// Search lowest top (bottom-left), ties - narrowest segment
+		for ( std::size_t i = 0; i < mNodes.size( ); i++ )
+		{
+
+			// Position
+			uint32_t y( 0 );
+
+			// Skip, if not fits
+			if ( !fit( i, width_, height_, y ) )
+				continue;
+
+			// Better
+			if ( y + height_ < bestTop_ || ( y + height_ == bestTop_ && mNodes[i].width_ < bestWidth_ ) )
+			{
+				bestIndex_ = i;
+				bestTop_ = y + height_;
+				bestWidth_ = mNodes[i].width_;
+				bestY_ = y;
+			}
+
+		}
+
+		// Cancel, if no space
+		if ( bestIndex_ == mNodes.size( ) )
+			return( false );
+
+		// Position
+		x_ = mNodes[bestIndex_].x_;
+		y_ = bestY_;
+
+		// Add segment on the top of the rectangle
+		mNodes.insert( mNodes.begin( ) + bestIndex_, Node{ x_, bestTop_, width_ } );
+
+		// Shrink or remove segments covered by the rectangle
+		for ( std::size_t i = bestIndex_ + 1; i < mNodes.size( ); )
+		{
+
+			// Previous segment right edge
+			const uint32_t right_( mNodes[i - 1].x_ + mNodes[i - 1].width_ );
+
+			// Not covered
+			if ( mNodes[i].x_ >= right_ )
+				break;
+
+			// Covered width
+			const uint32_t shrink_( right_ - mNodes[i].x_ );
+
+			// Fully covered
+			if ( mNodes[i].width_ <= shrink_ )
+			{
+				mNodes.erase( mNodes.begin( ) + i );
+				continue;
+			}
+
+			// Partially covered
+			mNodes[i].x_ += shrink_;
+			mNodes[i].width_ -= shrink_;
+			break;
+
+		}
+
+		// Merge same-height segments
+		merge( );
+
+		// Used area
+		mUsedArea += static_cast<uint64_t>( width_ ) * height_;
+
+		// Return TRUE
+		return( true );
+
+	}
+
+	/*
+	 * Removes all rectangles.
+	 *
+	 * @thread_safety - not thread-safe.
+	*/
+	void SkylinePacker::Reset( ) noexcept
+	{
+
+		// Remove segments
+		mNodes.clear( );
+
+		// One segment along the bottom (capacity reserved, no allocation)
+		mNodes.push_back( Node{ 0, 0, mWidth } );
+
+		// Reset used area
+		mUsedArea = 0;
+
+	}
+
+	// -------------------------------------------------------- \\
+
+}
\ No newline at end of file
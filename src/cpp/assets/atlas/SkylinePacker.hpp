@@ -0,0 +1,180 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_skyline_packer_hpp__
+#define __c0de4un_skyline_packer_hpp__
+
+// Include std::vector
+#ifndef __c0de4un_vector_hpp__
+#include "../../cfg/vector.hpp"
+#endif // !__c0de4un_vector_hpp__
+
+// Include STL
+#include <cstdint> // uint32_t, uint64_t
+
+// SkylinePacker declared
+#define __c0de4un_skyline_packer_decl__
+
+namespace c0de4un
+{
+
+	/*
+	 * SkylinePacker - rectangles packer (skyline, bottom-left heuristic).
+	 *
+	 * Packed area described by the skyline: sorted horizontal segments,
+	 * rectangle placed where its top is lowest (ties - narrowest segment).
+	 * Incremental: rectangles inserted one by one, space of removed rectangles
+	 * reclaimed only by Reset & re-insert (see TextureAtlas::Defragment).
+	 *
+	 * @version 1.0
+	*/
+	class SkylinePacker final
+	{
+
+	public:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Constructor & destructor
+		// ===========================================================
+
+		/*
+		 * SkylinePacker constructor.
+		 *
+		 * @param width_ - packing area width.
+		 * @param height_ - packing area height.
+		 * @throws - std::bad_alloc.
+		*/
+		explicit SkylinePacker( const uint32_t width_, const uint32_t height_ );
+
+		/* SkylinePacker destructor */
+		~SkylinePacker( );
+
+		// ===========================================================
+		// Getter & Setter
+		// ===========================================================
+
+		/* Returns packing area width */
+		const uint32_t getWidth( ) const noexcept;
+
+		/* Returns packing area height */
+		const uint32_t getHeight( ) const noexcept;
+
+		/* Returns area of the inserted rectangles */
+		const uint64_t getUsedArea( ) const noexcept;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Inserts rectangle.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param width_ - rectangle width.
+		 * @param height_ - rectangle height.
+		 * @param x_ - output x (left).
+		 * @param y_ - output y (bottom).
+		 * @return - 'false' if no space.
+		 * @throws - std::bad_alloc.
+		*/
+		const bool Insert( const uint32_t width_, const uint32_t height_, uint32_t & x_, uint32_t & y_ );
+
+		/*
+		 * Removes all rectangles.
+		 *
+		 * @thread_safety - not thread-safe.
+		*/
+		void Reset( ) noexcept;
+
+		// -------------------------------------------------------- \\
+
+	private:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Types
+		// ===========================================================
+
+		/* Skyline segment */
+		struct Node final
+		{
+
+			/* Left */
+			uint32_t x_;
+
+			/* Top of the packed rectangles below */
+			uint32_t y_;
+
+			/* Width */
+			uint32_t width_;
+
+		};
+
+		// ===========================================================
+		// Constants
+		// ===========================================================
+
+		/* Width */
+		const uint32_t mWidth;
+
+		/* Height */
+		const uint32_t mHeight;
+
+		// ===========================================================
+		// Fields
+		// ===========================================================
+
+		/* Skyline, sorted by x */
+		std::vector<Node> mNodes;
+
+		/* Inserted area */
+		uint64_t mUsedArea;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Checks if rectangle fits at the skyline segment.
+		 *
+		 * @param index_ - segment index, rectangle left at segment left.
+		 * @param width_ - rectangle width.
+		 * @param height_ - rectangle height.
+		 * @param y_ - output y (highest segment under rectangle).
+		 * @return - 'true' if fits.
+		*/
+		const bool fit( const std::size_t index_, const uint32_t width_, const uint32_t height_, uint32_t & y_ ) const noexcept;
+
+		/* Merges neighbour segments with the same y */
+		void merge( ) noexcept;
+
+		// ===========================================================
+		// Deleted
+		// ===========================================================
+
+		/* @deleted SkylinePacker const copy constructor */
+		SkylinePacker( const SkylinePacker & ) = delete;
+
+		/* @deleted SkylinePacker const copy assignment operator */
+		SkylinePacker & operator=( const SkylinePacker & ) = delete;
+
+		/* @deleted SkylinePacker move constructor */
+		SkylinePacker( SkylinePacker && ) = delete;
+
+		/* @deleted SkylinePacker move assignment operator */
+		SkylinePacker & operator=( SkylinePacker && ) = delete;
+
+		// -------------------------------------------------------- \\
+
+	};
+
+}
+
+#endif // !__c0de4un_skyline_packer_hpp__
\ No newline at end of file
@@ -0,0 +1,585 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+// HEADER
+#ifndef __c0de4un_texture_atlas_hpp__
+#include "TextureAtlas.hpp"
+#endif // !__c0de4un_texture_atlas_hpp__
+
+// Include SkylinePacker
+#ifndef __c0de4un_skyline_packer_hpp__
+#include "SkylinePacker.hpp"
+#endif // !__c0de4un_skyline_packer_hpp__
+
+// Include PNGImage
+#ifndef __c0de4un_png_image_hpp__
+#include "../image/PNGImage.hpp"
+#endif // !__c0de4un_png_image_hpp__
+
+// Include string
+#ifndef __c0de4un_string_hpp__
+#include "../../cfg/string.hpp"
+#endif // !__c0de4un_string_hpp__
+
+// Include Log
+#ifndef __c0de4un_log_hpp__
+#include "../../utils/log/Log.hpp"
+#endif // !__c0de4un_log_hpp__
+
+// Include STL
+#include <algorithm> // sort
+#include <cstring> // memcpy
+#include <utility> // move
+
+namespace c0de4un
+{
+
+	// -------------------------------------------------------- \\
+
+	// ===========================================================
+	// Constructor & destructor
+	// ===========================================================
+
+	/*
+	 * TextureAtlas constructor.
+	 *
+	 * @param pageSize_ - page width & height.
+	 * @param padding_ - padding around each region, texels.
+	 * @param maxPages_ - pages limit.
+	*/
+	TextureAtlas::TextureAtlas( const uint32_t pageSize_, const uint32_t padding_, const uint32_t maxPages_ )
+		: mPageSize( pageSize_ ),
+		mPadding( padding_ ),
+		mMaxPages( maxPages_ ),
+		mPages( ),
+		mRegions( ),
+		mNextID( 1 ),
+		mGeneration( 0 ),
+		mUploadBuffer( )
+	{
+
+		// Log
+		Log::printDebug( "TextureAtlas::constructor" );
+
+	}
+
+	/* TextureAtlas destructor */
+	TextureAtlas::~TextureAtlas( )
+	{
+
+		// Log
+		Log::printDebug( "TextureAtlas::destructor" );
+
+		// Release packers (2D-Textures deleted by Unload)
+		for ( Page & page_ : mPages )
+			delete page_.packer_;
+
+	}
+
+	// ===========================================================
+	// Getter & Setter
+	// ===========================================================
+
+	/* Returns page width & height */
+	const uint32_t TextureAtlas::getPageSize( ) const noexcept
+	{ return( mPageSize ); }
+
+	/* Returns pages count */
+	const uint32_t TextureAtlas::getPagesCount( ) const noexcept
+	{ return( static_cast<uint32_t>( mPages.size( ) ) ); }
+
+	/*
+	 * Returns OpenGL 2D Texture Object ID of the page.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @param page_ - page index.
+	 * @return - 2D Texture Object ID, or 0.
+	*/
+	const GLuint TextureAtlas::getPageTexture( const uint32_t page_ ) const noexcept
+	{ return( page_ < mPages.size( ) ? mPages[page_].textureObject_ : 0 ); }
+
+	/*
+	 * Returns region.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @param id_ - region ID.
+	 * @return - region, or null if not found.
+	*/
+	const AtlasRegion * TextureAtlas::getRegion( const uint32_t id_ ) const noexcept
+	{
+
+		// Search region
+		const std::map<const uint32_t, Entry>::const_iterator entryPos_ = mRegions.find( id_ );
+
+		// Return region
+		return( entryPos_ != mRegions.cend( ) ? &entryPos_->second.region_ : nullptr );
+
+	}
+
+	/*
+	 * Returns generation, incremented when regions UVs changed (defragmentation).
+	 * Copies of UVs (Drawables) must be refreshed, if generation changed.
+	*/
+	const uint32_t TextureAtlas::getGeneration( ) const noexcept
+	{ return( mGeneration ); }
+
+	// ===========================================================
+	// Methods
+	// ===========================================================
+
+	/*
+	 * Creates page.
+	 *
+	 * @return - 'true' if OK.
+	 * @throws - can throw exception.
+	*/
+	const bool TextureAtlas::addPage( )
+	{
+
+		// Page
+		Page page_{ 0, nullptr, 0 };
+
+		// Create 2D-Texture Object
+		glGenTextures( 1, &page_.textureObject_ );
+
+		// Check 2D-Texture Object
+		if ( page_.textureObject_ < 1 )
+		{
+
+			// Log
+			Log::printError( "TextureAtlas::addPage - failed to create 2D-Texture !" );
+
+			// Return FALSE
+			return( false );
+
+		}
+
+		// Bind 2D-Texture Object
+		glBindTexture( GL_TEXTURE_2D, page_.textureObject_ );
+
+		// Allocate storage, regions uploaded later
+		glTexImage2D( GL_TEXTURE_2D, 0, GL_RGBA8, mPageSize, mPageSize, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr );
+
+		// Set Texture Min. & Mag. Filters to Linear (padding prevents bleeding)
+		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR );
+		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
+
+		// No mip-maps: smaller levels blend neighbour regions (padding covers few levels only),
+		// so page complete with level #0 only, even with mip-map filter of the SamplerCache::SPRITE
+		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0 );
+
+		// Set Texture S & T Wrap-Methods to Clamp to edge
+		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE );
+		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE );
+
+		// Unbind Texture
+		glBindTexture( GL_TEXTURE_2D, 0 );
+
+		// Guarded-Block
+		try
+		{
+
+			// Create packer
+			page_.packer_ = new SkylinePacker( mPageSize, mPageSize );
+
+			// Add page
+			mPages.push_back( page_ );
+
+		}
+		catch ( ... )
+		{
+
+			// Release
+			delete page_.packer_;
+			glDeleteTextures( 1, &page_.textureObject_ );
+
+			// Re-throw
+			throw;
+
+		}
+
+		// Log
+		std::string logMsg( "TextureAtlas::addPage - page #" );
+		logMsg += std::to_string( mPages.size( ) - 1 );
+		logMsg += " created";
+		Log::printDebug( logMsg.c_str( ) );
+
+		// Return TRUE
+		return( true );
+
+	}
+
+	/*
+	 * Packs region into the page, sets position & UVs.
+	 *
+	 * @param page_ - page index.
+	 * @param region_ - region, width & height set.
+	 * @return - 'false' if no space.
+	 * @throws - std::bad_alloc.
+	*/
+	const bool TextureAtlas::place( const uint32_t page_, AtlasRegion & region_ )
+	{
+
+		// Page
+		Page & atlasPage_ = mPages[page_];
+
+		// Padded size
+		const uint32_t width_( region_.width_ + mPadding * 2 );
+		const uint32_t height_( region_.height_ + mPadding * 2 );
+
+		// Position
+		uint32_t x( 0 ), y( 0 );
+
+		// Pack
+		if ( !atlasPage_.packer_->Insert( width_, height_, x, y ) )
+			return( false );
+
+		// Page
+		region_.page_ = page_;
+		region_.textureObject_ = atlasPage_.textureObject_;
+
+		// Position (padding excluded)
+		region_.x_ = x + mPadding;
+		region_.y_ = y + mPadding;
+
+		// UVs
+		const float scale_( 1.0f / static_cast<float>( mPageSize ) );
+		region_.uvRect_[0] = static_cast<float>( region_.x_ ) * scale_;
+		region_.uvRect_[1] = static_cast<float>( region_.y_ ) * scale_;
+		region_.uvRect_[2] = static_cast<float>( region_.width_ ) * scale_;
+		region_.uvRect_[3] = static_cast<float>( region_.height_ ) * scale_;
+
+		// Live area
+		atlasPage_.liveArea_ += static_cast<uint64_t>( width_ ) * height_;
+
+		// Return TRUE
+		return( true );
+
+	}
+
+	/*
+	 * Uploads padded & extruded region pixels to the page.
+	 *
+	 * @param entry_ - region.
+	 * @throws - std::bad_alloc.
+	*/
+	void TextureAtlas::upload( const Entry & entry_ )
+	{
+
+		// Region
+		const AtlasRegion & region_ = entry_.region_;
+
+		// Padded size
+		const uint32_t width_( region_.width_ + mPadding * 2 );
+		const uint32_t height_( region_.height_ + mPadding * 2 );
+
+		// Allocate
+		mUploadBuffer.resize( static_cast<std::size_t>( width_ ) * height_ * 4 );
+
+		// Copy with edge extrusion (padding texels repeat the nearest edge texel)
+		for ( uint32_t y = 0; y < height_; y++ )
+		{
+
+			// Source row (clamped)
+			const uint32_t sourceY_( y < mPadding ? 0 : ( y - mPadding < region_.height_ ? y - mPadding : region_.height_ - 1 ) );
+			const unsigned char *const source_( entry_.pixels_.data( ) + static_cast<std::size_t>( sourceY_ ) * region_.width_ * 4 );
+
+			// Destination row
+			unsigned char *const destination_( mUploadBuffer.data( ) + static_cast<std::size_t>( y ) * width_ * 4 );
+
+			// Left padding
+			for ( uint32_t x = 0; x < mPadding; x++ )
+				std::memcpy( destination_ + x * 4, source_, 4 );
+
+			// Row
+			std::memcpy( destination_ + mPadding * 4, source_, region_.width_ * 4 );
+
+			// Right padding
+			for ( uint32_t x = mPadding + region_.width_; x < width_; x++ )
+				std::memcpy( destination_ + x * 4, source_ + ( region_.width_ - 1 ) * 4, 4 );
+
+		}
+
+		// Bind page
+		glBindTexture( GL_TEXTURE_2D, region_.textureObject_ );
+
+		// Tightly packed rows
+		glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
+
+		// Upload
+		glTexSubImage2D( GL_TEXTURE_2D, 0, region_.x_ - mPadding, region_.y_ - mPadding, width_, height_, GL_RGBA, GL_UNSIGNED_BYTE, mUploadBuffer.data( ) );
+
+		// Unbind Texture
+		glBindTexture( GL_TEXTURE_2D, 0 );
+
+	}
+
+	/*
+	 * Adds image to the atlas.
+	 * Pages with removed regions defragmented, if image doesn't fit,
+	 * new page created if still no space.
+	 * Generation incremented if defragmented, UVs copies must be refreshed (SpriteSystem::refreshAtlas).
+	 *
+	 * @thread_safety - thread with current OpenGL context only.
+	 * @param image_ - loaded image, 8 bits per channel.
+	 * @return - region ID, or 0 if failed.
+	 * @throws - can throw exception.
+	*/
+	const uint32_t TextureAtlas::Insert( const PNGImage & image_ )
+	{
+
+		// Region
+		Entry entry_;
+
+		// Convert pixels
+		if ( !image_.toRGBA8( entry_.pixels_ ) )
+		{
+
+			// Log
+			std::string logMsg( "TextureAtlas::Insert - image format not supported: " );
+			logMsg += image_.mFile;
+			Log::printError( logMsg.c_str( ) );
+
+			// Return 0
+			return( 0 );
+
+		}
+
+		// Size
+		entry_.region_.width_ = image_.mSize[0];
+		entry_.region_.height_ = image_.mSize[1];
+
+		// Padded area
+		const uint64_t area_( static_cast<uint64_t>( entry_.region_.width_ + mPadding * 2 ) * ( entry_.region_.height_ + mPadding * 2 ) );
+
+		// Placed flag
+		bool placed_( false );
+
+		// Try pages
+		for ( uint32_t page_ = 0; !placed_ && page_ < mPages.size( ); page_++ )
+			placed_ = place( page_, entry_.region_ );
+
+		// Defragment pages with enough removed space
+		for ( uint32_t page_ = 0; !placed_ && page_ < mPages.size( ); page_++ )
+		{
+
+			// Page
+			const Page & atlasPage_ = mPages[page_];
+
+			// Skip, if nothing removed or not enough free space
+			if ( atlasPage_.packer_->getUsedArea( ) == atlasPage_.liveArea_ || static_cast<uint64_t>( mPageSize ) * mPageSize - atlasPage_.liveArea_ < area_ )
+				continue;
+
+			// Repack & try
+			placed_ = Defragment( page_ ) && place( page_, entry_.region_ );
+
+		}
+
+		// New page
+		if ( !placed_ && mPages.size( ) < mMaxPages && addPage( ) )
+			placed_ = place( static_cast<uint32_t>( mPages.size( ) - 1 ), entry_.region_ );
+
+		// Cancel, if no space
+		if ( !placed_ )
+		{
+
+			// Log
+			std::string logMsg( "TextureAtlas::Insert - no space for image: " );
+			logMsg += image_.mFile;
+			Log::printError( logMsg.c_str( ) );
+
+			// Return 0
+			return( 0 );
+
+		}
+
+		// Upload
+		upload( entry_ );
+
+		// Region ID
+		const uint32_t id_( mNextID++ );
+
+		// Add region
+		mRegions.emplace( id_, std::move( entry_ ) );
+
+		// Return region ID
+		return( id_ );
+
+	}
+
+	/*
+	 * Removes region. Space reclaimed by defragmentation.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @param id_ - region ID.
+	*/
+	void TextureAtlas::Remove( const uint32_t id_ ) noexcept
+	{
+
+		// Search region
+		const std::map<const uint32_t, Entry>::iterator entryPos_ = mRegions.find( id_ );
+
+		// Cancel
+		if ( entryPos_ == mRegions.end( ) )
+			return;
+
+		// Region
+		const AtlasRegion & region_ = entryPos_->second.region_;
+
+		// Live area
+		mPages[region_.page_].liveArea_ -= static_cast<uint64_t>( region_.width_ + mPadding * 2 ) * ( region_.height_ + mPadding * 2 );
+
+		// Remove region
+		mRegions.erase( entryPos_ );
+
+	}
+
+	/*
+	 * Repacks live regions of the page (tallest first) & uploads moved regions.
+	 * Nothing changed, if regions don't fit.
+	 *
+	 * @thread_safety - thread with current OpenGL context only.
+	 * @param page_ - page index.
+	 * @return - 'true' if repacked.
+	 * @throws - can throw exception.
+	*/
+	const bool TextureAtlas::Defragment( const uint32_t page_ )
+	{
+
+		// Cancel
+		if ( page_ >= mPages.size( ) )
+			return( false );
+
+		// Regions of the page
+		std::vector<Entry*> entries_;
+		for ( std::pair<const uint32_t, Entry> & entryPair_ : mRegions )
+		{
+			if ( entryPair_.second.region_.page_ == page_ )
+				entries_.push_back( &entryPair_.second );
+		}
+
+		// Tallest first, then widest
+		std::sort( entries_.begin( ), entries_.end( ), []( const Entry *const a_, const Entry *const b_ ) { return( a_->region_.height_ != b_->region_.height_ ? a_->region_.height_ > b_->region_.height_ : a_->region_.width_ > b_->region_.width_ ); } );
+
+		// New positions
+		std::vector<uint32_t> positions_( entries_.size( ) * 2 );
+
+		// New packer
+		SkylinePacker * packer_( new SkylinePacker( mPageSize, mPageSize ) );
+
+		// Guarded-Block
+		try
+		{
+
+			// Repack
+			for ( std::size_t i = 0; i < entries_.size( ); i++ )
+			{
+
+				// Region
+				const AtlasRegion & region_ = entries_[i]->region_;
+
+				// Cancel, if not fits
+				if ( !packer_->Insert( region_.width_ + mPadding * 2, region_.height_ + mPadding * 2, positions_[i * 2], positions_[i * 2 + 1] ) )
+				{
+					delete packer_;
+					return( false );
+				}
+
+			}
+
+		}
+		catch ( ... )
+		{
+
+			// Release
+			delete packer_;
+
+			// Re-throw
+			throw;
+
+		}
+
+		// Replace packer
+		delete mPages[page_].packer_;
+		mPages[page_].packer_ = packer_;
+
+		// Move regions
+		const float scale_( 1.0f / static_cast<float>( mPageSize ) );
+		for ( std::size_t i = 0; i < entries_.size( ); i++ )
+		{
+
+			// Region
+			AtlasRegion & region_ = entries_[i]->region_;
+
+			// Position (padding excluded)
+			const uint32_t x_( positions_[i * 2] + mPadding );
+			const uint32_t y_( positions_[i * 2 + 1] + mPadding );
+
+			// Skip, if not moved
+			if ( region_.x_ == x_ && region_.y_ == y_ )
+				continue;
+
+			// Set position & UVs
+			region_.x_ = x_;
+			region_.y_ = y_;
+			region_.uvRect_[0] = static_cast<float>( x_ ) * scale_;
+			region_.uvRect_[1] = static_cast<float>( y_ ) * scale_;
+
+			// Upload
+			upload( *entries_[i] );
+
+		}
+
+		// UVs changed
+		mGeneration++;
+
+		// Log
+		std::string logMsg( "TextureAtlas::Defragment - page #" );
+		logMsg += std::to_string( page_ );
+		logMsg += " repacked, regions: ";
+		logMsg += std::to_string( entries_.size( ) );
+		Log::printDebug( logMsg.c_str( ) );
+
+		// Return TRUE
+		return( true );
+
+	}
+
+	/*
+	 * Deletes pages & regions.
+	 *
+	 * @thread_safety - thread with current OpenGL context only.
+	*/
+	void TextureAtlas::Unload( ) noexcept
+	{
+
+		// Pages
+		for ( Page & page_ : mPages )
+		{
+
+			// Delete 2D-Texture
+			glDeleteTextures( 1, &page_.textureObject_ );
+
+			// Delete packer
+			delete page_.packer_;
+
+		}
+
+		// Remove pages
+		mPages.clear( );
+
+		// Remove regions
+		mRegions.clear( );
+
+		// Regions UVs invalid
+		mGeneration++;
+
+	}
+
+	// -------------------------------------------------------- \\
+
+}
\ No newline at end of file
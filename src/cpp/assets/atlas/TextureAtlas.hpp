@@ -0,0 +1,305 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_texture_atlas_hpp__
+#define __c0de4un_texture_atlas_hpp__
+
+// Include opengl
+#ifndef __c0de4un_opengl_hpp__
+#include "../../cfg/opengl.hpp"
+#endif // !__c0de4un_opengl_hpp__
+
+// Include std::map
+#ifndef __c0de4un_map_hpp__
+#include "../../cfg/map.hpp"
+#endif // !__c0de4un_map_hpp__
+
+// Include std::vector
+#ifndef __c0de4un_vector_hpp__
+#include "../../cfg/vector.hpp"
+#endif // !__c0de4un_vector_hpp__
+
+// Include AtlasRegion
+#ifndef __c0de4un_atlas_region_hpp__
+#include "AtlasRegion.hpp"
+#endif // !__c0de4un_atlas_region_hpp__
+
+// Forward-declaration of SkylinePacker
+#ifndef __c0de4un_skyline_packer_decl__
+#define __c0de4un_skyline_packer_decl__
+namespace c0de4un { class SkylinePacker; }
+#endif // !__c0de4un_skyline_packer_decl__
+
+// Forward-declared PNGImage
+#ifndef __c0de4un_png_image_decl__
+#define __c0de4un_png_image_decl__
+namespace c0de4un { class PNGImage; }
+#endif // !__c0de4un_png_image_decl__
+
+// TextureAtlas declared
+#define __c0de4un_texture_atlas_decl__
+
+namespace c0de4un
+{
+
+	/*
+	 * TextureAtlas - packs images into large RGBA8 2D-Texture pages,
+	 * so Sprites with different images share one 2D-Texture (one batch, one bind).
+	 *
+	 * Each image padded & its edge texels extruded into the padding,
+	 * so linear filtering never samples neighbour images.
+	 * Sprites get region UVs instead of own 2D-Texture (see Drawable::uvRect_).
+	 *
+	 * Pixels of each region kept in memory, so page can be repacked (Defragment)
+	 * after regions removed. Regions never move between pages (page 2D-Texture,
+	 * so batches, stay the same), only UVs change - see getGeneration.
+	 *
+	 * (!) Binds GL_TEXTURE_2D directly, GLStateCache must be invalidated after
+	 * changes on the render-thread.
+	 *
+	 * @features
+	 * - skyline (bottom-left) packing ;
+	 * - incremental insertion, new page if no space ;
+	 * - per-page defragmentation, when page is full but has removed regions ;
+	 *
+	 * @version 1.0
+	*/
+	class TextureAtlas final
+	{
+
+	public:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Config
+		// ===========================================================
+
+		/* Default page size (width & height) */
+		static constexpr uint32_t DEFAULT_PAGE_SIZE = 2048;
+
+		/* Default padding around each region, texels */
+		static constexpr uint32_t DEFAULT_PADDING = 2;
+
+		/* Default pages limit */
+		static constexpr uint32_t DEFAULT_MAX_PAGES = 8;
+
+		// ===========================================================
+		// Constructor & destructor
+		// ===========================================================
+
+		/*
+		 * TextureAtlas constructor.
+		 *
+		 * @param pageSize_ - page width & height.
+		 * @param padding_ - padding around each region, texels.
+		 * @param maxPages_ - pages limit.
+		*/
+		explicit TextureAtlas( const uint32_t pageSize_ = DEFAULT_PAGE_SIZE, const uint32_t padding_ = DEFAULT_PADDING, const uint32_t maxPages_ = DEFAULT_MAX_PAGES );
+
+		/* TextureAtlas destructor */
+		~TextureAtlas( );
+
+		// ===========================================================
+		// Getter & Setter
+		// ===========================================================
+
+		/* Returns page width & height */
+		const uint32_t getPageSize( ) const noexcept;
+
+		/* Returns pages count */
+		const uint32_t getPagesCount( ) const noexcept;
+
+		/*
+		 * Returns OpenGL 2D Texture Object ID of the page.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param page_ - page index.
+		 * @return - 2D Texture Object ID, or 0.
+		*/
+		const GLuint getPageTexture( const uint32_t page_ ) const noexcept;
+
+		/*
+		 * Returns region.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param id_ - region ID.
+		 * @return - region, or null if not found.
+		*/
+		const AtlasRegion * getRegion( const uint32_t id_ ) const noexcept;
+
+		/*
+		 * Returns generation, incremented when regions UVs changed (defragmentation).
+		 * Copies of UVs (Drawables) must be refreshed, if generation changed.
+		*/
+		const uint32_t getGeneration( ) const noexcept;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Adds image to the atlas.
+		 * Pages with removed regions defragmented, if image doesn't fit,
+		 * new page created if still no space.
+	 * Generation incremented if defragmented, UVs copies must be refreshed (SpriteSystem::refreshAtlas).
+		 *
+		 * @thread_safety - thread with current OpenGL context only.
+		 * @param image_ - loaded image, 8 bits per channel.
+		 * @return - region ID, or 0 if failed.
+		 * @throws - can throw exception.
+		*/
+		const uint32_t Insert( const PNGImage & image_ );
+
+		/*
+		 * Removes region. Space reclaimed by defragmentation.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param id_ - region ID.
+		*/
+		void Remove( const uint32_t id_ ) noexcept;
+
+		/*
+		 * Repacks live regions of the page (tallest first) & uploads moved regions.
+		 * Nothing changed, if regions don't fit.
+		 *
+		 * @thread_safety - thread with current OpenGL context only.
+		 * @param page_ - page index.
+		 * @return - 'true' if repacked.
+		 * @throws - can throw exception.
+		*/
+		const bool Defragment( const uint32_t page_ );
+
+		/*
+		 * Deletes pages & regions.
+		 *
+		 * @thread_safety - thread with current OpenGL context only.
+		*/
+		void Unload( ) noexcept;
+
+		// -------------------------------------------------------- \\
+
+	private:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Types
+		// ===========================================================
+
+		/* Atlas page */
+		struct Page final
+		{
+
+			/* OpenGL 2D Texture Object ID */
+			GLuint textureObject_;
+
+			/* Packer */
+			SkylinePacker * packer_;
+
+			/* Area of the live regions (padded) */
+			uint64_t liveArea_;
+
+		};
+
+		/* Region with pixels (RGBA8, rows as in PNGImage) */
+		struct Entry final
+		{
+
+			/* Region */
+			AtlasRegion region_;
+
+			/* Pixels */
+			std::vector<unsigned char> pixels_;
+
+		};
+
+		// ===========================================================
+		// Constants
+		// ===========================================================
+
+		/* Page width & height */
+		const uint32_t mPageSize;
+
+		/* Padding */
+		const uint32_t mPadding;
+
+		/* Pages limit */
+		const uint32_t mMaxPages;
+
+		// ===========================================================
+		// Fields
+		// ===========================================================
+
+		/* Pages */
+		std::vector<Page> mPages;
+
+		/* Regions by ID */
+		std::map<const uint32_t, Entry> mRegions;
+
+		/* Next region ID */
+		uint32_t mNextID;
+
+		/* UVs generation */
+		uint32_t mGeneration;
+
+		/* Padded & extruded region pixels, upload scratch */
+		std::vector<unsigned char> mUploadBuffer;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Creates page.
+		 *
+		 * @return - 'true' if OK.
+		 * @throws - can throw exception.
+		*/
+		const bool addPage( );
+
+		/*
+		 * Packs region into the page, sets position & UVs.
+		 *
+		 * @param page_ - page index.
+		 * @param region_ - region, width & height set.
+		 * @return - 'false' if no space.
+		 * @throws - std::bad_alloc.
+		*/
+		const bool place( const uint32_t page_, AtlasRegion & region_ );
+
+		/*
+		 * Uploads padded & extruded region pixels to the page.
+		 *
+		 * @param entry_ - region.
+		 * @throws - std::bad_alloc.
+		*/
+		void upload( const Entry & entry_ );
+
+		// ===========================================================
+		// Deleted
+		// ===========================================================
+
+		/* @deleted TextureAtlas const copy constructor */
+		TextureAtlas( const TextureAtlas & ) = delete;
+
+		/* @deleted TextureAtlas const copy assignment operator */
+		TextureAtlas & operator=( const TextureAtlas & ) = delete;
+
+		/* @deleted TextureAtlas move constructor */
+		TextureAtlas( TextureAtlas && ) = delete;
+
+		/* @deleted TextureAtlas move assignment operator */
+		TextureAtlas & operator=( TextureAtlas && ) = delete;
+
+		// -------------------------------------------------------- \\
+
+	};
+
+}
+
+#endif // !__c0de4un_texture_atlas_hpp__
\ No newline at end of file
@@ -0,0 +1,465 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+// HEADER
+#ifndef __c0de4un_bc_encoder_hpp__
+#include "BCEncoder.hpp"
+#endif // !__c0de4un_bc_encoder_hpp__
+
+// Include STL
+#include <cmath> // fabs
+#include <cstring> // memset
+
+namespace c0de4un
+{
+
+	// -------------------------------------------------------- \\
+
+	/* Alpha distance from 0 & 255 still treated as 1-bit alpha (PNG export noise) */
+	static constexpr unsigned char ALPHA_TOLERANCE = 8;
+
+	/* Power iterations of the principal axis */
+	static constexpr int AXIS_ITERATIONS = 4;
+
+	/*
+	 * Quantizes RGB8 color to RGB565.
+	 *
+	 * @param color_ - RGB8 color.
+	*/
+	static uint32_t toRGB565( const int *const color_ ) noexcept
+	{
+		return( ( static_cast<uint32_t>( ( color_[0] * 31 + 127 ) / 255 ) << 11 )
+			| ( static_cast<uint32_t>( ( color_[1] * 63 + 127 ) / 255 ) << 5 )
+			| static_cast<uint32_t>( ( color_[2] * 31 + 127 ) / 255 ) );
+	}
+
+	/*
+	 * Expands RGB565 color to RGB8, the way decoders do.
+	 *
+	 * @param rgb565_ - RGB565 color.
+	 * @param color_ - output RGB8 color.
+	*/
+	static void fromRGB565( const uint32_t rgb565_, int *const color_ ) noexcept
+	{
+		const int r_( static_cast<int>( ( rgb565_ >> 11 ) & 31 ) );
+		const int g_( static_cast<int>( ( rgb565_ >> 5 ) & 63 ) );
+		const int b_( static_cast<int>( rgb565_ & 31 ) );
+		color_[0] = ( r_ << 3 ) | ( r_ >> 2 );
+		color_[1] = ( g_ << 2 ) | ( g_ >> 4 );
+		color_[2] = ( b_ << 3 ) | ( b_ >> 2 );
+	}
+
+	// ===========================================================
+	// Getter & Setter
+	// ===========================================================
+
+	/*
+	 * Returns 'true' if alpha has intermediate values (not only transparent & opaque),
+	 * so BC1 (1-bit alpha) is not enough.
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param pixels_ - RGBA8 pixels, rows tightly packed.
+	 * @param width_ - width.
+	 * @param height_ - height.
+	*/
+	const bool BCEncoder::hasAlphaGradient( const unsigned char *const pixels_, const uint32_t width_, const uint32_t height_ ) noexcept
+	{
+
+		// Pixels count
+		const std::size_t count_( static_cast<std::size_t>( width_ ) * height_ );
+
+		// Search intermediate alpha
+		for ( std::size_t i = 0; i < count_; i++ )
+		{
+			const unsigned char alpha_( pixels_[i * 4 + 3] );
+			if ( alpha_ > ALPHA_TOLERANCE && alpha_ < 255 - ALPHA_TOLERANCE )
+				return( true );
+		}
+
+		// Return FALSE
+		return( false );
+
+	}
+
+	// ===========================================================
+	// Methods
+	// ===========================================================
+
+	/*
+	 * Encodes RGBA8 pixels to BC1 (GL_COMPRESSED_RGBA_S3TC_DXT1_EXT), alpha < 128 encoded as transparent.
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param pixels_ - RGBA8 pixels, rows tightly packed.
+	 * @param width_ - width.
+	 * @param height_ - height.
+	 * @param blocks_ - output blocks, 8 bytes per 4x4 block (see TextureFormats::getImageBytes).
+	*/
+	void BCEncoder::EncodeBC1( const unsigned char *const pixels_, const uint32_t width_, const uint32_t height_, unsigned char *const blocks_ ) noexcept
+	{
+
+		// Block pixels
+		unsigned char block_[64];
+
+		// Output block
+		unsigned char * output_( blocks_ );
+
+		// Blocks, rows of blocks stored one after another
+		for ( uint32_t blockY = 0; blockY * 4 < height_; blockY++ )
+		{
+			for ( uint32_t blockX = 0; blockX * 4 < width_; blockX++, output_ += 8 )
+			{
+
+				// Read block
+				readBlock( pixels_, width_, height_, blockX, blockY, block_ );
+
+				// Transparent texels in the block
+				bool transparent_( false );
+				for ( int i = 0; i < 16 && !transparent_; i++ )
+					transparent_ = block_[i * 4 + 3] < 128;
+
+				// Encode colors, 3-colors mode if transparent
+				encodeColorBlock( block_, transparent_, output_ );
+
+			}
+		}
+
+	}
+
+	/*
+	 * Encodes RGBA8 pixels to BC3 (GL_COMPRESSED_RGBA_S3TC_DXT5_EXT).
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param pixels_ - RGBA8 pixels, rows tightly packed.
+	 * @param width_ - width.
+	 * @param height_ - height.
+	 * @param blocks_ - output blocks, 16 bytes per 4x4 block (see TextureFormats::getImageBytes).
+	*/
+	void BCEncoder::EncodeBC3( const unsigned char *const pixels_, const uint32_t width_, const uint32_t height_, unsigned char *const blocks_ ) noexcept
+	{
+
+		// Block pixels
+		unsigned char block_[64];
+
+		// Output block
+		unsigned char * output_( blocks_ );
+
+		// Blocks, rows of blocks stored one after another
+		for ( uint32_t blockY = 0; blockY * 4 < height_; blockY++ )
+		{
+			for ( uint32_t blockX = 0; blockX * 4 < width_; blockX++, output_ += 16 )
+			{
+
+				// Read block
+				readBlock( pixels_, width_, height_, blockX, blockY, block_ );
+
+				// Encode alpha, then colors (BC3 color block is always 4-colors)
+				encodeAlphaBlock( block_, output_ );
+				encodeColorBlock( block_, false, output_ + 8 );
+
+			}
+		}
+
+	}
+
+	/*
+	 * Copies 4x4 block pixels, edge pixels repeated outside the image.
+	 *
+	 * @param pixels_ - RGBA8 pixels.
+	 * @param width_ - width.
+	 * @param height_ - height.
+	 * @param blockX_ - block column.
+	 * @param blockY_ - block row.
+	 * @param block_ - output 16 RGBA8 pixels.
+	*/
+	void BCEncoder::readBlock( const unsigned char *const pixels_, const uint32_t width_, const uint32_t height_,
+		const uint32_t blockX_, const uint32_t blockY_, unsigned char *const block_ ) noexcept
+	{
+
+		for ( uint32_t y = 0; y < 4; y++ )
+		{
+
+			// Source row, clamped
+			const uint32_t sourceY_( blockY_ * 4 + y < height_ ? blockY_ * 4 + y : height_ - 1 );
+
+			for ( uint32_t x = 0; x < 4; x++ )
+			{
+
+				// Source column, clamped
+				const uint32_t sourceX_( blockX_ * 4 + x < width_ ? blockX_ * 4 + x : width_ - 1 );
+
+				// Copy pixel
+				const unsigned char *const source_( pixels_ + ( static_cast<std::size_t>( sourceY_ ) * width_ + sourceX_ ) * 4 );
+				unsigned char *const destination_( block_ + ( y * 4 + x ) * 4 );
+				destination_[0] = source_[0];
+				destination_[1] = source_[1];
+				destination_[2] = source_[2];
+				destination_[3] = source_[3];
+
+			}
+
+		}
+
+	}
+
+	/*
+	 * Encodes color block (BC1 layout, 8 bytes).
+	 *
+	 * @param block_ - 16 RGBA8 pixels.
+	 * @param transparent_ - 'true' to use 3-colors mode, alpha < 128 encoded as transparent (BC1 only).
+	 * @param output_ - output 8 bytes.
+	*/
+	void BCEncoder::encodeColorBlock( const unsigned char *const block_, const bool transparent_, unsigned char *const output_ ) noexcept
+	{
+
+		// Encoded pixels (opaque pixels only in 3-colors mode)
+		bool used_[16];
+		int usedCount_( 0 );
+
+		// Mean color
+		double mean_[3] = { 0.0, 0.0, 0.0 };
+		for ( int i = 0; i < 16; i++ )
+		{
+			used_[i] = !transparent_ || block_[i * 4 + 3] >= 128;
+			if ( !used_[i] )
+				continue;
+			mean_[0] += block_[i * 4];
+			mean_[1] += block_[i * 4 + 1];
+			mean_[2] += block_[i * 4 + 2];
+			usedCount_++;
+		}
+
+		// All transparent: c0 <= c1 (3-colors mode), all indices #3
+		if ( usedCount_ == 0 )
+		{
+			std::memset( output_, 0, 4 );
+			std::memset( output_ + 4, 0xFF, 4 );
+			return;
+		}
+
+		// Mean
+		for ( int c = 0; c < 3; c++ )
+			mean_[c] /= usedCount_;
+
+		// Covariance (rr, rg, rb, gg, gb, bb)
+		double covariance_[6] = { 0.0, 0.0, 0.0, 0.0, 0.0, 0.0 };
+		for ( int i = 0; i < 16; i++ )
+		{
+			if ( !used_[i] )
+				continue;
+			const double r_( block_[i * 4] - mean_[0] );
+			const double g_( block_[i * 4 + 1] - mean_[1] );
+			const double b_( block_[i * 4 + 2] - mean_[2] );
+			covariance_[0] += r_ * r_;
+			covariance_[1] += r_ * g_;
+			covariance_[2] += r_ * b_;
+			covariance_[3] += g_ * g_;
+			covariance_[4] += g_ * b_;
+			covariance_[5] += b_ * b_;
+		}
+
+		// Principal axis (power iteration), luminance-like axis if colors equal
+		double axis_[3] = { 1.0, 1.0, 1.0 };
+		for ( int iteration = 0; iteration < AXIS_ITERATIONS; iteration++ )
+		{
+
+			// Multiply by covariance
+			const double r_( covariance_[0] * axis_[0] + covariance_[1] * axis_[1] + covariance_[2] * axis_[2] );
+			const double g_( covariance_[1] * axis_[0] + covariance_[3] * axis_[1] + covariance_[4] * axis_[2] );
+			const double b_( covariance_[2] * axis_[0] + covariance_[4] * axis_[1] + covariance_[5] * axis_[2] );
+
+			// Normalize by max. component
+			double max_( std::fabs( r_ ) );
+			if ( std::fabs( g_ ) > max_ )
+				max_ = std::fabs( g_ );
+			if ( std::fabs( b_ ) > max_ )
+				max_ = std::fabs( b_ );
+			if ( max_ < 1e-9 )
+				break;
+			axis_[0] = r_ / max_;
+			axis_[1] = g_ / max_;
+			axis_[2] = b_ / max_;
+
+		}
+
+		// Extreme pixels along the axis
+		int min_( -1 );
+		int max_( -1 );
+		double minDot_( 0.0 );
+		double maxDot_( 0.0 );
+		for ( int i = 0; i < 16; i++ )
+		{
+			if ( !used_[i] )
+				continue;
+			const double dot_( block_[i * 4] * axis_[0] + block_[i * 4 + 1] * axis_[1] + block_[i * 4 + 2] * axis_[2] );
+			if ( min_ < 0 || dot_ < minDot_ )
+			{
+				min_ = i;
+				minDot_ = dot_;
+			}
+			if ( max_ < 0 || dot_ > maxDot_ )
+			{
+				max_ = i;
+				maxDot_ = dot_;
+			}
+		}
+
+		// Endpoints, inset by 1/16 of the range (palette covers the pixels better)
+		int endpoint0_[3];
+		int endpoint1_[3];
+		for ( int c = 0; c < 3; c++ )
+		{
+			const int high_( block_[max_ * 4 + c] );
+			const int low_( block_[min_ * 4 + c] );
+			const int inset_( ( high_ - low_ ) / 16 );
+			endpoint0_[c] = high_ - inset_;
+			endpoint1_[c] = low_ + inset_;
+		}
+
+		// Quantize endpoints
+		uint32_t color0_( toRGB565( endpoint0_ ) );
+		uint32_t color1_( toRGB565( endpoint1_ ) );
+
+		// Order endpoints: c0 > c1 for 4-colors mode, c0 <= c1 for 3-colors mode
+		if ( transparent_ ? color0_ > color1_ : color0_ < color1_ )
+		{
+			const uint32_t swap_( color0_ );
+			color0_ = color1_;
+			color1_ = swap_;
+		}
+
+		// Palette, as decoded
+		int palette_[4][3];
+		fromRGB565( color0_, palette_[0] );
+		fromRGB565( color1_, palette_[1] );
+		for ( int c = 0; c < 3; c++ )
+		{
+			if ( transparent_ )
+			{
+				palette_[2][c] = ( palette_[0][c] + palette_[1][c] ) / 2;
+				palette_[3][c] = 0;
+			}
+			else
+			{
+				palette_[2][c] = ( 2 * palette_[0][c] + palette_[1][c] ) / 3;
+				palette_[3][c] = ( palette_[0][c] + 2 * palette_[1][c] ) / 3;
+			}
+		}
+
+		// Selectable colors (#3 is transparent in 3-colors mode, equal endpoints use #0 only)
+		const int colorsCount_( color0_ == color1_ ? 1 : ( transparent_ ? 3 : 4 ) );
+
+		// Indices, 2 bits per texel
+		uint32_t indices_( 0 );
+		for ( int i = 0; i < 16; i++ )
+		{
+
+			// Transparent texel
+			if ( !used_[i] )
+			{
+				indices_ |= 3u << ( i * 2 );
+				continue;
+			}
+
+			// Nearest palette color
+			int nearest_( 0 );
+			int nearestDistance_( -1 );
+			for ( int p = 0; p < colorsCount_; p++ )
+			{
+				const int r_( block_[i * 4] - palette_[p][0] );
+				const int g_( block_[i * 4 + 1] - palette_[p][1] );
+				const int b_( block_[i * 4 + 2] - palette_[p][2] );
+				const int distance_( r_ * r_ + g_ * g_ + b_ * b_ );
+				if ( nearestDistance_ < 0 || distance_ < nearestDistance_ )
+				{
+					nearest_ = p;
+					nearestDistance_ = distance_;
+				}
+			}
+
+			// Set index
+			indices_ |= static_cast<uint32_t>( nearest_ ) << ( i * 2 );
+
+		}
+
+		// Write endpoints & indices, little-endian
+		output_[0] = static_cast<unsigned char>( color0_ );
+		output_[1] = static_cast<unsigned char>( color0_ >> 8 );
+		output_[2] = static_cast<unsigned char>( color1_ );
+		output_[3] = static_cast<unsigned char>( color1_ >> 8 );
+		output_[4] = static_cast<unsigned char>( indices_ );
+		output_[5] = static_cast<unsigned char>( indices_ >> 8 );
+		output_[6] = static_cast<unsigned char>( indices_ >> 16 );
+		output_[7] = static_cast<unsigned char>( indices_ >> 24 );
+
+	}
+
+	/*
+	 * Encodes alpha block (BC3 layout, 8 bytes).
+	 *
+	 * @param block_ - 16 RGBA8 pixels.
+	 * @param output_ - output 8 bytes.
+	*/
+	void BCEncoder::encodeAlphaBlock( const unsigned char *const block_, unsigned char *const output_ ) noexcept
+	{
+
+		// Alpha range
+		int alpha0_( 0 );
+		int alpha1_( 255 );
+		for ( int i = 0; i < 16; i++ )
+		{
+			const int alpha_( block_[i * 4 + 3] );
+			if ( alpha_ > alpha0_ )
+				alpha0_ = alpha_;
+			if ( alpha_ < alpha1_ )
+				alpha1_ = alpha_;
+		}
+
+		// Palette, 8-values mode (alpha0 > alpha1)
+		int palette_[8];
+		palette_[0] = alpha0_;
+		palette_[1] = alpha1_;
+		for ( int p = 2; p < 8; p++ )
+			palette_[p] = ( ( 8 - p ) * alpha0_ + ( p - 1 ) * alpha1_ ) / 7;
+
+		// Indices, 3 bits per texel (all #0 if alpha constant)
+		uint64_t indices_( 0 );
+		if ( alpha0_ != alpha1_ )
+		{
+			for ( int i = 0; i < 16; i++ )
+			{
+
+				// Nearest palette value
+				const int alpha_( block_[i * 4 + 3] );
+				int nearest_( 0 );
+				int nearestDistance_( 256 );
+				for ( int p = 0; p < 8; p++ )
+				{
+					const int distance_( alpha_ > palette_[p] ? alpha_ - palette_[p] : palette_[p] - alpha_ );
+					if ( distance_ < nearestDistance_ )
+					{
+						nearest_ = p;
+						nearestDistance_ = distance_;
+					}
+				}
+
+				// Set index
+				indices_ |= static_cast<uint64_t>( nearest_ ) << ( i * 3 );
+
+			}
+		}
+
+		// Write endpoints & indices (48 bits), little-endian
+		output_[0] = static_cast<unsigned char>( alpha0_ );
+		output_[1] = static_cast<unsigned char>( alpha1_ );
+		for ( int i = 0; i < 6; i++ )
+			output_[2 + i] = static_cast<unsigned char>( indices_ >> ( i * 8 ) );
+
+	}
+
+	// -------------------------------------------------------- \\
+
+}
\ No newline at end of file
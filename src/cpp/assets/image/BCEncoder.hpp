@@ -0,0 +1,143 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_bc_encoder_hpp__
+#define __c0de4un_bc_encoder_hpp__
+
+// Include STL
+#include <cstdint> // uint32_t
+
+// BCEncoder declared
+#define __c0de4un_bc_encoder_decl__
+
+namespace c0de4un
+{
+
+	/*
+	 * BCEncoder - CPU encoder of RGBA8 pixels to BC1 (DXT1) & BC3 (DXT5) blocks.
+	 *
+	 * Range fit: endpoints are the extreme pixels along the principal color axis, inset by 1/16,
+	 * texels mapped to the nearest palette color. Fast enough for the cook step, not an offline-quality
+	 * encoder (use DDS/KTX from texture tools for that).
+	 * Partial blocks (size not multiple of 4) padded with edge pixels.
+	 *
+	 * @version 1.0
+	*/
+	class BCEncoder final
+	{
+
+	public:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Getter & Setter
+		// ===========================================================
+
+		/*
+		 * Returns 'true' if alpha has intermediate values (not only transparent & opaque),
+		 * so BC1 (1-bit alpha) is not enough.
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param pixels_ - RGBA8 pixels, rows tightly packed.
+		 * @param width_ - width.
+		 * @param height_ - height.
+		*/
+		static const bool hasAlphaGradient( const unsigned char *const pixels_, const uint32_t width_, const uint32_t height_ ) noexcept;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Encodes RGBA8 pixels to BC1 (GL_COMPRESSED_RGBA_S3TC_DXT1_EXT), alpha < 128 encoded as transparent.
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param pixels_ - RGBA8 pixels, rows tightly packed.
+		 * @param width_ - width.
+		 * @param height_ - height.
+		 * @param blocks_ - output blocks, 8 bytes per 4x4 block (see TextureFormats::getImageBytes).
+		*/
+		static void EncodeBC1( const unsigned char *const pixels_, const uint32_t width_, const uint32_t height_, unsigned char *const blocks_ ) noexcept;
+
+		/*
+		 * Encodes RGBA8 pixels to BC3 (GL_COMPRESSED_RGBA_S3TC_DXT5_EXT).
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param pixels_ - RGBA8 pixels, rows tightly packed.
+		 * @param width_ - width.
+		 * @param height_ - height.
+		 * @param blocks_ - output blocks, 16 bytes per 4x4 block (see TextureFormats::getImageBytes).
+		*/
+		static void EncodeBC3( const unsigned char *const pixels_, const uint32_t width_, const uint32_t height_, unsigned char *const blocks_ ) noexcept;
+
+		// -------------------------------------------------------- \\
+
+	private:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Copies 4x4 block pixels, edge pixels repeated outside the image.
+		 *
+		 * @param pixels_ - RGBA8 pixels.
+		 * @param width_ - width.
+		 * @param height_ - height.
+		 * @param blockX_ - block column.
+		 * @param blockY_ - block row.
+		 * @param block_ - output 16 RGBA8 pixels.
+		*/
+		static void readBlock( const unsigned char *const pixels_, const uint32_t width_, const uint32_t height_,
+			const uint32_t blockX_, const uint32_t blockY_, unsigned char *const block_ ) noexcept;
+
+		/*
+		 * Encodes color block (BC1 layout, 8 bytes).
+		 *
+		 * @param block_ - 16 RGBA8 pixels.
+		 * @param transparent_ - 'true' to use 3-colors mode, alpha < 128 encoded as transparent (BC1 only).
+		 * @param output_ - output 8 bytes.
+		*/
+		static void encodeColorBlock( const unsigned char *const block_, const bool transparent_, unsigned char *const output_ ) noexcept;
+
+		/*
+		 * Encodes alpha block (BC3 layout, 8 bytes).
+		 *
+		 * @param block_ - 16 RGBA8 pixels.
+		 * @param output_ - output 8 bytes.
+		*/
+		static void encodeAlphaBlock( const unsigned char *const block_, unsigned char *const output_ ) noexcept;
+
+		// ===========================================================
+		// Deleted
+		// ===========================================================
+
+		/* @deleted BCEncoder constructor */
+		BCEncoder( ) = delete;
+
+		/* @deleted BCEncoder const copy constructor */
+		BCEncoder( const BCEncoder & ) = delete;
+
+		/* @deleted BCEncoder const copy assignment operator */
+		BCEncoder & operator=( const BCEncoder & ) = delete;
+
+		/* @deleted BCEncoder move constructor */
+		BCEncoder( BCEncoder && ) = delete;
+
+		/* @deleted BCEncoder move assignment operator */
+		BCEncoder & operator=( BCEncoder && ) = delete;
+
+		// -------------------------------------------------------- \\
+
+	};
+
+}
+
+#endif // !__c0de4un_bc_encoder_hpp__
\ No newline at end of file
@@ -0,0 +1,210 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+// HEADER
+#ifndef __c0de4un_compressed_image_hpp__
+#include "CompressedImage.hpp"
+#endif // !__c0de4un_compressed_image_hpp__
+
+// Include CompressedLoader
+#ifndef __c0de4un_compressed_loader_hpp__
+#include "CompressedLoader.hpp"
+#endif // !__c0de4un_compressed_loader_hpp__
+
+// Include InputFile
+#ifndef __c0de4un_input_file_hpp__
+#include "../../utils/io/InputFile.hpp"
+#endif // !__c0de4un_input_file_hpp__
+
+// Include StreamMode
+#ifndef __c0de4un_stream_mode_hpp__
+#include "../../utils/io/StreamMode.hpp"
+#endif // !__c0de4un_stream_mode_hpp__
+
+// Include Log
+#ifndef __c0de4un_log_hpp__
+#include "../../utils/log/Log.hpp"
+#endif // !__c0de4un_log_hpp__
+
+// Include STL
+#include <cctype> // tolower
+
+namespace c0de4un
+{
+
+	// -------------------------------------------------------- \\
+
+	// ===========================================================
+	// Constructor & destructor
+	// ===========================================================
+
+	/*
+	 * CompressedImage constructor
+	 *
+	 * @param pFile - path to the DDS or KTX file.
+	*/
+	CompressedImage::CompressedImage( const std::string & pFile )
+		: mFile( pFile ),
+		mSize{ 0, 0 },
+		mFormat( 0 ),
+		mLevels( ),
+		mBytes( ),
+		mSourceHash( 0 )
+	{
+
+		// Log
+		std::string logMsg( "CompressedImage#" );
+		logMsg += mFile;
+		logMsg += "::constructor";
+		Log::printDebug( logMsg.c_str( ) );
+
+	}
+
+	/* CompressedImage destructor */
+	CompressedImage::~CompressedImage( )
+	{
+
+		// Log
+		std::string logMsg( "CompressedImage#" );
+		logMsg += mFile;
+		logMsg += "::destructor";
+		Log::printDebug( logMsg.c_str( ) );
+
+	}
+
+	// ===========================================================
+	// Getter & Setter
+	// ===========================================================
+
+	/*
+	 * Returns 'true' if the file is DDS or KTX (by extension).
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param file_ - file path.
+	*/
+	const bool CompressedImage::isCompressedFile( const std::string & file_ ) noexcept
+	{
+
+		// Cancel, if no extension
+		if ( file_.size( ) < 4 || file_[file_.size( ) - 4] != '.' )
+			return( false );
+
+		// Extension, lower-case
+		char extension_[3];
+		for ( std::size_t i = 0; i < 3; i++ )
+			extension_[i] = static_cast<char>( std::tolower( static_cast<unsigned char>( file_[file_.size( ) - 3 + i] ) ) );
+
+		// Return TRUE if ".dds" or ".ktx"
+		return( ( extension_[0] == 'd' && extension_[1] == 'd' && extension_[2] == 's' )
+			|| ( extension_[0] == 'k' && extension_[1] == 't' && extension_[2] == 'x' ) );
+
+	}
+
+	/*
+	 * Returns blocks of the mipmap level.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @param level_ - mipmap level, less than levels count.
+	*/
+	const unsigned char *const CompressedImage::getLevelData( const uint32_t level_ ) const noexcept
+	{ return( mBytes.data( ) + mLevels[level_].offset_ ); }
+
+	/*
+	 * Returns 'true' if loaded.
+	 *
+	 * @thread_safety - not thread-safe.
+	*/
+	const bool CompressedImage::isLoaded( ) const noexcept
+	{ return( !mLevels.empty( ) ); }
+
+	// ===========================================================
+	// Methods
+	// ===========================================================
+
+	/*
+	 * Load DDS or KTX file, from the mounted AssetPack if packed.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @return - 'true' if OK, 'false' if not found, corrupted or format not supported.
+	 * @throws - can throw exception (io-exception, std::bad_alloc, etc).
+	*/
+	const bool CompressedImage::Load( )
+	{
+
+		// Cancel
+		if ( isLoaded( ) )
+			return( true );
+
+		// Log
+		std::string logMsg( "CompressedImage#" );
+		logMsg += mFile;
+		logMsg += "::Load";
+		Log::printDebug( logMsg.c_str( ) );
+
+		// Cancel, if not DDS or KTX
+		if ( !isCompressedFile( mFile ) )
+			return( false );
+
+		// InputFile
+		InputFile inputFile;
+
+		// Open stream
+		if ( !inputFile.openStream_A( mFile, StreamMode::READ_BYTES, 0 ) )
+			return( false );
+
+		// Load DDS or KTX (by the 2nd char of the extension)
+		const char type_( static_cast<char>( std::tolower( static_cast<unsigned char>( mFile[mFile.size( ) - 2] ) ) ) );
+		const bool loaded_( type_ == 'd' ? CompressedLoader::loadDDS( this, &inputFile ) : CompressedLoader::loadKTX( this, &inputFile ) );
+
+		// Close stream
+		inputFile.close( );
+
+		// Reset on fail
+		if ( !loaded_ )
+		{
+
+			// Log
+			logMsg = "CompressedImage::Load - failed to load #";
+			logMsg += mFile;
+			Log::printWarning( logMsg.c_str( ) );
+
+			// Release bytes
+			Unload( );
+
+			// Return FALSE
+			return( false );
+
+		}
+
+		// Return TRUE
+		return( true );
+
+	}
+
+	/*
+	 * Unload image, releases bytes.
+	 *
+	 * @thread_safety - not thread-safe.
+	*/
+	void CompressedImage::Unload( ) noexcept
+	{
+
+		// Release levels & bytes
+		std::vector<ImageLevel>( ).swap( mLevels );
+		std::vector<unsigned char>( ).swap( mBytes );
+
+		// Reset
+		mSize[0] = 0;
+		mSize[1] = 0;
+		mFormat = 0;
+		mSourceHash = 0;
+
+	}
+
+	// -------------------------------------------------------- \\
+
+}
\ No newline at end of file
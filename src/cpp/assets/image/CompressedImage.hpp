@@ -0,0 +1,187 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_compressed_image_hpp__
+#define __c0de4un_compressed_image_hpp__
+
+// Include string
+#ifndef __c0de4un_string_hpp__
+#include "../../cfg/string.hpp"
+#endif // !__c0de4un_string_hpp__
+
+// Include OpenGL
+#ifndef __c0de4un_opengl_hpp__
+#include "../../cfg/opengl.hpp"
+#endif // !__c0de4un_opengl_hpp__
+
+// Include std::vector
+#ifndef __c0de4un_vector_hpp__
+#include "../../cfg/vector.hpp"
+#endif // !__c0de4un_vector_hpp__
+
+// Include STL
+#include <cstdint> // uint32_t, uint64_t
+
+// CompressedImage declared
+#define __c0de4un_compressed_image_decl__
+
+namespace c0de4un
+{
+
+	/*
+	 * ImageLevel - mipmap level of the compressed image.
+	 *
+	 * @version 1.0
+	*/
+	struct ImageLevel final
+	{
+
+		/* Offset in the image bytes */
+		uint32_t offset_;
+
+		/* Bytes count */
+		uint32_t size_;
+
+		/* Width in texels */
+		uint32_t width_;
+
+		/* Height in texels */
+		uint32_t height_;
+
+	};
+
+	/*
+	 * CompressedImage - block-compressed (BC1/BC2/BC3, BC7, ETC2) image asset, loaded from DDS or KTX file.
+	 *
+	 * Blocks uploaded as stored (glCompressedTexImage2D), so files must be authored
+	 * bottom row first, like PNGLoader output. Cooked DDS files (see TextureCache) are.
+	 *
+	 * @version 1.0
+	*/
+	class CompressedImage final
+	{
+
+	public:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Constants
+		// ===========================================================
+
+		/* Path to the DDS or KTX file */
+		const std::string mFile;
+
+		// ===========================================================
+		// Fields
+		// ===========================================================
+
+		/* Width & Height of the level #0 */
+		uint32_t mSize[2];
+
+		/* OpenGL compressed internal format */
+		GLenum mFormat;
+
+		/* Mipmap levels, #0 first */
+		std::vector<ImageLevel> mLevels;
+
+		/* Blocks of all levels */
+		std::vector<unsigned char> mBytes;
+
+		/* Source image hash of the cooked DDS file, 0 if not cooked */
+		uint64_t mSourceHash;
+
+		// ===========================================================
+		// Constructor & destructor
+		// ===========================================================
+
+		/*
+		 * CompressedImage constructor
+		 *
+		 * @param pFile - path to the DDS or KTX file.
+		*/
+		explicit CompressedImage( const std::string & pFile );
+
+		/* CompressedImage destructor */
+		~CompressedImage( );
+
+		// ===========================================================
+		// Getter & Setter
+		// ===========================================================
+
+		/*
+		 * Returns 'true' if the file is DDS or KTX (by extension).
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param file_ - file path.
+		*/
+		static const bool isCompressedFile( const std::string & file_ ) noexcept;
+
+		/*
+		 * Returns blocks of the mipmap level.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param level_ - mipmap level, less than levels count.
+		*/
+		const unsigned char *const getLevelData( const uint32_t level_ ) const noexcept;
+
+		/*
+		 * Returns 'true' if loaded.
+		 *
+		 * @thread_safety - not thread-safe.
+		*/
+		const bool isLoaded( ) const noexcept;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Load DDS or KTX file, from the mounted AssetPack if packed.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @return - 'true' if OK, 'false' if not found, corrupted or format not supported.
+		 * @throws - can throw exception (io-exception, std::bad_alloc, etc).
+		*/
+		const bool Load( );
+
+		/*
+		 * Unload image, releases bytes.
+		 *
+		 * @thread_safety - not thread-safe.
+		*/
+		void Unload( ) noexcept;
+
+		// -------------------------------------------------------- \\
+
+	private:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Deleted
+		// ===========================================================
+
+		/* @deleted CompressedImage const copy constructor */
+		CompressedImage( const CompressedImage & ) = delete;
+
+		/* @deleted CompressedImage const copy assignment operator */
+		CompressedImage & operator=( const CompressedImage & ) = delete;
+
+		/* @deleted CompressedImage move constructor */
+		CompressedImage( CompressedImage && ) = delete;
+
+		/* @deleted CompressedImage move assignment operator */
+		CompressedImage & operator=( CompressedImage && ) = delete;
+
+		// -------------------------------------------------------- \\
+
+	};
+
+}
+
+#endif // !__c0de4un_compressed_image_hpp__
\ No newline at end of file
@@ -0,0 +1,457 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+// HEADER
+#ifndef __c0de4un_compressed_loader_hpp__
+#include "CompressedLoader.hpp"
+#endif // !__c0de4un_compressed_loader_hpp__
+
+// Include CompressedImage
+#ifndef __c0de4un_compressed_image_hpp__
+#include "CompressedImage.hpp"
+#endif // !__c0de4un_compressed_image_hpp__
+
+// Include TextureFormats
+#ifndef __c0de4un_texture_formats_hpp__
+#include "TextureFormats.hpp"
+#endif // !__c0de4un_texture_formats_hpp__
+
+// Include TextureCache
+#ifndef __c0de4un_texture_cache_hpp__
+#include "TextureCache.hpp"
+#endif // !__c0de4un_texture_cache_hpp__
+
+// Include InputFile
+#ifndef __c0de4un_input_file_hpp__
+#include "../../utils/io/InputFile.hpp"
+#endif // !__c0de4un_input_file_hpp__
+
+// Include Log
+#ifndef __c0de4un_log_hpp__
+#include "../../utils/log/Log.hpp"
+#endif // !__c0de4un_log_hpp__
+
+// Include ProfileScope
+#ifndef __c0de4un_profile_scope_hpp__
+#include "../../utils/profiler/ProfileScope.hpp"
+#endif // !__c0de4un_profile_scope_hpp__
+
+// Include STL
+#include <cstring> // memcmp, memset
+
+namespace c0de4un
+{
+
+	// -------------------------------------------------------- \\
+
+	/* DDS file type, "DDS " */
+	static constexpr uint32_t DDS_MAGIC = 0x20534444;
+
+	/* DDS header size, without file type */
+	static constexpr uint32_t DDS_HEADER_SIZE = 124;
+
+	/* DDS FourCC codes */
+	static constexpr uint32_t DDS_FOURCC_DXT1 = 0x31545844;
+	static constexpr uint32_t DDS_FOURCC_DXT3 = 0x33545844;
+	static constexpr uint32_t DDS_FOURCC_DXT5 = 0x35545844;
+	static constexpr uint32_t DDS_FOURCC_DX10 = 0x30315844;
+
+	/* DDS header flags (DDSD_CAPS, HEIGHT, WIDTH, PIXELFORMAT, MIPMAPCOUNT, LINEARSIZE) */
+	static constexpr uint32_t DDSD_REQUIRED = 0x1 | 0x2 | 0x4 | 0x1000;
+	static constexpr uint32_t DDSD_MIPMAPCOUNT = 0x20000;
+	static constexpr uint32_t DDSD_LINEARSIZE = 0x80000;
+
+	/* DDS pixel format flag, FourCC set */
+	static constexpr uint32_t DDPF_FOURCC = 0x4;
+
+	/* DDS caps (DDSCAPS_COMPLEX, TEXTURE, MIPMAP) */
+	static constexpr uint32_t DDSCAPS_COMPLEX = 0x8;
+	static constexpr uint32_t DDSCAPS_TEXTURE = 0x1000;
+	static constexpr uint32_t DDSCAPS_MIPMAP = 0x400000;
+
+	/* DDS caps2, cube map or volume */
+	static constexpr uint32_t DDSCAPS2_CUBEMAP_OR_VOLUME = 0x200 | 0x200000;
+
+	/* DXGI_FORMAT of BC1, BC2, BC3 & BC7 (typeless, unorm, unorm sRGB) */
+	static constexpr uint32_t DXGI_FORMAT_BC1_TYPELESS = 70;
+	static constexpr uint32_t DXGI_FORMAT_BC1_UNORM = 71;
+	static constexpr uint32_t DXGI_FORMAT_BC2_TYPELESS = 73;
+	static constexpr uint32_t DXGI_FORMAT_BC2_UNORM = 74;
+	static constexpr uint32_t DXGI_FORMAT_BC3_TYPELESS = 76;
+	static constexpr uint32_t DXGI_FORMAT_BC3_UNORM = 77;
+	static constexpr uint32_t DXGI_FORMAT_BC7_TYPELESS = 97;
+	static constexpr uint32_t DXGI_FORMAT_BC7_UNORM = 98;
+	static constexpr uint32_t DXGI_FORMAT_BC7_UNORM_SRGB = 99;
+
+	/* DX10 resource dimension, 2D texture */
+	static constexpr uint32_t DDS_DIMENSION_TEXTURE2D = 3;
+
+	/* KTX file type */
+	static constexpr unsigned char KTX_IDENTIFIER[12] = { 0xAB, 0x4B, 0x54, 0x58, 0x20, 0x31, 0x31, 0xBB, 0x0D, 0x0A, 0x1A, 0x0A };
+
+	/* KTX byte order, same as reader */
+	static constexpr uint32_t KTX_ENDIANNESS = 0x04030201;
+
+	// ===========================================================
+	// Methods
+	// ===========================================================
+
+	/*
+	 * Reads bytes, exact count.
+	 *
+	 * @param inputFile_ - input stream.
+	 * @param buffer_ - output buffer.
+	 * @param count_ - bytes count.
+	 * @return - 'false' if end of file.
+	 * @throws - can throw exceptions (io-exception, etc).
+	*/
+	const bool CompressedLoader::readBytes( InputFile *const inputFile_, void *const buffer_, const uint32_t count_ )
+	{
+
+		// Nothing to read
+		if ( count_ == 0 )
+			return( true );
+
+		// Read
+		uint32_t readCount_( count_ );
+		return( inputFile_->readBytes_A( static_cast<char*>( buffer_ ), readCount_ ) );
+
+	}
+
+	/*
+	 * Sets size & format, reads mipmap levels blocks stored one after another (tightly packed).
+	 *
+	 * @param image_ - CompressedImage.
+	 * @param inputFile_ - input stream.
+	 * @param levelsCount_ - levels count.
+	 * @param padded_ - 'true' if KTX (each level prefixed by size & padded to 4 bytes).
+	 * @return - 'false' if end of file or sizes invalid.
+	 * @throws - can throw exceptions (io-exception, std::bad_alloc, etc).
+	*/
+	const bool CompressedLoader::readLevels( CompressedImage *const image_, InputFile *const inputFile_, const uint32_t levelsCount_, const bool padded_ )
+	{
+
+		// Level size
+		uint32_t width_( image_->mSize[0] );
+		uint32_t height_( image_->mSize[1] );
+
+		// Cancel, if size not valid
+		if ( width_ == 0 || height_ == 0 || width_ > MAX_SIZE || height_ > MAX_SIZE )
+			return( false );
+
+		// Levels count, down to 1x1 at most
+		uint32_t maxLevels_( 1 );
+		for ( uint32_t size_ = width_ > height_ ? width_ : height_; size_ > 1; size_ >>= 1 )
+			maxLevels_++;
+		const uint32_t levels_( levelsCount_ < 1 ? 1 : ( levelsCount_ < maxLevels_ ? levelsCount_ : maxLevels_ ) );
+
+		// Read levels
+		image_->mLevels.reserve( levels_ );
+		for ( uint32_t i = 0; i < levels_; i++ )
+		{
+
+			// Level bytes count
+			const uint32_t size_( TextureFormats::getImageBytes( image_->mFormat, width_, height_ ) );
+
+			// KTX image size, must match
+			if ( padded_ )
+			{
+				uint32_t imageSize_( 0 );
+				if ( !readBytes( inputFile_, &imageSize_, sizeof( uint32_t ) ) || imageSize_ != size_ )
+					return( false );
+			}
+
+			// Add level
+			const uint32_t offset_( static_cast<uint32_t>( image_->mBytes.size( ) ) );
+			image_->mLevels.push_back( ImageLevel{ offset_, size_, width_, height_ } );
+
+			// Read blocks
+			image_->mBytes.resize( static_cast<std::size_t>( offset_ ) + size_ );
+			if ( !readBytes( inputFile_, image_->mBytes.data( ) + offset_, size_ ) )
+				return( false );
+
+			// KTX mip padding, to 4 bytes (block sizes are 8 or 16, so never read for the last level)
+			const uint32_t padding_( 3 - ( ( size_ + 3 ) % 4 ) );
+			if ( padded_ && padding_ > 0 && i + 1 < levels_ )
+			{
+				unsigned char skipped_[3];
+				if ( !readBytes( inputFile_, skipped_, padding_ ) )
+					return( false );
+			}
+
+			// Next level size
+			width_ = width_ > 1 ? width_ >> 1 : 1;
+			height_ = height_ > 1 ? height_ >> 1 : 1;
+
+		}
+
+		// Return TRUE
+		return( true );
+
+	}
+
+	/*
+	 * Load DDS image (DXT1, DXT3, DXT5 or DX10 BC1/BC2/BC3/BC7).
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @param image_ - CompressedImage to store loaded data.
+	 * @param inputFile_ - opened input stream.
+	 * @return - 'true' if OK, 'false' if corrupted or format not supported.
+	 * @throws - can throw exceptions (io-exception, std::bad_alloc, etc).
+	*/
+	const bool CompressedLoader::loadDDS( CompressedImage *const image_, InputFile *const inputFile_ )
+	{
+
+		// Profile
+		C0DE4UN_PROFILE_SCOPE( "CompressedLoader::loadDDS" );
+
+		// Read header
+		DDSHeader header_;
+		if ( !readBytes( inputFile_, &header_, sizeof( DDSHeader ) ) )
+			return( false );
+
+		// Check type & header
+		if ( header_.magic_ != DDS_MAGIC || header_.size_ != DDS_HEADER_SIZE || ( header_.formatFlags_ & DDPF_FOURCC ) == 0 )
+		{
+			Log::printWarning( "CompressedLoader::loadDDS - not DDS or not compressed" );
+			return( false );
+		}
+
+		// Cube maps & volumes not supported
+		if ( ( header_.caps2_ & DDSCAPS2_CUBEMAP_OR_VOLUME ) != 0 )
+		{
+			Log::printWarning( "CompressedLoader::loadDDS - cube maps & volumes not supported" );
+			return( false );
+		}
+
+		// OpenGL format
+		GLenum format_( 0 );
+		switch ( header_.fourCC_ )
+		{
+		case DDS_FOURCC_DXT1:
+			format_ = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+			break;
+		case DDS_FOURCC_DXT3:
+			format_ = GL_COMPRESSED_RGBA_S3TC_DXT3_EXT;
+			break;
+		case DDS_FOURCC_DXT5:
+			format_ = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+			break;
+		case DDS_FOURCC_DX10:
+		{
+
+			// Read extended header
+			DDSHeaderDX10 header10_;
+			if ( !readBytes( inputFile_, &header10_, sizeof( DDSHeaderDX10 ) ) )
+				return( false );
+
+			// 2D, single image only
+			if ( header10_.resourceDimension_ != DDS_DIMENSION_TEXTURE2D || header10_.arraySize_ > 1 || ( header10_.miscFlag_ & 0x4 ) != 0 )
+			{
+				Log::printWarning( "CompressedLoader::loadDDS - arrays & cube maps not supported" );
+				return( false );
+			}
+
+			// DXGI format (sRGB S3TC not supported, requires EXT_texture_sRGB)
+			switch ( header10_.dxgiFormat_ )
+			{
+			case DXGI_FORMAT_BC1_TYPELESS:
+			case DXGI_FORMAT_BC1_UNORM:
+				format_ = GL_COMPRESSED_RGBA_S3TC_DXT1_EXT;
+				break;
+			case DXGI_FORMAT_BC2_TYPELESS:
+			case DXGI_FORMAT_BC2_UNORM:
+				format_ = GL_COMPRESSED_RGBA_S3TC_DXT3_EXT;
+				break;
+			case DXGI_FORMAT_BC3_TYPELESS:
+			case DXGI_FORMAT_BC3_UNORM:
+				format_ = GL_COMPRESSED_RGBA_S3TC_DXT5_EXT;
+				break;
+			case DXGI_FORMAT_BC7_TYPELESS:
+			case DXGI_FORMAT_BC7_UNORM:
+				format_ = GL_COMPRESSED_RGBA_BPTC_UNORM;
+				break;
+			case DXGI_FORMAT_BC7_UNORM_SRGB:
+				format_ = GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM;
+				break;
+			default:
+				break;
+			}
+
+			break;
+
+		}
+		default:
+			break;
+		}
+
+		// Check format
+		if ( format_ == 0 )
+		{
+			Log::printWarning( "CompressedLoader::loadDDS - format not supported" );
+			return( false );
+		}
+
+		// Set Image
+		image_->mSize[0] = header_.width_;
+		image_->mSize[1] = header_.height_;
+		image_->mFormat = format_;
+
+		// Source hash, if cooked by the current cook version (older cooked again)
+		if ( header_.reserved1_[0] == TextureCache::MAGIC && header_.reserved1_[3] == TextureCache::COMPRESSED_VERSION )
+			image_->mSourceHash = static_cast<uint64_t>( header_.reserved1_[1] ) | ( static_cast<uint64_t>( header_.reserved1_[2] ) << 32 );
+
+		// Read levels
+		return( readLevels( image_, inputFile_, ( header_.flags_ & DDSD_MIPMAPCOUNT ) != 0 ? header_.mipMapCount_ : 1, false ) );
+
+	}
+
+	/*
+	 * Load KTX (version 1) image, any format known by TextureFormats.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @param image_ - CompressedImage to store loaded data.
+	 * @param inputFile_ - opened input stream.
+	 * @return - 'true' if OK, 'false' if corrupted or format not supported.
+	 * @throws - can throw exceptions (io-exception, std::bad_alloc, etc).
+	*/
+	const bool CompressedLoader::loadKTX( CompressedImage *const image_, InputFile *const inputFile_ )
+	{
+
+		// Profile
+		C0DE4UN_PROFILE_SCOPE( "CompressedLoader::loadKTX" );
+
+		// Read header
+		KTXHeader header_;
+		if ( !readBytes( inputFile_, &header_, sizeof( KTXHeader ) ) )
+			return( false );
+
+		// Check type & byte order
+		if ( std::memcmp( header_.identifier_, KTX_IDENTIFIER, sizeof( KTX_IDENTIFIER ) ) != 0 || header_.endianness_ != KTX_ENDIANNESS )
+		{
+			Log::printWarning( "CompressedLoader::loadKTX - not KTX or byte order not supported" );
+			return( false );
+		}
+
+		// Compressed 2D, single image only
+		if ( header_.glType_ != 0 || header_.glFormat_ != 0 || !TextureFormats::isCompressed( header_.glInternalFormat_ )
+			|| header_.pixelDepth_ > 1 || header_.numberOfArrayElements_ > 1 || header_.numberOfFaces_ != 1 )
+		{
+			Log::printWarning( "CompressedLoader::loadKTX - format not supported" );
+			return( false );
+		}
+
+		// Skip key-value data
+		if ( header_.bytesOfKeyValueData_ > 0 )
+		{
+			std::vector<unsigned char> keyValueData_( header_.bytesOfKeyValueData_ );
+			if ( !readBytes( inputFile_, keyValueData_.data( ), header_.bytesOfKeyValueData_ ) )
+				return( false );
+		}
+
+		// Set Image
+		image_->mSize[0] = header_.pixelWidth_;
+		image_->mSize[1] = header_.pixelHeight_;
+		image_->mFormat = static_cast<GLenum>( header_.glInternalFormat_ );
+
+		// Read levels
+		return( readLevels( image_, inputFile_, header_.numberOfMipmapLevels_, true ) );
+
+	}
+
+	/*
+	 * Writes DDS image (DXT1, DXT3, DXT5, or DX10 for BC7).
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @param image_ - loaded CompressedImage.
+	 * @param sourceHash_ - source image hash, 0 if not cooked.
+	 * @param output_ - binary output stream.
+	 * @return - 'false' if format not supported by DDS or write failed.
+	*/
+	const bool CompressedLoader::writeDDS( const CompressedImage & image_, const uint64_t sourceHash_, std::ostream & output_ )
+	{
+
+		// FourCC & DXGI format
+		uint32_t fourCC_( 0 );
+		uint32_t dxgiFormat_( 0 );
+		switch ( image_.mFormat )
+		{
+		case GL_COMPRESSED_RGB_S3TC_DXT1_EXT:
+		case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
+			fourCC_ = DDS_FOURCC_DXT1;
+			break;
+		case GL_COMPRESSED_RGBA_S3TC_DXT3_EXT:
+			fourCC_ = DDS_FOURCC_DXT3;
+			break;
+		case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
+			fourCC_ = DDS_FOURCC_DXT5;
+			break;
+		case GL_COMPRESSED_RGBA_BPTC_UNORM:
+			fourCC_ = DDS_FOURCC_DX10;
+			dxgiFormat_ = DXGI_FORMAT_BC7_UNORM;
+			break;
+		case GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM:
+			fourCC_ = DDS_FOURCC_DX10;
+			dxgiFormat_ = DXGI_FORMAT_BC7_UNORM_SRGB;
+			break;
+		default:
+			return( false );
+		}
+
+		// Cancel, if not loaded
+		if ( !image_.isLoaded( ) )
+			return( false );
+
+		// Levels count
+		const uint32_t levels_( static_cast<uint32_t>( image_.mLevels.size( ) ) );
+
+		// Header
+		DDSHeader header_;
+		std::memset( &header_, 0, sizeof( DDSHeader ) );
+		header_.magic_ = DDS_MAGIC;
+		header_.size_ = DDS_HEADER_SIZE;
+		header_.flags_ = DDSD_REQUIRED | DDSD_LINEARSIZE | ( levels_ > 1 ? DDSD_MIPMAPCOUNT : 0 );
+		header_.height_ = image_.mSize[1];
+		header_.width_ = image_.mSize[0];
+		header_.linearSize_ = image_.mLevels[0].size_;
+		header_.mipMapCount_ = levels_;
+		header_.formatSize_ = 32;
+		header_.formatFlags_ = DDPF_FOURCC;
+		header_.fourCC_ = fourCC_;
+		header_.caps_ = DDSCAPS_TEXTURE | ( levels_ > 1 ? DDSCAPS_COMPLEX | DDSCAPS_MIPMAP : 0 );
+
+		// Cooked tag & source hash
+		if ( sourceHash_ != 0 )
+		{
+			header_.reserved1_[0] = TextureCache::MAGIC;
+			header_.reserved1_[1] = static_cast<uint32_t>( sourceHash_ );
+			header_.reserved1_[2] = static_cast<uint32_t>( sourceHash_ >> 32 );
+			header_.reserved1_[3] = TextureCache::COMPRESSED_VERSION;
+		}
+
+		// Write header
+		output_.write( reinterpret_cast<const char*>( &header_ ), sizeof( DDSHeader ) );
+
+		// Write extended header
+		if ( fourCC_ == DDS_FOURCC_DX10 )
+		{
+			const DDSHeaderDX10 header10_{ dxgiFormat_, DDS_DIMENSION_TEXTURE2D, 0, 1, 0 };
+			output_.write( reinterpret_cast<const char*>( &header10_ ), sizeof( DDSHeaderDX10 ) );
+		}
+
+		// Write levels, tightly packed
+		for ( const ImageLevel & level_ : image_.mLevels )
+			output_.write( reinterpret_cast<const char*>( image_.mBytes.data( ) + level_.offset_ ), level_.size_ );
+
+		// Return TRUE if written
+		return( output_.good( ) );
+
+	}
+
+	// -------------------------------------------------------- \\
+
+}
\ No newline at end of file
@@ -0,0 +1,296 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_compressed_loader_hpp__
+#define __c0de4un_compressed_loader_hpp__
+
+// Include STL
+#include <cstdint> // uint32_t, uint64_t
+#include <ostream> // ostream
+
+// Forward-declaration of CompressedImage
+#ifndef __c0de4un_compressed_image_decl__
+#define __c0de4un_compressed_image_decl__
+namespace c0de4un { class CompressedImage; }
+#endif // !__c0de4un_compressed_image_decl__
+
+// Forward-declaration of InputFile
+#ifndef __c0de4un_input_file_decl__
+#define __c0de4un_input_file_decl__
+namespace c0de4un { class InputFile; }
+#endif // !__c0de4un_input_file_decl__
+
+// CompressedLoader declared
+#define __c0de4un_compressed_loader_decl__
+
+// Enable structure-data (fields, variables) alignment (by compilator) to 1 byte
+#pragma pack( push, 1 )
+
+namespace c0de4un
+{
+
+	/*
+	 * DDSHeader - DDS file type & header (DDS_HEADER with DDS_PIXELFORMAT).
+	 *
+	 * @version 1.0
+	*/
+	struct DDSHeader final
+	{
+
+		/* File type, "DDS " */
+		uint32_t magic_;
+
+		/* Header size, 124 */
+		uint32_t size_;
+
+		/* Valid fields (DDSD_ flags) */
+		uint32_t flags_;
+
+		/* Height */
+		uint32_t height_;
+
+		/* Width */
+		uint32_t width_;
+
+		/* Level #0 bytes count */
+		uint32_t linearSize_;
+
+		/* Volume depth */
+		uint32_t depth_;
+
+		/* Mipmap levels count */
+		uint32_t mipMapCount_;
+
+		/* Reserved, cooked files store tag, source hash & cook version (see CompressedLoader::writeDDS) */
+		uint32_t reserved1_[11];
+
+		/* Pixel format size, 32 */
+		uint32_t formatSize_;
+
+		/* Pixel format flags (DDPF_ flags) */
+		uint32_t formatFlags_;
+
+		/* Compression, "DXT1", "DXT5", "DX10", etc */
+		uint32_t fourCC_;
+
+		/* Uncompressed formats: bits per pixel & channel masks */
+		uint32_t rgbBitCount_;
+		uint32_t rBitMask_;
+		uint32_t gBitMask_;
+		uint32_t bBitMask_;
+		uint32_t aBitMask_;
+
+		/* Surface flags (DDSCAPS_ flags) */
+		uint32_t caps_;
+
+		/* Cube map & volume flags */
+		uint32_t caps2_;
+
+		/* Unused */
+		uint32_t caps3_;
+		uint32_t caps4_;
+		uint32_t reserved2_;
+
+	};
+
+	/*
+	 * DDSHeaderDX10 - DDS extended header, follows DDSHeader if fourCC is "DX10".
+	 *
+	 * @version 1.0
+	*/
+	struct DDSHeaderDX10 final
+	{
+
+		/* DXGI_FORMAT */
+		uint32_t dxgiFormat_;
+
+		/* Resource dimension, 3 for 2D */
+		uint32_t resourceDimension_;
+
+		/* Misc. flags, 4 for cube map */
+		uint32_t miscFlag_;
+
+		/* Array size */
+		uint32_t arraySize_;
+
+		/* Alpha mode */
+		uint32_t miscFlags2_;
+
+	};
+
+	/*
+	 * KTXHeader - KTX (version 1) file header.
+	 *
+	 * @version 1.0
+	*/
+	struct KTXHeader final
+	{
+
+		/* File type, "KTX 11\r\n\x1A\n" */
+		unsigned char identifier_[12];
+
+		/* 0x04030201 if written with the same byte order */
+		uint32_t endianness_;
+
+		/* OpenGL type, 0 if compressed */
+		uint32_t glType_;
+
+		/* OpenGL type size, 1 if compressed */
+		uint32_t glTypeSize_;
+
+		/* OpenGL format, 0 if compressed */
+		uint32_t glFormat_;
+
+		/* OpenGL internal format */
+		uint32_t glInternalFormat_;
+
+		/* OpenGL base internal format */
+		uint32_t glBaseInternalFormat_;
+
+		/* Width */
+		uint32_t pixelWidth_;
+
+		/* Height */
+		uint32_t pixelHeight_;
+
+		/* Depth, 0 for 2D */
+		uint32_t pixelDepth_;
+
+		/* Array elements, 0 if not array */
+		uint32_t numberOfArrayElements_;
+
+		/* Faces, 6 for cube map */
+		uint32_t numberOfFaces_;
+
+		/* Mipmap levels count, 0 if generated on load */
+		uint32_t numberOfMipmapLevels_;
+
+		/* Key-value data bytes count, follows the header */
+		uint32_t bytesOfKeyValueData_;
+
+	};
+
+	/*
+	 * CompressedLoader - utility to load block-compressed DDS & KTX (version 1) files.
+	 *
+	 * 2D images only (no cube maps, arrays or volumes), all mipmap levels loaded.
+	 *
+	 * @version 1.0
+	*/
+	class CompressedLoader final
+	{
+
+	public:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Constants
+		// ===========================================================
+
+		/* Max. width & height */
+		static constexpr uint32_t MAX_SIZE = 16384;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Load DDS image (DXT1, DXT3, DXT5 or DX10 BC1/BC2/BC3/BC7).
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param image_ - CompressedImage to store loaded data.
+		 * @param inputFile_ - opened input stream.
+		 * @return - 'true' if OK, 'false' if corrupted or format not supported.
+		 * @throws - can throw exceptions (io-exception, std::bad_alloc, etc).
+		*/
+		static const bool loadDDS( CompressedImage *const image_, InputFile *const inputFile_ );
+
+		/*
+		 * Load KTX (version 1) image, any format known by TextureFormats.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param image_ - CompressedImage to store loaded data.
+		 * @param inputFile_ - opened input stream.
+		 * @return - 'true' if OK, 'false' if corrupted or format not supported.
+		 * @throws - can throw exceptions (io-exception, std::bad_alloc, etc).
+		*/
+		static const bool loadKTX( CompressedImage *const image_, InputFile *const inputFile_ );
+
+		/*
+		 * Writes DDS image (DXT1, DXT3, DXT5, or DX10 for BC7).
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param image_ - loaded CompressedImage.
+		 * @param sourceHash_ - source image hash, 0 if not cooked.
+		 * @param output_ - binary output stream.
+		 * @return - 'false' if format not supported by DDS or write failed.
+		*/
+		static const bool writeDDS( const CompressedImage & image_, const uint64_t sourceHash_, std::ostream & output_ );
+
+		// -------------------------------------------------------- \\
+
+	private:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Reads bytes, exact count.
+		 *
+		 * @param inputFile_ - input stream.
+		 * @param buffer_ - output buffer.
+		 * @param count_ - bytes count.
+		 * @return - 'false' if end of file.
+		 * @throws - can throw exceptions (io-exception, etc).
+		*/
+		static const bool readBytes( InputFile *const inputFile_, void *const buffer_, const uint32_t count_ );
+
+		/*
+		 * Sets size & format, reads mipmap levels blocks stored one after another (tightly packed).
+		 *
+		 * @param image_ - CompressedImage.
+		 * @param inputFile_ - input stream.
+		 * @param levelsCount_ - levels count.
+		 * @param padded_ - 'true' if KTX (each level prefixed by size & padded to 4 bytes).
+		 * @return - 'false' if end of file or sizes invalid.
+		 * @throws - can throw exceptions (io-exception, std::bad_alloc, etc).
+		*/
+		static const bool readLevels( CompressedImage *const image_, InputFile *const inputFile_, const uint32_t levelsCount_, const bool padded_ );
+
+		// ===========================================================
+		// Deleted
+		// ===========================================================
+
+		/* @deleted CompressedLoader constructor */
+		CompressedLoader( ) = delete;
+
+		/* @deleted CompressedLoader const copy constructor */
+		CompressedLoader( const CompressedLoader & ) = delete;
+
+		/* @deleted CompressedLoader const copy assignment operator */
+		CompressedLoader & operator=( const CompressedLoader & ) = delete;
+
+		/* @deleted CompressedLoader move constructor */
+		CompressedLoader( CompressedLoader && ) = delete;
+
+		/* @deleted CompressedLoader move assignment operator */
+		CompressedLoader & operator=( CompressedLoader && ) = delete;
+
+		// -------------------------------------------------------- \\
+
+	};
+
+}
+
+// Restore structure-data alignment to default (8-byte on MSVC)
+#pragma pack( pop )
+
+#endif // !__c0de4un_compressed_loader_hpp__
\ No newline at end of file
@@ -0,0 +1,295 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+// HEADER
+#ifndef __c0de4un_mipmap_builder_hpp__
+#include "MipmapBuilder.hpp"
+#endif // !__c0de4un_mipmap_builder_hpp__
+
+// Include STL
+#include <cmath> // floor, ceil, sqrt, sin, fabs
+#include <algorithm> // min, max
+
+namespace c0de4un
+{
+
+	// -------------------------------------------------------- \\
+
+	/* Alpha below treated as transparent, straight color used */
+	static constexpr float MIN_ALPHA = 1.0f / 512.0f;
+
+	/* Pi */
+	static constexpr float PI = 3.14159265358979f;
+
+	/*
+	 * Clamps value to [0, 1] & converts to 8 bits.
+	 *
+	 * @param value_ - value.
+	*/
+	static unsigned char toByte( const float value_ ) noexcept
+	{ return( static_cast<unsigned char>( std::min( std::max( value_, 0.0f ), 1.0f ) * 255.0f + 0.5f ) ); }
+
+	// ===========================================================
+	// Getter & Setter
+	// ===========================================================
+
+	/*
+	 * Returns full mipmap chain levels count (down to 1x1), level #0 included.
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param width_ - level #0 width.
+	 * @param height_ - level #0 height.
+	*/
+	const uint32_t MipmapBuilder::getLevelsCount( const uint32_t width_, const uint32_t height_ ) noexcept
+	{
+
+		// Largest side
+		uint32_t size_( std::max( width_, height_ ) );
+
+		// Count halvings
+		uint32_t levels_( 1 );
+		while ( size_ > 1 )
+		{
+			size_ >>= 1;
+			levels_++;
+		}
+
+		// Return levels count
+		return( levels_ );
+
+	}
+
+	/*
+	 * Returns size (width or height) of the mipmap level.
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param size_ - level #0 size.
+	 * @param level_ - mipmap level.
+	*/
+	const uint32_t MipmapBuilder::getLevelSize( const uint32_t size_, const uint32_t level_ ) noexcept
+	{ return( level_ < 32 ? std::max( size_ >> level_, 1u ) : 1u ); }
+
+	// ===========================================================
+	// Methods
+	// ===========================================================
+
+	/*
+	 * Returns modified Bessel function of the first kind, order 0 (series).
+	 *
+	 * @param x_ - argument.
+	*/
+	const float MipmapBuilder::besselI0( const float x_ ) noexcept
+	{
+
+		// Sum of ( (x/2)^k / k! )^2
+		const float halfX_( x_ * 0.5f );
+		float term_( 1.0f );
+		float sum_( 1.0f );
+		for ( int k = 1; k < 32 && term_ > sum_ * 1e-7f; k++ )
+		{
+			const float factor_( halfX_ / static_cast<float>( k ) );
+			term_ *= factor_ * factor_;
+			sum_ += term_;
+		}
+
+		// Return sum
+		return( sum_ );
+
+	}
+
+	/*
+	 * Returns Kaiser-windowed sinc weight.
+	 *
+	 * @param x_ - distance, texels of the smaller level.
+	*/
+	const float MipmapBuilder::kaiser( const float x_ ) noexcept
+	{
+
+		// Outside window
+		const float t_( x_ / KAISER_RADIUS );
+		if ( t_ <= -1.0f || t_ >= 1.0f )
+			return( 0.0f );
+
+		// Sinc
+		const float px_( PI * x_ );
+		const float sinc_( std::fabs( px_ ) < 1e-5f ? 1.0f : std::sin( px_ ) / px_ );
+
+		// Window
+		return( sinc_ * besselI0( KAISER_ALPHA * std::sqrt( 1.0f - t_ * t_ ) ) / besselI0( KAISER_ALPHA ) );
+
+	}
+
+	/*
+	 * Computes filter taps of one axis, same taps count for each output texel.
+	 *
+	 * @param srcSize_ - input size.
+	 * @param dstSize_ - output size.
+	 * @param filter_ - FILTER_BOX or FILTER_KAISER.
+	 * @param indices_ - output input texel index per tap (clamped to edge).
+	 * @param weights_ - output normalized weight per tap.
+	 * @return - taps count per output texel.
+	 * @throws - std::bad_alloc.
+	*/
+	const uint32_t MipmapBuilder::computeTaps( const uint32_t srcSize_, const uint32_t dstSize_, const unsigned char filter_,
+		std::vector<uint32_t> & indices_, std::vector<float> & weights_ )
+	{
+
+		// Input texels per output texel
+		const float scale_( static_cast<float>( srcSize_ ) / static_cast<float>( dstSize_ ) );
+
+		// Filter radius, input texels
+		const float radius_( ( filter_ == FILTER_KAISER ? KAISER_RADIUS : 0.5f ) * scale_ );
+
+		// Taps count
+		const uint32_t taps_( static_cast<uint32_t>( std::ceil( radius_ * 2.0f ) ) + 1 );
+
+		// Allocate
+		indices_.resize( dstSize_ * taps_ );
+		weights_.resize( dstSize_ * taps_ );
+
+		// Output texels
+		for ( uint32_t i = 0; i < dstSize_; i++ )
+		{
+
+			// Output texel center, input coordinates
+			const float center_( ( static_cast<float>( i ) + 0.5f ) * scale_ );
+
+			// First input texel
+			const int first_( static_cast<int>( std::floor( center_ - radius_ ) ) );
+
+			// Weights
+			float sum_( 0.0f );
+			for ( uint32_t k = 0; k < taps_; k++ )
+			{
+
+				// Input texel
+				const int j_( first_ + static_cast<int>( k ) );
+				const float texel_( static_cast<float>( j_ ) );
+
+				// Box: overlap of the input texel & output texel footprint, Kaiser: sampled at the input texel center
+				const float weight_( filter_ == FILTER_KAISER
+					? kaiser( ( texel_ + 0.5f - center_ ) / scale_ )
+					: std::max( std::min( texel_ + 1.0f, center_ + radius_ ) - std::max( texel_, center_ - radius_ ), 0.0f ) );
+
+				// Set tap, edge texels repeated
+				indices_[i * taps_ + k] = static_cast<uint32_t>( std::min( std::max( j_, 0 ), static_cast<int>( srcSize_ ) - 1 ) );
+				weights_[i * taps_ + k] = weight_;
+				sum_ += weight_;
+
+			}
+
+			// Normalize
+			for ( uint32_t k = 0; k < taps_; k++ )
+				weights_[i * taps_ + k] /= sum_;
+
+		}
+
+		// Return taps count
+		return( taps_ );
+
+	}
+
+	/*
+	 * Downsamples RGBA8 pixels to the next mipmap level (getLevelSize of level #1).
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param pixels_ - RGBA8 pixels, rows tightly packed.
+	 * @param width_ - width.
+	 * @param height_ - height.
+	 * @param filter_ - FILTER_BOX or FILTER_KAISER.
+	 * @param output_ - output RGBA8 pixels, rows tightly packed.
+	 * @throws - std::bad_alloc.
+	*/
+	void MipmapBuilder::Downsample( const unsigned char *const pixels_, const uint32_t width_, const uint32_t height_,
+		const unsigned char filter_, std::vector<unsigned char> & output_ )
+	{
+
+		// Output size
+		const uint32_t dstWidth_( getLevelSize( width_, 1 ) );
+		const uint32_t dstHeight_( getLevelSize( height_, 1 ) );
+
+		// Taps
+		std::vector<uint32_t> indicesX_;
+		std::vector<float> weightsX_;
+		const uint32_t tapsX_( computeTaps( width_, dstWidth_, filter_, indicesX_, weightsX_ ) );
+		std::vector<uint32_t> indicesY_;
+		std::vector<float> weightsY_;
+		const uint32_t tapsY_( computeTaps( height_, dstHeight_, filter_, indicesY_, weightsY_ ) );
+
+		// Input channels
+		std::vector<float> source_( static_cast<std::size_t>( width_ ) * height_ * CHANNELS );
+		for ( std::size_t i = 0; i < static_cast<std::size_t>( width_ ) * height_; i++ )
+		{
+
+			// Texel
+			const unsigned char *const texel_( pixels_ + i * 4 );
+			float *const channels_( &source_[i * CHANNELS] );
+			const float alpha_( texel_[3] / 255.0f );
+
+			// Premultiplied, alpha, straight
+			for ( uint32_t c = 0; c < 3; c++ )
+			{
+				channels_[c] = texel_[c] / 255.0f * alpha_;
+				channels_[4 + c] = texel_[c] / 255.0f;
+			}
+			channels_[3] = alpha_;
+
+		}
+
+		// Horizontal pass: output width, input height
+		std::vector<float> rows_( static_cast<std::size_t>( dstWidth_ ) * height_ * CHANNELS, 0.0f );
+		for ( uint32_t y = 0; y < height_; y++ )
+		{
+			for ( uint32_t x = 0; x < dstWidth_; x++ )
+			{
+				float *const channels_( &rows_[( static_cast<std::size_t>( y ) * dstWidth_ + x ) * CHANNELS] );
+				for ( uint32_t k = 0; k < tapsX_; k++ )
+				{
+					const float weight_( weightsX_[x * tapsX_ + k] );
+					const float *const input_( &source_[( static_cast<std::size_t>( y ) * width_ + indicesX_[x * tapsX_ + k] ) * CHANNELS] );
+					for ( uint32_t c = 0; c < CHANNELS; c++ )
+						channels_[c] += input_[c] * weight_;
+				}
+			}
+		}
+
+		// Vertical pass & conversion to RGBA8
+		output_.resize( static_cast<std::size_t>( dstWidth_ ) * dstHeight_ * 4 );
+		for ( uint32_t y = 0; y < dstHeight_; y++ )
+		{
+			for ( uint32_t x = 0; x < dstWidth_; x++ )
+			{
+
+				// Filter
+				float channels_[CHANNELS] = { };
+				for ( uint32_t k = 0; k < tapsY_; k++ )
+				{
+					const float weight_( weightsY_[y * tapsY_ + k] );
+					const float *const input_( &rows_[( static_cast<std::size_t>( indicesY_[y * tapsY_ + k] ) * dstWidth_ + x ) * CHANNELS] );
+					for ( uint32_t c = 0; c < CHANNELS; c++ )
+						channels_[c] += input_[c] * weight_;
+				}
+
+				// Output texel
+				unsigned char *const texel_( &output_[( static_cast<std::size_t>( y ) * dstWidth_ + x ) * 4] );
+
+				// Color: un-premultiplied, straight if transparent
+				const float alpha_( channels_[3] );
+				for ( uint32_t c = 0; c < 3; c++ )
+					texel_[c] = toByte( alpha_ > MIN_ALPHA ? channels_[c] / alpha_ : channels_[4 + c] );
+
+				// Alpha
+				texel_[3] = toByte( alpha_ );
+
+			}
+		}
+
+	}
+
+	// -------------------------------------------------------- \\
+
+}
\ No newline at end of file
@@ -0,0 +1,168 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_mipmap_builder_hpp__
+#define __c0de4un_mipmap_builder_hpp__
+
+// Include std::vector
+#ifndef __c0de4un_vector_hpp__
+#include "../../cfg/vector.hpp"
+#endif // !__c0de4un_vector_hpp__
+
+// Include STL
+#include <cstdint> // uint32_t
+
+// MipmapBuilder declared
+#define __c0de4un_mipmap_builder_decl__
+
+namespace c0de4un
+{
+
+	/*
+	 * MipmapBuilder - CPU downsampling of RGBA8 pixels to the next mipmap level.
+	 *
+	 * Used by the cook step for compressed textures (glGenerateMipmap can't filter
+	 * block-compressed levels). Separable filter, edge texels repeated outside the image,
+	 * odd sizes handled (level size is half, rounded down, at least 1).
+	 * Color weighted by alpha, so transparent texels don't darken sprite edges.
+	 *
+	 * @version 1.0
+	*/
+	class MipmapBuilder final
+	{
+
+	public:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Constants
+		// ===========================================================
+
+		/* Box filter (area average), fast */
+		static constexpr unsigned char FILTER_BOX = 0;
+
+		/* Kaiser-windowed sinc filter, sharper smaller levels */
+		static constexpr unsigned char FILTER_KAISER = 1;
+
+		/* Kaiser filter radius, texels of the smaller level */
+		static constexpr float KAISER_RADIUS = 2.0f;
+
+		/* Kaiser window shape (alpha) */
+		static constexpr float KAISER_ALPHA = 4.0f;
+
+		// ===========================================================
+		// Getter & Setter
+		// ===========================================================
+
+		/*
+		 * Returns full mipmap chain levels count (down to 1x1), level #0 included.
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param width_ - level #0 width.
+		 * @param height_ - level #0 height.
+		*/
+		static const uint32_t getLevelsCount( const uint32_t width_, const uint32_t height_ ) noexcept;
+
+		/*
+		 * Returns size (width or height) of the mipmap level.
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param size_ - level #0 size.
+		 * @param level_ - mipmap level.
+		*/
+		static const uint32_t getLevelSize( const uint32_t size_, const uint32_t level_ ) noexcept;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Downsamples RGBA8 pixels to the next mipmap level (getLevelSize of level #1).
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param pixels_ - RGBA8 pixels, rows tightly packed.
+		 * @param width_ - width.
+		 * @param height_ - height.
+		 * @param filter_ - FILTER_BOX or FILTER_KAISER.
+		 * @param output_ - output RGBA8 pixels, rows tightly packed.
+		 * @throws - std::bad_alloc.
+		*/
+		static void Downsample( const unsigned char *const pixels_, const uint32_t width_, const uint32_t height_,
+			const unsigned char filter_, std::vector<unsigned char> & output_ );
+
+		// -------------------------------------------------------- \\
+
+	private:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Constants
+		// ===========================================================
+
+		/* Filtered channels: premultiplied RGB, alpha, straight RGB (color of transparent texels) */
+		static constexpr uint32_t CHANNELS = 7;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Computes filter taps of one axis, same taps count for each output texel.
+		 *
+		 * @param srcSize_ - input size.
+		 * @param dstSize_ - output size.
+		 * @param filter_ - FILTER_BOX or FILTER_KAISER.
+		 * @param indices_ - output input texel index per tap (clamped to edge).
+		 * @param weights_ - output normalized weight per tap.
+		 * @return - taps count per output texel.
+		 * @throws - std::bad_alloc.
+		*/
+		static const uint32_t computeTaps( const uint32_t srcSize_, const uint32_t dstSize_, const unsigned char filter_,
+			std::vector<uint32_t> & indices_, std::vector<float> & weights_ );
+
+		/*
+		 * Returns Kaiser-windowed sinc weight.
+		 *
+		 * @param x_ - distance, texels of the smaller level.
+		*/
+		static const float kaiser( const float x_ ) noexcept;
+
+		/*
+		 * Returns modified Bessel function of the first kind, order 0 (series).
+		 *
+		 * @param x_ - argument.
+		*/
+		static const float besselI0( const float x_ ) noexcept;
+
+		// ===========================================================
+		// Deleted
+		// ===========================================================
+
+		/* @deleted MipmapBuilder constructor */
+		MipmapBuilder( ) = delete;
+
+		/* @deleted MipmapBuilder const copy constructor */
+		MipmapBuilder( const MipmapBuilder & ) = delete;
+
+		/* @deleted MipmapBuilder const copy assignment operator */
+		MipmapBuilder & operator=( const MipmapBuilder & ) = delete;
+
+		/* @deleted MipmapBuilder move constructor */
+		MipmapBuilder( MipmapBuilder && ) = delete;
+
+		/* @deleted MipmapBuilder move assignment operator */
+		MipmapBuilder & operator=( MipmapBuilder && ) = delete;
+
+		// -------------------------------------------------------- \\
+
+	};
+
+}
+
+#endif // !__c0de4un_mipmap_builder_hpp__
\ No newline at end of file
@@ -20,11 +20,24 @@
 #include "../../utils/io/InputFile.hpp"
 #endif // !__c0de4un_input_file_hpp__
 
+// Include TextureCache
+#ifndef __c0de4un_texture_cache_hpp__
+#include "TextureCache.hpp"
+#endif // !__c0de4un_texture_cache_hpp__
+
+// Include MappedFile
+#ifndef __c0de4un_mapped_file_hpp__
+#include "../../utils/io/MappedFile.hpp"
+#endif // !__c0de4un_mapped_file_hpp__
+
 // Include Log
 #ifndef __c0de4un_log_hpp__
 #include "../../utils/log/Log.hpp"
 #endif // !__c0de4un_log_hpp__
 
+// Include STL
+#include <cstring> // memcpy
+
 namespace c0de4un
 {
 
@@ -46,7 +59,8 @@ namespace c0de4un
 		mBytes( nullptr ),
 		mDataLength( 0 ),
 		mBitDepth( 0 ),
-		mChannelsCount( 0 )
+		mChannelsCount( 0 ),
+		mCooked( nullptr )
 	{
 
 		// Log
@@ -68,16 +82,7 @@ namespace c0de4un
 		Log::printDebug( logMsg.c_str( ) );
 
 		// Release PNG bytes
-		if ( mBytes != nullptr )
-		{
-
-			// Delete bytes-array
-			delete[] mBytes;
-
-			// Reset pointer-value
-			mBytes = nullptr;
-
-		}
+		releaseBytes( );
 
 	}
 
@@ -103,12 +108,75 @@ namespace c0de4un
 	const unsigned int PNGImage::getLength( ) const noexcept
 	{ return( mDataLength ); }
 
+	/*
+	 * Returns channels count of the color format, 8 bits per channel.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @return - channels count, 0 if format not supported.
+	*/
+	const unsigned char PNGImage::getFormatChannels( ) const noexcept
+	{ return( getFormatChannels( mColorFormat, mBitDepth ) ); }
+
+	/*
+	 * Returns row length in bytes, rows aligned to 4 bytes by PNGLoader.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @return - row length, 0 if format not supported.
+	*/
+	const uint32_t PNGImage::getRowStride( ) const noexcept
+	{ return( static_cast<uint32_t>( getRowStride( mSize[0], mColorFormat, mBitDepth ) ) ); }
+
+	/*
+	 * Returns channels count of the color format, 8 bits per channel.
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param colorFormat_ - OpenGL color format (GL_RGBA, GL_RGB, etc).
+	 * @param bitDepth_ - bits per channel.
+	 * @return - channels count, 0 if format not supported.
+	*/
+	const unsigned char PNGImage::getFormatChannels( const GLenum colorFormat_, const unsigned char bitDepth_ ) noexcept
+	{
+
+		// Cancel, if not 8 bits per channel
+		if ( bitDepth_ != 8 )
+			return( 0 );
+
+		// Channels count (PNGLoader sets format, not channels)
+		switch ( colorFormat_ )
+		{
+		case GL_RGBA:
+			return( 4 );
+		case GL_RGB:
+			return( 3 );
+		case GL_LUMINANCE_ALPHA:
+			return( 2 );
+		case GL_LUMINANCE:
+			return( 1 );
+		default:
+			return( 0 );
+		}
+
+	}
+
+	/*
+	 * Returns row length in bytes, rows aligned to 4 bytes by PNGLoader.
+	 * Used to check cooked file headers, so not overflowed by any width.
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param width_ - width.
+	 * @param colorFormat_ - OpenGL color format (GL_RGBA, GL_RGB, etc).
+	 * @param bitDepth_ - bits per channel.
+	 * @return - row length, 0 if format not supported.
+	*/
+	const uint64_t PNGImage::getRowStride( const uint32_t width_, const GLenum colorFormat_, const unsigned char bitDepth_ ) noexcept
+	{ return( ( static_cast<uint64_t>( width_ ) * getFormatChannels( colorFormat_, bitDepth_ ) + 3 ) & ~static_cast<uint64_t>( 3 ) ); }
+
 	// ===========================================================
 	// Methods
 	// ===========================================================
 
 	/*
-	 * Load PNG Image.
+	 * Load PNG Image, maps cooked file if valid, decodes & cooks otherwise (see TextureCache).
 	 *
 	 * @thread_safety - not thread-safe.
 	 * @return - 'true' if OK.
@@ -121,12 +189,69 @@ namespace c0de4un
 		if ( mBytes != nullptr )
 			return( true );
 
+		// Source hash, cooked file valid only for the same source
+		uint64_t sourceHash_( 0 );
+		const bool hashed_( TextureCache::HashFile( mFile, sourceHash_ ) );
+
+		// Load
+		return( load( hashed_, sourceHash_, true ) );
+
+	}
+
+	/*
+	 * Load PNG Image with already hashed source, maps cooked file if valid, decodes otherwise.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @param sourceHash_ - source file hash (TextureCache::HashFile).
+	 * @param cook_ - 'true' to cook decoded image, 'false' if caller cooks compressed image instead.
+	 * @return - 'true' if OK.
+	 * @throws - can throw exception (io-exception, access-exception, png-exception, etc).
+	*/
+	const bool PNGImage::Load( const uint64_t sourceHash_, const bool cook_ )
+	{
+
+		// Cancel
+		if ( mBytes != nullptr )
+			return( true );
+
+		// Load
+		return( load( true, sourceHash_, cook_ ) );
+
+	}
+
+	/*
+	 * Cooks decoded image (see TextureCache::Cook), if not mapped from the cooked file.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @param sourceHash_ - source file hash.
+	 * @return - 'true' if cooked.
+	 * @throws - std::bad_alloc.
+	*/
+	const bool PNGImage::Cook( const uint64_t sourceHash_ )
+	{ return( mCooked == nullptr && TextureCache::Cook( *this, sourceHash_ ) ); }
+
+	/*
+	 * Load PNG Image, maps cooked file if valid, decodes & cooks otherwise.
+	 *
+	 * @param hashed_ - 'false' if source not hashed, cooked file not used.
+	 * @param sourceHash_ - source file hash.
+	 * @param cook_ - 'true' to cook decoded image.
+	 * @return - 'true' if OK.
+	 * @throws - can throw exception (io-exception, access-exception, png-exception, etc).
+	*/
+	const bool PNGImage::load( const bool hashed_, const uint64_t sourceHash_, const bool cook_ )
+	{
+
 		// Log
 		std::string logMsg( "PNGImage#" );
 		logMsg += mFile;
 		logMsg += "::Load";
 		Log::printDebug( logMsg.c_str( ) );
 
+		// Use cooked file, no decoding
+		if ( hashed_ && loadCooked( sourceHash_ ) )
+			return( true );
+
 		// InputFile
 		InputFile inputFile;
 
@@ -143,6 +268,17 @@ namespace c0de4un
 
 		}
 
+		// Data length, rows aligned to 4 bytes
+		mDataLength = getRowStride( ) * mSize[1];
+
+		// Cook, for the next start
+		if ( hashed_ && cook_ && !TextureCache::Cook( *this, sourceHash_ ) )
+		{
+			logMsg = "PNGImage::Load - not cooked #";
+			logMsg += mFile;
+			Log::printDebug( logMsg.c_str( ) );
+		}
+
 		// Return TRUE
 		return( true );
 
@@ -163,6 +299,70 @@ namespace c0de4un
 		logMsg += "::Unload";
 		Log::printDebug( logMsg.c_str( ) );
 
+		// Release PNG bytes
+		releaseBytes( );
+
+	}
+
+	/*
+	 * Maps cooked file, bytes used in place.
+	 *
+	 * @param sourceHash_ - source file hash.
+	 * @return - 'true' if OK, 'false' if not cooked or outdated.
+	 * @throws - std::bad_alloc.
+	*/
+	const bool PNGImage::loadCooked( const uint64_t sourceHash_ )
+	{
+
+		// Create MappedFile
+		if ( mCooked == nullptr )
+			mCooked = new MappedFile( );
+
+		// Map cooked file
+		if ( !TextureCache::Open( mFile, sourceHash_, *mCooked ) )
+		{
+			delete mCooked;
+			mCooked = nullptr;
+			return( false );
+		}
+
+		// Header
+		CookedHeader header_;
+		std::memcpy( &header_, mCooked->getData( ), sizeof( CookedHeader ) );
+
+		// Set Image
+		mSize[0] = header_.width_;
+		mSize[1] = header_.height_;
+		mColorFormat = static_cast<GLenum>( header_.colorFormat_ );
+		mBitDepth = header_.bitDepth_;
+		mChannelsCount = 4;
+		mDataLength = header_.dataLength_;
+
+		// Pixels, read-only mapped memory
+		mBytes = const_cast<unsigned char*>( mCooked->getData( ) + sizeof( CookedHeader ) );
+
+		// Return TRUE
+		return( true );
+
+	}
+
+	/* Releases decoded bytes, or unmaps cooked file */
+	void PNGImage::releaseBytes( ) noexcept
+	{
+
+		// Unmap cooked file, bytes mapped
+		if ( mCooked != nullptr )
+		{
+
+			// Delete MappedFile
+			delete mCooked;
+
+			// Reset pointer-values
+			mCooked = nullptr;
+			mBytes = nullptr;
+
+		}
+
 		// Release PNG bytes
 		if ( mBytes != nullptr )
 		{
@@ -177,6 +377,65 @@ namespace c0de4un
 
 	}
 
+	/*
+	 * Converts pixels to RGBA8, rows tightly packed.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @param pixels_ - output pixels.
+	 * @return - 'false' if format not supported.
+	 * @throws - std::bad_alloc.
+	*/
+	const bool PNGImage::toRGBA8( std::vector<unsigned char> & pixels_ ) const
+	{
+
+		// Channels count
+		const unsigned char channels_( getFormatChannels( ) );
+
+		// Cancel, if not loaded or format not supported
+		if ( mBytes == nullptr || channels_ == 0 )
+			return( false );
+
+		// Size
+		const uint32_t width_( mSize[0] );
+		const uint32_t height_( mSize[1] );
+
+		// Source row length
+		const uint32_t stride_( getRowStride( ) );
+
+		// Allocate
+		pixels_.resize( static_cast<std::size_t>( width_ ) * height_ * 4 );
+
+		// Rows
+		for ( uint32_t y = 0; y < height_; y++ )
+		{
+
+			// Source row
+			const unsigned char * source_( mBytes + static_cast<std::size_t>( y ) * stride_ );
+
+			// Destination row
+			unsigned char * destination_( pixels_.data( ) + static_cast<std::size_t>( y ) * width_ * 4 );
+
+			// Texels
+			for ( uint32_t x = 0; x < width_; x++, source_ += channels_, destination_ += 4 )
+			{
+
+				// Gray or RGB
+				destination_[0] = source_[0];
+				destination_[1] = channels_ > 2 ? source_[1] : source_[0];
+				destination_[2] = channels_ > 2 ? source_[2] : source_[0];
+
+				// Alpha
+				destination_[3] = channels_ == 4 ? source_[3] : ( channels_ == 2 ? source_[1] : 255 );
+
+			}
+
+		}
+
+		// Return TRUE
+		return( true );
+
+	}
+
 	// -------------------------------------------------------- \\
 
 }
\ No newline at end of file
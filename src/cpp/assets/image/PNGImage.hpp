@@ -16,6 +16,20 @@
 // Include OpenGL
 #include "../../cfg/opengl.hpp"
 
+// Include std::vector
+#ifndef __c0de4un_vector_hpp__
+#include "../../cfg/vector.hpp"
+#endif // !__c0de4un_vector_hpp__
+
+// Include STL
+#include <cstdint> // uint32_t
+
+// Forward-declared MappedFile
+#ifndef __c0de4un_mapped_file_decl__
+#define __c0de4un_mapped_file_decl__
+namespace c0de4un { class MappedFile; }
+#endif // !__c0de4un_mapped_file_decl__
+
 // PNGImage declared
 #define __c0de4un_png_image_decl__
 
@@ -48,7 +62,7 @@ namespace c0de4un
 		/* Width & Height */
 		unsigned int mSize[2];
 
-		/* Image RAW Data (Bytes) */
+		/* Image RAW Data (Bytes), read-only if mapped from the cooked file */
 		unsigned char * mBytes;
 
 		/* Data Length in bytes */
@@ -97,12 +111,50 @@ namespace c0de4un
 		*/
 		const unsigned int getLength( ) const noexcept;
 
+		/*
+		 * Returns channels count of the color format, 8 bits per channel.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @return - channels count, 0 if format not supported.
+		*/
+		const unsigned char getFormatChannels( ) const noexcept;
+
+		/*
+		 * Returns row length in bytes, rows aligned to 4 bytes by PNGLoader.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @return - row length, 0 if format not supported.
+		*/
+		const uint32_t getRowStride( ) const noexcept;
+
+		/*
+		 * Returns channels count of the color format, 8 bits per channel.
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param colorFormat_ - OpenGL color format (GL_RGBA, GL_RGB, etc).
+		 * @param bitDepth_ - bits per channel.
+		 * @return - channels count, 0 if format not supported.
+		*/
+		static const unsigned char getFormatChannels( const GLenum colorFormat_, const unsigned char bitDepth_ ) noexcept;
+
+		/*
+		 * Returns row length in bytes, rows aligned to 4 bytes by PNGLoader.
+		 * Used to check cooked file headers, so not overflowed by any width.
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param width_ - width.
+		 * @param colorFormat_ - OpenGL color format (GL_RGBA, GL_RGB, etc).
+		 * @param bitDepth_ - bits per channel.
+		 * @return - row length, 0 if format not supported.
+		*/
+		static const uint64_t getRowStride( const uint32_t width_, const GLenum colorFormat_, const unsigned char bitDepth_ ) noexcept;
+
 		// ===========================================================
 		// Methods
 		// ===========================================================
 
 		/*
-		 * Load PNG Image.
+		 * Load PNG Image, maps cooked file if valid, decodes & cooks otherwise (see TextureCache).
 		 *
 		 * @thread_safety - not thread-safe.
 		 * @return - 'true' if OK.
@@ -110,6 +162,27 @@ namespace c0de4un
 		*/
 		const bool Load( );
 
+		/*
+		 * Load PNG Image with already hashed source, maps cooked file if valid, decodes otherwise.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param sourceHash_ - source file hash (TextureCache::HashFile).
+		 * @param cook_ - 'true' to cook decoded image, 'false' if caller cooks compressed image instead.
+		 * @return - 'true' if OK.
+		 * @throws - can throw exception (io-exception, access-exception, png-exception, etc).
+		*/
+		const bool Load( const uint64_t sourceHash_, const bool cook_ );
+
+		/*
+		 * Cooks decoded image (see TextureCache::Cook), if not mapped from the cooked file.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param sourceHash_ - source file hash.
+		 * @return - 'true' if cooked.
+		 * @throws - std::bad_alloc.
+		*/
+		const bool Cook( const uint64_t sourceHash_ );
+
 		/*
 		 * Unload PNG Image.
 		 * 
@@ -118,12 +191,56 @@ namespace c0de4un
 		*/
 		void Unload( );
 
+		/*
+		 * Converts pixels to RGBA8, rows tightly packed.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param pixels_ - output pixels.
+		 * @return - 'false' if not loaded or format not supported (8 bits per channel only).
+		 * @throws - std::bad_alloc.
+		*/
+		const bool toRGBA8( std::vector<unsigned char> & pixels_ ) const;
+
 		// -------------------------------------------------------- \\
 
 	private:
 
 		// -------------------------------------------------------- \\
 
+		// ===========================================================
+		// Fields
+		// ===========================================================
+
+		/* Cooked file, bytes mapped from it, null if decoded */
+		MappedFile * mCooked;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Maps cooked file, bytes used in place.
+		 *
+		 * @param sourceHash_ - source file hash.
+		 * @return - 'true' if OK, 'false' if not cooked or outdated.
+		 * @throws - std::bad_alloc.
+		*/
+		const bool loadCooked( const uint64_t sourceHash_ );
+
+		/*
+		 * Load PNG Image, maps cooked file if valid, decodes & cooks otherwise.
+		 *
+		 * @param hashed_ - 'false' if source not hashed, cooked file not used.
+		 * @param sourceHash_ - source file hash.
+		 * @param cook_ - 'true' to cook decoded image.
+		 * @return - 'true' if OK.
+		 * @throws - can throw exception (io-exception, access-exception, png-exception, etc).
+		*/
+		const bool load( const bool hashed_, const uint64_t sourceHash_, const bool cook_ );
+
+		/* Releases decoded bytes, or unmaps cooked file */
+		void releaseBytes( ) noexcept;
+
 		// ===========================================================
 		// Deleted
 		// ===========================================================
@@ -11,6 +11,7 @@
 #endif // !__c0de4un_png_loader_hpp__
 
 #include <iostream> // I/O streams
+#include <cstdio> // snprintf
 
 // Include InputFile
 #ifndef __c0de4un_input_file_hpp__
@@ -27,6 +28,11 @@
 #include "../../utils/log/Log.hpp"
 #endif // !__c0de4un_log_hpp__
 
+// Include ProfileScope
+#ifndef __c0de4un_profile_scope_hpp__
+#include "../../utils/profiler/ProfileScope.hpp"
+#endif // !__c0de4un_profile_scope_hpp__
+
 namespace c0de4un
 {
 
@@ -59,8 +65,9 @@ namespace c0de4un
 		// InputFile
 		InputFile *const inputFile_ = static_cast<InputFile*>( png_get_io_ptr( pStruct ) );
 
-		// Read bytes
-		inputFile_->readBytes_A( (char*) pData, pSize );
+		// Read bytes, libPNG reads rows & chunks (32 bits count)
+		std::uint32_t count_( static_cast<std::uint32_t>( pSize ) );
+		inputFile_->readBytes_A( (char*) pData, count_ );
 
 	}
 
@@ -124,6 +131,9 @@ namespace c0de4un
 	const bool PNGLoader::loadImage( PNGImage *const pngImage_, InputFile *const inputFile_ )
 	{
 
+		// Profile
+		C0DE4UN_PROFILE_SCOPE( "PNGLoader::loadImage" );
+
 		// Open Input Stream
 		if ( !inputFile_->openStream_A( pngImage_->mFile, StreamMode::READ_BYTES, 0 ) )
 		{
@@ -252,14 +262,17 @@ namespace c0de4un
 		// Width
 		const unsigned int mTextureWidth = png_get_image_width( pngStruct, pngInfo );
 
-		// Print Debug
-		std::cout << "PNGLoader::loadImage - Width = " << mTextureWidth << std::endl;
+		// Print Debug (no std::string, libPNG errors longjmp over destructors)
+		char logMsg[64];
+		std::snprintf( logMsg, sizeof( logMsg ), "PNGLoader::loadImage - Width = %u", mTextureWidth );
+		Log::printDebug( logMsg );
 
 		// Height
 		const unsigned int mTextureHeight = png_get_image_height( pngStruct, pngInfo );
 
 		// Print Debug
-		std::cout << "PNGLoader::loadImage - Height = " << mTextureHeight << std::endl;
+		std::snprintf( logMsg, sizeof( logMsg ), "PNGLoader::loadImage - Height = %u", mTextureHeight );
+		Log::printDebug( logMsg );
 
 		// Color Type
 		const png_byte colorType = png_get_color_type( pngStruct, pngInfo );
@@ -304,9 +317,9 @@ namespace c0de4un
 
 			// Print Debug
 			if ( transparency )
-				std::cout << "PNGLoader::loadImage - Color Type is PNG_COLOR_TYPE_PALETTE, GL format is RGBA. Transparency is on" << std::endl;
+				Log::printDebug( "PNGLoader::loadImage - Color Type is PNG_COLOR_TYPE_PALETTE, GL format is RGBA. Transparency is on" );
 			else
-				std::cout << "PNGLoader::loadImage - Color Type is PNG_COLOR_TYPE_PALETTE, GL format is RGB. Transparency is off" << std::endl;
+				Log::printDebug( "PNGLoader::loadImage - Color Type is PNG_COLOR_TYPE_PALETTE, GL format is RGB. Transparency is off" );
 
 			break;
 		case PNG_COLOR_TYPE_RGB:
@@ -316,9 +329,9 @@ namespace c0de4un
 
 			// Print Debug
 			if ( transparency )
-				std::cout << "PNGLoader::loadImage - Color Type is PNG_COLOR_TYPE_RGB, GL format is RGBA. Transparency is on" << std::endl;
+				Log::printDebug( "PNGLoader::loadImage - Color Type is PNG_COLOR_TYPE_RGB, GL format is RGBA. Transparency is on" );
 			else
-				std::cout << "PNGLoader::loadImage - Color Type is PNG_COLOR_TYPE_RGB, GL format is RGB. Transparency is off" << std::endl;
+				Log::printDebug( "PNGLoader::loadImage - Color Type is PNG_COLOR_TYPE_RGB, GL format is RGB. Transparency is off" );
 
 			break;
 		case PNG_COLOR_TYPE_RGBA:
@@ -327,7 +340,7 @@ namespace c0de4un
 			glFormat = GL_RGBA;
 
 			// Print Debug
-			std::cout << "PNGLoader::loadImage - Color Type is PNG_COLOR_TYPE_RGBA, GL format is RGBA. Transparency is on" << std::endl;
+			Log::printDebug( "PNGLoader::loadImage - Color Type is PNG_COLOR_TYPE_RGBA, GL format is RGBA. Transparency is on" );
 
 			break;
 		case PNG_COLOR_TYPE_GRAY:
@@ -340,9 +353,9 @@ namespace c0de4un
 
 			// Print Debug
 			if ( transparency )
-				std::cout << "PNGLoader::loadImage - Color Type is PNG_COLOR_TYPE_GRAY, GL format is GL_LUMINANCE_ALPHA. Transparency is on" << std::endl;
+				Log::printDebug( "PNGLoader::loadImage - Color Type is PNG_COLOR_TYPE_GRAY, GL format is GL_LUMINANCE_ALPHA. Transparency is on" );
 			else
-				std::cout << "PNGLoader::loadImage - Color Type is PNG_COLOR_TYPE_GRAY, GL format is GL_LUMINANCE. Transparency is off" << std::endl;
+				Log::printDebug( "PNGLoader::loadImage - Color Type is PNG_COLOR_TYPE_GRAY, GL format is GL_LUMINANCE. Transparency is off" );
 
 			break;
 		case PNG_COLOR_TYPE_GA:
@@ -355,7 +368,7 @@ namespace c0de4un
 
 			// Print Debug
 			if ( transparency )
-				std::cout << "PNGLoader::loadImage - Color Type is PNG_COLOR_TYPE_GRAY, GL format is GL_LUMINANCE_ALPHA. Transparency is on" << std::endl;
+				Log::printDebug( "PNGLoader::loadImage - Color Type is PNG_COLOR_TYPE_GRAY, GL format is GL_LUMINANCE_ALPHA. Transparency is on" );
 
 			break;
 		}
@@ -0,0 +1,343 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+// HEADER
+#ifndef __c0de4un_texture_cache_hpp__
+#include "TextureCache.hpp"
+#endif // !__c0de4un_texture_cache_hpp__
+
+// Include PNGImage
+#ifndef __c0de4un_png_image_hpp__
+#include "PNGImage.hpp"
+#endif // !__c0de4un_png_image_hpp__
+
+// Include CompressedImage
+#ifndef __c0de4un_compressed_image_hpp__
+#include "CompressedImage.hpp"
+#endif // !__c0de4un_compressed_image_hpp__
+
+// Include CompressedLoader
+#ifndef __c0de4un_compressed_loader_hpp__
+#include "CompressedLoader.hpp"
+#endif // !__c0de4un_compressed_loader_hpp__
+
+// Include TextureFormats
+#ifndef __c0de4un_texture_formats_hpp__
+#include "TextureFormats.hpp"
+#endif // !__c0de4un_texture_formats_hpp__
+
+// Include BCEncoder
+#ifndef __c0de4un_bc_encoder_hpp__
+#include "BCEncoder.hpp"
+#endif // !__c0de4un_bc_encoder_hpp__
+
+// Include MipmapBuilder
+#ifndef __c0de4un_mipmap_builder_hpp__
+#include "MipmapBuilder.hpp"
+#endif // !__c0de4un_mipmap_builder_hpp__
+
+// Include MappedFile
+#ifndef __c0de4un_mapped_file_hpp__
+#include "../../utils/io/MappedFile.hpp"
+#endif // !__c0de4un_mapped_file_hpp__
+
+// Include FileUtils
+#ifndef __c0de4un_file_utils_hpp__
+#include "../../utils/io/FileUtils.hpp"
+#endif // !__c0de4un_file_utils_hpp__
+
+// Include Log
+#ifndef __c0de4un_log_hpp__
+#include "../../utils/log/Log.hpp"
+#endif // !__c0de4un_log_hpp__
+
+// Include STL
+#include <cstdio> // remove
+#include <cstring> // memcpy
+#include <fstream> // ofstream
+
+namespace c0de4un
+{
+
+	// -------------------------------------------------------- \\
+
+	// ===========================================================
+	// Getter & Setter
+	// ===========================================================
+
+	/*
+	 * Returns cooked file path of the source image.
+	 *
+	 * @param file_ - source image path.
+	 * @throws - std::bad_alloc.
+	*/
+	const std::string TextureCache::getCookedFile( const std::string & file_ )
+	{ return( file_ + ".ctex" ); }
+
+	/*
+	 * Returns compressed (DDS) cooked file path of the source image.
+	 *
+	 * @param file_ - source image path.
+	 * @throws - std::bad_alloc.
+	*/
+	const std::string TextureCache::getCompressedFile( const std::string & file_ )
+	{ return( file_ + ".dds" ); }
+
+	// ===========================================================
+	// Methods
+	// ===========================================================
+
+	/*
+	 * Hashes file bytes (FNV-1a, 64 bits).
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param file_ - file path.
+	 * @param hash_ - output hash.
+	 * @return - 'false' if file not found or empty.
+	*/
+	const bool TextureCache::HashFile( const std::string & file_, uint64_t & hash_ ) noexcept
+	{
+
+		// Map file
+		MappedFile mapped_;
+		if ( !mapped_.Open( file_ ) )
+			return( false );
+
+		// Set hash
+		hash_ = FileUtils::Hash( FileUtils::HASH_BASIS, mapped_.getData( ), mapped_.getSize( ) );
+
+		// Return TRUE
+		return( true );
+
+	}
+
+	/*
+	 * Maps cooked file, if valid & made from the same source.
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param file_ - source image path.
+	 * @param sourceHash_ - source file hash.
+	 * @param cooked_ - output mapped cooked file, header at #0.
+	 * @return - 'true' if OK, 'false' if not cooked or outdated.
+	 * @throws - std::bad_alloc.
+	*/
+	const bool TextureCache::Open( const std::string & file_, const uint64_t sourceHash_, MappedFile & cooked_ )
+	{
+
+		// Map cooked file
+		if ( !cooked_.Open( getCookedFile( file_ ) ) )
+			return( false );
+
+		// Check header size
+		if ( cooked_.getSize( ) < sizeof( CookedHeader ) )
+		{
+			cooked_.Close( );
+			return( false );
+		}
+
+		// Header (copied, mapping alignment not assumed)
+		CookedHeader header_;
+		std::memcpy( &header_, cooked_.getData( ), sizeof( CookedHeader ) );
+
+		// Check type, version, source & size
+		if ( header_.magic_ != MAGIC || header_.version_ != VERSION || header_.sourceHash_ != sourceHash_
+			|| cooked_.getSize( ) - sizeof( CookedHeader ) < header_.dataLength_ )
+		{
+			cooked_.Close( );
+			return( false );
+		}
+
+		// Row length, 0 if format not supported
+		const uint64_t stride_( PNGImage::getRowStride( header_.width_, static_cast<GLenum>( header_.colorFormat_ ), header_.bitDepth_ ) );
+
+		// Check pixels fit data (corrupted header), rows read by upload & conversion, stride_ * height_ may overflow
+		if ( stride_ == 0 || header_.height_ == 0 || stride_ > header_.dataLength_ / header_.height_ )
+		{
+			cooked_.Close( );
+			return( false );
+		}
+
+		// Return TRUE
+		return( true );
+
+	}
+
+	/*
+	 * Writes cooked file of the decoded image, replaced by FileUtils::ReplaceFile.
+	 *
+	 * @thread_safety - thread-safe, not for the same image.
+	 * @param image_ - decoded image.
+	 * @param sourceHash_ - source file hash.
+	 * @return - 'true' if OK, 'false' if format not supported or write failed.
+	 * @throws - std::bad_alloc.
+	*/
+	const bool TextureCache::Cook( const PNGImage & image_, const uint64_t sourceHash_ )
+	{
+
+		// Row length
+		const uint32_t stride_( image_.getRowStride( ) );
+
+		// Cancel, if not decoded or format not supported
+		if ( image_.mBytes == nullptr || stride_ == 0 )
+			return( false );
+
+		// Header
+		const CookedHeader header_{ MAGIC, VERSION, static_cast<uint32_t>( image_.mColorFormat ), image_.mSize[0], image_.mSize[1],
+			stride_ * image_.mSize[1], sourceHash_, image_.mBitDepth, { 0, 0, 0, 0, 0, 0, 0 } };
+
+		// Files
+		const std::string cookedFile_( getCookedFile( image_.mFile ) );
+		const std::string tempFile_( cookedFile_ + ".tmp" );
+
+		// Write temp. file
+		{
+
+			// Open
+			std::ofstream output_( tempFile_, std::ios::binary | std::ios::trunc );
+			if ( !output_.is_open( ) )
+				return( false );
+
+			// Write header & pixels
+			output_.write( reinterpret_cast<const char*>( &header_ ), sizeof( CookedHeader ) );
+			output_.write( reinterpret_cast<const char*>( image_.mBytes ), header_.dataLength_ );
+
+			// Check
+			if ( !output_.good( ) )
+			{
+				output_.close( );
+				std::remove( tempFile_.c_str( ) );
+				return( false );
+			}
+
+		}
+
+		// Replace cooked file
+		if ( !FileUtils::ReplaceFile( tempFile_, cookedFile_ ) )
+			return( false );
+
+		// Log
+		std::string logMsg( "TextureCache::Cook - cooked #" );
+		logMsg += cookedFile_;
+		Log::printDebug( logMsg.c_str( ) );
+
+		// Return TRUE
+		return( true );
+
+	}
+
+	/*
+	 * Encodes decoded image to BC1 (1-bit alpha) or BC3 (alpha gradients) & writes compressed cooked file.
+	 *
+	 * @thread_safety - thread-safe, not for the same image.
+	 * @param image_ - decoded image.
+	 * @param sourceHash_ - source file hash.
+	 * @param compressed_ - output image, created with getCompressedFile path.
+	 * @return - 'true' if encoded (write failure only logged), 'false' if format not supported.
+	 * @throws - std::bad_alloc.
+	*/
+	const bool TextureCache::CookCompressed( const PNGImage & image_, const uint64_t sourceHash_, CompressedImage & compressed_ )
+	{
+
+		// RGBA8 pixels
+		std::vector<unsigned char> pixels_;
+		if ( !image_.toRGBA8( pixels_ ) )
+			return( false );
+
+		// Size
+		const uint32_t width_( image_.mSize[0] );
+		const uint32_t height_( image_.mSize[1] );
+
+		// BC1 keeps 1-bit alpha only, BC3 for alpha gradients (soft edges, shadows)
+		const bool gradient_( BCEncoder::hasAlphaGradient( pixels_.data( ), width_, height_ ) );
+		const GLenum format_( gradient_ ? GL_COMPRESSED_RGBA_S3TC_DXT5_EXT : GL_COMPRESSED_RGBA_S3TC_DXT1_EXT );
+
+		// Set image
+		compressed_.Unload( );
+		compressed_.mSize[0] = width_;
+		compressed_.mSize[1] = height_;
+		compressed_.mFormat = format_;
+		compressed_.mSourceHash = sourceHash_;
+
+		// Levels, full mipmap chain
+		const uint32_t levelsCount_( MipmapBuilder::getLevelsCount( width_, height_ ) );
+		compressed_.mLevels.reserve( levelsCount_ );
+		uint32_t bytes_( 0 );
+		for ( uint32_t level_ = 0; level_ < levelsCount_; level_++ )
+		{
+			const uint32_t levelWidth_( MipmapBuilder::getLevelSize( width_, level_ ) );
+			const uint32_t levelHeight_( MipmapBuilder::getLevelSize( height_, level_ ) );
+			const uint32_t size_( TextureFormats::getImageBytes( format_, levelWidth_, levelHeight_ ) );
+			compressed_.mLevels.push_back( ImageLevel{ bytes_, size_, levelWidth_, levelHeight_ } );
+			bytes_ += size_;
+		}
+		compressed_.mBytes.resize( bytes_ );
+
+		// Encode levels, each level filtered from the previous one
+		std::vector<unsigned char> nextLevel_;
+		for ( uint32_t level_ = 0; level_ < levelsCount_; level_++ )
+		{
+
+			// Level
+			const ImageLevel & imageLevel_ = compressed_.mLevels[level_];
+			unsigned char *const blocks_( compressed_.mBytes.data( ) + imageLevel_.offset_ );
+
+			// Encode
+			if ( gradient_ )
+				BCEncoder::EncodeBC3( pixels_.data( ), imageLevel_.width_, imageLevel_.height_, blocks_ );
+			else
+				BCEncoder::EncodeBC1( pixels_.data( ), imageLevel_.width_, imageLevel_.height_, blocks_ );
+
+			// Filter next level
+			if ( level_ + 1 < levelsCount_ )
+			{
+				MipmapBuilder::Downsample( pixels_.data( ), imageLevel_.width_, imageLevel_.height_, MipmapBuilder::FILTER_KAISER, nextLevel_ );
+				pixels_.swap( nextLevel_ );
+			}
+
+		}
+
+		// Files
+		const std::string & cookedFile_( compressed_.mFile );
+		const std::string tempFile_( cookedFile_ + ".tmp" );
+
+		// Write temp. file
+		bool written_( false );
+		{
+
+			// Open
+			std::ofstream output_( tempFile_, std::ios::binary | std::ios::trunc );
+
+			// Write DDS
+			written_ = output_.is_open( ) && CompressedLoader::writeDDS( compressed_, sourceHash_, output_ );
+
+		}
+
+		// Replace cooked file
+		std::string logMsg;
+		if ( written_ && FileUtils::ReplaceFile( tempFile_, cookedFile_ ) )
+		{
+			logMsg = "TextureCache::CookCompressed - cooked #";
+			logMsg += cookedFile_;
+			logMsg += gradient_ ? " (BC3)" : " (BC1)";
+			Log::printDebug( logMsg.c_str( ) );
+		}
+		else
+		{
+			std::remove( tempFile_.c_str( ) );
+			logMsg = "TextureCache::CookCompressed - not written #";
+			logMsg += cookedFile_;
+			Log::printWarning( logMsg.c_str( ) );
+		}
+
+		// Return TRUE, encoded
+		return( true );
+
+	}
+
+	// -------------------------------------------------------- \\
+
+}
\ No newline at end of file
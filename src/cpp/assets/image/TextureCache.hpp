@@ -0,0 +1,220 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_texture_cache_hpp__
+#define __c0de4un_texture_cache_hpp__
+
+// Include string
+#ifndef __c0de4un_string_hpp__
+#include "../../cfg/string.hpp"
+#endif // !__c0de4un_string_hpp__
+
+// Include STL
+#include <cstdint> // uint32_t, uint64_t
+
+// Forward-declared PNGImage
+#ifndef __c0de4un_png_image_decl__
+#define __c0de4un_png_image_decl__
+namespace c0de4un { class PNGImage; }
+#endif // !__c0de4un_png_image_decl__
+
+// Forward-declared CompressedImage
+#ifndef __c0de4un_compressed_image_decl__
+#define __c0de4un_compressed_image_decl__
+namespace c0de4un { class CompressedImage; }
+#endif // !__c0de4un_compressed_image_decl__
+
+// Forward-declared MappedFile
+#ifndef __c0de4un_mapped_file_decl__
+#define __c0de4un_mapped_file_decl__
+namespace c0de4un { class MappedFile; }
+#endif // !__c0de4un_mapped_file_decl__
+
+// TextureCache declared
+#define __c0de4un_texture_cache_decl__
+
+// Enable structure-data (fields, variables) alignment (by compilator) to 1 byte
+#pragma pack( push, 1 )
+
+namespace c0de4un
+{
+
+	/*
+	 * CookedHeader - header of the cooked texture file, pixels follow it.
+	 *
+	 * @version 1.0
+	*/
+	struct CookedHeader final
+	{
+
+		/* File type, TextureCache::MAGIC */
+		uint32_t magic_;
+
+		/* Format version, TextureCache::VERSION */
+		uint32_t version_;
+
+		/* OpenGL color format (GL_RGBA, GL_RGB, etc) */
+		uint32_t colorFormat_;
+
+		/* Width */
+		uint32_t width_;
+
+		/* Height */
+		uint32_t height_;
+
+		/* Pixels bytes count, rows aligned to 4 bytes */
+		uint32_t dataLength_;
+
+		/* Source file hash (FNV-1a) */
+		uint64_t sourceHash_;
+
+		/* Bits per channel */
+		uint8_t bitDepth_;
+
+		/* Reserved, pixels aligned to 8 bytes */
+		uint8_t reserved_[7];
+
+	};
+
+	/*
+	 * TextureCache - cooked (decoded, GL-ready) textures stored beside source images.
+	 *
+	 * Cooked file holds PNGLoader output as is (rows flipped for OpenGL & aligned to 4 bytes),
+	 * so warm starts map it & upload without zlib inflate. Cooked file used only if
+	 * the hash of the source file matches, so edited sources cooked again.
+	 *
+	 * Compressed cook (CookCompressed) encodes the image to BC1 (no alpha gradients) or BC3
+	 * & stores it as DDS file beside the source, source hash kept in the DDS reserved fields.
+	 * Full mipmap chain filtered on CPU (see MipmapBuilder) & encoded, compressed levels
+	 * can't be generated by glGenerateMipmap.
+	 *
+	 * @version 1.0
+	*/
+	class TextureCache final
+	{
+
+	public:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Constants
+		// ===========================================================
+
+		/* Cooked file type, "CTEX" */
+		static constexpr uint32_t MAGIC = 0x58455443;
+
+		/* Cooked format version, increased when layout or PNGLoader output changed */
+		static constexpr uint32_t VERSION = 1;
+
+		/* Compressed cook version (DDS reserved field), increased when encoding changed. #1: mipmaps added */
+		static constexpr uint32_t COMPRESSED_VERSION = 1;
+
+		// ===========================================================
+		// Getter & Setter
+		// ===========================================================
+
+		/*
+		 * Returns cooked file path of the source image.
+		 *
+		 * @param file_ - source image path.
+		 * @throws - std::bad_alloc.
+		*/
+		static const std::string getCookedFile( const std::string & file_ );
+
+		/*
+		 * Returns compressed (DDS) cooked file path of the source image.
+		 *
+		 * @param file_ - source image path.
+		 * @throws - std::bad_alloc.
+		*/
+		static const std::string getCompressedFile( const std::string & file_ );
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Hashes file bytes (FNV-1a, 64 bits).
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param file_ - file path.
+		 * @param hash_ - output hash.
+		 * @return - 'false' if file not found or empty.
+		*/
+		static const bool HashFile( const std::string & file_, uint64_t & hash_ ) noexcept;
+
+		/*
+		 * Maps cooked file, if valid & made from the same source.
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param file_ - source image path.
+		 * @param sourceHash_ - source file hash.
+		 * @param cooked_ - output mapped cooked file, header at #0.
+		 * @return - 'true' if OK, 'false' if not cooked or outdated.
+		 * @throws - std::bad_alloc.
+		*/
+		static const bool Open( const std::string & file_, const uint64_t sourceHash_, MappedFile & cooked_ );
+
+		/*
+		 * Writes cooked file of the decoded image, replaced by FileUtils::ReplaceFile.
+		 *
+		 * @thread_safety - thread-safe, not for the same image.
+		 * @param image_ - decoded image.
+		 * @param sourceHash_ - source file hash.
+		 * @return - 'true' if OK, 'false' if format not supported or write failed.
+		 * @throws - std::bad_alloc.
+		*/
+		static const bool Cook( const PNGImage & image_, const uint64_t sourceHash_ );
+
+		/*
+		 * Encodes decoded image & its mipmaps to BC1 (1-bit alpha) or BC3 (alpha gradients) & writes compressed cooked file.
+		 *
+		 * @thread_safety - thread-safe, not for the same image.
+		 * @param image_ - decoded image.
+		 * @param sourceHash_ - source file hash.
+		 * @param compressed_ - output image, created with getCompressedFile path.
+		 * @return - 'true' if encoded (write failure only logged), 'false' if format not supported.
+		 * @throws - std::bad_alloc.
+		*/
+		static const bool CookCompressed( const PNGImage & image_, const uint64_t sourceHash_, CompressedImage & compressed_ );
+
+		// -------------------------------------------------------- \\
+
+	private:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Deleted
+		// ===========================================================
+
+		/* @deleted TextureCache constructor */
+		TextureCache( ) = delete;
+
+		/* @deleted TextureCache const copy constructor */
+		TextureCache( const TextureCache & ) = delete;
+
+		/* @deleted TextureCache const copy assignment operator */
+		TextureCache & operator=( const TextureCache & ) = delete;
+
+		/* @deleted TextureCache move constructor */
+		TextureCache( TextureCache && ) = delete;
+
+		/* @deleted TextureCache move assignment operator */
+		TextureCache & operator=( TextureCache && ) = delete;
+
+		// -------------------------------------------------------- \\
+
+	};
+
+}
+
+// Restore structure-data alignment to default (8-byte on MSVC)
+#pragma pack( pop )
+
+#endif // !__c0de4un_texture_cache_hpp__
\ No newline at end of file
@@ -0,0 +1,179 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+// HEADER
+#ifndef __c0de4un_texture_formats_hpp__
+#include "TextureFormats.hpp"
+#endif // !__c0de4un_texture_formats_hpp__
+
+// Include Log
+#ifndef __c0de4un_log_hpp__
+#include "../../utils/log/Log.hpp"
+#endif // !__c0de4un_log_hpp__
+
+// Include STL
+#include <atomic> // atomic
+#include <string> // string
+
+namespace c0de4un
+{
+
+	// -------------------------------------------------------- \\
+
+	/* Supported formats (TextureFormats::SUPPORT_ flags), set by Detect */
+	static std::atomic<uint32_t> supportedFormats_( 0 );
+
+	// ===========================================================
+	// Getter & Setter
+	// ===========================================================
+
+	/*
+	 * Returns 'true' if the format is block-compressed (known by this class).
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param format_ - OpenGL internal format.
+	*/
+	const bool TextureFormats::isCompressed( const GLenum format_ ) noexcept
+	{ return( getBlockBytes( format_ ) > 0 ); }
+
+	/*
+	 * Returns 'true' if the compressed format supported by the OpenGL context.
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param format_ - OpenGL internal format.
+	 * @return - 'false' if not compressed, not supported or not detected yet.
+	*/
+	const bool TextureFormats::isSupported( const GLenum format_ ) noexcept
+	{
+
+		// Support flag of the format
+		uint32_t flag_( 0 );
+		switch ( format_ )
+		{
+		case GL_COMPRESSED_RGB_S3TC_DXT1_EXT:
+		case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
+		case GL_COMPRESSED_RGBA_S3TC_DXT3_EXT:
+		case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
+			flag_ = SUPPORT_S3TC;
+			break;
+		case GL_COMPRESSED_RGBA_BPTC_UNORM:
+		case GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM:
+			flag_ = SUPPORT_BPTC;
+			break;
+		case GL_COMPRESSED_RGB8_ETC2:
+		case GL_COMPRESSED_SRGB8_ETC2:
+		case GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2:
+		case GL_COMPRESSED_RGBA8_ETC2_EAC:
+		case GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC:
+			flag_ = SUPPORT_ETC2;
+			break;
+		default:
+			return( false );
+		}
+
+		// Check flag
+		return( ( supportedFormats_.load( std::memory_order_acquire ) & flag_ ) != 0 );
+
+	}
+
+	/*
+	 * Returns bytes count of the 4x4 block.
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param format_ - OpenGL internal format.
+	 * @return - 8 or 16, 0 if not compressed.
+	*/
+	const uint32_t TextureFormats::getBlockBytes( const GLenum format_ ) noexcept
+	{
+
+		switch ( format_ )
+		{
+		case GL_COMPRESSED_RGB_S3TC_DXT1_EXT:
+		case GL_COMPRESSED_RGBA_S3TC_DXT1_EXT:
+		case GL_COMPRESSED_RGB8_ETC2:
+		case GL_COMPRESSED_SRGB8_ETC2:
+		case GL_COMPRESSED_RGB8_PUNCHTHROUGH_ALPHA1_ETC2:
+			return( 8 );
+		case GL_COMPRESSED_RGBA_S3TC_DXT3_EXT:
+		case GL_COMPRESSED_RGBA_S3TC_DXT5_EXT:
+		case GL_COMPRESSED_RGBA_BPTC_UNORM:
+		case GL_COMPRESSED_SRGB_ALPHA_BPTC_UNORM:
+		case GL_COMPRESSED_RGBA8_ETC2_EAC:
+		case GL_COMPRESSED_SRGB8_ALPHA8_ETC2_EAC:
+			return( 16 );
+		default:
+			return( 0 );
+		}
+
+	}
+
+	/*
+	 * Returns bytes count of the compressed image (mipmap level).
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param format_ - OpenGL internal format.
+	 * @param width_ - width in texels.
+	 * @param height_ - height in texels.
+	 * @return - bytes count, 0 if not compressed.
+	*/
+	const uint32_t TextureFormats::getImageBytes( const GLenum format_, const uint32_t width_, const uint32_t height_ ) noexcept
+	{
+
+		// Blocks count, partial blocks padded
+		const uint32_t blocksX_( ( width_ + BLOCK_SIZE - 1 ) / BLOCK_SIZE );
+		const uint32_t blocksY_( ( height_ + BLOCK_SIZE - 1 ) / BLOCK_SIZE );
+
+		// Return bytes count, 1x1 & 2x2 levels take one block
+		return( ( blocksX_ > 0 ? blocksX_ : 1 ) * ( blocksY_ > 0 ? blocksY_ : 1 ) * getBlockBytes( format_ ) );
+
+	}
+
+	// ===========================================================
+	// Methods
+	// ===========================================================
+
+	/*
+	 * Detects compressed formats supported by the current OpenGL context.
+	 *
+	 * @thread_safety - thread with current OpenGL context, after glewInit.
+	 * @throws - std::bad_alloc.
+	*/
+	void TextureFormats::Detect( )
+	{
+
+		// Supported flags
+		uint32_t supported_( 0 );
+
+		// S3TC, extension only (patents), but exposed by all desktop drivers
+		if ( GLEW_EXT_texture_compression_s3tc )
+			supported_ |= SUPPORT_S3TC;
+
+		// BPTC, core since OpenGL 4.2
+		if ( GLEW_VERSION_4_2 || GLEW_ARB_texture_compression_bptc )
+			supported_ |= SUPPORT_BPTC;
+
+		// ETC2, core since OpenGL 4.3 (often decompressed by desktop drivers, still saves disk & bus)
+		if ( GLEW_VERSION_4_3 || GLEW_ARB_ES3_compatibility )
+			supported_ |= SUPPORT_ETC2;
+
+		// Publish
+		supportedFormats_.store( supported_, std::memory_order_release );
+
+		// Log
+		std::string logMsg( "TextureFormats::Detect - S3TC: " );
+		logMsg += ( supported_ & SUPPORT_S3TC ) != 0 ? "yes" : "no";
+		logMsg += ", BPTC: ";
+		logMsg += ( supported_ & SUPPORT_BPTC ) != 0 ? "yes" : "no";
+		logMsg += ", ETC2: ";
+		logMsg += ( supported_ & SUPPORT_ETC2 ) != 0 ? "yes" : "no";
+		Log::printInfo( logMsg.c_str( ) );
+
+	}
+
+	// -------------------------------------------------------- \\
+
+}
\ No newline at end of file
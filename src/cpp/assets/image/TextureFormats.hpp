@@ -0,0 +1,145 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_texture_formats_hpp__
+#define __c0de4un_texture_formats_hpp__
+
+// Include OpenGL
+#ifndef __c0de4un_opengl_hpp__
+#include "../../cfg/opengl.hpp"
+#endif // !__c0de4un_opengl_hpp__
+
+// Include STL
+#include <cstdint> // uint32_t
+
+// TextureFormats declared
+#define __c0de4un_texture_formats_decl__
+
+namespace c0de4un
+{
+
+	/*
+	 * TextureFormats - compressed texture formats (BC1/BC2/BC3, BC7, ETC2) supported by the OpenGL context.
+	 *
+	 * Support detected once on the render-thread (after glewInit) & read by any thread,
+	 * so decoding threads choose compressed or uncompressed image before upload.
+	 * Nothing supported until Detect called.
+	 *
+	 * @version 1.0
+	*/
+	class TextureFormats final
+	{
+
+	public:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Constants
+		// ===========================================================
+
+		/* Compressed block width & height in texels */
+		static constexpr uint32_t BLOCK_SIZE = 4;
+
+		// ===========================================================
+		// Getter & Setter
+		// ===========================================================
+
+		/*
+		 * Returns 'true' if the format is block-compressed (known by this class).
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param format_ - OpenGL internal format.
+		*/
+		static const bool isCompressed( const GLenum format_ ) noexcept;
+
+		/*
+		 * Returns 'true' if the compressed format supported by the OpenGL context.
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param format_ - OpenGL internal format.
+		 * @return - 'false' if not compressed, not supported or not detected yet.
+		*/
+		static const bool isSupported( const GLenum format_ ) noexcept;
+
+		/*
+		 * Returns bytes count of the 4x4 block.
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param format_ - OpenGL internal format.
+		 * @return - 8 or 16, 0 if not compressed.
+		*/
+		static const uint32_t getBlockBytes( const GLenum format_ ) noexcept;
+
+		/*
+		 * Returns bytes count of the compressed image (mipmap level).
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param format_ - OpenGL internal format.
+		 * @param width_ - width in texels.
+		 * @param height_ - height in texels.
+		 * @return - bytes count, 0 if not compressed.
+		*/
+		static const uint32_t getImageBytes( const GLenum format_, const uint32_t width_, const uint32_t height_ ) noexcept;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Detects compressed formats supported by the current OpenGL context.
+		 *
+		 * @thread_safety - thread with current OpenGL context, after glewInit.
+		 * @throws - std::bad_alloc.
+		*/
+		static void Detect( );
+
+		// -------------------------------------------------------- \\
+
+	private:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Constants
+		// ===========================================================
+
+		/* S3TC (BC1, BC2, BC3) supported */
+		static constexpr uint32_t SUPPORT_S3TC = 1;
+
+		/* BPTC (BC7) supported */
+		static constexpr uint32_t SUPPORT_BPTC = 2;
+
+		/* ETC2 & EAC supported */
+		static constexpr uint32_t SUPPORT_ETC2 = 4;
+
+		// ===========================================================
+		// Deleted
+		// ===========================================================
+
+		/* @deleted TextureFormats constructor */
+		TextureFormats( ) = delete;
+
+		/* @deleted TextureFormats const copy constructor */
+		TextureFormats( const TextureFormats & ) = delete;
+
+		/* @deleted TextureFormats const copy assignment operator */
+		TextureFormats & operator=( const TextureFormats & ) = delete;
+
+		/* @deleted TextureFormats move constructor */
+		TextureFormats( TextureFormats && ) = delete;
+
+		/* @deleted TextureFormats move assignment operator */
+		TextureFormats & operator=( TextureFormats && ) = delete;
+
+		// -------------------------------------------------------- \\
+
+	};
+
+}
+
+#endif // !__c0de4un_texture_formats_hpp__
\ No newline at end of file
@@ -0,0 +1,352 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+// HEADER
+#ifndef __c0de4un_asset_loader_hpp__
+#include "AssetLoader.hpp"
+#endif // !__c0de4un_asset_loader_hpp__
+
+// Include GLTexture2D
+#ifndef __c0de4un_gl_texture_2D_hpp__
+#include "../texture/GLTexture2D.hpp"
+#endif // !__c0de4un_gl_texture_2D_hpp__
+
+// Include TextureUploader
+#ifndef __c0de4un_texture_uploader_hpp__
+#include "TextureUploader.hpp"
+#endif // !__c0de4un_texture_uploader_hpp__
+
+// Include JobSystem
+#ifndef __c0de4un_job_system_hpp__
+#include "../../utils/jobs/JobSystem.hpp"
+#endif // !__c0de4un_job_system_hpp__
+
+// Include Log
+#ifndef __c0de4un_log_hpp__
+#include "../../utils/log/Log.hpp"
+#endif // !__c0de4un_log_hpp__
+
+// Include ProfileScope
+#ifndef __c0de4un_profile_scope_hpp__
+#include "../../utils/profiler/ProfileScope.hpp"
+#endif // !__c0de4un_profile_scope_hpp__
+
+namespace c0de4un
+{
+
+	// -------------------------------------------------------- \\
+
+	// ===========================================================
+	// Constructor & destructor
+	// ===========================================================
+
+	/*
+	 * AssetLoader constructor, starts decode threads.
+	 *
+	 * @param decodeThreads_ - decode threads, at least 1.
+	 * @param slots_ - max. decoding & decoded (not uploaded) images, at least 1.
+	 * @throws - std::bad_alloc, std::system_error.
+	*/
+	AssetLoader::AssetLoader( const uint32_t decodeThreads_, const uint32_t slots_ )
+		: mDecodeJobs( nullptr ),
+		mCounter( ),
+		mSlots( ),
+		mFreeSlots( ),
+		mCompleted( ),
+		mWaiting( ),
+		mMutex( )
+	{
+
+		// Slots count
+		const uint32_t slotsCount_( slots_ > 0 ? slots_ : 1 );
+
+		// Slots, pointers to them passed to Jobs (never re-allocated)
+		mSlots.resize( slotsCount_ );
+		mFreeSlots.reserve( slotsCount_ );
+		for ( uint32_t i = slotsCount_; i > 0; i-- )
+		{
+			mSlots[i - 1] = Slot{ this, LoadRequest{ nullptr, nullptr, nullptr }, i - 1 };
+			mFreeSlots.push_back( i - 1 );
+		}
+
+		// Start decode threads (Jobs of JobSystem without workers run only by Wait)
+		mDecodeJobs = new JobSystem( decodeThreads_ > 0 ? decodeThreads_ : 1 );
+
+		// Log
+		Log::printDebug( "AssetLoader::constructor" );
+
+	}
+
+	/* AssetLoader destructor, waits for decoding Jobs & stops decode threads */
+	AssetLoader::~AssetLoader( )
+	{
+
+		// Log
+		Log::printDebug( "AssetLoader::destructor" );
+
+		// Finish decoding, slots used by Jobs
+		Wait( );
+
+		// Stop decode threads
+		delete mDecodeJobs;
+		mDecodeJobs = nullptr;
+
+	}
+
+	// ===========================================================
+	// Getter & Setter
+	// ===========================================================
+
+	/*
+	 * Returns requests count, not uploaded yet.
+	 *
+	 * @thread_safety - thread-safe.
+	*/
+	const uint32_t AssetLoader::getPendingCount( ) noexcept
+	{
+
+		// Lock
+		std::lock_guard<std::mutex> lock_( mMutex );
+
+		// Return used slots & waiting requests
+		return( static_cast<uint32_t>( mSlots.size( ) - mFreeSlots.size( ) + mWaiting.size( ) ) );
+
+	}
+
+	// ===========================================================
+	// Methods
+	// ===========================================================
+
+	/*
+	 * Decode Job function.
+	 *
+	 * @param pData - Slot.
+	 * @param begin_ - unused.
+	 * @param end_ - unused.
+	*/
+	void AssetLoader::decodeJob( void *const pData, const uint32_t begin_, const uint32_t end_ ) noexcept
+	{
+
+		// Profile
+		C0DE4UN_PROFILE_SCOPE( "AssetLoader::decodeJob" );
+
+		// Slot
+		Slot & slot_ = *static_cast<Slot*>( pData );
+
+		// Guarded-Block
+		try
+		{
+
+			// Decode PNG Image (state set to failed, if not decoded)
+			slot_.request_.texture_->Decode( );
+
+		}
+		catch ( const std::exception & exception_ )
+		{
+
+			// Log-message
+			std::string logMsg( "AssetLoader::decodeJob - ERROR: " );
+			logMsg += exception_.what( );
+
+			// Print to the Log
+			Log::printError( logMsg.c_str( ) );
+
+		}
+		catch ( ... )
+		{
+
+			// Print to the Log
+			Log::printError( "AssetLoader::decodeJob - unknown error !" );
+
+		}
+
+		// Lock
+		std::lock_guard<std::mutex> lock_( slot_.loader_->mMutex );
+
+		// Add to the completion queue (bounded by slots count)
+		slot_.loader_->mCompleted.push_back( slot_.index_ );
+
+	}
+
+	/*
+	 * Dispatches decode Job of the slot.
+	 *
+	 * @param slot_ - slot index, request set.
+	 * @throws - std::bad_alloc.
+	*/
+	void AssetLoader::dispatch( const uint32_t slot_ )
+	{
+
+		// Dispatch one Job
+		mDecodeJobs->Dispatch( mCounter, &AssetLoader::decodeJob, &mSlots[slot_], 1, 1 );
+
+	}
+
+	/*
+	 * Requests asynchronous loading of the 2D-Texture.
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param texture_ - 2D-Texture, must live until loaded.
+	 * @param callback_ - called on the render-thread after Upload, optional.
+	 * @param pData - callback user-data.
+	 * @return - 'false' if already loading or loaded (callback not called).
+	 * @throws - std::bad_alloc.
+	*/
+	const bool AssetLoader::Request( GLTexture2D & texture_, texture_callback_t callback_, void *const pData )
+	{
+
+		// Cancel, if already loading or loaded
+		if ( !texture_.Queue( ) )
+			return( false );
+
+		// Request
+		const LoadRequest request_{ &texture_, callback_, pData };
+
+		// Slot index
+		uint32_t slot_( 0 );
+
+		// Take free slot, or wait
+		{
+
+			// Lock
+			std::lock_guard<std::mutex> lock_( mMutex );
+
+			// Wait for free slot
+			if ( mFreeSlots.empty( ) )
+			{
+				mWaiting.push_back( request_ );
+				return( true );
+			}
+
+			// Take free slot
+			slot_ = mFreeSlots.back( );
+			mFreeSlots.pop_back( );
+			mSlots[slot_].request_ = request_;
+
+		}
+
+		// Decode
+		dispatch( slot_ );
+
+		// Return TRUE
+		return( true );
+
+	}
+
+	/*
+	 * Uploads decoded 2D-Textures & calls callbacks, or passes them to the TextureUploader.
+	 * Uploads bind GL_TEXTURE_2D directly, GLStateCache must be invalidated if returned > 0.
+	 * With uploader no OpenGL calls made, 2D-Textures passed while uploader queue
+	 * shorter than slots count (decoded images memory stays bounded).
+	 *
+	 * @thread_safety - render-thread only.
+	 * @param maxUploads_ - max. uploads.
+	 * @param uploader_ - PBO uploader, optional.
+	 * @return - uploaded, passed or failed 2D-Textures count.
+	 * @throws - can throw exception.
+	*/
+	const uint32_t AssetLoader::Update( const uint32_t maxUploads_, TextureUploader *const uploader_ )
+	{
+
+		// Profile
+		C0DE4UN_PROFILE_SCOPE( "AssetLoader::Update" );
+
+		// Uploaded
+		uint32_t uploaded_( 0 );
+
+		// Upload
+		for ( ; uploaded_ < maxUploads_; uploaded_++ )
+		{
+
+			// Stop, if uploader queue full
+			if ( uploader_ != nullptr && uploader_->getPendingCount( ) >= mSlots.size( ) )
+				break;
+
+			// Decoded request
+			LoadRequest request_{ nullptr, nullptr, nullptr };
+
+			// Pop decoded slot
+			{
+
+				// Lock
+				std::lock_guard<std::mutex> lock_( mMutex );
+
+				// Stop, if nothing decoded
+				if ( mCompleted.empty( ) )
+					break;
+
+				// Pop
+				const uint32_t slot_( mCompleted.front( ) );
+				mCompleted.pop_front( );
+
+				// Copy request
+				request_ = mSlots[slot_].request_;
+
+				// Next waiting request takes slot, free slot otherwise
+				if ( !mWaiting.empty( ) )
+				{
+					mSlots[slot_].request_ = mWaiting.front( );
+					mWaiting.pop_front( );
+				}
+				else
+				{
+					mSlots[slot_].request_ = LoadRequest{ nullptr, nullptr, nullptr };
+					mFreeSlots.push_back( slot_ );
+				}
+
+				// Decode next request (queued only, Job takes lock to complete)
+				if ( mSlots[slot_].request_.texture_ != nullptr )
+					dispatch( slot_ );
+
+			}
+
+			// Pass decoded 2D-Texture to the uploader, callback called after upload
+			if ( uploader_ != nullptr && request_.texture_->getState( ) == GLTexture2D::STATE_DECODED )
+			{
+				uploader_->Push( *request_.texture_, request_.callback_, request_.data_ );
+				continue;
+			}
+
+			// Upload to OpenGL (Upload fails, if decoding failed)
+			const bool loaded_( request_.texture_->Upload( ) );
+
+			// Log
+			if ( !loaded_ )
+			{
+				std::string logMsg( "AssetLoader::Update - failed to load 2D-Texture #" );
+				logMsg += request_.texture_->mName;
+				Log::printWarning( logMsg.c_str( ) );
+			}
+
+			// Callback
+			if ( request_.callback_ != nullptr )
+				request_.callback_( *request_.texture_, loaded_, request_.data_ );
+
+		}
+
+		// Return uploaded count
+		return( uploaded_ );
+
+	}
+
+	/*
+	 * Waits until decoding Jobs finished, calling thread decodes too.
+	 * Waiting (not started) requests stay queued.
+	 *
+	 * @thread_safety - not worker-thread.
+	*/
+	void AssetLoader::Wait( ) noexcept
+	{
+
+		// Wait for decoding Jobs
+		mDecodeJobs->Wait( mCounter );
+
+	}
+
+	// -------------------------------------------------------- \\
+
+}
\ No newline at end of file
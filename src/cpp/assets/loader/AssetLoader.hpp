@@ -0,0 +1,260 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_asset_loader_hpp__
+#define __c0de4un_asset_loader_hpp__
+
+// Include std::vector
+#ifndef __c0de4un_vector_hpp__
+#include "../../cfg/vector.hpp"
+#endif // !__c0de4un_vector_hpp__
+
+// Include JobCounter
+#ifndef __c0de4un_job_counter_hpp__
+#include "../../utils/jobs/JobCounter.hpp"
+#endif // !__c0de4un_job_counter_hpp__
+
+// Include STL
+#include <deque> // deque
+#include <mutex> // mutex
+
+// Forward-declaration of GLTexture2D
+#ifndef __c0de4un_gl_texture_2D_decl__
+#define __c0de4un_gl_texture_2D_decl__
+namespace c0de4un { class GLTexture2D; }
+#endif // !__c0de4un_gl_texture_2D_decl__
+
+// Forward-declaration of JobSystem
+#ifndef __c0de4un_job_system_decl__
+#define __c0de4un_job_system_decl__
+namespace c0de4un { class JobSystem; }
+#endif // !__c0de4un_job_system_decl__
+
+// Forward-declaration of TextureUploader
+#ifndef __c0de4un_texture_uploader_decl__
+#define __c0de4un_texture_uploader_decl__
+namespace c0de4un { class TextureUploader; }
+#endif // !__c0de4un_texture_uploader_decl__
+
+// AssetLoader declared
+#define __c0de4un_asset_loader_decl__
+
+namespace c0de4un
+{
+
+	/*
+	 * Texture loaded callback, called on the render-thread after Upload.
+	 *
+	 * @param texture_ - 2D-Texture.
+	 * @param loaded_ - 'false' if decoding or Upload failed.
+	 * @param pData - user-data.
+	*/
+	using texture_callback_t = void( * )( GLTexture2D & texture_, const bool loaded_, void *const pData );
+
+	/*
+	 * AssetLoader - decodes 2D-Textures on worker threads, uploads them on the render-thread.
+	 *
+	 * Decoding runs on own JobSystem, so long decode Jobs never executed by threads
+	 * waiting for frame Jobs. Decoded images wait in the completion queue, uploaded
+	 * by Update with per-frame limit, so frame time stays flat while textures stream in.
+	 *
+	 * Requests are limited by slots (decoding + decoded, not uploaded), extra requests
+	 * wait until slot freed, so memory of decoded images is bounded.
+	 *
+	 * @version 1.0
+	*/
+	class AssetLoader final
+	{
+
+	public:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Config
+		// ===========================================================
+
+		/* Default decode threads */
+		static constexpr uint32_t DEFAULT_DECODE_THREADS = 2;
+
+		/* Default slots (decoding & decoded images) */
+		static constexpr uint32_t DEFAULT_SLOTS = 8;
+
+		// ===========================================================
+		// Constructor & destructor
+		// ===========================================================
+
+		/*
+		 * AssetLoader constructor, starts decode threads.
+		 *
+		 * @param decodeThreads_ - decode threads, at least 1.
+		 * @param slots_ - max. decoding & decoded (not uploaded) images, at least 1.
+		 * @throws - std::bad_alloc, std::system_error.
+		*/
+		explicit AssetLoader( const uint32_t decodeThreads_ = DEFAULT_DECODE_THREADS, const uint32_t slots_ = DEFAULT_SLOTS );
+
+		/* AssetLoader destructor, waits for decoding Jobs & stops decode threads */
+		~AssetLoader( );
+
+		// ===========================================================
+		// Getter & Setter
+		// ===========================================================
+
+		/*
+		 * Returns requests count, not uploaded yet.
+		 *
+		 * @thread_safety - thread-safe.
+		*/
+		const uint32_t getPendingCount( ) noexcept;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Requests asynchronous loading of the 2D-Texture.
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param texture_ - 2D-Texture, must live until loaded.
+		 * @param callback_ - called on the render-thread after Upload, optional.
+		 * @param pData - callback user-data.
+		 * @return - 'false' if already loading or loaded (callback not called).
+		 * @throws - std::bad_alloc.
+		*/
+		const bool Request( GLTexture2D & texture_, texture_callback_t callback_ = nullptr, void *const pData = nullptr );
+
+		/*
+		 * Uploads decoded 2D-Textures & calls callbacks, or passes them to the TextureUploader.
+		 * Uploads bind GL_TEXTURE_2D directly, GLStateCache must be invalidated if returned > 0.
+		 * With uploader no OpenGL calls made, 2D-Textures passed while uploader queue
+		 * shorter than slots count (decoded images memory stays bounded).
+		 *
+		 * @thread_safety - render-thread only.
+		 * @param maxUploads_ - max. uploads.
+		 * @param uploader_ - PBO uploader, optional.
+		 * @return - uploaded, passed or failed 2D-Textures count.
+		 * @throws - can throw exception.
+		*/
+		const uint32_t Update( const uint32_t maxUploads_, TextureUploader *const uploader_ = nullptr );
+
+		/*
+		 * Waits until decoding Jobs finished, calling thread decodes too.
+		 * Waiting (not started) requests stay queued.
+		 *
+		 * @thread_safety - not worker-thread.
+		*/
+		void Wait( ) noexcept;
+
+		// -------------------------------------------------------- \\
+
+	private:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Types
+		// ===========================================================
+
+		/* Loading request */
+		struct LoadRequest final
+		{
+
+			/* 2D-Texture */
+			GLTexture2D * texture_;
+
+			/* Callback */
+			texture_callback_t callback_;
+
+			/* Callback user-data */
+			void * data_;
+
+		};
+
+		/* Decoding slot, Job user-data */
+		struct Slot final
+		{
+
+			/* AssetLoader */
+			AssetLoader * loader_;
+
+			/* Request */
+			LoadRequest request_;
+
+			/* Slot index */
+			uint32_t index_;
+
+		};
+
+		// ===========================================================
+		// Fields
+		// ===========================================================
+
+		/* Decode threads */
+		JobSystem * mDecodeJobs;
+
+		/* Decoding Jobs */
+		JobCounter mCounter;
+
+		/* Slots */
+		std::vector<Slot> mSlots;
+
+		/* Free slots */
+		std::vector<uint32_t> mFreeSlots;
+
+		/* Decoded slots, upload order */
+		std::deque<uint32_t> mCompleted;
+
+		/* Requests waiting for free slot */
+		std::deque<LoadRequest> mWaiting;
+
+		/* Guards free slots, completion & waiting queues */
+		std::mutex mMutex;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Decode Job function.
+		 *
+		 * @param pData - Slot.
+		 * @param begin_ - unused.
+		 * @param end_ - unused.
+		*/
+		static void decodeJob( void *const pData, const uint32_t begin_, const uint32_t end_ ) noexcept;
+
+		/*
+		 * Dispatches decode Job of the slot.
+		 *
+		 * @param slot_ - slot index, request set.
+		 * @throws - std::bad_alloc.
+		*/
+		void dispatch( const uint32_t slot_ );
+
+		// ===========================================================
+		// Deleted
+		// ===========================================================
+
+		/* @deleted AssetLoader const copy constructor */
+		AssetLoader( const AssetLoader & ) = delete;
+
+		/* @deleted AssetLoader const copy assignment operator */
+		AssetLoader & operator=( const AssetLoader & ) = delete;
+
+		/* @deleted AssetLoader move constructor */
+		AssetLoader( AssetLoader && ) = delete;
+
+		/* @deleted AssetLoader move assignment operator */
+		AssetLoader & operator=( AssetLoader && ) = delete;
+
+		// -------------------------------------------------------- \\
+
+	};
+
+}
+
+#endif // !__c0de4un_asset_loader_hpp__
\ No newline at end of file
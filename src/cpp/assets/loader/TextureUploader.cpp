@@ -0,0 +1,373 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+// HEADER
+#ifndef __c0de4un_texture_uploader_hpp__
+#include "TextureUploader.hpp"
+#endif // !__c0de4un_texture_uploader_hpp__
+
+// Include GLTexture2D
+#ifndef __c0de4un_gl_texture_2D_hpp__
+#include "../texture/GLTexture2D.hpp"
+#endif // !__c0de4un_gl_texture_2D_hpp__
+
+// Include PNGImage
+#ifndef __c0de4un_png_image_hpp__
+#include "../image/PNGImage.hpp"
+#endif // !__c0de4un_png_image_hpp__
+
+// Include Log
+#ifndef __c0de4un_log_hpp__
+#include "../../utils/log/Log.hpp"
+#endif // !__c0de4un_log_hpp__
+
+// Include ProfileScope
+#ifndef __c0de4un_profile_scope_hpp__
+#include "../../utils/profiler/ProfileScope.hpp"
+#endif // !__c0de4un_profile_scope_hpp__
+
+// Include STL
+#include <algorithm> // min, max
+#include <cstring> // memcpy
+
+namespace c0de4un
+{
+
+	// -------------------------------------------------------- \\
+
+	// ===========================================================
+	// Constructor & destructor
+	// ===========================================================
+
+	/*
+	 * TextureUploader constructor, no OpenGL calls (PBOs created by first Update).
+	 *
+	 * @param buffers_ - staging PBOs, at least 1.
+	 * @param bufferSize_ - staging PBO size in bytes, grown if one row does not fit.
+	*/
+	TextureUploader::TextureUploader( const uint32_t buffers_, const uint32_t bufferSize_ )
+		: mBuffersCount( buffers_ > 0 ? buffers_ : 1 ),
+		mBufferSize( bufferSize_ ),
+		mBuffers( ),
+		mNextBuffer( 0 ),
+		mQueue( ),
+		mUploadedBytes( 0 )
+	{
+
+		// Log
+		Log::printDebug( "TextureUploader::constructor" );
+
+	}
+
+	/* TextureUploader destructor, Unload must be called before */
+	TextureUploader::~TextureUploader( )
+	{
+
+		// Log
+		Log::printDebug( "TextureUploader::destructor" );
+
+#ifdef DEBUG // DEBUG
+		// Check PBOs deleted
+		if ( !mBuffers.empty( ) )
+			Log::printWarning( "TextureUploader::destructor - PBOs not unloaded" );
+#endif // DEBUG
+
+	}
+
+	// ===========================================================
+	// Getter & Setter
+	// ===========================================================
+
+	/* Returns queued (not completely uploaded) 2D-Textures count */
+	const uint32_t TextureUploader::getPendingCount( ) const noexcept
+	{ return( static_cast<uint32_t>( mQueue.size( ) ) ); }
+
+	/* Returns bytes uploaded since creation */
+	const uint64_t TextureUploader::getUploadedBytes( ) const noexcept
+	{ return( mUploadedBytes ); }
+
+	// ===========================================================
+	// Methods
+	// ===========================================================
+
+	/*
+	 * Returns 'true' if the GPU finished reading PBO, fence deleted.
+	 *
+	 * @param buffer_ - staging PBO.
+	*/
+	const bool TextureUploader::isBufferFree( StagingBuffer & buffer_ ) noexcept
+	{
+
+		// Not used yet
+		if ( buffer_.fence_ == nullptr )
+			return( true );
+
+		// Poll fence, no wait
+		const GLenum status_( glClientWaitSync( buffer_.fence_, 0, 0 ) );
+
+		// GPU still reading
+		if ( status_ == GL_TIMEOUT_EXPIRED )
+			return( false );
+
+		// Delete fence (signaled, or failed & never signaled)
+		glDeleteSync( buffer_.fence_ );
+		buffer_.fence_ = nullptr;
+
+		// Return TRUE
+		return( true );
+
+	}
+
+	/*
+	 * Queues decoded 2D-Texture for upload.
+	 *
+	 * @thread_safety - render-thread only.
+	 * @param texture_ - decoded 2D-Texture, must live until uploaded or unloaded.
+	 * @param callback_ - called after upload, optional.
+	 * @param pData - callback user-data.
+	 * @throws - std::bad_alloc.
+	*/
+	void TextureUploader::Push( GLTexture2D & texture_, texture_callback_t callback_, void *const pData )
+	{ mQueue.push_back( PendingUpload{ &texture_, callback_, pData, 0 } ); }
+
+	/*
+	 * Uploads queued 2D-Textures, at least one part per call.
+	 * Binds GL_TEXTURE_2D directly, GLStateCache must be invalidated if returned 'true'.
+	 *
+	 * @thread_safety - render-thread only.
+	 * @param budget_ - max. bytes.
+	 * @return - 'true' if OpenGL bindings changed.
+	 * @throws - can throw exception.
+	*/
+	const bool TextureUploader::Update( const uint32_t budget_ )
+	{
+
+		// Profile
+		C0DE4UN_PROFILE_SCOPE( "TextureUploader::Update" );
+
+		// Cancel, if nothing queued
+		if ( mQueue.empty( ) )
+			return( false );
+
+		// Create PBOs
+		if ( mBuffers.empty( ) )
+		{
+			mBuffers.resize( mBuffersCount, StagingBuffer{ 0, 0, nullptr } );
+			for ( StagingBuffer & buffer_ : mBuffers )
+				glGenBuffers( 1, &buffer_.buffer_ );
+		}
+
+		// Bytes left
+		uint32_t budgetLeft_( budget_ );
+
+		// Bindings changed
+		bool bound_( false );
+
+		// Upload parts
+		while ( !mQueue.empty( ) )
+		{
+
+			// Queued 2D-Texture
+			PendingUpload & upload_ = mQueue.front( );
+
+			// Decoded PNG Image (null if unloaded, or loaded synchronously after Push)
+			const PNGImage *const image_( upload_.texture_->getImage( ) );
+
+			// Row length
+			const uint32_t stride_( image_ != nullptr ? image_->getRowStride( ) : 0 );
+
+			// Drop, if not decoded anymore, compressed or format not supported
+			if ( stride_ == 0 )
+			{
+
+				// Bytes uploaded at once, if still decoded (compressed images are small, no staging)
+				const uint32_t bytes_( upload_.texture_->getDecodedLength( ) );
+
+				// Stop, if budget spent (one upload at least per call)
+				if ( bound_ && budgetLeft_ < bytes_ )
+					break;
+
+				// Copy, callback can Push
+				const PendingUpload dropped_( upload_ );
+				mQueue.pop_front( );
+
+				// Upload at once
+				if ( dropped_.texture_->getState( ) == GLTexture2D::STATE_DECODED )
+				{
+
+					// Unbind PBO, client-memory upload
+					glBindBuffer( GL_PIXEL_UNPACK_BUFFER, 0 );
+
+					// Upload
+					dropped_.texture_->Upload( );
+					bound_ = true;
+
+					// Budget
+					budgetLeft_ -= std::min( budgetLeft_, bytes_ );
+					mUploadedBytes += bytes_;
+
+				}
+
+				// Callback
+				if ( dropped_.callback_ != nullptr )
+					dropped_.callback_( *dropped_.texture_, dropped_.texture_->isLoaded( ), dropped_.data_ );
+
+				// Next
+				continue;
+
+			}
+
+			// Stop, if budget spent (one row at least uploaded per call)
+			if ( bound_ && budgetLeft_ < stride_ )
+				break;
+
+			// Staging PBO
+			StagingBuffer & buffer_ = mBuffers[mNextBuffer];
+
+			// Stop, if the GPU still reads the next PBO
+			if ( !isBufferFree( buffer_ ) )
+				break;
+
+			// Create storage, before the first part
+			if ( upload_.row_ == 0 )
+				upload_.texture_->Allocate( );
+			bound_ = true;
+
+			// Image height
+			const uint32_t height_( image_->mSize[1] );
+
+			// Rows of this part: fit the PBO & the budget, one at least
+			const uint32_t partBytes_( std::min( std::max( mBufferSize, stride_ ), std::max( budgetLeft_, stride_ ) ) );
+			const uint32_t rows_( std::min( partBytes_ / stride_, height_ - upload_.row_ ) );
+			const uint32_t size_( rows_ * stride_ );
+
+			// Bind PBO
+			glBindBuffer( GL_PIXEL_UNPACK_BUFFER, buffer_.buffer_ );
+
+			// Grow PBO storage
+			if ( buffer_.size_ < size_ )
+			{
+				glBufferData( GL_PIXEL_UNPACK_BUFFER, size_, nullptr, GL_STREAM_DRAW );
+				buffer_.size_ = size_;
+			}
+
+			// Map PBO (fence passed, so no implicit synchronization required)
+			void *const mapped_( glMapBufferRange( GL_PIXEL_UNPACK_BUFFER, 0, size_, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT ) );
+
+			// Fail 2D-Texture, if not mapped
+			if ( mapped_ == nullptr )
+			{
+
+				// Log
+				std::string logMsg( "TextureUploader::Update - failed to map PBO for 2D-Texture #" );
+				logMsg += upload_.texture_->mName;
+				Log::printError( logMsg.c_str( ) );
+
+				// Copy, callback can Push
+				const PendingUpload failed_( upload_ );
+				mQueue.pop_front( );
+
+				// Delete 2D-Texture Object & PNG Image
+				failed_.texture_->Unload( );
+
+				// Callback
+				if ( failed_.callback_ != nullptr )
+					failed_.callback_( *failed_.texture_, false, failed_.data_ );
+
+				// Next
+				continue;
+
+			}
+
+			// Copy rows to the PBO
+			std::memcpy( mapped_, image_->mBytes + static_cast<std::size_t>( upload_.row_ ) * stride_, size_ );
+
+			// Unmap PBO, data lost (corrupted) if returned FALSE, part repeated by the next Update
+			if ( glUnmapBuffer( GL_PIXEL_UNPACK_BUFFER ) == GL_FALSE )
+				break;
+
+			// Bind 2D-Texture Object
+			glBindTexture( GL_TEXTURE_2D, upload_.texture_->getTextureObject( ) );
+
+			// Image rows aligned to 4 bytes by PNGLoader
+			glPixelStorei( GL_UNPACK_ALIGNMENT, 4 );
+
+			// Upload rows from the PBO (offset #0)
+			glTexSubImage2D( GL_TEXTURE_2D, 0, 0, static_cast<GLint>( upload_.row_ ), image_->mSize[0], rows_, image_->mColorFormat, GL_UNSIGNED_BYTE, nullptr );
+
+			// Fence, PBO reused after the GPU copied rows
+			buffer_.fence_ = glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
+
+			// Next PBO
+			mNextBuffer = ( mNextBuffer + 1 ) % mBuffersCount;
+
+			// Budget
+			budgetLeft_ -= std::min( budgetLeft_, size_ );
+			mUploadedBytes += size_;
+
+			// Next rows
+			upload_.row_ += rows_;
+
+			// Complete 2D-Texture
+			if ( upload_.row_ >= height_ )
+			{
+
+				// Copy, callback can Push
+				const PendingUpload completed_( upload_ );
+				mQueue.pop_front( );
+
+				// Release PNG Image, set state
+				completed_.texture_->Complete( );
+
+				// Callback
+				if ( completed_.callback_ != nullptr )
+					completed_.callback_( *completed_.texture_, true, completed_.data_ );
+
+			}
+
+		}
+
+		// Unbind PBO, client-memory uploads (atlas, texture arrays) expect no unpack buffer
+		if ( bound_ )
+			glBindBuffer( GL_PIXEL_UNPACK_BUFFER, 0 );
+
+		// Return bindings changed
+		return( bound_ );
+
+	}
+
+	/*
+	 * Deletes PBOs & fences, queued 2D-Textures dropped (callbacks not called).
+	 *
+	 * @thread_safety - thread with current OpenGL context only.
+	*/
+	void TextureUploader::Unload( ) noexcept
+	{
+
+		// Delete PBOs & fences
+		for ( StagingBuffer & buffer_ : mBuffers )
+		{
+
+			// Delete fence
+			if ( buffer_.fence_ != nullptr )
+				glDeleteSync( buffer_.fence_ );
+
+			// Delete PBO
+			glDeleteBuffers( 1, &buffer_.buffer_ );
+
+		}
+
+		// Clear
+		mBuffers.clear( );
+		mNextBuffer = 0;
+		mQueue.clear( );
+
+	}
+
+	// -------------------------------------------------------- \\
+
+}
\ No newline at end of file
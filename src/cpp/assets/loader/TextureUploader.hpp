@@ -0,0 +1,228 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_texture_uploader_hpp__
+#define __c0de4un_texture_uploader_hpp__
+
+// Include opengl
+#ifndef __c0de4un_opengl_hpp__
+#include "../../cfg/opengl.hpp"
+#endif // !__c0de4un_opengl_hpp__
+
+// Include std::vector
+#ifndef __c0de4un_vector_hpp__
+#include "../../cfg/vector.hpp"
+#endif // !__c0de4un_vector_hpp__
+
+// Include AssetLoader (texture_callback_t)
+#ifndef __c0de4un_asset_loader_hpp__
+#include "AssetLoader.hpp"
+#endif // !__c0de4un_asset_loader_hpp__
+
+// Include STL
+#include <cstdint> // uint32_t
+#include <deque> // deque
+
+// TextureUploader declared
+#define __c0de4un_texture_uploader_decl__
+
+namespace c0de4un
+{
+
+	/*
+	 * TextureUploader - streams decoded 2D-Textures to OpenGL through Pixel Buffer Objects.
+	 *
+	 * Rows of the decoded image copied to the staging PBO, then uploaded by glTexSubImage2D
+	 * from the PBO, so the driver copies asynchronously instead of blocking on client memory.
+	 * Bytes uploaded per Update limited by the budget, big images uploaded over several frames.
+	 *
+	 * PBOs used as the ring, each guarded by the fence: PBO reused only when the GPU finished
+	 * reading it, Update stops (never waits) if the next PBO still in use.
+	 *
+	 * Compressed 2D-Textures (see GLTexture2D) not staged, uploaded at once by Update,
+	 * bytes charged against the same budget (deferred to the next Update if spent).
+	 *
+	 * @version 1.0
+	*/
+	class TextureUploader final
+	{
+
+	public:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Config
+		// ===========================================================
+
+		/* Default staging PBOs */
+		static constexpr uint32_t DEFAULT_BUFFERS = 3;
+
+		/* Default staging PBO size in bytes */
+		static constexpr uint32_t DEFAULT_BUFFER_SIZE = 4 * 1024 * 1024;
+
+		// ===========================================================
+		// Constructor & destructor
+		// ===========================================================
+
+		/*
+		 * TextureUploader constructor, no OpenGL calls (PBOs created by first Update).
+		 *
+		 * @param buffers_ - staging PBOs, at least 1.
+		 * @param bufferSize_ - staging PBO size in bytes, grown if one row does not fit.
+		*/
+		explicit TextureUploader( const uint32_t buffers_ = DEFAULT_BUFFERS, const uint32_t bufferSize_ = DEFAULT_BUFFER_SIZE );
+
+		/* TextureUploader destructor, Unload must be called before */
+		~TextureUploader( );
+
+		// ===========================================================
+		// Getter & Setter
+		// ===========================================================
+
+		/* Returns queued (not completely uploaded) 2D-Textures count */
+		const uint32_t getPendingCount( ) const noexcept;
+
+		/* Returns bytes uploaded since creation */
+		const uint64_t getUploadedBytes( ) const noexcept;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Queues decoded 2D-Texture for upload.
+		 *
+		 * @thread_safety - render-thread only.
+		 * @param texture_ - decoded 2D-Texture, must live until uploaded or unloaded.
+		 * @param callback_ - called after upload, optional.
+		 * @param pData - callback user-data.
+		 * @throws - std::bad_alloc.
+		*/
+		void Push( GLTexture2D & texture_, texture_callback_t callback_ = nullptr, void *const pData = nullptr );
+
+		/*
+		 * Uploads queued 2D-Textures, at least one part per call.
+		 * Binds GL_TEXTURE_2D directly, GLStateCache must be invalidated if returned 'true'.
+		 *
+		 * @thread_safety - render-thread only.
+		 * @param budget_ - max. bytes.
+		 * @return - 'true' if OpenGL bindings changed.
+		 * @throws - can throw exception.
+		*/
+		const bool Update( const uint32_t budget_ );
+
+		/*
+		 * Deletes PBOs & fences, queued 2D-Textures dropped (callbacks not called).
+		 *
+		 * @thread_safety - thread with current OpenGL context only.
+		*/
+		void Unload( ) noexcept;
+
+		// -------------------------------------------------------- \\
+
+	private:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Types
+		// ===========================================================
+
+		/* Staging PBO */
+		struct StagingBuffer final
+		{
+
+			/* OpenGL Buffer Object ID */
+			GLuint buffer_;
+
+			/* Storage size in bytes */
+			uint32_t size_;
+
+			/* Fence of the last upload from this PBO, null if none */
+			GLsync fence_;
+
+		};
+
+		/* Queued 2D-Texture */
+		struct PendingUpload final
+		{
+
+			/* 2D-Texture */
+			GLTexture2D * texture_;
+
+			/* Callback */
+			texture_callback_t callback_;
+
+			/* Callback user-data */
+			void * data_;
+
+			/* Next row to upload */
+			uint32_t row_;
+
+		};
+
+		// ===========================================================
+		// Constants
+		// ===========================================================
+
+		/* Staging PBOs count */
+		const uint32_t mBuffersCount;
+
+		/* Staging PBO initial size in bytes */
+		const uint32_t mBufferSize;
+
+		// ===========================================================
+		// Fields
+		// ===========================================================
+
+		/* Staging PBOs, empty until first Update */
+		std::vector<StagingBuffer> mBuffers;
+
+		/* Next staging PBO */
+		uint32_t mNextBuffer;
+
+		/* Queued 2D-Textures, upload order */
+		std::deque<PendingUpload> mQueue;
+
+		/* Bytes uploaded */
+		uint64_t mUploadedBytes;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Returns 'true' if the GPU finished reading PBO, fence deleted.
+		 *
+		 * @param buffer_ - staging PBO.
+		*/
+		static const bool isBufferFree( StagingBuffer & buffer_ ) noexcept;
+
+		// ===========================================================
+		// Deleted
+		// ===========================================================
+
+		/* @deleted TextureUploader const copy constructor */
+		TextureUploader( const TextureUploader & ) = delete;
+
+		/* @deleted TextureUploader const copy assignment operator */
+		TextureUploader & operator=( const TextureUploader & ) = delete;
+
+		/* @deleted TextureUploader move constructor */
+		TextureUploader( TextureUploader && ) = delete;
+
+		/* @deleted TextureUploader move assignment operator */
+		TextureUploader & operator=( TextureUploader && ) = delete;
+
+		// -------------------------------------------------------- \\
+
+	};
+
+}
+
+#endif // !__c0de4un_texture_uploader_hpp__
\ No newline at end of file
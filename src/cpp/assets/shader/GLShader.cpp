@@ -20,6 +20,11 @@
 #include "../../utils/log/Log.hpp"
 #endif // !__c0de4un_log_hpp__
 
+// Include ProfileScope
+#ifndef __c0de4un_profile_scope_hpp__
+#include "../../utils/profiler/ProfileScope.hpp"
+#endif // !__c0de4un_profile_scope_hpp__
+
 namespace c0de4un
 {
 
@@ -85,34 +90,58 @@ namespace c0de4un
 	const std::string & GLShader::getName( ) const noexcept
 	{ return( mName ); }
 
+	/* Returns GLSL Source-Code, or null if not set */
+	const std::string *const GLShader::getSourceCode( ) const noexcept
+	{ return( mCode ); }
+
 	// ===========================================================
 	// Methods
 	// ===========================================================
 
 	/*
-	 * Load & compile this Shader.
+	 * Starts compilation of this Shader, compile status not checked (see Load).
 	 *
-	 * @inline - no specific reason.
 	 * @thread_safety - render-thread-only.
-	 * @return 'true' if OK.
 	 * @throws - can throw exception.
 	*/
-	const bool GLShader::Load( )
+	void GLShader::Compile( )
 	{
 
-		// Cancel if loaded
-		if ( mShaderObject > 0 )
-			return( true );
+		// Profile
+		C0DE4UN_PROFILE_SCOPE( "GLShader::Compile" );
+
+		// Cancel if started or source code not set
+		if ( mShaderObject > 0 || mCode == nullptr )
+			return;
 
 		// Log
 		std::string logMsg( "GLShader#" );
 		logMsg += mName;
-		logMsg += "::Load";
+		logMsg += "::Compile";
 		Log::printDebug( logMsg.c_str( ) );
 
-		// Load & Compile
-		if ( mCode != nullptr )
-			GLRenderer::loadShader( mShaderObject, mCode->c_str( ), mType );
+		// Create Shader Object & start compilation
+		GLRenderer::compileShader( mShaderObject, mCode->c_str( ), mType );
+
+	}
+
+	/*
+	 * Load & compile this Shader, waits if compilation started by Compile.
+	 *
+	 * @inline - no specific reason.
+	 * @thread_safety - render-thread-only.
+	 * @return 'true' if OK.
+	 * @throws - can throw exception.
+	*/
+	const bool GLShader::Load( )
+	{
+
+		// Start compilation, if not started
+		Compile( );
+
+		// Check compile status, Shader Object deleted if failed
+		if ( mShaderObject > 0 )
+			return( GLRenderer::checkShader( mShaderObject ) );
 
 		// Return TRUE
 		return( true );
@@ -70,12 +70,23 @@ namespace c0de4un
 		/* Returns Name */
 		const std::string & getName( ) const noexcept;
 
+		/* Returns GLSL Source-Code, or null if not set */
+		const std::string *const getSourceCode( ) const noexcept;
+
 		// ===========================================================
 		// Methods
 		// ===========================================================
 
 		/*
-		 * Load & compile this Shader.
+		 * Starts compilation of this Shader, compile status not checked (see Load).
+		 *
+		 * @thread_safety - render-thread-only.
+		 * @throws - can throw exception.
+		*/
+		void Compile( );
+
+		/*
+		 * Load & compile this Shader, waits if compilation started by Compile.
 		 *
 		 * @inline - no specific reason.
 		 * @thread_safety - render-thread-only.
@@ -15,16 +15,31 @@
 #include "../../renderer/GLRenderer.hpp"
 #endif // !__c0de4un_gl_renderer_hpp__
 
+// Include BatchRequest
+#ifndef __c0de4un_batch_request_hpp__
+#include "../../renderer/batch/BatchRequest.hpp"
+#endif // !__c0de4un_batch_request_hpp__
+
 // Include GLShader
 #ifndef __c0de4un_gl_shader_hpp__
 #include "GLShader.hpp"
 #endif // !__c0de4un_gl_shader_hpp__
 
+// Include ProgramCache
+#ifndef __c0de4un_program_cache_hpp__
+#include "ProgramCache.hpp"
+#endif // !__c0de4un_program_cache_hpp__
+
 // Include Log
 #ifndef __c0de4un_log_hpp__
 #include "../../utils/log/Log.hpp"
 #endif // !__c0de4un_log_hpp__
 
+// Include ProfileScope
+#ifndef __c0de4un_profile_scope_hpp__
+#include "../../utils/profiler/ProfileScope.hpp"
+#endif // !__c0de4un_profile_scope_hpp__
+
 namespace c0de4un
 {
 
@@ -44,14 +59,24 @@ namespace c0de4un
 	 * @param vertexTexCoordsAttrName_ - Vertex Texture Coordinates attribute Name.
 	 * @param vertexColorAttrName_ - Vertex Color attribute Name.
 	 * @param texSamplerName_ - Texture Sampler Name.
-	 * @param mvpUniformName_ - Model View Projection Matrix Uniform name.
+	 * @param mvpUniformName_ - Model View Projection Matrix Uniform name (not instanced).
+	 * @param modelAttrName_ - 2D affine Model Matrix (mat2x4, rows) per-instance Attribute name, optional.
+	 * If set, Sprites drawn with instancing, Color Attribute used as per-instance Attribute.
+	 * @param viewProjUniformName_ - View-Projection Matrix Uniform name, required with modelAttrName_.
+	 * @param uvRectAttrName_ - 2D-Texture region (u, v, width, height) Attribute name, optional.
+	 * Per-instance with instancing, constant per Sprite otherwise (TextureAtlas regions).
+	 * @param texLayerAttrName_ - 2D-Texture Array layer Attribute name, optional (sampler2DArray, TextureArrayPool).
 	*/
 	GLShaderProgram::GLShaderProgram( const std::string & pName, GLShader & vertexShader_, GLShader & fragmentShader_,
 		const std::string & vertexPosAttrName_,
 		const std::string & vertexTexCoordsAttrName_,
 		const std::string & vertexColorAttrName_,
 		const std::string & texSamplerName_, 
-		const std::string & mvpUniformName_ )
+		const std::string & mvpUniformName_,
+		const std::string & modelAttrName_,
+		const std::string & viewProjUniformName_,
+		const std::string & uvRectAttrName_,
+		const std::string & texLayerAttrName_ )
 		: mName( pName ),
 		mVertexShader( vertexShader_ ),
 		mFragmentShader( fragmentShader_ ),
@@ -61,10 +86,22 @@ namespace c0de4un
 		mVertexColorAttrName( vertexColorAttrName_ ),
 		mTexSamplerName( texSamplerName_ ),
 		mMVPUniformName( mvpUniformName_ ),
+		mModelAttrName( modelAttrName_ ),
+		mViewProjUniformName( viewProjUniformName_ ),
+		mUVRectAttrName( uvRectAttrName_ ),
+		mTexLayerAttrName( texLayerAttrName_ ),
 		mVertexPosAttrIndex( -1 ),
 		mVertexColorAttrIndex( -1 ),
 		mVertexTexCoordsAttrIndex( -1 ),
-		mTexSamplerLoc( -1 )
+		mTexSamplerLoc( -1 ),
+		mMVPMatUniformLoc( -1 ),
+		mModelMatAttrIndex( -1 ),
+		mViewProjMatUniformLoc( -1 ),
+		mUVRectAttrIndex( -1 ),
+		mTexLayerAttrIndex( -1 ),
+		mTextureTarget( GL_TEXTURE_2D ),
+		mBinaryKey( 0 ),
+		mState( STATE_UNLOADED )
 	{
 
 		// Log
@@ -119,38 +156,122 @@ namespace c0de4un
 	const GLint & GLShaderProgram::getMVPUniform( ) const noexcept
 	{ return( mMVPMatUniformLoc ); }
 
+	/* Returns 2D affine Model Matrix per-instance Attribute index, or -1 */
+	const GLint & GLShaderProgram::getModelAttrIndex( ) const noexcept
+	{ return( mModelMatAttrIndex ); }
+
+	/* Returns View-Projection Matrix Uniform location/index, or -1 */
+	const GLint & GLShaderProgram::getViewProjUniform( ) const noexcept
+	{ return( mViewProjMatUniformLoc ); }
+
+	/* Returns 2D-Texture region Attribute index, or -1 */
+	const GLint & GLShaderProgram::getUVRectAttrIndex( ) const noexcept
+	{ return( mUVRectAttrIndex ); }
+
+	/* Returns 2D-Texture Array layer Attribute index, or -1 */
+	const GLint & GLShaderProgram::getTexLayerAttrIndex( ) const noexcept
+	{ return( mTexLayerAttrIndex ); }
+
+	/* Returns Texture Sampler #0 target ( GL_TEXTURE_2D or GL_TEXTURE_2D_ARRAY ) */
+	const GLenum GLShaderProgram::getTextureTarget( ) const noexcept
+	{ return( mTextureTarget ); }
+
+	/*
+	 * Returns 'true' if loaded, ready to use.
+	 *
+	 * @thread_safety - any thread, if not loaded or unloaded concurrently.
+	*/
+	const bool GLShaderProgram::isLoaded( ) const noexcept
+	{ return( mState == STATE_LOADED ); }
+
+	/*
+	 * Sets Shader Program Object, attributes & uniforms locations & texture target of the BatchRequest.
+	 * No GL calls, locations resolved by Finish.
+	 *
+	 * @thread_safety - any thread, if loaded (isLoaded) & not unloaded concurrently.
+	 * @param batchRequest_ - BatchRequest of the Drawable drawn by this Shader Program.
+	*/
+	void GLShaderProgram::getBatchRequest( BatchRequest & batchRequest_ ) const noexcept
+	{
+
+		// Set Shader Program Object
+		batchRequest_.shaderProgram_ = mProgramObject;
+
+		// Set Vertex Position attribute location/index
+		batchRequest_.vertexPosAttrIndex_ = mVertexPosAttrIndex;
+
+		// Set Vertex Color attribute location/index
+		batchRequest_.colorAttrIndex_ = mVertexColorAttrIndex;
+
+		// Set Vertex 2D-Texture Coordinates attribute location/index
+		batchRequest_.texCoordsAttrIndex_ = mVertexTexCoordsAttrIndex;
+
+		// Set MVP (Model View Projection) Matrix uniform location/index
+		batchRequest_.mvpMatUniformIndex_ = mMVPMatUniformLoc;
+
+		// Set 2D affine Model Matrix per-instance attribute location/index
+		batchRequest_.modelMatAttrIndex_ = mModelMatAttrIndex;
+
+		// Set View-Projection Matrix uniform location/index
+		batchRequest_.viewProjMatUniformIndex_ = mViewProjMatUniformLoc;
+
+		// Set 2D-Texture region attribute location/index
+		batchRequest_.uvRectAttrIndex_ = mUVRectAttrIndex;
+
+		// Set 2D-Texture Array layer attribute location/index
+		batchRequest_.texLayerAttrIndex_ = mTexLayerAttrIndex;
+
+		// Set Texture target
+		batchRequest_.textureTarget_ = mTextureTarget;
+
+	}
+
 	// ===========================================================
 	// Methods
 	// ===========================================================
 
 	/*
-	 * Load Shader Program & attached Shaders (upload shaders source code to OpenGL, compile, link with program).
+	 * Returns program binary key (see ProgramCache::getKey), 0 if binaries not supported or source code not set.
+	 *
+	 * @thread_safety - render-thread only.
+	*/
+	const uint64_t GLShaderProgram::getBinaryKey( ) const noexcept
+	{
+
+		// Source code
+		const std::string *const vertexCode_( mVertexShader.getSourceCode( ) );
+		const std::string *const fragmentCode_( mFragmentShader.getSourceCode( ) );
+
+		// Cancel, if not cached
+		if ( vertexCode_ == nullptr || fragmentCode_ == nullptr || !ProgramCache::isSupported( ) )
+			return( 0 );
+
+		// Return key
+		return( ProgramCache::getKey( *vertexCode_, *fragmentCode_ ) );
+
+	}
+
+	/*
+	 * Waits Shaders compilation & Shader Program link started by Start, checks statuses.
 	 *
 	 * @thread_safety - render-thread only.
 	 * @return - 'TRUE' if OK.
 	 * @throws - can throw exception.
 	*/
-	const bool GLShaderProgram::Load( )
+	const bool GLShaderProgram::checkLink( )
 	{
 
-		// Cancel
-		if ( mProgramObject > 0 )
-			return( true );
-
 		// Log
-		std::string logMsg( "GLShaderProgram#" );
-		logMsg += mName;
-		logMsg += "::Load";
-		Log::printDebug( logMsg.c_str( ) );
+		std::string logMsg;
 
-		// Load Vertex Shader
+		// Check Vertex Shader
 		if ( !mVertexShader.Load( ) )
 		{
 
 			// Log
 			logMsg = "GLShaderProgram#";
 			logMsg += mName;
-			logMsg += "::Load - failed to load vertex shader#";
+			logMsg += "::Finish - failed to load vertex shader#";
 			logMsg += mVertexShader.getName( );
 			Log::printWarning( logMsg.c_str( ) );
 
@@ -159,14 +280,14 @@ namespace c0de4un
 
 		}
 
-		// Load Fragment Shader
+		// Check Fragment Shader
 		if ( !mFragmentShader.Load( ) )
 		{
 
 			// Log
 			logMsg = "GLShaderProgram#";
 			logMsg += mName;
-			logMsg += "::Load - failed to load fragment shader#";
+			logMsg += "::Finish - failed to load fragment shader#";
 			logMsg += mFragmentShader.getName( );
 			Log::printWarning( logMsg.c_str( ) );
 
@@ -175,14 +296,73 @@ namespace c0de4un
 
 		}
 
-		// Create Program Object, attach Shaders & Link
-		if ( !GLRenderer::loadProgram( mProgramObject, mVertexShader.getShaderObject( ), mFragmentShader.getShaderObject( ) ) )
+		// Check Link
+		if ( !GLRenderer::checkProgram( mProgramObject ) )
+		{
+
+			// Log
+			logMsg = "GLShaderProgram#";
+			logMsg += mName;
+			logMsg += "::Finish - failed to link Shader Program";
+			Log::printWarning( logMsg.c_str( ) );
+
+			// Return FALSE
+			return( false );
+
+		}
+
+		// Return TRUE
+		return( true );
+
+	}
+
+	/*
+	 * Starts loading of the Shader Program, doesn't wait for the driver.
+	 * Linked from the program binary (see ProgramCache) if cached, otherwise Shaders compilation
+	 * & link started (background with GL_KHR_parallel_shader_compile). Completed by Finish.
+	 *
+	 * @thread_safety - render-thread only.
+	 * @return - 'TRUE' if started (or loaded), 'FALSE' if Shaders source code not set.
+	 * @throws - can throw exception.
+	*/
+	const bool GLShaderProgram::Start( )
+	{
+
+		// Profile
+		C0DE4UN_PROFILE_SCOPE( "GLShaderProgram::Start" );
+
+		// Cancel, if started or loaded
+		if ( mState != STATE_UNLOADED )
+			return( true );
+
+		// Log
+		std::string logMsg( "GLShaderProgram#" );
+		logMsg += mName;
+		logMsg += "::Start";
+		Log::printDebug( logMsg.c_str( ) );
+
+		// Program binary key, 0 if not cached
+		mBinaryKey = getBinaryKey( );
+
+		// Link from the program binary, only locations resolved by Finish
+		if ( mBinaryKey != 0 && ProgramCache::Load( mName, mBinaryKey, mProgramObject ) )
+		{
+			mState = STATE_LINKED;
+			return( true );
+		}
+
+		// Start Shaders compilation
+		mVertexShader.Compile( );
+		mFragmentShader.Compile( );
+
+		// Cancel, if Shaders source code not set
+		if ( mVertexShader.getShaderObject( ) < 1 || mFragmentShader.getShaderObject( ) < 1 )
 		{
 
 			// Log
 			logMsg = "GLShaderProgram#";
 			logMsg += mName;
-			logMsg += "::Load - failed to link Shader Program";
+			logMsg += "::Start - shader source code not set";
 			Log::printWarning( logMsg.c_str( ) );
 
 			// Return FALSE
@@ -190,6 +370,93 @@ namespace c0de4un
 
 		}
 
+		// Start link, driver waits for Shaders compilation
+		GLRenderer::linkProgram( mProgramObject, mVertexShader.getShaderObject( ), mFragmentShader.getShaderObject( ) );
+		mState = STATE_LINKING;
+
+		// Return TRUE
+		return( true );
+
+	}
+
+	/*
+	 * Returns 'true' if Finish won't wait for the driver (compile & link completed, or not started).
+	 *
+	 * @thread_safety - render-thread only.
+	*/
+	const bool GLShaderProgram::isCompleted( ) const noexcept
+	{ return( mState != STATE_LINKING || GLRenderer::isProgramCompleted( mProgramObject ) ); }
+
+	/*
+	 * Completes loading started by Start: checks compile & link status (waits if not completed),
+	 * saves program binary, resolves attributes & uniforms locations.
+	 *
+	 * @thread_safety - render-thread only.
+	 * @return - 'TRUE' if OK, 'FALSE' if failed or not started.
+	 * @throws - can throw exception.
+	*/
+	const bool GLShaderProgram::Finish( )
+	{
+
+		// Profile
+		C0DE4UN_PROFILE_SCOPE( "GLShaderProgram::Finish" );
+
+		// Cancel, if loaded or not started
+		if ( mState == STATE_LOADED )
+			return( true );
+		if ( mState == STATE_UNLOADED )
+			return( false );
+
+		// Compiled from source
+		if ( mState == STATE_LINKING )
+		{
+
+			// Check Shaders & link
+			if ( !checkLink( ) )
+				return( false );
+
+			// Save program binary for the next launch
+			if ( mBinaryKey != 0 )
+				ProgramCache::Save( mName, mBinaryKey, mProgramObject );
+
+			// Linked
+			mState = STATE_LINKED;
+
+		}
+
+		// Resolve locations
+		if ( !resolveLocations( ) )
+			return( false );
+
+		// Loaded
+		mState = STATE_LOADED;
+
+		// Return TRUE
+		return( true );
+
+	}
+
+	/*
+	 * Load Shader Program & attached Shaders (upload shaders source code to OpenGL, compile, link with program).
+	 * Linked from the program binary (see ProgramCache) if cached, Shaders not compiled then.
+	 * Blocking Start & Finish, see ShaderCompiler to load many programs in parallel.
+	 *
+	 * @thread_safety - render-thread only.
+	 * @return - 'TRUE' if OK.
+	 * @throws - can throw exception.
+	*/
+	const bool GLShaderProgram::Load( )
+	{ return( Start( ) && Finish( ) ); }
+
+	/*
+	 * Resolves attributes & uniforms locations of the linked Shader Program.
+	 *
+	 * @thread_safety - render-thread only.
+	 * @return - 'TRUE' if OK.
+	*/
+	const bool GLShaderProgram::resolveLocations( )
+	{
+
 		// Search Vertex Position attribute index
 		mVertexPosAttrIndex = glGetAttribLocation( mProgramObject, mVertexPosAttrName.c_str( ) );
 
@@ -263,7 +530,7 @@ namespace c0de4un
 		}
 
 		// Texture Sampler #0
-		if ( mVertexTexCoordsAttrIndex > 0 )
+		if ( mVertexTexCoordsAttrIndex >= 0 )
 		{
 
 			// Search Texture Sampler #0 location/index
@@ -286,6 +553,19 @@ namespace c0de4un
 				return( false );
 			}
 
+			// Texture Sampler #0 uniform index
+			const GLchar * samplerName_( mTexSamplerName.c_str( ) );
+			GLuint samplerIndex_( GL_INVALID_INDEX );
+			glGetUniformIndices( mProgramObject, 1, &samplerName_, &samplerIndex_ );
+
+			// Texture Sampler #0 type
+			GLint samplerType_( GL_SAMPLER_2D );
+			if ( samplerIndex_ != GL_INVALID_INDEX )
+				glGetActiveUniformsiv( mProgramObject, 1, &samplerIndex_, GL_UNIFORM_TYPE, &samplerType_ );
+
+			// Texture target, sampler2DArray - 2D-Texture Array layers
+			mTextureTarget = samplerType_ == GL_SAMPLER_2D_ARRAY ? GL_TEXTURE_2D_ARRAY : GL_TEXTURE_2D;
+
 		}
 
 		// MVP Matrix
@@ -314,6 +594,87 @@ namespace c0de4un
 
 		}
 
+		// Model Matrix per-instance Attribute
+		if ( !mModelAttrName.empty( ) )
+		{
+
+			// Search 2D affine Model Matrix Attribute index (first row)
+			mModelMatAttrIndex = glGetAttribLocation( mProgramObject, mModelAttrName.c_str( ) );
+
+			// Search View-Projection Matrix Uniform location/index
+			mViewProjMatUniformLoc = glGetUniformLocation( mProgramObject, mViewProjUniformName.c_str( ) );
+
+			// Check if Attribute & Uniform Locations Found
+			if ( mModelMatAttrIndex < 0 || mViewProjMatUniformLoc < 0 )
+			{
+				// Log Message
+				std::string logMsg( "GLShaderProgram#" );
+				logMsg += mName;
+
+				// Append Details
+				logMsg += "::Load - Model Matrix attribute or View-Projection Matrix uniform Location not found !";
+
+				// Print Message to Log
+				Log::printError( logMsg.c_str( ) );
+
+				// Return FALSE
+				return( false );
+			}
+
+		}
+
+		// 2D-Texture region Attribute
+		if ( !mUVRectAttrName.empty( ) )
+		{
+
+			// Search 2D-Texture region Attribute index
+			mUVRectAttrIndex = glGetAttribLocation( mProgramObject, mUVRectAttrName.c_str( ) );
+
+			// Check if Attribute Location Found
+			if ( mUVRectAttrIndex < 0 )
+			{
+				// Log Message
+				std::string logMsg( "GLShaderProgram#" );
+				logMsg += mName;
+
+				// Append Details
+				logMsg += "::Load - 2D-Texture region attribute Location not found !";
+
+				// Print Message to Log
+				Log::printError( logMsg.c_str( ) );
+
+				// Return FALSE
+				return( false );
+			}
+
+		}
+
+		// 2D-Texture Array layer Attribute
+		if ( !mTexLayerAttrName.empty( ) )
+		{
+
+			// Search 2D-Texture Array layer Attribute index
+			mTexLayerAttrIndex = glGetAttribLocation( mProgramObject, mTexLayerAttrName.c_str( ) );
+
+			// Check if Attribute Location Found
+			if ( mTexLayerAttrIndex < 0 )
+			{
+				// Log Message
+				std::string logMsg( "GLShaderProgram#" );
+				logMsg += mName;
+
+				// Append Details
+				logMsg += "::Load - 2D-Texture Array layer attribute Location not found !";
+
+				// Print Message to Log
+				Log::printError( logMsg.c_str( ) );
+
+				// Return FALSE
+				return( false );
+			}
+
+		}
+
 		// Return TRUE
 		return( true );
 
@@ -325,6 +686,9 @@ namespace c0de4un
 	void GLShaderProgram::Unload( )
 	{
 
+		// Reset state, program can be started again
+		mState = STATE_UNLOADED;
+
 		// Cancel
 		if ( mProgramObject < 1 )
 			return;
@@ -350,6 +714,18 @@ namespace c0de4un
 		// Reset Texture Uniform #0 Index
 		mTexSamplerLoc = -1;
 
+		// Reset MVP, Model & View-Projection Matrices Indices
+		mMVPMatUniformLoc = -1;
+		mModelMatAttrIndex = -1;
+		mViewProjMatUniformLoc = -1;
+
+		// Reset 2D-Texture region Attribute Index
+		mUVRectAttrIndex = -1;
+
+		// Reset 2D-Texture Array layer Attribute Index & Texture target
+		mTexLayerAttrIndex = -1;
+		mTextureTarget = GL_TEXTURE_2D;
+
 		// Reset Shader Program Object ID
 		mProgramObject = 0;
 
@@ -18,12 +18,21 @@
 #include "../../cfg/opengl.hpp"
 #endif // !__c0de4un_opengl_hpp__
 
+// Include STL
+#include <cstdint> // uint64_t
+
 // Forward-declare GLShader
 #ifndef __c0de4un_gl_shader_decl__
 #define __c0de4un_gl_shader_decl__
 namespace c0de4un { class GLShader; }
 #endif // !__c0de4un_gl_shader_decl__
 
+// Forward-declaration of BatchRequest
+#ifndef __c0de4un_batch_request_decl__
+#define __c0de4un_batch_request_decl__
+namespace c0de4un { struct BatchRequest; }
+#endif // !__c0de4un_batch_request_decl__
+
 // GLShaderProgram declared
 #define __c0de4un_gl_shader_program_decl__
 
@@ -54,14 +63,24 @@ namespace c0de4un
 		 * @param vertexTexCoordsAttrName_ - Vertex Texture Coordinates attribute Name.
 		 * @param vertexColorAttrName_ - Vertex Color attribute Name.
 		 * @param texSamplerName_ - Texture Sampler Name.
-		 * @param mvpUniformName_ - Model View Projection Matrix Uniform name.
+		 * @param mvpUniformName_ - Model View Projection Matrix Uniform name (not instanced).
+		 * @param modelAttrName_ - 2D affine Model Matrix (mat2x4, rows) per-instance Attribute name, optional.
+		 * If set, Sprites drawn with instancing, Color Attribute used as per-instance Attribute.
+		 * @param viewProjUniformName_ - View-Projection Matrix Uniform name, required with modelAttrName_.
+		 * @param uvRectAttrName_ - 2D-Texture region (u, v, width, height) Attribute name, optional.
+		 * Per-instance with instancing, constant per Sprite otherwise (TextureAtlas regions).
+		 * @param texLayerAttrName_ - 2D-Texture Array layer Attribute name, optional (sampler2DArray, TextureArrayPool).
 		*/
 		explicit GLShaderProgram( const std::string & pName, GLShader & vertexShader_, GLShader & fragmentShader_, 
 			const std::string & vertexPosAttrName_, 
 			const std::string & vertexTexCoordsAttrName_, 
 			const std::string & vertexColorAttrName_, 
 			const std::string & texSamplerName_,
-			const std::string & mvpUniformName_ );
+			const std::string & mvpUniformName_,
+			const std::string & modelAttrName_ = "",
+			const std::string & viewProjUniformName_ = "",
+			const std::string & uvRectAttrName_ = "",
+			const std::string & texLayerAttrName_ = "" );
 
 		/* GLShaderProgram destructor */
 		~GLShaderProgram( );
@@ -91,12 +110,73 @@ namespace c0de4un
 		/* Returns Model View Projection (MVP) Matrix Uniform location/index */
 		const GLint & getMVPUniform( ) const noexcept;
 
+		/* Returns 2D affine Model Matrix per-instance Attribute index, or -1 */
+		const GLint & getModelAttrIndex( ) const noexcept;
+
+		/* Returns View-Projection Matrix Uniform location/index, or -1 */
+		const GLint & getViewProjUniform( ) const noexcept;
+
+		/* Returns 2D-Texture region Attribute index, or -1 */
+		const GLint & getUVRectAttrIndex( ) const noexcept;
+
+		/* Returns 2D-Texture Array layer Attribute index, or -1 */
+		const GLint & getTexLayerAttrIndex( ) const noexcept;
+
+		/* Returns Texture Sampler #0 target ( GL_TEXTURE_2D or GL_TEXTURE_2D_ARRAY ) */
+		const GLenum getTextureTarget( ) const noexcept;
+
+		/*
+		 * Returns 'true' if loaded, ready to use.
+		 *
+		 * @thread_safety - any thread, if not loaded or unloaded concurrently.
+		*/
+		const bool isLoaded( ) const noexcept;
+
+		/*
+		 * Sets Shader Program Object, attributes & uniforms locations & texture target of the BatchRequest.
+		 * No GL calls, locations resolved by Finish.
+		 *
+		 * @thread_safety - any thread, if loaded (isLoaded) & not unloaded concurrently.
+		 * @param batchRequest_ - BatchRequest of the Drawable drawn by this Shader Program.
+		*/
+		void getBatchRequest( BatchRequest & batchRequest_ ) const noexcept;
+
 		// ===========================================================
 		// Methods
 		// ===========================================================
 
+		/*
+		 * Starts loading of the Shader Program, doesn't wait for the driver.
+		 * Linked from the program binary (see ProgramCache) if cached, otherwise Shaders compilation
+		 * & link started (background with GL_KHR_parallel_shader_compile). Completed by Finish.
+		 *
+		 * @thread_safety - render-thread only.
+		 * @return - 'TRUE' if started (or loaded), 'FALSE' if Shaders source code not set.
+		 * @throws - can throw exception.
+		*/
+		const bool Start( );
+
+		/*
+		 * Returns 'true' if Finish won't wait for the driver (compile & link completed, or not started).
+		 *
+		 * @thread_safety - render-thread only.
+		*/
+		const bool isCompleted( ) const noexcept;
+
+		/*
+		 * Completes loading started by Start: checks compile & link status (waits if not completed),
+		 * saves program binary, resolves attributes & uniforms locations.
+		 *
+		 * @thread_safety - render-thread only.
+		 * @return - 'TRUE' if OK, 'FALSE' if failed or not started.
+		 * @throws - can throw exception.
+		*/
+		const bool Finish( );
+
 		/*
 		 * Load Shader Program & attached Shaders (upload shaders source code to OpenGL, compile, link with program).
+		 * Linked from the program binary (see ProgramCache) if cached, Shaders not compiled then.
+		 * Blocking Start & Finish, see ShaderCompiler to load many programs in parallel.
 		 *
 		 * @thread_safety - render-thread only.
 		 * @return - 'TRUE' if OK.
@@ -119,6 +199,18 @@ namespace c0de4un
 		// Constants
 		// ===========================================================
 
+		/* State: not started */
+		static constexpr unsigned char STATE_UNLOADED = 0;
+
+		/* State: Shaders compiling & program linking (Start), not checked */
+		static constexpr unsigned char STATE_LINKING = 1;
+
+		/* State: linked (checked, or from the program binary), locations not resolved */
+		static constexpr unsigned char STATE_LINKED = 2;
+
+		/* State: loaded, ready to use */
+		static constexpr unsigned char STATE_LOADED = 3;
+
 		/* Name */
 		const std::string mName;
 
@@ -137,6 +229,18 @@ namespace c0de4un
 		/* Model View Projection Matrix Uniform Name */
 		const std::string mMVPUniformName;
 
+		/* 2D affine Model Matrix per-instance Attribute Name */
+		const std::string mModelAttrName;
+
+		/* View-Projection Matrix Uniform Name */
+		const std::string mViewProjUniformName;
+
+		/* 2D-Texture region Attribute Name */
+		const std::string mUVRectAttrName;
+
+		/* 2D-Texture Array layer Attribute Name */
+		const std::string mTexLayerAttrName;
+
 		// ===========================================================
 		// Fields
 		// ===========================================================
@@ -165,6 +269,55 @@ namespace c0de4un
 		/* MVP (Model View Projection) Matrix attribute Index for OpenGL */
 		GLint mMVPMatUniformLoc;
 
+		/* 2D affine Model Matrix per-instance Attribute Index for OpenGL */
+		GLint mModelMatAttrIndex;
+
+		/* View-Projection Matrix Uniform Location for OpenGL */
+		GLint mViewProjMatUniformLoc;
+
+		/* 2D-Texture region Attribute Index for OpenGL */
+		GLint mUVRectAttrIndex;
+
+		/* 2D-Texture Array layer Attribute Index for OpenGL */
+		GLint mTexLayerAttrIndex;
+
+		/* Texture Sampler #0 target, from sampler type */
+		GLenum mTextureTarget;
+
+		/* Program binary key, 0 if not cached (see getBinaryKey) */
+		uint64_t mBinaryKey;
+
+		/* Load state (STATE_UNLOADED, etc), render-thread only */
+		unsigned char mState;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Returns program binary key (see ProgramCache::getKey), 0 if binaries not supported or source code not set.
+		 *
+		 * @thread_safety - render-thread only.
+		*/
+		const uint64_t getBinaryKey( ) const noexcept;
+
+		/*
+		 * Waits Shaders compilation & Shader Program link started by Start, checks statuses.
+		 *
+		 * @thread_safety - render-thread only.
+		 * @return - 'TRUE' if OK.
+		 * @throws - can throw exception.
+		*/
+		const bool checkLink( );
+
+		/*
+		 * Resolves attributes & uniforms locations of the linked Shader Program.
+		 *
+		 * @thread_safety - render-thread only.
+		 * @return - 'TRUE' if OK.
+		*/
+		const bool resolveLocations( );
+
 		// ===========================================================
 		// Deleted
 		// ===========================================================
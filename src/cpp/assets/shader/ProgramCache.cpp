@@ -0,0 +1,297 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+// HEADER
+#ifndef __c0de4un_program_cache_hpp__
+#include "ProgramCache.hpp"
+#endif // !__c0de4un_program_cache_hpp__
+
+// Include MappedFile
+#ifndef __c0de4un_mapped_file_hpp__
+#include "../../utils/io/MappedFile.hpp"
+#endif // !__c0de4un_mapped_file_hpp__
+
+// Include FileUtils
+#ifndef __c0de4un_file_utils_hpp__
+#include "../../utils/io/FileUtils.hpp"
+#endif // !__c0de4un_file_utils_hpp__
+
+// Include std::vector
+#ifndef __c0de4un_vector_hpp__
+#include "../../cfg/vector.hpp"
+#endif // !__c0de4un_vector_hpp__
+
+// Include Log
+#ifndef __c0de4un_log_hpp__
+#include "../../utils/log/Log.hpp"
+#endif // !__c0de4un_log_hpp__
+
+// Include ProfileScope
+#ifndef __c0de4un_profile_scope_hpp__
+#include "../../utils/profiler/ProfileScope.hpp"
+#endif // !__c0de4un_profile_scope_hpp__
+
+// Include STL
+#include <cstdio> // remove
+#include <cstring> // strlen
+#include <fstream> // ofstream
+
+namespace c0de4un
+{
+
+	// -------------------------------------------------------- \\
+
+	/* Directory of the program binary files, working directory if empty */
+	static std::string directory_;
+
+	// ===========================================================
+	// Getter & Setter
+	// ===========================================================
+
+	/*
+	 * Sets directory of the program binary files, with trailing separator.
+	 * Working directory used if not set.
+	 *
+	 * @thread_safety - not thread-safe, set before programs loaded.
+	 * @param pDirectory - directory path.
+	 * @throws - std::bad_alloc.
+	*/
+	void ProgramCache::setDirectory( const std::string & pDirectory )
+	{ directory_ = pDirectory; }
+
+	/*
+	 * Returns program binary file path.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @param name_ - Shader Program name.
+	 * @throws - std::bad_alloc.
+	*/
+	const std::string ProgramCache::getFile( const std::string & name_ )
+	{ return( directory_ + name_ + ".glbin" ); }
+
+	/*
+	 * Returns 'true' if program binaries supported by the OpenGL context.
+	 *
+	 * @thread_safety - render-thread only.
+	*/
+	const bool ProgramCache::isSupported( ) noexcept
+	{
+
+		// Extension (core since OpenGL 4.1)
+		if ( !GLEW_ARB_get_program_binary && !GLEW_VERSION_4_1 )
+			return( false );
+
+		// Binary formats, some drivers expose the extension without formats
+		GLint formats_( 0 );
+		glGetIntegerv( GL_NUM_PROGRAM_BINARY_FORMATS, &formats_ );
+
+		// Return TRUE if any format
+		return( formats_ > 0 );
+
+	}
+
+	/*
+	 * Returns key of the Shader Program: hash of the shaders source code & driver strings.
+	 *
+	 * @thread_safety - render-thread only.
+	 * @param vertexCode_ - Vertex Shader source code.
+	 * @param fragmentCode_ - Fragment Shader source code.
+	*/
+	const uint64_t ProgramCache::getKey( const std::string & vertexCode_, const std::string & fragmentCode_ ) noexcept
+	{
+
+		// FNV-1a offset basis
+		uint64_t key_( FileUtils::HASH_BASIS );
+
+		// Source code, separated by size so moved text changes the key
+		const uint64_t vertexSize_( vertexCode_.size( ) );
+		key_ = FileUtils::Hash( key_, &vertexSize_, sizeof( vertexSize_ ) );
+		key_ = FileUtils::Hash( key_, vertexCode_.data( ), vertexCode_.size( ) );
+		key_ = FileUtils::Hash( key_, fragmentCode_.data( ), fragmentCode_.size( ) );
+
+		// Driver strings, binaries of other driver or version rejected anyway
+		const GLenum strings_[3] = { GL_VENDOR, GL_RENDERER, GL_VERSION };
+		for ( const GLenum name_ : strings_ )
+		{
+			const char *const string_( reinterpret_cast<const char*>( glGetString( name_ ) ) );
+			if ( string_ != nullptr )
+				key_ = FileUtils::Hash( key_, string_, std::strlen( string_ ) + 1 );
+		}
+
+		// Return key
+		return( key_ );
+
+	}
+
+	// ===========================================================
+	// Methods
+	// ===========================================================
+
+	/*
+	 * Creates Shader Program from the program binary file, if made with the same key & accepted by the driver.
+	 * Rejected file removed, outdated file replaced by Save.
+	 *
+	 * @thread_safety - render-thread only.
+	 * @param name_ - Shader Program name.
+	 * @param key_ - Shader Program key.
+	 * @param program_ - output OpenGL Shader Program Object ID, set if loaded.
+	 * @return - 'true' if linked from binary, 'false' if not cached or rejected.
+	 * @throws - std::bad_alloc.
+	*/
+	const bool ProgramCache::Load( const std::string & name_, const uint64_t key_, GLuint & program_ )
+	{
+
+		// Profile
+		C0DE4UN_PROFILE_SCOPE( "ProgramCache::Load" );
+
+		// Program binary file
+		const std::string file_( getFile( name_ ) );
+
+		// Map file
+		MappedFile mapped_;
+		if ( !mapped_.Open( file_ ) )
+			return( false );
+
+		// Validate header
+		const ProgramBinaryHeader *const header_( reinterpret_cast<const ProgramBinaryHeader*>( mapped_.getData( ) ) );
+		const bool valid_( mapped_.getSize( ) >= sizeof( ProgramBinaryHeader )
+			&& header_->magic_ == MAGIC
+			&& header_->version_ == VERSION
+			&& header_->length_ > 0 && header_->length_ <= MAX_LENGTH
+			&& mapped_.getSize( ) - sizeof( ProgramBinaryHeader ) >= header_->length_ );
+
+		// Outdated: other sources or driver, compiled & written again
+		if ( !valid_ || header_->key_ != key_ )
+			return( false );
+
+		// Create Shader Program Object
+		const GLuint loaded_( glCreateProgram( ) );
+		if ( loaded_ < 1 )
+			return( false );
+
+		// Upload binary, links the program
+		glProgramBinary( loaded_, header_->format_, mapped_.getData( ) + sizeof( ProgramBinaryHeader ), static_cast<GLsizei>( header_->length_ ) );
+
+		// Validate: driver rejects binaries of other hardware or driver build
+		GLint linkStatus_( GL_FALSE );
+		glGetProgramiv( loaded_, GL_LINK_STATUS, &linkStatus_ );
+		if ( linkStatus_ != GL_TRUE )
+		{
+
+			// Delete Shader Program Object
+			glDeleteProgram( loaded_ );
+
+			// Remove rejected file
+			mapped_.Close( );
+			std::remove( file_.c_str( ) );
+
+			// Log
+			std::string logMsg( "ProgramCache::Load - binary rejected by the driver #" );
+			logMsg += file_;
+			Log::printWarning( logMsg.c_str( ) );
+
+			// Return FALSE
+			return( false );
+
+		}
+
+		// Set Shader Program Object
+		program_ = loaded_;
+
+		// Log
+		std::string logMsg( "ProgramCache::Load - linked from binary #" );
+		logMsg += file_;
+		Log::printDebug( logMsg.c_str( ) );
+
+		// Return TRUE
+		return( true );
+
+	}
+
+	/*
+	 * Writes binary of the linked Shader Program, replaced by FileUtils::ReplaceFile.
+	 * Program must be linked with GL_PROGRAM_BINARY_RETRIEVABLE_HINT (see GLRenderer::linkProgram).
+	 *
+	 * @thread_safety - render-thread only.
+	 * @param name_ - Shader Program name.
+	 * @param key_ - Shader Program key.
+	 * @param program_ - linked OpenGL Shader Program Object ID.
+	 * @return - 'true' if written.
+	 * @throws - std::bad_alloc.
+	*/
+	const bool ProgramCache::Save( const std::string & name_, const uint64_t key_, const GLuint program_ )
+	{
+
+		// Profile
+		C0DE4UN_PROFILE_SCOPE( "ProgramCache::Save" );
+
+		// Binary bytes count
+		GLint length_( 0 );
+		glGetProgramiv( program_, GL_PROGRAM_BINARY_LENGTH, &length_ );
+		if ( length_ < 1 || static_cast<uint32_t>( length_ ) > MAX_LENGTH )
+			return( false );
+
+		// Get binary
+		std::vector<unsigned char> binary_( static_cast<std::size_t>( length_ ) );
+		GLsizei written_( 0 );
+		GLenum format_( 0 );
+		glGetProgramBinary( program_, length_, &written_, &format_, binary_.data( ) );
+		if ( written_ < 1 )
+			return( false );
+
+		// Header
+		const ProgramBinaryHeader header_{ MAGIC, VERSION, key_, format_, static_cast<uint32_t>( written_ ) };
+
+		// Files
+		const std::string file_( getFile( name_ ) );
+		const std::string tempFile_( file_ + ".tmp" );
+
+		// Write temp. file
+		bool saved_( false );
+		{
+
+			// Open
+			std::ofstream output_( tempFile_, std::ios::binary | std::ios::trunc );
+
+			// Write header & binary
+			if ( output_.is_open( ) )
+			{
+				output_.write( reinterpret_cast<const char*>( &header_ ), sizeof( header_ ) );
+				output_.write( reinterpret_cast<const char*>( binary_.data( ) ), written_ );
+				saved_ = output_.good( );
+			}
+
+		}
+
+		// Replace file
+		if ( saved_ )
+			saved_ = FileUtils::ReplaceFile( tempFile_, file_ );
+
+		// Log
+		std::string logMsg;
+		if ( saved_ )
+		{
+			logMsg = "ProgramCache::Save - saved #";
+			logMsg += file_;
+			Log::printDebug( logMsg.c_str( ) );
+		}
+		else
+		{
+			std::remove( tempFile_.c_str( ) );
+			logMsg = "ProgramCache::Save - not written #";
+			logMsg += file_;
+			Log::printWarning( logMsg.c_str( ) );
+		}
+
+		// Return result
+		return( saved_ );
+
+	}
+
+	// -------------------------------------------------------- \\
+
+}
\ No newline at end of file
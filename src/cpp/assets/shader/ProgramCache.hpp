@@ -0,0 +1,195 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_program_cache_hpp__
+#define __c0de4un_program_cache_hpp__
+
+// Include string
+#ifndef __c0de4un_string_hpp__
+#include "../../cfg/string.hpp"
+#endif // !__c0de4un_string_hpp__
+
+// Include OpenGL
+#ifndef __c0de4un_opengl_hpp__
+#include "../../cfg/opengl.hpp"
+#endif // !__c0de4un_opengl_hpp__
+
+// Include STL
+#include <cstdint> // uint32_t, uint64_t
+#include <cstddef> // size_t
+
+// ProgramCache declared
+#define __c0de4un_program_cache_decl__
+
+// Enable structure-data (fields, variables) alignment (by compilator) to 1 byte
+#pragma pack( push, 1 )
+
+namespace c0de4un
+{
+
+	/*
+	 * ProgramBinaryHeader - header of the program binary file, driver binary follows it.
+	 *
+	 * @version 1.0
+	*/
+	struct ProgramBinaryHeader final
+	{
+
+		/* File type, ProgramCache::MAGIC */
+		uint32_t magic_;
+
+		/* Format version, ProgramCache::VERSION */
+		uint32_t version_;
+
+		/* Key, hash of the shaders source code & driver strings (see ProgramCache::getKey) */
+		uint64_t key_;
+
+		/* Binary format (glGetProgramBinary) */
+		uint32_t format_;
+
+		/* Binary bytes count */
+		uint32_t length_;
+
+	};
+
+	/*
+	 * ProgramCache - linked Shader Programs stored on disk as driver binaries (glGetProgramBinary),
+	 * so warm starts skip GLSL compile & link.
+	 *
+	 * Binary used only if the key matches: hash (FNV-1a) of the shaders source code
+	 * & GL_VENDOR, GL_RENDERER, GL_VERSION strings, so edited shaders & driver updates compile again.
+	 * Binary still can be rejected by the driver (glProgramBinary fails to link), then file removed
+	 * & program compiled from source.
+	 *
+	 * Requires GL_ARB_get_program_binary (OpenGL 4.1) & at least one binary format.
+	 *
+	 * @version 1.0
+	*/
+	class ProgramCache final
+	{
+
+	public:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Constants
+		// ===========================================================
+
+		/* Program binary file type, "GLPB" */
+		static constexpr uint32_t MAGIC = 0x42504C47;
+
+		/* Program binary format version, increased when layout or key changed */
+		static constexpr uint32_t VERSION = 1;
+
+		/* Max. binary bytes count (corrupted header guard) */
+		static constexpr uint32_t MAX_LENGTH = 64 * 1024 * 1024;
+
+		// ===========================================================
+		// Getter & Setter
+		// ===========================================================
+
+		/*
+		 * Sets directory of the program binary files, with trailing separator.
+		 * Working directory used if not set.
+		 *
+		 * @thread_safety - not thread-safe, set before programs loaded.
+		 * @param pDirectory - directory path.
+		 * @throws - std::bad_alloc.
+		*/
+		static void setDirectory( const std::string & pDirectory );
+
+		/*
+		 * Returns program binary file path.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param name_ - Shader Program name.
+		 * @throws - std::bad_alloc.
+		*/
+		static const std::string getFile( const std::string & name_ );
+
+		/*
+		 * Returns 'true' if program binaries supported by the OpenGL context.
+		 *
+		 * @thread_safety - render-thread only.
+		*/
+		static const bool isSupported( ) noexcept;
+
+		/*
+		 * Returns key of the Shader Program: hash of the shaders source code & driver strings.
+		 *
+		 * @thread_safety - render-thread only.
+		 * @param vertexCode_ - Vertex Shader source code.
+		 * @param fragmentCode_ - Fragment Shader source code.
+		*/
+		static const uint64_t getKey( const std::string & vertexCode_, const std::string & fragmentCode_ ) noexcept;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Creates Shader Program from the program binary file, if made with the same key & accepted by the driver.
+		 * Rejected file removed, outdated file replaced by Save.
+		 *
+		 * @thread_safety - render-thread only.
+		 * @param name_ - Shader Program name.
+		 * @param key_ - Shader Program key.
+		 * @param program_ - output OpenGL Shader Program Object ID, set if loaded.
+		 * @return - 'true' if linked from binary, 'false' if not cached or rejected.
+		 * @throws - std::bad_alloc.
+		*/
+		static const bool Load( const std::string & name_, const uint64_t key_, GLuint & program_ );
+
+		/*
+		 * Writes binary of the linked Shader Program, replaced by FileUtils::ReplaceFile.
+		 * Program must be linked with GL_PROGRAM_BINARY_RETRIEVABLE_HINT (see GLRenderer::linkProgram).
+		 *
+		 * @thread_safety - render-thread only.
+		 * @param name_ - Shader Program name.
+		 * @param key_ - Shader Program key.
+		 * @param program_ - linked OpenGL Shader Program Object ID.
+		 * @return - 'true' if written.
+		 * @throws - std::bad_alloc.
+		*/
+		static const bool Save( const std::string & name_, const uint64_t key_, const GLuint program_ );
+
+		// -------------------------------------------------------- \\
+
+	private:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Deleted
+		// ===========================================================
+
+		/* @deleted ProgramCache constructor */
+		ProgramCache( ) = delete;
+
+		/* @deleted ProgramCache const copy constructor */
+		ProgramCache( const ProgramCache & ) = delete;
+
+		/* @deleted ProgramCache const copy assignment operator */
+		ProgramCache & operator=( const ProgramCache & ) = delete;
+
+		/* @deleted ProgramCache move constructor */
+		ProgramCache( ProgramCache && ) = delete;
+
+		/* @deleted ProgramCache move assignment operator */
+		ProgramCache & operator=( ProgramCache && ) = delete;
+
+		// -------------------------------------------------------- \\
+
+	};
+
+}
+
+// Restore structure-data alignment to default (8-byte on MSVC)
+#pragma pack( pop )
+
+#endif // !__c0de4un_program_cache_hpp__
\ No newline at end of file
@@ -0,0 +1,227 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+// HEADER
+#ifndef __c0de4un_shader_compiler_hpp__
+#include "ShaderCompiler.hpp"
+#endif // !__c0de4un_shader_compiler_hpp__
+
+// Include GLShaderProgram
+#ifndef __c0de4un_gl_shader_program_hpp__
+#include "GLShaderProgram.hpp"
+#endif // !__c0de4un_gl_shader_program_hpp__
+
+// Include Log
+#ifndef __c0de4un_log_hpp__
+#include "../../utils/log/Log.hpp"
+#endif // !__c0de4un_log_hpp__
+
+// Include ProfileScope
+#ifndef __c0de4un_profile_scope_hpp__
+#include "../../utils/profiler/ProfileScope.hpp"
+#endif // !__c0de4un_profile_scope_hpp__
+
+// Include STL
+#include <thread> // yield
+#include <exception> // exception
+
+namespace c0de4un
+{
+
+	// -------------------------------------------------------- \\
+
+	/* 'true' if driver compiler threads count set */
+	static bool threadsSet_( false );
+
+	// ===========================================================
+	// Constructor & destructor
+	// ===========================================================
+
+	/* ShaderCompiler constructor */
+	ShaderCompiler::ShaderCompiler( )
+		: mAdded( ),
+		mPending( ),
+		mFailedCount( 0 )
+	{
+	}
+
+	/* ShaderCompiler destructor, programs not unloaded */
+	ShaderCompiler::~ShaderCompiler( )
+	{
+	}
+
+	// ===========================================================
+	// Getter & Setter
+	// ===========================================================
+
+	/* Returns count of the started programs, not finished yet */
+	const std::size_t ShaderCompiler::getPendingCount( ) const noexcept
+	{ return( mPending.size( ) ); }
+
+	/* Returns count of the programs failed to start or finish */
+	const std::size_t ShaderCompiler::getFailedCount( ) const noexcept
+	{ return( mFailedCount ); }
+
+	// ===========================================================
+	// Methods
+	// ===========================================================
+
+	/*
+	 * Adds Shader Program, started by the next Start.
+	 *
+	 * @thread_safety - render-thread only.
+	 * @param shaderProgram_ - Shader Program, must be alive until finished.
+	 * @throws - std::bad_alloc.
+	*/
+	void ShaderCompiler::Add( GLShaderProgram & shaderProgram_ )
+	{ mAdded.push_back( &shaderProgram_ ); }
+
+	/*
+	 * Starts compile & link of the added programs, doesn't wait for the driver.
+	 * Driver compiler threads count set to max. on first call.
+	 *
+	 * @thread_safety - render-thread only.
+	 * @throws - std::bad_alloc.
+	*/
+	void ShaderCompiler::Start( )
+	{
+
+		// Profile
+		C0DE4UN_PROFILE_SCOPE( "ShaderCompiler::Start" );
+
+		// Driver compiler threads, implementation-specific max.
+		if ( !threadsSet_ )
+		{
+
+			if ( GLEW_KHR_parallel_shader_compile )
+				glMaxShaderCompilerThreadsKHR( 0xFFFFFFFF );
+			else if ( GLEW_ARB_parallel_shader_compile )
+				glMaxShaderCompilerThreadsARB( 0xFFFFFFFF );
+
+			threadsSet_ = true;
+
+		}
+
+		// Reserve, so started programs not lost on bad_alloc
+		mPending.reserve( mPending.size( ) + mAdded.size( ) );
+
+		// Start all, compile & link queued to the driver
+		for ( GLShaderProgram *const shaderProgram_ : mAdded )
+		{
+
+			// Guarded-Block
+			bool started_( false );
+			try
+			{ started_ = shaderProgram_->Start( ); }
+			catch ( const std::exception & exception_ )
+			{ Log::printError( exception_.what( ) ); }
+
+			// Pending or failed
+			if ( started_ )
+				mPending.push_back( shaderProgram_ );
+			else
+				mFailedCount++;
+
+		}
+
+		// Clear added
+		mAdded.clear( );
+
+	}
+
+	/*
+	 * Finishes Shader Program, exceptions (compile or link errors) logged.
+	 *
+	 * @param shaderProgram_ - started Shader Program.
+	 * @return - 'true' if loaded.
+	*/
+	const bool ShaderCompiler::finish( GLShaderProgram & shaderProgram_ ) noexcept
+	{
+
+		// Guarded-Block
+		try
+		{
+
+			// Finish
+			if ( shaderProgram_.Finish( ) )
+				return( true );
+
+			// Log
+			std::string logMsg( "ShaderCompiler::finish - failed to load Shader Program#" );
+			logMsg += shaderProgram_.getName( );
+			Log::printWarning( logMsg.c_str( ) );
+
+		}
+		catch ( const std::exception & exception_ )
+		{ Log::printError( exception_.what( ) ); }
+
+		// Return FALSE
+		return( false );
+
+	}
+
+	/*
+	 * Finishes completed programs, doesn't wait for the driver.
+	 *
+	 * @thread_safety - render-thread only.
+	 * @return - 'true' if no pending programs.
+	*/
+	const bool ShaderCompiler::Poll( ) noexcept
+	{
+
+		// Profile
+		C0DE4UN_PROFILE_SCOPE( "ShaderCompiler::Poll" );
+
+		// Finish completed, swap-remove
+		std::size_t i( 0 );
+		while ( i < mPending.size( ) )
+		{
+
+			// Still compiling or linking
+			GLShaderProgram *const shaderProgram_( mPending[i] );
+			if ( !shaderProgram_->isCompleted( ) )
+			{
+				i++;
+				continue;
+			}
+
+			// Finish
+			if ( !finish( *shaderProgram_ ) )
+				mFailedCount++;
+
+			// Remove
+			mPending[i] = mPending.back( );
+			mPending.pop_back( );
+
+		}
+
+		// Return TRUE if none pending
+		return( mPending.empty( ) );
+
+	}
+
+	/*
+	 * Finishes all started programs, waits for the driver.
+	 *
+	 * @thread_safety - render-thread only.
+	 * @return - 'true' if all programs loaded.
+	*/
+	const bool ShaderCompiler::Wait( ) noexcept
+	{
+
+		// Poll until all finished
+		while ( !Poll( ) )
+			std::this_thread::yield( );
+
+		// Return TRUE if none failed
+		return( mFailedCount == 0 );
+
+	}
+
+	// -------------------------------------------------------- \\
+
+}
\ No newline at end of file
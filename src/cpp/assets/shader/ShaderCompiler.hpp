@@ -0,0 +1,159 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_shader_compiler_hpp__
+#define __c0de4un_shader_compiler_hpp__
+
+// Include std::vector
+#ifndef __c0de4un_vector_hpp__
+#include "../../cfg/vector.hpp"
+#endif // !__c0de4un_vector_hpp__
+
+// Include STL
+#include <cstddef> // size_t
+
+// Forward-declare GLShaderProgram
+#ifndef __c0de4un_gl_shader_program_decl__
+#define __c0de4un_gl_shader_program_decl__
+namespace c0de4un { class GLShaderProgram; }
+#endif // !__c0de4un_gl_shader_program_decl__
+
+// ShaderCompiler declared
+#define __c0de4un_shader_compiler_decl__
+
+namespace c0de4un
+{
+
+	/*
+	 * ShaderCompiler - loads many Shader Programs in parallel (GL_KHR_parallel_shader_compile).
+	 *
+	 * All compiles & links started first (Start), then completion polled (GL_COMPLETION_STATUS_KHR)
+	 * & each program finished (status checked, locations resolved) once the driver completed it,
+	 * so the driver compiles programs on its threads instead of one by one.
+	 * Without the extension completion is always reported, Finish waits like GLShaderProgram::Load.
+	 *
+	 * @version 1.0
+	*/
+	class ShaderCompiler final
+	{
+
+	public:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Constructor & destructor
+		// ===========================================================
+
+		/* ShaderCompiler constructor */
+		explicit ShaderCompiler( );
+
+		/* ShaderCompiler destructor, programs not unloaded */
+		~ShaderCompiler( );
+
+		// ===========================================================
+		// Getter & Setter
+		// ===========================================================
+
+		/* Returns count of the started programs, not finished yet */
+		const std::size_t getPendingCount( ) const noexcept;
+
+		/* Returns count of the programs failed to start or finish */
+		const std::size_t getFailedCount( ) const noexcept;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Adds Shader Program, started by the next Start.
+		 *
+		 * @thread_safety - render-thread only.
+		 * @param shaderProgram_ - Shader Program, must be alive until finished.
+		 * @throws - std::bad_alloc.
+		*/
+		void Add( GLShaderProgram & shaderProgram_ );
+
+		/*
+		 * Starts compile & link of the added programs, doesn't wait for the driver.
+		 * Driver compiler threads count set to max. on first call.
+		 *
+		 * @thread_safety - render-thread only.
+		 * @throws - std::bad_alloc.
+		*/
+		void Start( );
+
+		/*
+		 * Finishes completed programs, doesn't wait for the driver.
+		 *
+		 * @thread_safety - render-thread only.
+		 * @return - 'true' if no pending programs.
+		*/
+		const bool Poll( ) noexcept;
+
+		/*
+		 * Finishes all started programs, waits for the driver.
+		 *
+		 * @thread_safety - render-thread only.
+		 * @return - 'true' if all programs loaded.
+		*/
+		const bool Wait( ) noexcept;
+
+		// -------------------------------------------------------- \\
+
+	private:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Fields
+		// ===========================================================
+
+		/* Added programs, not started */
+		std::vector<GLShaderProgram*> mAdded;
+
+		/* Started programs, not finished */
+		std::vector<GLShaderProgram*> mPending;
+
+		/* Failed programs count */
+		std::size_t mFailedCount;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Finishes Shader Program, exceptions (compile or link errors) logged.
+		 *
+		 * @param shaderProgram_ - started Shader Program.
+		 * @return - 'true' if loaded.
+		*/
+		static const bool finish( GLShaderProgram & shaderProgram_ ) noexcept;
+
+		// ===========================================================
+		// Deleted
+		// ===========================================================
+
+		/* @deleted ShaderCompiler const copy constructor */
+		ShaderCompiler( const ShaderCompiler & ) = delete;
+
+		/* @deleted ShaderCompiler const copy assignment operator */
+		ShaderCompiler & operator=( const ShaderCompiler & ) = delete;
+
+		/* @deleted ShaderCompiler move constructor */
+		ShaderCompiler( ShaderCompiler && ) = delete;
+
+		/* @deleted ShaderCompiler move assignment operator */
+		ShaderCompiler & operator=( ShaderCompiler && ) = delete;
+
+		// -------------------------------------------------------- \\
+
+	};
+
+}
+
+#endif // !__c0de4un_shader_compiler_hpp__
\ No newline at end of file
@@ -20,11 +20,39 @@
 #include "../image/PNGImage.hpp"
 #endif // !__c0de4un_png_image_hpp__
 
+// Include CompressedImage
+#ifndef __c0de4un_compressed_image_hpp__
+#include "../image/CompressedImage.hpp"
+#endif // !__c0de4un_compressed_image_hpp__
+
+// Include TextureFormats
+#ifndef __c0de4un_texture_formats_hpp__
+#include "../image/TextureFormats.hpp"
+#endif // !__c0de4un_texture_formats_hpp__
+
+// Include TextureCache
+#ifndef __c0de4un_texture_cache_hpp__
+#include "../image/TextureCache.hpp"
+#endif // !__c0de4un_texture_cache_hpp__
+
+// Include MipmapBuilder
+#ifndef __c0de4un_mipmap_builder_hpp__
+#include "../image/MipmapBuilder.hpp"
+#endif // !__c0de4un_mipmap_builder_hpp__
+
 // Include Log
 #ifndef __c0de4un_log_hpp__
 #include "../../utils/log/Log.hpp"
 #endif // !__c0de4un_log_hpp__
 
+// Include ProfileScope
+#ifndef __c0de4un_profile_scope_hpp__
+#include "../../utils/profiler/ProfileScope.hpp"
+#endif // !__c0de4un_profile_scope_hpp__
+
+// Include STL
+#include <stdexcept> // runtime_error
+
 namespace c0de4un
 {
 
@@ -38,23 +66,27 @@ namespace c0de4un
 	 * GLTexture2D constructor
 	 *
 	 * @param pName - Name.
-	 * @param pFile - Image-file path.
+	 * @param pFile - Image-file path (PNG, DDS or KTX).
+	 * @param pCompress - 'true' to compress PNG Image (lossy, see BCEncoder).
 	*/
-	GLTexture2D::GLTexture2D( const std::string & pName, const std::string & pFile )
+	GLTexture2D::GLTexture2D( const std::string & pName, const std::string & pFile, const bool pCompress )
 		: mName( pName ),
 		mFile( pFile ),
+		mCompress( pCompress ),
 		mTextureObject( 0 ),
-		mImage( nullptr )
+		mImage( nullptr ),
+		mCompressed( nullptr ),
+		mState( STATE_UNLOADED )
 	{
 
 #ifdef DEBUG // DEBUG
 		// Check Name
 		if ( mName.empty( ) )
-			throw std::exception( "GLTexture2D::constructor - Name is null" );
+			throw std::runtime_error( "GLTexture2D::constructor - Name is null" );
 
 		// Check Image file path
 		if ( pFile.empty( ) )
-			throw std::exception( "GLTexture2D::constructor - Path to the image is null" );
+			throw std::runtime_error( "GLTexture2D::constructor - Path to the image is null" );
 #endif // DEBUG
 
 		// Log
@@ -87,6 +119,10 @@ namespace c0de4un
 
 		}
 
+		// Release compressed image
+		delete mCompressed;
+		mCompressed = nullptr;
+
 	}
 
 	// ===========================================================
@@ -97,12 +133,57 @@ namespace c0de4un
 	const GLuint & GLTexture2D::getTextureObject( ) const noexcept
 	{ return( mTextureObject ); }
 
+	/*
+	 * Returns loading state (STATE_UNLOADED, STATE_LOADED, etc).
+	 *
+	 * @thread_safety - thread-safe.
+	*/
+	const unsigned char GLTexture2D::getState( ) const noexcept
+	{ return( mState.load( std::memory_order_acquire ) ); }
+
+	/*
+	 * Returns 'true' if uploaded to OpenGL.
+	 *
+	 * @thread_safety - thread-safe.
+	*/
+	const bool GLTexture2D::isLoaded( ) const noexcept
+	{ return( mState.load( std::memory_order_acquire ) == STATE_LOADED ); }
+
+	/*
+	 * Returns decoded PNG Image, null if not decoded or already uploaded.
+	 *
+	 * @thread_safety - render-thread only, after Decode.
+	*/
+	const PNGImage *const GLTexture2D::getImage( ) const noexcept
+	{ return( mState.load( std::memory_order_acquire ) == STATE_DECODED ? mImage : nullptr ); }
+
+	/*
+	 * Returns bytes uploaded by Upload: compressed blocks of all levels or PNG Image pixels, 0 if not decoded.
+	 *
+	 * @thread_safety - render-thread only, after Decode.
+	*/
+	const uint32_t GLTexture2D::getDecodedLength( ) const noexcept
+	{
+
+		// Cancel, if not decoded
+		if ( mState.load( std::memory_order_acquire ) != STATE_DECODED )
+			return( 0 );
+
+		// Compressed blocks
+		if ( mCompressed != nullptr )
+			return( static_cast<uint32_t>( mCompressed->mBytes.size( ) ) );
+
+		// PNG Image pixels
+		return( mImage != nullptr ? mImage->mDataLength : 0 );
+
+	}
+
 	// ===========================================================
 	// Methods
 	// ===========================================================
 
 	/*
-	 * Load this 2D Texture.
+	 * Load this 2D Texture (Decode & Upload on the calling thread).
 	 *
 	 * @thread_safety - render-thread only.
 	 * @return - 'true' if OK.
@@ -112,7 +193,7 @@ namespace c0de4un
 	{
 
 		// Cancel
-		if ( mTextureObject > 0 )
+		if ( isLoaded( ) )
 			return( true );
 
 		// Log
@@ -121,70 +202,385 @@ namespace c0de4un
 		logMsg += "::Load";
 		Log::printDebug( logMsg.c_str( ) );
 
-		// Create PNGImage instance
-		if ( mImage == nullptr )
-			mImage = new PNGImage( mFile );
+		// Loading state
+		const unsigned char state_( mState.load( std::memory_order_acquire ) );
+
+		// Cancel, if decoding by AssetLoader
+		if ( state_ == STATE_QUEUED )
+			return( false );
+
+		// Decode & Upload
+		return( ( state_ == STATE_DECODED || Decode( ) ) && Upload( ) );
+
+	}
+
+	/*
+	 * Marks this 2D Texture as queued for decoding.
+	 *
+	 * @thread_safety - thread-safe.
+	 * @return - 'false' if already queued, decoded or loaded.
+	*/
+	const bool GLTexture2D::Queue( ) noexcept
+	{
+
+		// Expected state
+		unsigned char state_( STATE_UNLOADED );
+
+		// Unloaded -> Queued
+		if ( mState.compare_exchange_strong( state_, STATE_QUEUED, std::memory_order_acq_rel ) )
+			return( true );
 
-		// Load PNG Image
-		if ( !mImage->Load( ) )
+		// Retry failed
+		state_ = STATE_FAILED;
+		return( mState.compare_exchange_strong( state_, STATE_QUEUED, std::memory_order_acq_rel ) );
+
+	}
+
+	/*
+	 * Decodes PNG Image, or loads compressed image, no OpenGL calls.
+	 *
+	 * @thread_safety - any thread, not concurrently with Upload or Unload.
+	 * @return - 'true' if OK.
+	 * @throws - can throw exception.
+	*/
+	const bool GLTexture2D::Decode( )
+	{
+
+		// Profile
+		C0DE4UN_PROFILE_SCOPE( "GLTexture2D::Decode" );
+
+		// Guarded-Block
+		try
 		{
 
-			// Log
-			logMsg = "GLTexture2D#";
-			logMsg += mName;
-			logMsg += "::Load - failed to load PNG Image #";
-			logMsg += mFile;
-			Log::printDebug( logMsg.c_str( ) );
+			// Decoded
+			bool decoded_( false );
+
+			// DDS or KTX file
+			if ( CompressedImage::isCompressedFile( mFile ) )
+				decoded_ = loadCompressed( mFile, 0 );
+			else
+			{
+
+				// Compress, if enabled & BC1/BC3 supported by the context (see TextureFormats::Detect)
+				const bool compress_( mCompress && TextureFormats::isSupported( GL_COMPRESSED_RGBA_S3TC_DXT1_EXT )
+					&& TextureFormats::isSupported( GL_COMPRESSED_RGBA_S3TC_DXT5_EXT ) );
+
+				// Source hash, compressed cooked file valid only for the same source
+				uint64_t sourceHash_( 0 );
+				const bool hashed_( compress_ && TextureCache::HashFile( mFile, sourceHash_ ) );
+
+				// Use compressed cooked file, no decoding & encoding
+				decoded_ = hashed_ && loadCompressed( TextureCache::getCompressedFile( mFile ), sourceHash_ );
+
+				// Decode PNG Image
+				if ( !decoded_ )
+				{
+
+					// Create PNGImage instance
+					if ( mImage == nullptr )
+						mImage = new PNGImage( mFile );
+
+					// Load PNG Image, source hashed once. Not cooked, if compressed image cooked instead
+					decoded_ = hashed_ ? mImage->Load( sourceHash_, false ) : mImage->Load( );
+
+					// Encode & cook compressed image, PNG Image uploaded & cooked if failed
+					if ( decoded_ && hashed_ )
+					{
+						mCompressed = new CompressedImage( TextureCache::getCompressedFile( mFile ) );
+						if ( TextureCache::CookCompressed( *mImage, sourceHash_, *mCompressed ) )
+						{
+							delete mImage;
+							mImage = nullptr;
+						}
+						else
+						{
+							delete mCompressed;
+							mCompressed = nullptr;
+							mImage->Cook( sourceHash_ );
+						}
+					}
+
+				}
+
+			}
+
+			// Failed
+			if ( !decoded_ )
+			{
+
+				// Log
+				std::string logMsg( "GLTexture2D#" );
+				logMsg += mName;
+				logMsg += "::Decode - failed to load image #";
+				logMsg += mFile;
+				Log::printDebug( logMsg.c_str( ) );
+
+				// Release images
+				delete mImage;
+				mImage = nullptr;
+				delete mCompressed;
+				mCompressed = nullptr;
+
+				// Set state
+				mState.store( STATE_FAILED, std::memory_order_release );
+
+				// Return FALSE
+				return( false );
+
+			}
 
-			// Unload
-			Unload( );
+		}
+		catch ( ... )
+		{
 
-			// Cancel
-			return( false );
+			// Set state
+			mState.store( STATE_FAILED, std::memory_order_release );
+
+			// Re-throw
+			throw;
 
 		}
 
+		// Set state, image published to the uploading thread
+		mState.store( STATE_DECODED, std::memory_order_release );
+
+		// Return TRUE
+		return( true );
+
+	}
+
+	/*
+	 * Uploads decoded PNG Image or compressed image to OpenGL & releases it.
+	 * Binds GL_TEXTURE_2D directly, GLStateCache must be invalidated.
+	 *
+	 * @thread_safety - render-thread only.
+	 * @return - 'true' if OK.
+	 * @throws - can throw exception.
+	*/
+	const bool GLTexture2D::Upload( )
+	{
+
+		// Profile
+		C0DE4UN_PROFILE_SCOPE( "GLTexture2D::Upload" );
+
+		// Cancel
+		if ( isLoaded( ) )
+			return( true );
+
+		// Cancel, if not decoded
+		if ( mState.load( std::memory_order_acquire ) != STATE_DECODED || ( mImage == nullptr && mCompressed == nullptr ) )
+			return( false );
+
+		// Create 2D-Texture Object & upload Image bytes from Local Memory (App Space) to OpenGL Memory (GPU/VRAM)
+		if ( mCompressed != nullptr )
+			createCompressedTexture( );
+		else
+			createTexture( mImage->mBytes );
+
+		// Generate mipmaps, release PNGImage & set state
+		Complete( );
+
+		// Unbind Texture
+		glBindTexture( GL_TEXTURE_2D, 0 );
+
+		// Return TRUE
+		return( true );
+
+	}
+
+	/*
+	 * Creates OpenGL 2D-Texture Object & storage of the decoded PNG Image size, no pixels.
+	 * Pixels uploaded later (see TextureUploader), state stays decoded until Complete.
+	 * Binds GL_TEXTURE_2D directly, GLStateCache must be invalidated.
+	 *
+	 * @thread_safety - render-thread only.
+	 * @return - 'true' if OK, 'false' if not decoded or compressed.
+	*/
+	const bool GLTexture2D::Allocate( ) noexcept
+	{
+
+		// Cancel, if not decoded
+		if ( mState.load( std::memory_order_acquire ) != STATE_DECODED || mImage == nullptr )
+			return( false );
+
+		// Create 2D-Texture Object & storage
+		createTexture( nullptr );
+
+		// Return TRUE
+		return( true );
+
+	}
+
+	/*
+	 * Marks this 2D Texture as loaded & releases decoded image, after all pixels uploaded.
+	 * Mipmaps of the PNG Image generated by the GPU (compressed images store own levels).
+	 * Binds GL_TEXTURE_2D directly, GLStateCache must be invalidated.
+	 *
+	 * @thread_safety - render-thread only.
+	*/
+	void GLTexture2D::Complete( ) noexcept
+	{
+
+		// Generate mipmaps from the uploaded level #0, so minified sprites don't alias
+		if ( mImage != nullptr && mTextureObject > 0 )
+			generateMipmaps( );
+
+		// Unload & release images, pixels in OpenGL memory now
+		delete mImage;
+		mImage = nullptr;
+		delete mCompressed;
+		mCompressed = nullptr;
+
+		// Set state
+		mState.store( STATE_LOADED, std::memory_order_release );
+
+	}
+
+	/*
+	 * Creates (if not created) & binds 2D-Texture Object, specifies storage & parameters.
+	 *
+	 * @param pixels_ - PNG Image pixels, or null to allocate storage only.
+	*/
+	void GLTexture2D::createTexture( const void *const pixels_ ) noexcept
+	{
+
 		// Create 2D-Texture Object
-		glCreateTextures( GL_TEXTURE_2D, 1, &mTextureObject );
+		if ( mTextureObject == 0 )
+			glGenTextures( 1, &mTextureObject );
 
 		// Bind 2D-Texture Object
 		glBindTexture( GL_TEXTURE_2D, mTextureObject );
 
-		// Mark that Texture Image Data is Tightly Packed (1 byte stride)
-		glPixelStorei( GL_UNPACK_ALIGNMENT, 1 );
+		// Image rows aligned to 4 bytes by PNGLoader
+		glPixelStorei( GL_UNPACK_ALIGNMENT, 4 );
 
 		// OpenGL Color Format
 		const GLenum & glColorForamt_ = mImage->mColorFormat;
 
-		// Upload Image bytes from Local Memory (App Space) to OpenGL Memory (GPU/VRAM)
-		glTexImage2D( GL_TEXTURE_2D, 0, glColorForamt_, mImage->mSize[0], mImage->mSize[1], 0, glColorForamt_, GL_UNSIGNED_BYTE, mImage->mBytes );
+		// Specify storage, upload Image bytes if set
+		glTexImage2D( GL_TEXTURE_2D, 0, glColorForamt_, mImage->mSize[0], mImage->mSize[1], 0, glColorForamt_, GL_UNSIGNED_BYTE, pixels_ );
+
+		// Set parameters, one level
+		setParameters( 0 );
+
+	}
+
+	/*
+	 * Creates (if not created) & binds 2D-Texture Object, uploads compressed image levels & sets parameters.
+	*/
+	void GLTexture2D::createCompressedTexture( ) noexcept
+	{
+
+		// Create 2D-Texture Object
+		if ( mTextureObject == 0 )
+			glGenTextures( 1, &mTextureObject );
+
+		// Bind 2D-Texture Object
+		glBindTexture( GL_TEXTURE_2D, mTextureObject );
+
+		// Levels count
+		const GLint levels_( static_cast<GLint>( mCompressed->mLevels.size( ) ) );
+
+		// Upload levels, blocks as stored
+		for ( GLint i = 0; i < levels_; i++ )
+		{
+			const ImageLevel & level_ = mCompressed->mLevels[i];
+			glCompressedTexImage2D( GL_TEXTURE_2D, i, mCompressed->mFormat, level_.width_, level_.height_, 0, level_.size_, mCompressed->getLevelData( i ) );
+		}
+
+		// Set parameters
+		setParameters( levels_ - 1 );
+
+	}
+
+	/*
+	 * Binds 2D-Texture Object, generates full mipmap chain (glGenerateMipmap) of the PNG Image size & sets parameters.
+	*/
+	void GLTexture2D::generateMipmaps( ) noexcept
+	{
+
+		// Bind 2D-Texture Object
+		glBindTexture( GL_TEXTURE_2D, mTextureObject );
+
+		// Generate levels
+		glGenerateMipmap( GL_TEXTURE_2D );
+
+		// Set parameters, all levels
+		setParameters( static_cast<GLint>( MipmapBuilder::getLevelsCount( mImage->mSize[0], mImage->mSize[1] ) ) - 1 );
 
-		// Set Texture Min. Filter to Nearest, cause smoothing not required (zooming, etc)
-		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR );
+	}
+
+	/*
+	 * Sets parameters of the bound 2D-Texture Object.
+	 * Ignored while Sampler Object bound to the unit (see SamplerCache), except GL_TEXTURE_MAX_LEVEL.
+	 *
+	 * @param maxLevel_ - last mipmap level.
+	*/
+	void GLTexture2D::setParameters( const GLint maxLevel_ ) noexcept
+	{
+
+		// Set last mipmap level, so texture complete without all levels
+		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, maxLevel_ );
+
+		// Set Texture Min. Filter to Linear, trilinear if mipmaps loaded
+		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, maxLevel_ > 0 ? GL_LINEAR_MIPMAP_LINEAR : GL_LINEAR );
 
 		// Set Texture Mag. Filter to Nearest, cause smoothing not required (zooming, etc)
 		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
 
 		// Set Texture S (U/X) Wrap-Method to Clamp to edge (repeat and others not required)
-		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_BORDER );
+		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE );
 
 		// Set Texture T (V/Y) Wrap-Method to Clamp to edge (repeat and others not required)
-		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_BORDER );
+		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE );
 
-		// Unbind Texture
-		glBindTexture( GL_TEXTURE_2D, 0 );
+	}
 
-		// Unload & release PNGImage
-		//delete mImage;
-		//mImage = nullptr;
+	/*
+	 * Loads compressed image, if the format supported by the context.
+	 *
+	 * @param file_ - DDS or KTX file path.
+	 * @param sourceHash_ - source image hash of the cooked file, 0 if not cooked.
+	 * @return - 'true' if OK.
+	 * @throws - can throw exception.
+	*/
+	const bool GLTexture2D::loadCompressed( const std::string & file_, const uint64_t sourceHash_ )
+	{
 
-		// Return TRUE
-		return( true );
+		// Create CompressedImage instance
+		if ( mCompressed == nullptr )
+			mCompressed = new CompressedImage( file_ );
+
+		// Load, check cooked source & format support
+		const bool loaded_( mCompressed->Load( ) && mCompressed->mSourceHash == sourceHash_ );
+		const bool supported_( loaded_ && TextureFormats::isSupported( mCompressed->mFormat ) );
+
+		// Log not supported format (cooked files checked before)
+		if ( loaded_ && !supported_ )
+		{
+			std::string logMsg( "GLTexture2D#" );
+			logMsg += mName;
+			logMsg += "::loadCompressed - format not supported by OpenGL context #";
+			logMsg += file_;
+			Log::printWarning( logMsg.c_str( ) );
+		}
+
+		// Release on fail
+		if ( !supported_ )
+		{
+			delete mCompressed;
+			mCompressed = nullptr;
+		}
+
+		// Return result
+		return( supported_ );
 
 	}
 
 	/*
 	 * Unload 2D Texture.
+	 * Must not be called while decoding (see AssetLoader::Wait).
 	 *
 	 * @thread_safety - render-thread only.
 	 * @throws - can throw exception.
@@ -216,6 +612,13 @@ namespace c0de4un
 
 		}
 
+		// Release compressed image
+		delete mCompressed;
+		mCompressed = nullptr;
+
+		// Set state
+		mState.store( STATE_UNLOADED, std::memory_order_release );
+
 	}
 
 	// -------------------------------------------------------- \\
@@ -18,12 +18,22 @@
 #include "../../cfg/opengl.hpp"
 #endif // !__c0de4un_opengl_hpp__
 
+// Include STL
+#include <atomic> // atomic
+#include <cstdint> // uint64_t
+
 // Forward-declared PNGImage
 #ifndef __c0de4un_png_image_decl__
 #define __c0de4un_png_image_decl__
 namespace c0de4un { class PNGImage; }
 #endif // !__c0de4un_png_image_decl__
 
+// Forward-declared CompressedImage
+#ifndef __c0de4un_compressed_image_decl__
+#define __c0de4un_compressed_image_decl__
+namespace c0de4un { class CompressedImage; }
+#endif // !__c0de4un_compressed_image_decl__
+
 // GLTexture2D declared
 #define __c0de4un_gl_texture_2D_decl__
 
@@ -33,6 +43,16 @@ namespace c0de4un
 	/*
 	 * GLTexture2D - 2D texture asset (game resource) for OpenGL.
 	 *
+	 * Loading split to Decode (PNG, any thread) & Upload (OpenGL, render-thread),
+	 * so AssetLoader can decode on worker threads & upload later.
+	 * Upload can be streamed by TextureUploader: Allocate, pixels uploaded in parts, Complete.
+	 *
+	 * DDS & KTX files uploaded compressed (glCompressedTexImage2D), if the format supported by the context.
+	 * PNG Image encoded to BC1/BC3 on Decode (cooked to DDS, see TextureCache) if compression enabled
+	 * & S3TC supported, uploaded uncompressed otherwise.
+	 * Full mipmap chain: generated by the GPU for PNG Image, filtered on cook for compressed PNG,
+	 * as stored for DDS & KTX. Filtering & wrapping set by the renderer Sampler Object (see SamplerCache).
+	 *
 	 * @version 1.0.0
 	*/
 	class GLTexture2D final
@@ -46,12 +66,30 @@ namespace c0de4un
 		// Constants
 		// ===========================================================
 
+		/* Not loaded */
+		static constexpr unsigned char STATE_UNLOADED = 0;
+
+		/* Queued for decoding (AssetLoader) */
+		static constexpr unsigned char STATE_QUEUED = 1;
+
+		/* Decoded, waiting for Upload */
+		static constexpr unsigned char STATE_DECODED = 2;
+
+		/* Uploaded to OpenGL */
+		static constexpr unsigned char STATE_LOADED = 3;
+
+		/* Decoding or Upload failed */
+		static constexpr unsigned char STATE_FAILED = 4;
+
 		/* Name */
 		const std::string mName;
 
 		/* Image path*/
 		const std::string mFile;
 
+		/* PNG Image compressed to BC1/BC3, if supported */
+		const bool mCompress;
+
 		// ===========================================================
 		// Constructor & destructor
 		// ===========================================================
@@ -60,9 +98,10 @@ namespace c0de4un
 		 * GLTexture2D constructor
 		 *
 		 * @param pName - Name.
-		 * @param pFile - Image-file path.
+		 * @param pFile - Image-file path (PNG, DDS or KTX).
+		 * @param pCompress - 'true' to compress PNG Image (lossy, see BCEncoder).
 		*/
-		explicit GLTexture2D( const std::string & pName, const std::string & pFile );
+		explicit GLTexture2D( const std::string & pName, const std::string & pFile, const bool pCompress = false );
 
 		/* GLTexture2D destructor */
 		~GLTexture2D( );
@@ -74,12 +113,40 @@ namespace c0de4un
 		/* Returns 2D Texture Object ID */
 		const GLuint & getTextureObject( ) const noexcept;
 
+		/*
+		 * Returns loading state (STATE_UNLOADED, STATE_LOADED, etc).
+		 *
+		 * @thread_safety - thread-safe.
+		*/
+		const unsigned char getState( ) const noexcept;
+
+		/*
+		 * Returns 'true' if uploaded to OpenGL.
+		 *
+		 * @thread_safety - thread-safe.
+		*/
+		const bool isLoaded( ) const noexcept;
+
+		/*
+		 * Returns decoded PNG Image, null if not decoded or already uploaded.
+		 *
+		 * @thread_safety - render-thread only, after Decode.
+		*/
+		const PNGImage *const getImage( ) const noexcept;
+
+		/*
+		 * Returns bytes uploaded by Upload: compressed blocks of all levels or PNG Image pixels, 0 if not decoded.
+		 *
+		 * @thread_safety - render-thread only, after Decode.
+		*/
+		const uint32_t getDecodedLength( ) const noexcept;
+
 		// ===========================================================
 		// Methods
 		// ===========================================================
 
 		/*
-		 * Load this 2D Texture.
+		 * Load this 2D Texture (Decode & Upload on the calling thread).
 		 *
 		 * @thread_safety - render-thread only.
 		 * @return - 'true' if OK.
@@ -87,8 +154,55 @@ namespace c0de4un
 		*/
 		const bool Load( );
 
+		/*
+		 * Marks this 2D Texture as queued for decoding.
+		 *
+		 * @thread_safety - thread-safe.
+		 * @return - 'false' if already queued, decoded or loaded.
+		*/
+		const bool Queue( ) noexcept;
+
+		/*
+		 * Decodes PNG Image, or loads compressed image, no OpenGL calls.
+		 *
+		 * @thread_safety - any thread, not concurrently with Upload or Unload.
+		 * @return - 'true' if OK.
+		 * @throws - can throw exception.
+		*/
+		const bool Decode( );
+
+		/*
+		 * Uploads decoded PNG Image or compressed image to OpenGL & releases it.
+		 * Binds GL_TEXTURE_2D directly, GLStateCache must be invalidated.
+		 *
+		 * @thread_safety - render-thread only.
+		 * @return - 'true' if OK.
+		 * @throws - can throw exception.
+		*/
+		const bool Upload( );
+
+		/*
+		 * Creates OpenGL 2D-Texture Object & storage of the decoded PNG Image size, no pixels.
+		 * Pixels uploaded later (see TextureUploader), state stays decoded until Complete.
+		 * Binds GL_TEXTURE_2D directly, GLStateCache must be invalidated.
+		 *
+		 * @thread_safety - render-thread only.
+		 * @return - 'true' if OK, 'false' if not decoded or compressed.
+		*/
+		const bool Allocate( ) noexcept;
+
+		/*
+		 * Marks this 2D Texture as loaded & releases decoded image, after all pixels uploaded.
+		 * Mipmaps of the PNG Image generated by the GPU (compressed images store own levels).
+		 * Binds GL_TEXTURE_2D directly, GLStateCache must be invalidated.
+		 *
+		 * @thread_safety - render-thread only.
+		*/
+		void Complete( ) noexcept;
+
 		/*
 		 * Unload 2D Texture.
+		 * Must not be called while decoding (see AssetLoader::Wait).
 		 *
 		 * @thread_safety - render-thread only.
 		 * @throws - can throw exception.
@@ -108,9 +222,54 @@ namespace c0de4un
 		/* OpenGL Texture Object ID */
 		GLuint mTextureObject;
 
-		/* PNGImage */
+		/* PNGImage, released after Upload */
 		PNGImage * mImage;
 
+		/* Compressed image (DDS, KTX or encoded PNG Image), released after Upload */
+		CompressedImage * mCompressed;
+
+		/* Loading state */
+		std::atomic<unsigned char> mState;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Creates (if not created) & binds 2D-Texture Object, specifies storage & parameters.
+		 *
+		 * @param pixels_ - PNG Image pixels, or null to allocate storage only.
+		*/
+		void createTexture( const void *const pixels_ ) noexcept;
+
+		/*
+		 * Creates (if not created) & binds 2D-Texture Object, uploads compressed image levels & sets parameters.
+		*/
+		void createCompressedTexture( ) noexcept;
+
+		/*
+		 * Binds 2D-Texture Object, generates full mipmap chain (glGenerateMipmap) of the PNG Image size & sets parameters.
+		*/
+		void generateMipmaps( ) noexcept;
+
+		/*
+		 * Sets parameters of the bound 2D-Texture Object.
+		 * Ignored while Sampler Object bound to the unit (see SamplerCache), except GL_TEXTURE_MAX_LEVEL.
+		 *
+		 * @param maxLevel_ - last mipmap level.
+		*/
+		static void setParameters( const GLint maxLevel_ ) noexcept;
+
+		/*
+		 * Loads compressed image, if the format supported by the context.
+		 *
+		 * @param file_ - DDS or KTX file path.
+		 * @param sourceHash_ - source image hash of the cooked file, 0 if not cooked.
+		 * @return - 'true' if OK.
+		 * @throws - can throw exception.
+		*/
+		const bool loadCompressed( const std::string & file_, const uint64_t sourceHash_ );
+
 		// ===========================================================
 		// Deleted
 		// ===========================================================
@@ -0,0 +1,637 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+// HEADER
+#ifndef __c0de4un_texture_array_pool_hpp__
+#include "TextureArrayPool.hpp"
+#endif // !__c0de4un_texture_array_pool_hpp__
+
+// Include PNGImage
+#ifndef __c0de4un_png_image_hpp__
+#include "../image/PNGImage.hpp"
+#endif // !__c0de4un_png_image_hpp__
+
+// Include Log
+#ifndef __c0de4un_log_hpp__
+#include "../../utils/log/Log.hpp"
+#endif // !__c0de4un_log_hpp__
+
+// Include STL
+#include <utility> // move
+
+namespace c0de4un
+{
+
+	// -------------------------------------------------------- \\
+
+	// ===========================================================
+	// Constructor & destructor
+	// ===========================================================
+
+	/*
+	 * TextureArrayPool constructor.
+	 *
+	 * @param initialLayers_ - layers of new 2D-Texture Array.
+	*/
+	TextureArrayPool::TextureArrayPool( const uint32_t initialLayers_ )
+		: mInitialLayers( initialLayers_ > 0 ? initialLayers_ : 1 ),
+		mArrays( ),
+		mShared( ),
+		mMaxLayers( 0 ),
+		mFramebuffer( 0 ),
+		mPixels( )
+	{
+
+		// Log
+		Log::printDebug( "TextureArrayPool::constructor" );
+
+	}
+
+	/* TextureArrayPool destructor */
+	TextureArrayPool::~TextureArrayPool( )
+	{
+
+		// Log (2D-Texture Arrays deleted by Unload)
+		Log::printDebug( "TextureArrayPool::destructor" );
+
+	}
+
+	// ===========================================================
+	// Getter & Setter
+	// ===========================================================
+
+	/* Returns 2D-Texture Arrays count */
+	const uint32_t TextureArrayPool::getArraysCount( ) const noexcept
+	{ return( static_cast<uint32_t>( mArrays.size( ) ) ); }
+
+	/* Returns used layers count of all 2D-Texture Arrays */
+	const uint32_t TextureArrayPool::getUsedLayers( ) const noexcept
+	{
+
+		// Used layers
+		uint32_t used_( 0 );
+
+		// 2D-Texture Arrays
+		for ( const std::pair<const uint64_t, Array> & pair_ : mArrays )
+			used_ += pair_.second.capacity_ - static_cast<uint32_t>( pair_.second.freeLayers_.size( ) );
+
+		// Return used layers
+		return( used_ );
+
+	}
+
+	// ===========================================================
+	// Methods
+	// ===========================================================
+
+	/*
+	 * Allocates storage of the bound 2D-Texture Array.
+	 *
+	 * @param width_ - layer width.
+	 * @param height_ - layer height.
+	 * @param layers_ - layers count.
+	*/
+	void TextureArrayPool::allocateStorage( const uint32_t width_, const uint32_t height_, const uint32_t layers_ ) noexcept
+	{
+
+		// Allocate storage, layers uploaded later
+		glTexImage3D( GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, width_, height_, layers_, 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr );
+
+	}
+
+	/*
+	 * Creates 2D-Texture Array.
+	 *
+	 * @param array_ - output Array.
+	 * @param width_ - layer width.
+	 * @param height_ - layer height.
+	 * @return - 'true' if OK.
+	 * @throws - std::bad_alloc.
+	*/
+	const bool TextureArrayPool::create( Array & array_, const uint32_t width_, const uint32_t height_ )
+	{
+
+		// Layers limit
+		if ( mMaxLayers < 1 )
+			glGetIntegerv( GL_MAX_ARRAY_TEXTURE_LAYERS, &mMaxLayers );
+
+		// Layers count
+		array_.capacity_ = mInitialLayers < static_cast<uint32_t>( mMaxLayers ) ? mInitialLayers : static_cast<uint32_t>( mMaxLayers );
+
+		// Free layers, #0 used first
+		array_.freeLayers_.reserve( array_.capacity_ );
+		for ( uint32_t layer_ = array_.capacity_; layer_ > 0; layer_-- )
+			array_.freeLayers_.push_back( layer_ - 1 );
+
+		// Create 2D-Texture Array Object
+		glGenTextures( 1, &array_.textureObject_ );
+
+		// Check 2D-Texture Array Object
+		if ( array_.textureObject_ < 1 )
+		{
+
+			// Log
+			Log::printError( "TextureArrayPool::create - failed to create 2D-Texture Array !" );
+
+			// Return FALSE
+			return( false );
+
+		}
+
+		// Bind 2D-Texture Array Object
+		glBindTexture( GL_TEXTURE_2D_ARRAY, array_.textureObject_ );
+
+		// Allocate storage
+		allocateStorage( width_, height_, array_.capacity_ );
+
+		// Set Texture Min. & Mag. Filters to Linear, no mip-maps
+		glTexParameteri( GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MIN_FILTER, GL_LINEAR );
+		glTexParameteri( GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAG_FILTER, GL_LINEAR );
+		glTexParameteri( GL_TEXTURE_2D_ARRAY, GL_TEXTURE_MAX_LEVEL, 0 );
+
+		// Set Texture S & T Wrap-Methods to Clamp to edge
+		glTexParameteri( GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_S, GL_CLAMP_TO_EDGE );
+		glTexParameteri( GL_TEXTURE_2D_ARRAY, GL_TEXTURE_WRAP_T, GL_CLAMP_TO_EDGE );
+
+		// Unbind 2D-Texture Array
+		glBindTexture( GL_TEXTURE_2D_ARRAY, 0 );
+
+		// Return TRUE
+		return( true );
+
+	}
+
+	/*
+	 * Copies layers between 2D-Texture Arrays of the same size (on the GPU).
+	 *
+	 * @param source_ - source 2D Texture Array Object ID.
+	 * @param destination_ - destination 2D Texture Array Object ID.
+	 * @param layers_ - layers count, from #0.
+	 * @param width_ - layer width.
+	 * @param height_ - layer height.
+	*/
+	void TextureArrayPool::copyLayers( const GLuint source_, const GLuint destination_, const uint32_t layers_, const uint32_t width_, const uint32_t height_ ) noexcept
+	{
+
+		// Bind Framebuffer as read source
+		glBindFramebuffer( GL_READ_FRAMEBUFFER, mFramebuffer );
+		glReadBuffer( GL_COLOR_ATTACHMENT0 );
+
+		// Bind destination
+		glBindTexture( GL_TEXTURE_2D_ARRAY, destination_ );
+
+		// Layers
+		for ( uint32_t layer_ = 0; layer_ < layers_; layer_++ )
+		{
+
+			// Attach source layer
+			glFramebufferTextureLayer( GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, source_, 0, layer_ );
+
+			// Copy to the destination layer
+			glCopyTexSubImage3D( GL_TEXTURE_2D_ARRAY, 0, 0, 0, layer_, 0, 0, width_, height_ );
+
+		}
+
+		// Detach source
+		glFramebufferTextureLayer( GL_READ_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, 0, 0, 0 );
+
+		// Restore default Framebuffer
+		glBindFramebuffer( GL_READ_FRAMEBUFFER, 0 );
+
+	}
+
+	/*
+	 * Doubles layers count, Texture Object ID & layers data kept.
+	 *
+	 * @param array_ - Array.
+	 * @param width_ - layer width.
+	 * @param height_ - layer height.
+	 * @return - 'false' if layers limit reached.
+	 * @throws - std::bad_alloc.
+	*/
+	const bool TextureArrayPool::grow( Array & array_, const uint32_t width_, const uint32_t height_ )
+	{
+
+		// Cancel, if layers limit reached
+		if ( array_.capacity_ >= static_cast<uint32_t>( mMaxLayers ) )
+			return( false );
+
+		// New layers count
+		const uint32_t capacity_( array_.capacity_ * 2 < static_cast<uint32_t>( mMaxLayers ) ? array_.capacity_ * 2 : static_cast<uint32_t>( mMaxLayers ) );
+
+		// Reserve free layers, before OpenGL objects changed
+		array_.freeLayers_.reserve( capacity_ - array_.capacity_ );
+
+		// Create Framebuffer Object
+		if ( mFramebuffer < 1 )
+			glGenFramebuffers( 1, &mFramebuffer );
+
+		// Temporary 2D-Texture Array, holds layers while storage re-allocated
+		GLuint copy_( 0 );
+		glGenTextures( 1, &copy_ );
+
+		// Cancel
+		if ( mFramebuffer < 1 || copy_ < 1 )
+		{
+
+			// Log
+			Log::printError( "TextureArrayPool::grow - failed to create OpenGL objects !" );
+
+			// Release
+			if ( copy_ > 0 )
+				glDeleteTextures( 1, &copy_ );
+
+			// Return FALSE
+			return( false );
+
+		}
+
+		// Allocate temporary storage
+		glBindTexture( GL_TEXTURE_2D_ARRAY, copy_ );
+		allocateStorage( width_, height_, array_.capacity_ );
+
+		// Copy layers out
+		copyLayers( array_.textureObject_, copy_, array_.capacity_, width_, height_ );
+
+		// Re-allocate storage, same Texture Object ID (parameters kept)
+		glBindTexture( GL_TEXTURE_2D_ARRAY, array_.textureObject_ );
+		allocateStorage( width_, height_, capacity_ );
+
+		// Copy layers back
+		copyLayers( copy_, array_.textureObject_, array_.capacity_, width_, height_ );
+
+		// Unbind 2D-Texture Array
+		glBindTexture( GL_TEXTURE_2D_ARRAY, 0 );
+
+		// Delete temporary 2D-Texture Array
+		glDeleteTextures( 1, &copy_ );
+
+		// Add free layers, lowest used first
+		for ( uint32_t layer_ = capacity_; layer_ > array_.capacity_; layer_-- )
+			array_.freeLayers_.push_back( layer_ - 1 );
+
+		// Set layers count
+		array_.capacity_ = capacity_;
+
+#ifdef DEBUG // DEBUG
+		// Log
+		std::string logMsg( "TextureArrayPool::grow - " );
+		logMsg += std::to_string( width_ );
+		logMsg += "x";
+		logMsg += std::to_string( height_ );
+		logMsg += " layers: ";
+		logMsg += std::to_string( capacity_ );
+		Log::printDebug( logMsg.c_str( ) );
+#endif // DEBUG
+
+		// Return TRUE
+		return( true );
+
+	}
+
+	/*
+	 * Allocates layer & uploads image to it.
+	 * 2D-Texture Array created or grown, if required.
+	 *
+	 * @thread_safety - thread with current OpenGL context only.
+	 * @param image_ - loaded image, 8 bits per channel.
+	 * @param layer_ - output layer.
+	 * @return - 'true' if OK, 'false' if format not supported or layers limit reached.
+	 * @throws - can throw exception.
+	*/
+	const bool TextureArrayPool::Allocate( const PNGImage & image_, TextureLayer & layer_ )
+	{
+
+		// Convert pixels
+		if ( !image_.toRGBA8( mPixels ) )
+		{
+
+			// Log
+			std::string logMsg( "TextureArrayPool::Allocate - image format not supported #" );
+			logMsg += image_.mFile;
+			Log::printWarning( logMsg.c_str( ) );
+
+			// Return FALSE
+			return( false );
+
+		}
+
+		// Allocate & upload
+		return( Allocate( image_.mSize[0], image_.mSize[1], mPixels.data( ), layer_ ) );
+
+	}
+
+	/*
+	 * Allocates layer & uploads RGBA8 pixels to it.
+	 * 2D-Texture Array created or grown, if required.
+	 *
+	 * @thread_safety - thread with current OpenGL context only.
+	 * @param width_ - pixels width.
+	 * @param height_ - pixels height.
+	 * @param pixels_ - RGBA8 pixels, width_ * height_ * 4 bytes.
+	 * @param layer_ - output layer.
+	 * @return - 'true' if OK, 'false' if layers limit reached.
+	 * @throws - can throw exception.
+	*/
+	const bool TextureArrayPool::Allocate( const uint32_t width_, const uint32_t height_, const unsigned char *const pixels_, TextureLayer & layer_ )
+	{
+
+		// 2D-Texture Array key
+		const uint64_t key_( ( static_cast<uint64_t>( width_ ) << 32 ) | height_ );
+
+		// Search 2D-Texture Array
+		std::map<const uint64_t, Array>::iterator position_( mArrays.find( key_ ) );
+
+		// Create 2D-Texture Array
+		if ( position_ == mArrays.end( ) )
+		{
+
+			// Array
+			Array array_{ 0, 0, std::vector<uint32_t>( ) };
+
+			// Cancel
+			if ( !create( array_, width_, height_ ) )
+				return( false );
+
+			// Guarded-Block
+			try
+			{
+
+				// Add 2D-Texture Array
+				position_ = mArrays.insert( std::pair<const uint64_t, Array>( key_, std::move( array_ ) ) ).first;
+
+			}
+			catch ( ... )
+			{
+
+				// Release
+				glDeleteTextures( 1, &array_.textureObject_ );
+
+				// Re-throw
+				throw;
+
+			}
+
+		}
+
+		// Array
+		Array & array_ = position_->second;
+
+		// Grow, if no free layers
+		if ( array_.freeLayers_.empty( ) && !grow( array_, width_, height_ ) )
+		{
+
+			// Log
+			Log::printWarning( "TextureArrayPool::Allocate - 2D-Texture Array layers limit reached" );
+
+			// Return FALSE
+			return( false );
+
+		}
+
+		// Take free layer
+		const uint32_t layerIndex_( array_.freeLayers_.back( ) );
+		array_.freeLayers_.pop_back( );
+
+		// Upload pixels to the layer
+		glBindTexture( GL_TEXTURE_2D_ARRAY, array_.textureObject_ );
+		glTexSubImage3D( GL_TEXTURE_2D_ARRAY, 0, 0, 0, layerIndex_, width_, height_, 1, GL_RGBA, GL_UNSIGNED_BYTE, pixels_ );
+		glBindTexture( GL_TEXTURE_2D_ARRAY, 0 );
+
+		// Set layer
+		layer_ = TextureLayer{ array_.textureObject_, layerIndex_, width_, height_ };
+
+		// Return TRUE
+		return( true );
+
+	}
+
+	/*
+	 * Frees layer, for reuse by the next Allocate.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @param layer_ - layer.
+	*/
+	void TextureArrayPool::Free( const TextureLayer & layer_ ) noexcept
+	{
+
+		// Search 2D-Texture Array
+		std::map<const uint64_t, Array>::iterator position_( mArrays.find( ( static_cast<uint64_t>( layer_.width_ ) << 32 ) | layer_.height_ ) );
+
+		// Cancel, if unloaded
+		if ( position_ == mArrays.end( ) || position_->second.textureObject_ != layer_.textureObject_ )
+			return;
+
+#ifdef DEBUG // DEBUG
+		assert( layer_.layer_ < position_->second.capacity_ && position_->second.freeLayers_.size( ) < position_->second.capacity_ && "TextureArrayPool::Free - invalid layer !" );
+#endif // DEBUG
+
+		// Add free layer (capacity reserved, no allocation)
+		position_->second.freeLayers_.push_back( layer_.layer_ );
+
+	}
+
+	/*
+	 * Returns layer of the image file, loads image & allocates layer if required.
+	 * Each Acquire must be paired with Release.
+	 *
+	 * @thread_safety - thread with current OpenGL context only.
+	 * @param file_ - path to the PNG-image, 8 bits per channel.
+	 * @param layer_ - output layer.
+	 * @return - 'true' if OK.
+	 * @throws - can throw exception.
+	*/
+	const bool TextureArrayPool::Acquire( const std::string & file_, TextureLayer & layer_ )
+	{
+
+		// Already allocated
+		if ( addReference( file_, layer_ ) )
+			return( true );
+
+		// Image
+		PNGImage image_( file_ );
+
+		// Load Image
+		if ( !image_.Load( ) )
+		{
+
+			// Log
+			std::string logMsg( "TextureArrayPool::Acquire - failed to load PNG Image #" );
+			logMsg += file_;
+			Log::printWarning( logMsg.c_str( ) );
+
+			// Return FALSE
+			return( false );
+
+		}
+
+		// Allocate layer
+		TextureLayer allocated_{ 0, 0, 0, 0 };
+		if ( !Allocate( image_, allocated_ ) )
+			return( false );
+
+		// Add shared layer
+		addShared( file_, allocated_ );
+
+		// Set layer
+		layer_ = allocated_;
+
+		// Return TRUE
+		return( true );
+
+	}
+
+	/*
+	 * Returns layer of the named RGBA8 pixels (generated textures), allocates layer if required.
+	 * Pixels not used, if name already acquired. Each Acquire must be paired with Release.
+	 *
+	 * @thread_safety - thread with current OpenGL context only.
+	 * @param name_ - pixels name, shared with Acquire by file.
+	 * @param width_ - pixels width.
+	 * @param height_ - pixels height.
+	 * @param pixels_ - RGBA8 pixels, width_ * height_ * 4 bytes.
+	 * @param layer_ - output layer.
+	 * @return - 'true' if OK.
+	 * @throws - can throw exception.
+	*/
+	const bool TextureArrayPool::Acquire( const std::string & name_, const uint32_t width_, const uint32_t height_, const unsigned char *const pixels_, TextureLayer & layer_ )
+	{
+
+		// Already allocated
+		if ( addReference( name_, layer_ ) )
+			return( true );
+
+		// Allocate layer
+		TextureLayer allocated_{ 0, 0, 0, 0 };
+		if ( !Allocate( width_, height_, pixels_, allocated_ ) )
+			return( false );
+
+		// Add shared layer
+		addShared( name_, allocated_ );
+
+		// Set layer
+		layer_ = allocated_;
+
+		// Return TRUE
+		return( true );
+
+	}
+
+	/*
+	 * Adds reference to the shared layer.
+	 *
+	 * @param name_ - image file or pixels name.
+	 * @param layer_ - output layer.
+	 * @return - 'false' if not acquired yet.
+	*/
+	const bool TextureArrayPool::addReference( const std::string & name_, TextureLayer & layer_ ) noexcept
+	{
+
+		// Search shared layer
+		std::map<const std::string, Shared>::iterator position_( mShared.find( name_ ) );
+
+		// Cancel
+		if ( position_ == mShared.end( ) )
+			return( false );
+
+		// Add reference
+		position_->second.references_++;
+
+		// Set layer
+		layer_ = position_->second.layer_;
+
+		// Return TRUE
+		return( true );
+
+	}
+
+	/*
+	 * Adds shared layer, one reference. Layer freed on error.
+	 *
+	 * @param name_ - image file or pixels name.
+	 * @param layer_ - allocated layer.
+	 * @throws - std::bad_alloc.
+	*/
+	void TextureArrayPool::addShared( const std::string & name_, const TextureLayer & layer_ )
+	{
+
+		// Guarded-Block
+		try
+		{
+
+			// Add shared layer
+			mShared.insert( std::pair<const std::string, Shared>( name_, Shared{ layer_, 1 } ) );
+
+		}
+		catch ( ... )
+		{
+
+			// Release
+			Free( layer_ );
+
+			// Re-throw
+			throw;
+
+		}
+
+	}
+
+	/*
+	 * Releases layer of the image file or name, layer freed when not used.
+	 * No GL calls.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @param file_ - path to the PNG-image, or pixels name.
+	*/
+	void TextureArrayPool::Release( const std::string & file_ ) noexcept
+	{
+
+		// Search shared layer
+		std::map<const std::string, Shared>::iterator position_( mShared.find( file_ ) );
+
+		// Cancel, if not found or still used
+		if ( position_ == mShared.end( ) || --position_->second.references_ > 0 )
+			return;
+
+		// Free layer
+		Free( position_->second.layer_ );
+
+		// Remove shared layer
+		mShared.erase( position_ );
+
+	}
+
+	/*
+	 * Deletes 2D-Texture Arrays & layers.
+	 *
+	 * @thread_safety - thread with current OpenGL context only.
+	*/
+	void TextureArrayPool::Unload( ) noexcept
+	{
+
+		// Delete 2D-Texture Arrays
+		for ( std::pair<const uint64_t, Array> & pair_ : mArrays )
+			glDeleteTextures( 1, &pair_.second.textureObject_ );
+
+		// Remove 2D-Texture Arrays
+		mArrays.clear( );
+
+		// Remove shared layers
+		mShared.clear( );
+
+		// Delete Framebuffer Object
+		if ( mFramebuffer > 0 )
+		{
+			glDeleteFramebuffers( 1, &mFramebuffer );
+			mFramebuffer = 0;
+		}
+
+	}
+
+	// -------------------------------------------------------- \\
+
+}
\ No newline at end of file
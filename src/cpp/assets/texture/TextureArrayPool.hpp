@@ -0,0 +1,336 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_texture_array_pool_hpp__
+#define __c0de4un_texture_array_pool_hpp__
+
+// Include opengl
+#ifndef __c0de4un_opengl_hpp__
+#include "../../cfg/opengl.hpp"
+#endif // !__c0de4un_opengl_hpp__
+
+// Include string
+#ifndef __c0de4un_string_hpp__
+#include "../../cfg/string.hpp"
+#endif // !__c0de4un_string_hpp__
+
+// Include std::map
+#ifndef __c0de4un_map_hpp__
+#include "../../cfg/map.hpp"
+#endif // !__c0de4un_map_hpp__
+
+// Include std::vector
+#ifndef __c0de4un_vector_hpp__
+#include "../../cfg/vector.hpp"
+#endif // !__c0de4un_vector_hpp__
+
+// Include TextureLayer
+#ifndef __c0de4un_texture_layer_hpp__
+#include "TextureLayer.hpp"
+#endif // !__c0de4un_texture_layer_hpp__
+
+// Forward-declared PNGImage
+#ifndef __c0de4un_png_image_decl__
+#define __c0de4un_png_image_decl__
+namespace c0de4un { class PNGImage; }
+#endif // !__c0de4un_png_image_decl__
+
+// TextureArrayPool declared
+#define __c0de4un_texture_array_pool_decl__
+
+namespace c0de4un
+{
+
+	/*
+	 * TextureArrayPool - same-size images stored as layers of one RGBA8 2D-Texture Array.
+	 *
+	 * Sprites with different images of the same size share one Texture Object,
+	 * so they are drawn by one instanced draw call, layer index passed per-instance
+	 * (see Drawable::textureLayer_). Shader Program samples 'sampler2DArray'.
+	 *
+	 * Array grows (layers count doubled) when all layers used. Texture Object ID
+	 * kept on grow (layers copied out & back on the GPU), so batches stay the same.
+	 *
+	 * (!) Binds GL_TEXTURE_2D_ARRAY & GL_READ_FRAMEBUFFER directly, GLStateCache
+	 * must be invalidated after changes on the render-thread.
+	 *
+	 * @features
+	 * - one 2D-Texture Array per image size ;
+	 * - shared layers per image file or name (reference counted), see Acquire & Release ;
+	 * - freed layers reused ;
+	 *
+	 * @version 1.0
+	*/
+	class TextureArrayPool final
+	{
+
+	public:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Config
+		// ===========================================================
+
+		/* Default layers of new 2D-Texture Array */
+		static constexpr uint32_t DEFAULT_INITIAL_LAYERS = 8;
+
+		// ===========================================================
+		// Constructor & destructor
+		// ===========================================================
+
+		/*
+		 * TextureArrayPool constructor.
+		 *
+		 * @param initialLayers_ - layers of new 2D-Texture Array.
+		*/
+		explicit TextureArrayPool( const uint32_t initialLayers_ = DEFAULT_INITIAL_LAYERS );
+
+		/* TextureArrayPool destructor */
+		~TextureArrayPool( );
+
+		// ===========================================================
+		// Getter & Setter
+		// ===========================================================
+
+		/* Returns 2D-Texture Arrays count */
+		const uint32_t getArraysCount( ) const noexcept;
+
+		/* Returns used layers count of all 2D-Texture Arrays */
+		const uint32_t getUsedLayers( ) const noexcept;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Returns layer of the image file, loads image & allocates layer if required.
+		 * Each Acquire must be paired with Release.
+		 *
+		 * @thread_safety - thread with current OpenGL context only.
+		 * @param file_ - path to the PNG-image, 8 bits per channel.
+		 * @param layer_ - output layer.
+		 * @return - 'true' if OK.
+		 * @throws - can throw exception.
+		*/
+		const bool Acquire( const std::string & file_, TextureLayer & layer_ );
+
+		/*
+		 * Returns layer of the named RGBA8 pixels (generated textures), allocates layer if required.
+		 * Pixels not used, if name already acquired. Each Acquire must be paired with Release.
+		 *
+		 * @thread_safety - thread with current OpenGL context only.
+		 * @param name_ - pixels name, shared with Acquire by file.
+		 * @param width_ - pixels width.
+		 * @param height_ - pixels height.
+		 * @param pixels_ - RGBA8 pixels, width_ * height_ * 4 bytes.
+		 * @param layer_ - output layer.
+		 * @return - 'true' if OK.
+		 * @throws - can throw exception.
+		*/
+		const bool Acquire( const std::string & name_, const uint32_t width_, const uint32_t height_, const unsigned char *const pixels_, TextureLayer & layer_ );
+
+		/*
+		 * Releases layer of the image file or name, layer freed when not used.
+		 * No GL calls.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param file_ - path to the PNG-image, or pixels name.
+		*/
+		void Release( const std::string & file_ ) noexcept;
+
+		/*
+		 * Allocates layer & uploads image to it.
+		 * 2D-Texture Array created or grown, if required.
+		 *
+		 * @thread_safety - thread with current OpenGL context only.
+		 * @param image_ - loaded image, 8 bits per channel.
+		 * @param layer_ - output layer.
+		 * @return - 'true' if OK, 'false' if format not supported or layers limit reached.
+		 * @throws - can throw exception.
+		*/
+		const bool Allocate( const PNGImage & image_, TextureLayer & layer_ );
+
+		/*
+		 * Allocates layer & uploads RGBA8 pixels to it (generated textures).
+		 * 2D-Texture Array created or grown, if required.
+		 *
+		 * @thread_safety - thread with current OpenGL context only.
+		 * @param width_ - pixels width.
+		 * @param height_ - pixels height.
+		 * @param pixels_ - RGBA8 pixels, width_ * height_ * 4 bytes.
+		 * @param layer_ - output layer.
+		 * @return - 'true' if OK, 'false' if layers limit reached.
+		 * @throws - can throw exception.
+		*/
+		const bool Allocate( const uint32_t width_, const uint32_t height_, const unsigned char *const pixels_, TextureLayer & layer_ );
+
+		/*
+		 * Frees layer, for reuse by the next Allocate.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param layer_ - layer.
+		*/
+		void Free( const TextureLayer & layer_ ) noexcept;
+
+		/*
+		 * Deletes 2D-Texture Arrays & layers.
+		 *
+		 * @thread_safety - thread with current OpenGL context only.
+		*/
+		void Unload( ) noexcept;
+
+		// -------------------------------------------------------- \\
+
+	private:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Types
+		// ===========================================================
+
+		/* 2D-Texture Array of the same-size layers */
+		struct Array final
+		{
+
+			/* OpenGL 2D Texture Array Object ID */
+			GLuint textureObject_;
+
+			/* Layers count */
+			uint32_t capacity_;
+
+			/* Free layers, next used last */
+			std::vector<uint32_t> freeLayers_;
+
+		};
+
+		/* Layer shared by image file */
+		struct Shared final
+		{
+
+			/* Layer */
+			TextureLayer layer_;
+
+			/* References count */
+			uint32_t references_;
+
+		};
+
+		// ===========================================================
+		// Constants
+		// ===========================================================
+
+		/* Layers of new 2D-Texture Array */
+		const uint32_t mInitialLayers;
+
+		// ===========================================================
+		// Fields
+		// ===========================================================
+
+		/* 2D-Texture Arrays by size, ( width << 32 ) | height */
+		std::map<const uint64_t, Array> mArrays;
+
+		/* Shared layers by image file */
+		std::map<const std::string, Shared> mShared;
+
+		/* GL_MAX_ARRAY_TEXTURE_LAYERS, 0 until first 2D-Texture Array created */
+		GLint mMaxLayers;
+
+		/* Framebuffer Object, source of layers copy on grow */
+		GLuint mFramebuffer;
+
+		/* RGBA8 pixels, upload scratch */
+		std::vector<unsigned char> mPixels;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Adds reference to the shared layer.
+		 *
+		 * @param name_ - image file or pixels name.
+		 * @param layer_ - output layer.
+		 * @return - 'false' if not acquired yet.
+		*/
+		const bool addReference( const std::string & name_, TextureLayer & layer_ ) noexcept;
+
+		/*
+		 * Adds shared layer, one reference. Layer freed on error.
+		 *
+		 * @param name_ - image file or pixels name.
+		 * @param layer_ - allocated layer.
+		 * @throws - std::bad_alloc.
+		*/
+		void addShared( const std::string & name_, const TextureLayer & layer_ );
+
+		/*
+		 * Allocates storage of the bound 2D-Texture Array.
+		 *
+		 * @param width_ - layer width.
+		 * @param height_ - layer height.
+		 * @param layers_ - layers count.
+		*/
+		static void allocateStorage( const uint32_t width_, const uint32_t height_, const uint32_t layers_ ) noexcept;
+
+		/*
+		 * Creates 2D-Texture Array.
+		 *
+		 * @param array_ - output Array.
+		 * @param width_ - layer width.
+		 * @param height_ - layer height.
+		 * @return - 'true' if OK.
+		 * @throws - std::bad_alloc.
+		*/
+		const bool create( Array & array_, const uint32_t width_, const uint32_t height_ );
+
+		/*
+		 * Doubles layers count, Texture Object ID & layers data kept.
+		 *
+		 * @param array_ - Array.
+		 * @param width_ - layer width.
+		 * @param height_ - layer height.
+		 * @return - 'false' if layers limit reached.
+		 * @throws - std::bad_alloc.
+		*/
+		const bool grow( Array & array_, const uint32_t width_, const uint32_t height_ );
+
+		/*
+		 * Copies layers between 2D-Texture Arrays of the same size (on the GPU).
+		 *
+		 * @param source_ - source 2D Texture Array Object ID.
+		 * @param destination_ - destination 2D Texture Array Object ID.
+		 * @param layers_ - layers count, from #0.
+		 * @param width_ - layer width.
+		 * @param height_ - layer height.
+		*/
+		void copyLayers( const GLuint source_, const GLuint destination_, const uint32_t layers_, const uint32_t width_, const uint32_t height_ ) noexcept;
+
+		// ===========================================================
+		// Deleted
+		// ===========================================================
+
+		/* @deleted TextureArrayPool const copy constructor */
+		TextureArrayPool( const TextureArrayPool & ) = delete;
+
+		/* @deleted TextureArrayPool const copy assignment operator */
+		TextureArrayPool & operator=( const TextureArrayPool & ) = delete;
+
+		/* @deleted TextureArrayPool move constructor */
+		TextureArrayPool( TextureArrayPool && ) = delete;
+
+		/* @deleted TextureArrayPool move assignment operator */
+		TextureArrayPool & operator=( TextureArrayPool && ) = delete;
+
+		// -------------------------------------------------------- \\
+
+	};
+
+}
+
+#endif // !__c0de4un_texture_array_pool_hpp__
\ No newline at end of file
@@ -0,0 +1,55 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_texture_layer_hpp__
+#define __c0de4un_texture_layer_hpp__
+
+// Include opengl
+#ifndef __c0de4un_opengl_hpp__
+#include "../../cfg/opengl.hpp"
+#endif // !__c0de4un_opengl_hpp__
+
+// Include STL
+#include <cstdint> // uint32_t
+
+// TextureLayer declared
+#define __c0de4un_texture_layer_decl__
+
+// Enable structure-data (fields, variables) alignment (by compilator) to 1 byte
+#pragma pack( push, 1 )
+
+namespace c0de4un
+{
+
+	/*
+	 * TextureLayer - image placed in the 2D-Texture Array layer (TextureArrayPool).
+	 *
+	 * @version 1.0
+	*/
+	struct TextureLayer final
+	{
+
+		/* OpenGL 2D Texture Array Object ID, #0 - not allocated */
+		GLuint textureObject_;
+
+		/* Layer index */
+		uint32_t layer_;
+
+		/* Layer width */
+		uint32_t width_;
+
+		/* Layer height */
+		uint32_t height_;
+
+	};
+
+}
+
+// Restore structure-data alignment to default (8-byte on MSVC)
+#pragma pack( pop )
+
+#endif // !__c0de4un_texture_layer_hpp__
\ No newline at end of file
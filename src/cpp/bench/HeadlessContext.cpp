@@ -0,0 +1,274 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+// HEADER
+#ifndef __c0de4un_headless_context_hpp__
+#include "HeadlessContext.hpp"
+#endif // !__c0de4un_headless_context_hpp__
+
+// Include Log
+#ifndef __c0de4un_log_hpp__
+#include "../utils/log/Log.hpp"
+#endif // !__c0de4un_log_hpp__
+
+// Include EGL, without X11 headers
+#ifndef EGL_NO_X11
+#define EGL_NO_X11
+#endif // !EGL_NO_X11
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+// Include STL
+#include <cstring> // strstr, strlen
+#include <cstdio> // snprintf
+
+namespace c0de4un
+{
+
+	// -------------------------------------------------------- \\
+
+	/*
+	 * Returns 'true' if extensions string contains extension.
+	 *
+	 * @param extensions_ - EGL extensions (space-separated), can be null.
+	 * @param extension_ - extension name.
+	*/
+	static const bool hasExtension_( const char *const extensions_, const char *const extension_ ) noexcept
+	{
+
+		// Cancel
+		if ( extensions_ == nullptr )
+			return( false );
+
+		// Search whole-word
+		const std::size_t length_( std::strlen( extension_ ) );
+		const char * found_( extensions_ );
+		while ( ( found_ = std::strstr( found_, extension_ ) ) != nullptr )
+		{
+
+			// Found
+			if ( ( found_ == extensions_ || found_[-1] == ' ' ) && ( found_[length_] == ' ' || found_[length_] == '\0' ) )
+				return( true );
+
+			found_ += length_;
+
+		}
+
+		// Return FALSE
+		return( false );
+
+	}
+
+	/*
+	 * Logs EGL error.
+	 *
+	 * @param message_ - error message.
+	*/
+	static void logError_( const char *const message_ )
+	{
+
+		// Log
+		std::string logMsg( "HeadlessContext::Create - " );
+		logMsg += message_;
+		logMsg += ", EGL error 0x";
+		char error_[16];
+		std::snprintf( error_, sizeof( error_ ), "%X", static_cast<unsigned int>( eglGetError( ) ) );
+		logMsg += error_;
+		Log::printError( logMsg.c_str( ) );
+
+	}
+
+	// ===========================================================
+	// Constructor & destructor
+	// ===========================================================
+
+	/* HeadlessContext constructor */
+	HeadlessContext::HeadlessContext( )
+		: mDisplay( EGL_NO_DISPLAY ),
+		mContext( EGL_NO_CONTEXT ),
+		mSurface( EGL_NO_SURFACE ),
+		mPlatform( )
+	{
+	}
+
+	/* HeadlessContext destructor, context destroyed */
+	HeadlessContext::~HeadlessContext( )
+	{ Destroy( ); }
+
+	// ===========================================================
+	// Getter & Setter
+	// ===========================================================
+
+	/*
+	 * Returns OpenGL entry point, for GLDispatch::useLoader.
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param name_ - OpenGL function name.
+	 * @return - entry point, or null if not found.
+	*/
+	void * HeadlessContext::getProcAddress( const char *const name_ ) noexcept
+	{ return( reinterpret_cast<void*>( eglGetProcAddress( name_ ) ) ); }
+
+	/* Returns EGL platform used ("surfaceless" or "default"), empty if not created */
+	const std::string & HeadlessContext::getPlatform( ) const noexcept
+	{ return( mPlatform ); }
+
+	// ===========================================================
+	// Methods
+	// ===========================================================
+
+	/*
+	 * Creates OpenGL core context & makes it current to the calling thread.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @param majorVersion_ - OpenGL major version.
+	 * @param minorVersion_ - OpenGL minor version.
+	 * @return - 'true' if OK, errors logged.
+	 * @throws - std::bad_alloc.
+	*/
+	const bool HeadlessContext::Create( const int majorVersion_, const int minorVersion_ )
+	{
+
+		// Release previous
+		Destroy( );
+
+		// Mesa surfaceless platform, no window-system required
+		const char *const clientExtensions_( eglQueryString( EGL_NO_DISPLAY, EGL_EXTENSIONS ) );
+		if ( hasExtension_( clientExtensions_, "EGL_MESA_platform_surfaceless" ) )
+		{
+
+			// Platform display
+			const PFNEGLGETPLATFORMDISPLAYEXTPROC getPlatformDisplay_( reinterpret_cast<PFNEGLGETPLATFORMDISPLAYEXTPROC>( eglGetProcAddress( "eglGetPlatformDisplayEXT" ) ) );
+			if ( getPlatformDisplay_ != nullptr )
+			{
+
+				mDisplay = getPlatformDisplay_( EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr );
+				if ( mDisplay != EGL_NO_DISPLAY && eglInitialize( mDisplay, nullptr, nullptr ) == EGL_TRUE )
+					mPlatform = "surfaceless";
+				else
+					mDisplay = EGL_NO_DISPLAY;
+
+			}
+
+		}
+
+		// Default display
+		if ( mDisplay == EGL_NO_DISPLAY )
+		{
+
+			mDisplay = eglGetDisplay( EGL_DEFAULT_DISPLAY );
+			if ( mDisplay == EGL_NO_DISPLAY || eglInitialize( mDisplay, nullptr, nullptr ) != EGL_TRUE )
+			{
+				mDisplay = EGL_NO_DISPLAY;
+				logError_( "failed to initialize EGL display" );
+				return( false );
+			}
+
+			mPlatform = "default";
+
+		}
+
+		// Desktop OpenGL
+		if ( eglBindAPI( EGL_OPENGL_API ) != EGL_TRUE )
+		{
+			logError_( "OpenGL API not supported" );
+			Destroy( );
+			return( false );
+		}
+
+		// Config, pbuffer-compatible if possible (fallback surface)
+		const EGLint pbufferAttribs_[] = { EGL_SURFACE_TYPE, EGL_PBUFFER_BIT, EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT, EGL_RED_SIZE, 8, EGL_GREEN_SIZE, 8, EGL_BLUE_SIZE, 8, EGL_ALPHA_SIZE, 8, EGL_NONE };
+		const EGLint anyAttribs_[] = { EGL_SURFACE_TYPE, 0, EGL_RENDERABLE_TYPE, EGL_OPENGL_BIT, EGL_NONE };
+		EGLConfig config_( nullptr );
+		EGLint configsCount_( 0 );
+		const bool pbuffer_( eglChooseConfig( mDisplay, pbufferAttribs_, &config_, 1, &configsCount_ ) == EGL_TRUE && configsCount_ > 0 );
+		if ( !pbuffer_ && ( eglChooseConfig( mDisplay, anyAttribs_, &config_, 1, &configsCount_ ) != EGL_TRUE || configsCount_ < 1 ) )
+		{
+			logError_( "no OpenGL config" );
+			Destroy( );
+			return( false );
+		}
+
+		// Core context
+		const EGLint contextAttribs_[] = { EGL_CONTEXT_MAJOR_VERSION, majorVersion_, EGL_CONTEXT_MINOR_VERSION, minorVersion_, EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT, EGL_NONE };
+		mContext = eglCreateContext( mDisplay, config_, EGL_NO_CONTEXT, contextAttribs_ );
+		if ( mContext == EGL_NO_CONTEXT )
+		{
+			logError_( "failed to create OpenGL core context" );
+			Destroy( );
+			return( false );
+		}
+
+		// Surfaceless, or 1x1 pbuffer
+		if ( !hasExtension_( eglQueryString( mDisplay, EGL_EXTENSIONS ), "EGL_KHR_surfaceless_context" ) )
+		{
+
+			const EGLint surfaceAttribs_[] = { EGL_WIDTH, 1, EGL_HEIGHT, 1, EGL_NONE };
+			if ( pbuffer_ )
+				mSurface = eglCreatePbufferSurface( mDisplay, config_, surfaceAttribs_ );
+
+			if ( mSurface == EGL_NO_SURFACE )
+			{
+				logError_( "surfaceless context not supported & failed to create pbuffer" );
+				Destroy( );
+				return( false );
+			}
+
+		}
+
+		// Make current
+		if ( eglMakeCurrent( mDisplay, mSurface, mSurface, mContext ) != EGL_TRUE )
+		{
+			logError_( "failed to make context current" );
+			Destroy( );
+			return( false );
+		}
+
+		// Return TRUE
+		return( true );
+
+	}
+
+	/*
+	 * Releases & destroys context.
+	 *
+	 * @thread_safety - not thread-safe.
+	*/
+	void HeadlessContext::Destroy( ) noexcept
+	{
+
+		// Cancel
+		if ( mDisplay == EGL_NO_DISPLAY )
+			return;
+
+		// Release
+		eglMakeCurrent( mDisplay, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT );
+
+		// Destroy surface
+		if ( mSurface != EGL_NO_SURFACE )
+		{
+			eglDestroySurface( mDisplay, mSurface );
+			mSurface = EGL_NO_SURFACE;
+		}
+
+		// Destroy context
+		if ( mContext != EGL_NO_CONTEXT )
+		{
+			eglDestroyContext( mDisplay, mContext );
+			mContext = EGL_NO_CONTEXT;
+		}
+
+		// Terminate display
+		eglTerminate( mDisplay );
+		mDisplay = EGL_NO_DISPLAY;
+		mPlatform.clear( );
+
+	}
+
+	// -------------------------------------------------------- \\
+
+}
\ No newline at end of file
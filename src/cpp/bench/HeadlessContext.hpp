@@ -0,0 +1,130 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_headless_context_hpp__
+#define __c0de4un_headless_context_hpp__
+
+// Include string
+#ifndef __c0de4un_string_hpp__
+#include "../cfg/string.hpp"
+#endif // !__c0de4un_string_hpp__
+
+// HeadlessContext declared
+#define __c0de4un_headless_context_decl__
+
+namespace c0de4un
+{
+
+	/*
+	 * HeadlessContext - OpenGL core context without window (EGL), for benchmarks on machines without GPU or display.
+	 *
+	 * Mesa surfaceless platform used if available (no X11, no DRM device, llvmpipe),
+	 * default display otherwise. Context made current without surface (EGL_KHR_surfaceless_context),
+	 * or with 1x1 pbuffer, so rendering goes to framebuffer objects only.
+	 *
+	 * @version 1.0
+	*/
+	class HeadlessContext final
+	{
+
+	public:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Constructor & destructor
+		// ===========================================================
+
+		/* HeadlessContext constructor */
+		explicit HeadlessContext( );
+
+		/* HeadlessContext destructor, context destroyed */
+		~HeadlessContext( );
+
+		// ===========================================================
+		// Getter & Setter
+		// ===========================================================
+
+		/*
+		 * Returns OpenGL entry point, for GLDispatch::useLoader.
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param name_ - OpenGL function name.
+		 * @return - entry point, or null if not found.
+		*/
+		static void * getProcAddress( const char *const name_ ) noexcept;
+
+		/* Returns EGL platform used ("surfaceless" or "default"), empty if not created */
+		const std::string & getPlatform( ) const noexcept;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Creates OpenGL core context & makes it current to the calling thread.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param majorVersion_ - OpenGL major version.
+		 * @param minorVersion_ - OpenGL minor version.
+		 * @return - 'true' if OK, errors logged.
+		 * @throws - std::bad_alloc.
+		*/
+		const bool Create( const int majorVersion_, const int minorVersion_ );
+
+		/*
+		 * Releases & destroys context.
+		 *
+		 * @thread_safety - not thread-safe.
+		*/
+		void Destroy( ) noexcept;
+
+		// -------------------------------------------------------- \\
+
+	private:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Fields
+		// ===========================================================
+
+		/* EGLDisplay */
+		void * mDisplay;
+
+		/* EGLContext */
+		void * mContext;
+
+		/* EGLSurface, 1x1 pbuffer if surfaceless context not supported */
+		void * mSurface;
+
+		/* EGL platform */
+		std::string mPlatform;
+
+		// ===========================================================
+		// Deleted
+		// ===========================================================
+
+		/* @deleted HeadlessContext const copy constructor */
+		HeadlessContext( const HeadlessContext & ) = delete;
+
+		/* @deleted HeadlessContext const copy assignment operator */
+		HeadlessContext & operator=( const HeadlessContext & ) = delete;
+
+		/* @deleted HeadlessContext move constructor */
+		HeadlessContext( HeadlessContext && ) = delete;
+
+		/* @deleted HeadlessContext move assignment operator */
+		HeadlessContext & operator=( HeadlessContext && ) = delete;
+
+		// -------------------------------------------------------- \\
+
+	};
+
+}
+
+#endif // !__c0de4un_headless_context_hpp__
\ No newline at end of file
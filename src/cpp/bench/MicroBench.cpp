@@ -0,0 +1,304 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+// HEADER
+#ifndef __c0de4un_micro_bench_hpp__
+#include "MicroBench.hpp"
+#endif // !__c0de4un_micro_bench_hpp__
+
+// Include platform
+#ifndef __c0de4un_platform_hpp__
+#include "../cfg/platform.hpp"
+#endif // !__c0de4un_platform_hpp__
+
+// Include Log
+#ifndef __c0de4un_log_hpp__
+#include "../utils/log/Log.hpp"
+#endif // !__c0de4un_log_hpp__
+
+// Include STL
+#include <atomic> // atomic
+#include <chrono> // steady_clock
+#include <cstdlib> // malloc, free, aligned_alloc
+#include <cstdio> // snprintf
+#include <fstream> // ofstream
+#include <new> // bad_alloc, align_val_t
+#include <algorithm> // min, max
+
+// -------------------------------------------------------- \\
+
+/* Heap allocations count, all threads */
+static std::atomic<uint64_t> allocationsCount_( 0 );
+
+/* Heap allocated bytes, all threads */
+static std::atomic<uint64_t> allocatedBytes_( 0 );
+
+/* Last escaped value */
+static const void *volatile escaped_( nullptr );
+
+/*
+ * Allocates heap memory & counts allocation.
+ *
+ * @param size_ - bytes count.
+ * @param alignment_ - alignment, 0 - default.
+ * @return - memory, null if failed.
+*/
+static void * allocate_( std::size_t size_, const std::size_t alignment_ ) noexcept
+{
+
+	// Count
+	allocationsCount_.fetch_add( 1, std::memory_order_relaxed );
+	allocatedBytes_.fetch_add( size_, std::memory_order_relaxed );
+
+	// Zero-size allocation must return unique pointer
+	if ( size_ == 0 )
+		size_ = 1;
+
+	// Default alignment
+	if ( alignment_ == 0 )
+		return( std::malloc( size_ ) );
+
+	// Over-aligned
+#ifdef WIN32 // WIN32
+	return( _aligned_malloc( size_, alignment_ ) );
+#else // !WIN32
+	return( std::aligned_alloc( alignment_, ( size_ + alignment_ - 1 ) / alignment_ * alignment_ ) );
+#endif // WIN32
+
+}
+
+/*
+ * Allocates heap memory, throws std::bad_alloc if failed.
+*/
+static void * allocateOrThrow_( const std::size_t size_, const std::size_t alignment_ )
+{
+
+	void *const memory_( allocate_( size_, alignment_ ) );
+	if ( memory_ == nullptr )
+		throw std::bad_alloc( );
+
+	return( memory_ );
+
+}
+
+/*
+ * Releases over-aligned heap memory.
+*/
+static void releaseAligned_( void *const memory_ ) noexcept
+{
+#ifdef WIN32 // WIN32
+	_aligned_free( memory_ );
+#else // !WIN32
+	std::free( memory_ );
+#endif // WIN32
+}
+
+// Replaced global allocation functions, array forms call these by default,
+// sized forms replaced too (-Wsized-deallocation), size not needed by free
+void * operator new( std::size_t size_ )
+{ return( allocateOrThrow_( size_, 0 ) ); }
+
+void * operator new( std::size_t size_, const std::nothrow_t & ) noexcept
+{ return( allocate_( size_, 0 ) ); }
+
+void operator delete( void * memory_ ) noexcept
+{ std::free( memory_ ); }
+
+void operator delete( void * memory_, const std::nothrow_t & ) noexcept
+{ std::free( memory_ ); }
+
+void operator delete( void * memory_, std::size_t ) noexcept
+{ operator delete( memory_ ); }
+
+void * operator new( std::size_t size_, std::align_val_t alignment_ )
+{ return( allocateOrThrow_( size_, static_cast<std::size_t>( alignment_ ) ) ); }
+
+void * operator new( std::size_t size_, std::align_val_t alignment_, const std::nothrow_t & ) noexcept
+{ return( allocate_( size_, static_cast<std::size_t>( alignment_ ) ) ); }
+
+void operator delete( void * memory_, std::align_val_t ) noexcept
+{ releaseAligned_( memory_ ); }
+
+void operator delete( void * memory_, std::align_val_t, const std::nothrow_t & ) noexcept
+{ releaseAligned_( memory_ ); }
+
+void operator delete( void * memory_, std::size_t, std::align_val_t alignment_ ) noexcept
+{ operator delete( memory_, alignment_ ); }
+
+namespace c0de4un
+{
+
+	// -------------------------------------------------------- \\
+
+	// ===========================================================
+	// Constructor & destructor
+	// ===========================================================
+
+	/*
+	 * MicroBench constructor
+	 *
+	 * @param minTime_ - min. measured run time, seconds.
+	 * @param filter_ - only benchmarks which names contain it run, empty - all.
+	*/
+	MicroBench::MicroBench( const double minTime_, const std::string & filter_ )
+		: mMinTime( minTime_ ),
+		mFilter( filter_ ),
+		mResults( )
+	{
+	}
+
+	/* MicroBench destructor */
+	MicroBench::~MicroBench( )
+	{
+	}
+
+	// ===========================================================
+	// Getter & Setter
+	// ===========================================================
+
+	/*
+	 * Returns 'true' if benchmark selected by the filter.
+	 * Used to skip expensive setup of filtered benchmarks.
+	 *
+	 * @param name_ - benchmark name.
+	*/
+	const bool MicroBench::isSelected( const std::string & name_ ) const noexcept
+	{ return( mFilter.empty( ) || name_.find( mFilter ) != std::string::npos ); }
+
+	/* Returns heap allocations count since start (all threads) */
+	const uint64_t MicroBench::getAllocationsCount( ) noexcept
+	{ return( allocationsCount_.load( std::memory_order_relaxed ) ); }
+
+	/* Returns heap allocated bytes since start (all threads) */
+	const uint64_t MicroBench::getAllocatedBytes( ) noexcept
+	{ return( allocatedBytes_.load( std::memory_order_relaxed ) ); }
+
+	// ===========================================================
+	// Methods
+	// ===========================================================
+
+	/*
+	 * Keeps value computed, so measured code not optimized away.
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param pValue - computed value.
+	*/
+	void MicroBench::Escape( const void *const pValue ) noexcept
+	{ escaped_ = pValue; }
+
+	/*
+	 * Runs benchmark, result printed & stored for the JSON report.
+	 * Skipped if not selected by the filter.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @param name_ - benchmark name, e.g. "sprite_update/1000".
+	 * @param itemName_ - item name, e.g. "sprites".
+	 * @param itemsPerIteration_ - items processed by one iteration.
+	 * @param function_ - benchmark function.
+	 * @param pData - user-data.
+	 * @throws - std::bad_alloc, exceptions of the benchmark function.
+	*/
+	void MicroBench::Run( const std::string & name_, const char *const itemName_, const uint64_t itemsPerIteration_, bench_function_t function_, void *const pData )
+	{
+
+		// Cancel
+		if ( !isSelected( name_ ) )
+			return;
+
+		// Grow iterations count until run takes min. time (first runs warm caches up)
+		uint64_t iterations_( 1 );
+		while ( true )
+		{
+
+			// Run
+			const uint64_t allocations_( getAllocationsCount( ) );
+			const uint64_t bytes_( getAllocatedBytes( ) );
+			const std::chrono::steady_clock::time_point start_( std::chrono::steady_clock::now( ) );
+			function_( pData, iterations_ );
+			const double elapsed_( std::chrono::duration<double>( std::chrono::steady_clock::now( ) - start_ ).count( ) );
+
+			// Next run, 2-100 times more iterations
+			if ( elapsed_ < mMinTime && iterations_ < MAX_ITERATIONS )
+			{
+				const double scale_( elapsed_ > 0.0 ? std::min( std::max( mMinTime * 1.4 / elapsed_, 2.0 ), 100.0 ) : 100.0 );
+				iterations_ = std::min( static_cast<uint64_t>( static_cast<double>( iterations_ ) * scale_ ), MAX_ITERATIONS );
+				continue;
+			}
+
+			// Result
+			const double iterationsCount_( static_cast<double>( iterations_ ) );
+			Result result_;
+			result_.name_ = name_;
+			result_.itemName_ = itemName_;
+			result_.iterations_ = iterations_;
+			result_.nsPerIteration_ = elapsed_ * 1e9 / iterationsCount_;
+			result_.itemsPerSecond_ = static_cast<double>( itemsPerIteration_ ) * iterationsCount_ / elapsed_;
+			result_.allocsPerIteration_ = static_cast<double>( getAllocationsCount( ) - allocations_ ) / iterationsCount_;
+			result_.bytesPerIteration_ = static_cast<double>( getAllocatedBytes( ) - bytes_ ) / iterationsCount_;
+			mResults.push_back( result_ );
+			break;
+
+		}
+
+		// Log
+		const Result & result_( mResults.back( ) );
+		char line_[256];
+		std::snprintf( line_, sizeof( line_ ), "%-32s %12llu it %14.1f ns/it %14.4g %s/s %10.2f allocs/it %12.1f B/it",
+			result_.name_.c_str( ), static_cast<unsigned long long>( result_.iterations_ ), result_.nsPerIteration_,
+			result_.itemsPerSecond_, itemName_, result_.allocsPerIteration_, result_.bytesPerIteration_ );
+		Log::printInfo( line_ );
+
+	}
+
+	/*
+	 * Writes results as JSON.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @param file_ - JSON file path.
+	 * @return - 'true' if written.
+	 * @throws - std::bad_alloc.
+	*/
+	const bool MicroBench::writeJSON( const std::string & file_ ) const
+	{
+
+		// Open
+		std::ofstream output_( file_, std::ios_base::out | std::ios_base::trunc );
+		if ( !output_.is_open( ) )
+		{
+			std::string logMsg( "MicroBench::writeJSON - failed to open " );
+			logMsg += file_;
+			Log::printError( logMsg.c_str( ) );
+			return( false );
+		}
+
+		// Results, names are plain identifiers (no escaping)
+		output_.precision( 10 );
+		output_ << "{\n\"min_time_s\": " << mMinTime << ",\n\"benchmarks\": [\n";
+		for ( std::size_t i = 0; i < mResults.size( ); i++ )
+		{
+
+			const Result & result_( mResults[i] );
+			output_ << "{ \"name\": \"" << result_.name_
+				<< "\", \"item\": \"" << result_.itemName_
+				<< "\", \"iterations\": " << result_.iterations_
+				<< ", \"ns_per_iteration\": " << result_.nsPerIteration_
+				<< ", \"items_per_second\": " << result_.itemsPerSecond_
+				<< ", \"allocs_per_iteration\": " << result_.allocsPerIteration_
+				<< ", \"bytes_per_iteration\": " << result_.bytesPerIteration_
+				<< ( i + 1 < mResults.size( ) ? " },\n" : " }\n" );
+
+		}
+		output_ << "]\n}\n";
+
+		// Return TRUE if written
+		return( output_.good( ) );
+
+	}
+
+	// -------------------------------------------------------- \\
+
+}
\ No newline at end of file
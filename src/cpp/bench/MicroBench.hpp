@@ -0,0 +1,201 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_micro_bench_hpp__
+#define __c0de4un_micro_bench_hpp__
+
+// Include std::vector
+#ifndef __c0de4un_vector_hpp__
+#include "../cfg/vector.hpp"
+#endif // !__c0de4un_vector_hpp__
+
+// Include string
+#ifndef __c0de4un_string_hpp__
+#include "../cfg/string.hpp"
+#endif // !__c0de4un_string_hpp__
+
+// Include STL
+#include <cstdint> // uint64_t
+
+// MicroBench declared
+#define __c0de4un_micro_bench_decl__
+
+namespace c0de4un
+{
+
+	/*
+	 * Benchmark function, runs iterations of the measured code.
+	 *
+	 * @param pData - user-data.
+	 * @param iterations_ - iterations count.
+	*/
+	using bench_function_t = void( * )( void *const pData, const uint64_t iterations_ );
+
+	/*
+	 * MicroBench - runs micro-benchmarks, reports items/sec & heap allocations per iteration.
+	 *
+	 * Iterations count grown until run takes min. time, last run measured.
+	 * Allocations counted by replaced global operator new (all threads, JobSystem workers included).
+	 *
+	 * @version 1.0
+	*/
+	class MicroBench final
+	{
+
+	public:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Constants
+		// ===========================================================
+
+		/* Iterations limit */
+		static constexpr uint64_t MAX_ITERATIONS = 1000000000;
+
+		// ===========================================================
+		// Constructor & destructor
+		// ===========================================================
+
+		/*
+		 * MicroBench constructor
+		 *
+		 * @param minTime_ - min. measured run time, seconds.
+		 * @param filter_ - only benchmarks which names contain it run, empty - all.
+		*/
+		explicit MicroBench( const double minTime_, const std::string & filter_ );
+
+		/* MicroBench destructor */
+		~MicroBench( );
+
+		// ===========================================================
+		// Getter & Setter
+		// ===========================================================
+
+		/*
+		 * Returns 'true' if benchmark selected by the filter.
+		 * Used to skip expensive setup of filtered benchmarks.
+		 *
+		 * @param name_ - benchmark name.
+		*/
+		const bool isSelected( const std::string & name_ ) const noexcept;
+
+		/* Returns heap allocations count since start (all threads) */
+		static const uint64_t getAllocationsCount( ) noexcept;
+
+		/* Returns heap allocated bytes since start (all threads) */
+		static const uint64_t getAllocatedBytes( ) noexcept;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Keeps value computed, so measured code not optimized away.
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param pValue - computed value.
+		*/
+		static void Escape( const void *const pValue ) noexcept;
+
+		/*
+		 * Runs benchmark, result printed & stored for the JSON report.
+		 * Skipped if not selected by the filter.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param name_ - benchmark name, e.g. "sprite_update/1000".
+		 * @param itemName_ - item name, e.g. "sprites".
+		 * @param itemsPerIteration_ - items processed by one iteration.
+		 * @param function_ - benchmark function.
+		 * @param pData - user-data.
+		 * @throws - std::bad_alloc, exceptions of the benchmark function.
+		*/
+		void Run( const std::string & name_, const char *const itemName_, const uint64_t itemsPerIteration_, bench_function_t function_, void *const pData );
+
+		/*
+		 * Writes results as JSON.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param file_ - JSON file path.
+		 * @return - 'true' if written.
+		 * @throws - std::bad_alloc.
+		*/
+		const bool writeJSON( const std::string & file_ ) const;
+
+		// -------------------------------------------------------- \\
+
+	private:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Types
+		// ===========================================================
+
+		/* Benchmark result */
+		struct Result final
+		{
+
+			/* Benchmark name */
+			std::string name_;
+
+			/* Item name */
+			std::string itemName_;
+
+			/* Measured iterations */
+			uint64_t iterations_;
+
+			/* Nanoseconds per iteration */
+			double nsPerIteration_;
+
+			/* Items per second */
+			double itemsPerSecond_;
+
+			/* Heap allocations per iteration */
+			double allocsPerIteration_;
+
+			/* Heap allocated bytes per iteration */
+			double bytesPerIteration_;
+
+		};
+
+		// ===========================================================
+		// Fields
+		// ===========================================================
+
+		/* Min. measured run time, seconds */
+		const double mMinTime;
+
+		/* Benchmarks names filter */
+		const std::string mFilter;
+
+		/* Results */
+		std::vector<Result> mResults;
+
+		// ===========================================================
+		// Deleted
+		// ===========================================================
+
+		/* @deleted MicroBench const copy constructor */
+		MicroBench( const MicroBench & ) = delete;
+
+		/* @deleted MicroBench const copy assignment operator */
+		MicroBench & operator=( const MicroBench & ) = delete;
+
+		/* @deleted MicroBench move constructor */
+		MicroBench( MicroBench && ) = delete;
+
+		/* @deleted MicroBench move assignment operator */
+		MicroBench & operator=( MicroBench && ) = delete;
+
+		// -------------------------------------------------------- \\
+
+	};
+
+}
+
+#endif // !__c0de4un_micro_bench_hpp__
\ No newline at end of file
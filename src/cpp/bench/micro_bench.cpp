@@ -0,0 +1,636 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+/*
+ * Micro-benchmarks of the sprite pipeline hot paths.
+ *
+ * OpenGL calls go to NullGL (no context), so only CPU work measured:
+ * SpriteSystem::Update & Snapshot, GLRenderer::addDrawable/removeDrawable churn,
+ * MVP building (GLRenderer::calculateMVP), PNGLoader::loadImage & Random::getUint32.
+ * Each benchmark reports items/sec & heap allocations per iteration, optionally as JSON.
+ *
+ * Usage: gl_sprite_microbench [--min-time SECONDS] [--filter NAME] [--max-sprites N] [--json FILE]
+*/
+
+// Include STL
+#include <iostream> // cout
+#include <cstdlib> // strtod, strtoul, EXIT_SUCCESS, EXIT_FAILURE
+#include <cstring> // strcmp, memset
+#include <cstdio> // remove
+#include <stdexcept> // runtime_error
+#include <filesystem> // temp_directory_path
+#include <memory> // unique_ptr
+
+// Include opengl
+#ifndef __c0de4un_opengl_hpp__
+#include "../cfg/opengl.hpp"
+#endif // !__c0de4un_opengl_hpp__
+
+// Include Log
+#ifndef __c0de4un_log_hpp__
+#include "../utils/log/Log.hpp"
+#endif // !__c0de4un_log_hpp__
+
+// Include MicroBench
+#ifndef __c0de4un_micro_bench_hpp__
+#include "MicroBench.hpp"
+#endif // !__c0de4un_micro_bench_hpp__
+
+// Include GLRenderer
+#ifndef __c0de4un_gl_renderer_hpp__
+#include "../renderer/GLRenderer.hpp"
+#endif // !__c0de4un_gl_renderer_hpp__
+
+// Include RenderSnapshot
+#ifndef __c0de4un_render_snapshot_hpp__
+#include "../renderer/snapshot/RenderSnapshot.hpp"
+#endif // !__c0de4un_render_snapshot_hpp__
+
+// Include BatchRequest
+#ifndef __c0de4un_batch_request_hpp__
+#include "../renderer/batch/BatchRequest.hpp"
+#endif // !__c0de4un_batch_request_hpp__
+
+// Include Drawable
+#ifndef __c0de4un_drawable_hpp__
+#include "../renderer/batch/Drawable.hpp"
+#endif // !__c0de4un_drawable_hpp__
+
+// Include GLShader
+#ifndef __c0de4un_gl_shader_hpp__
+#include "../assets/shader/GLShader.hpp"
+#endif // !__c0de4un_gl_shader_hpp__
+
+// Include GLShaderProgram
+#ifndef __c0de4un_gl_shader_program_hpp__
+#include "../assets/shader/GLShaderProgram.hpp"
+#endif // !__c0de4un_gl_shader_program_hpp__
+
+// Include PNGImage
+#ifndef __c0de4un_png_image_hpp__
+#include "../assets/image/PNGImage.hpp"
+#endif // !__c0de4un_png_image_hpp__
+
+// Include PNGLoader
+#ifndef __c0de4un_png_loader_hpp__
+#include "../assets/image/PNGLoader.hpp"
+#endif // !__c0de4un_png_loader_hpp__
+
+// Include InputFile
+#ifndef __c0de4un_input_file_hpp__
+#include "../utils/io/InputFile.hpp"
+#endif // !__c0de4un_input_file_hpp__
+
+// Include Random
+#ifndef __c0de4un_random_hpp__
+#include "../utils/random/Random.hpp"
+#endif // !__c0de4un_random_hpp__
+
+// Include JobSystem
+#ifndef __c0de4un_job_system_hpp__
+#include "../utils/jobs/JobSystem.hpp"
+#endif // !__c0de4un_job_system_hpp__
+
+// Include SpriteSystem
+#ifndef __c0de4un_sprite_system_hpp__
+#include "../systems/SpriteSystem.hpp"
+#endif // !__c0de4un_sprite_system_hpp__
+
+/* World size */
+static const unsigned int WORLD_WIDTH = 1280, WORLD_HEIGHT = 720;
+
+/* Frame time step (seconds) */
+static const double FRAME_TIME = 1.0 / 60.0;
+
+/* Sprites counts of the SpriteSystem benchmarks */
+static const unsigned int SPRITES_COUNTS[] = { 1000, 10000, 100000, 1000000 };
+
+/* Resident Drawables counts of the GLRenderer churn benchmarks */
+static const unsigned int DRAWABLES_COUNTS[] = { 1000, 10000 };
+
+/* 2D-Textures Drawables split between (churn) */
+static const GLuint CHURN_TEXTURES_COUNT = 4;
+
+/* Render-Instances per iteration (MVP) */
+static const unsigned int MVP_INSTANCES_COUNT = 4096;
+
+/* PNG images sizes (pixels) */
+static const unsigned int PNG_SIZES[] = { 64, 256, 1024 };
+
+/* Random numbers per iteration */
+static const unsigned int RANDOM_NUMBERS_COUNT = 1024;
+
+/* Sprites limit (--max-sprites) */
+static unsigned int maxSprites( 1000000 );
+
+/* Random numbers generator (wrapper) */
+static c0de4un::Random * randomizer( nullptr );
+
+/* Job system - worker threads pool */
+static c0de4un::JobSystem * jobSystem( nullptr );
+
+/* GLRenderer, NullGL backend */
+static c0de4un::GLRenderer * glRenderer( nullptr );
+
+/* Vertex & Fragment Shaders */
+static c0de4un::GLShader * vertexShader( nullptr ), * fragmentShader( nullptr );
+
+/* Shader Program */
+static c0de4un::GLShaderProgram * shaderProgram( nullptr );
+
+/* 2D-Texture of the Sprites (NullGL object) */
+static GLuint texture( 0 );
+
+/* SpriteSystem benchmark data */
+struct SpritesBench
+{
+
+	/* SpriteSystem */
+	c0de4un::SpriteSystem * spritesSystem_;
+
+	/* Render-Snapshot */
+	c0de4un::RenderSnapshot snapshot_;
+
+};
+
+/* GLRenderer churn benchmark data */
+struct ChurnBench
+{
+
+	/* Resident Drawables */
+	std::unique_ptr<c0de4un::Drawable[]> drawables_;
+
+	/* Drawables count */
+	unsigned int count_;
+
+	/* Next Drawable re-added */
+	unsigned int next_;
+
+};
+
+/* MVP benchmark data */
+struct MVPBench
+{
+
+	/* Render-Instances */
+	std::vector<c0de4un::RenderInstance> instances_;
+
+	/* Camera View-Projection Matrix */
+	glm::mat4 viewProjMat_;
+
+};
+
+/* PNG benchmark data */
+struct PNGBench
+{
+
+	/* PNG Image, file loaded */
+	c0de4un::PNGImage * image_;
+
+};
+
+/*
+ * Updates Sprites.
+*/
+static void benchSpriteUpdate( void *const pData, const uint64_t iterations_ )
+{
+
+	SpritesBench *const bench_( static_cast<SpritesBench*>( pData ) );
+	for ( uint64_t i = 0; i < iterations_; i++ )
+		bench_->spritesSystem_->Update( FRAME_TIME );
+
+}
+
+/*
+ * Writes Render-Snapshot of the Sprites.
+*/
+static void benchSpriteSnapshot( void *const pData, const uint64_t iterations_ )
+{
+
+	SpritesBench *const bench_( static_cast<SpritesBench*>( pData ) );
+	for ( uint64_t i = 0; i < iterations_; i++ )
+	{
+		bench_->spritesSystem_->Snapshot( bench_->snapshot_ );
+		c0de4un::MicroBench::Escape( &bench_->snapshot_ );
+	}
+
+}
+
+/*
+ * Fills Batch Request of the Drawable, like SpriteSystem::showSprite.
+*/
+static void fillBatchRequest( c0de4un::BatchRequest & batchRequest_, c0de4un::Drawable & drawable_ )
+{
+	batchRequest_.shaderProgram_ = drawable_.shaderProgram_;
+	batchRequest_.textureObject_ = drawable_.textureObject_;
+	batchRequest_.vertexPosAttrIndex_ = shaderProgram->getVertexPosAttrIndex( );
+	batchRequest_.drawable_ = &drawable_;
+}
+
+/*
+ * Removes & re-adds one resident Drawable per iteration.
+*/
+static void benchRendererChurn( void *const pData, const uint64_t iterations_ )
+{
+
+	ChurnBench *const bench_( static_cast<ChurnBench*>( pData ) );
+	c0de4un::BatchRequest batchRequest_;
+	for ( uint64_t i = 0; i < iterations_; i++ )
+	{
+
+		// Next Drawable, round-robin
+		c0de4un::Drawable & drawable_( bench_->drawables_[bench_->next_] );
+		bench_->next_ = bench_->next_ + 1 < bench_->count_ ? bench_->next_ + 1 : 0;
+
+		// Remove & add
+		glRenderer->removeDrawable( &drawable_, drawable_.shaderProgram_, drawable_.textureObject_ );
+		fillBatchRequest( batchRequest_, drawable_ );
+		glRenderer->addDrawable( batchRequest_ );
+
+	}
+
+}
+
+/*
+ * Calculates MVP Matrices of the Render-Instances.
+*/
+static void benchMVP( void *const pData, const uint64_t iterations_ )
+{
+
+	MVPBench *const bench_( static_cast<MVPBench*>( pData ) );
+	glm::mat4 mvpMat_;
+	for ( uint64_t i = 0; i < iterations_; i++ )
+	{
+		for ( const c0de4un::RenderInstance & instance_ : bench_->instances_ )
+		{
+			c0de4un::GLRenderer::calculateMVP( instance_, bench_->viewProjMat_, mvpMat_ );
+			c0de4un::MicroBench::Escape( &mvpMat_ );
+		}
+	}
+
+}
+
+/*
+ * Loads & unloads PNG image.
+*/
+static void benchPNGLoad( void *const pData, const uint64_t iterations_ )
+{
+
+	PNGBench *const bench_( static_cast<PNGBench*>( pData ) );
+	for ( uint64_t i = 0; i < iterations_; i++ )
+	{
+
+		// Load, new stream like PNGImage::Load
+		c0de4un::InputFile inputFile_;
+		if ( !c0de4un::PNGLoader::loadImage( bench_->image_, &inputFile_ ) )
+			throw std::runtime_error( "micro_bench::benchPNGLoad - failed to load PNG image" );
+		c0de4un::MicroBench::Escape( bench_->image_->getBytes( ) );
+
+		// Release bytes
+		bench_->image_->Unload( );
+
+	}
+
+}
+
+/*
+ * Generates random numbers.
+*/
+static void benchRandom( void *const pData, const uint64_t iterations_ )
+{
+
+	int sum_( 0 );
+	for ( uint64_t i = 0; i < iterations_; i++ )
+	{
+		for ( unsigned int j = 0; j < RANDOM_NUMBERS_COUNT; j++ )
+			sum_ += randomizer->getUint32( 0, 1000 );
+	}
+	c0de4un::MicroBench::Escape( &sum_ );
+
+}
+
+/*
+ * Writes RGBA PNG image (gradient & noise, so compressed like real images).
+ *
+ * @param file_ - PNG file path.
+ * @param size_ - width & height.
+ * @return - 'true' if written.
+*/
+static const bool writePNG( const std::string & file_, const unsigned int size_ )
+{
+
+	// Pixels
+	std::vector<unsigned char> pixels_( static_cast<std::size_t>( size_ ) * size_ * 4 );
+	uint32_t noise_( 0x9E3779B9u );
+	for ( unsigned int y = 0; y < size_; y++ )
+	{
+		for ( unsigned int x = 0; x < size_; x++ )
+		{
+			noise_ = noise_ * 1664525u + 1013904223u;
+			unsigned char *const pixel_( &pixels_[( static_cast<std::size_t>( y ) * size_ + x ) * 4] );
+			pixel_[0] = static_cast<unsigned char>( x * 255 / size_ );
+			pixel_[1] = static_cast<unsigned char>( y * 255 / size_ );
+			pixel_[2] = static_cast<unsigned char>( ( noise_ >> 24 ) & 0x3F );
+			pixel_[3] = 255;
+		}
+	}
+
+	// Write (libPNG simplified API)
+	png_image image_;
+	std::memset( &image_, 0, sizeof( image_ ) );
+	image_.version = PNG_IMAGE_VERSION;
+	image_.width = size_;
+	image_.height = size_;
+	image_.format = PNG_FORMAT_RGBA;
+	const bool written_( png_image_write_to_file( &image_, file_.c_str( ), 0, pixels_.data( ), 0, nullptr ) != 0 );
+	png_image_free( &image_ );
+
+	// Return TRUE if written
+	return( written_ );
+
+}
+
+/*
+ * Parses command-line arguments.
+ *
+ * @return - 'false' if unknown argument, usage printed.
+*/
+const bool parseArguments( const int argc, char *const argv[], double & minTime_, std::string & filter_, std::string & jsonFile_ )
+{
+
+	for ( int i = 1; i < argc; i += 2 )
+	{
+
+		// Values
+		bool parsed_( true );
+		if ( i + 1 >= argc )
+			parsed_ = false;
+		else if ( std::strcmp( argv[i], "--min-time" ) == 0 )
+			minTime_ = std::strtod( argv[i + 1], nullptr );
+		else if ( std::strcmp( argv[i], "--filter" ) == 0 )
+			filter_ = argv[i + 1];
+		else if ( std::strcmp( argv[i], "--max-sprites" ) == 0 )
+			maxSprites = static_cast<unsigned int>( std::strtoul( argv[i + 1], nullptr, 10 ) );
+		else if ( std::strcmp( argv[i], "--json" ) == 0 )
+			jsonFile_ = argv[i + 1];
+		else
+			parsed_ = false;
+
+		// Usage
+		if ( !parsed_ )
+		{
+			std::cout << "Usage: " << argv[0] << " [--min-time SECONDS] [--filter NAME] [--max-sprites N] [--json FILE]" << std::endl;
+			return( false );
+		}
+
+	}
+
+	// Return TRUE
+	return( true );
+
+}
+
+/*
+ * Creates NullGL backend, GLRenderer & Shader Program.
+ *
+ * @throws - can throw exception.
+*/
+void Initialize( )
+{
+
+	// No context, calls counted only
+	c0de4un::GLDispatch::useNull( );
+
+	// Create GLRenderer, Randomizer, JobSystem
+	glRenderer = new c0de4un::GLRenderer( );
+	randomizer = new c0de4un::Random( );
+	jobSystem = new c0de4un::JobSystem( c0de4un::JobSystem::getDefaultWorkersCount( ) );
+
+	// Shader Program (sources not compiled by NullGL)
+	const std::string glslCode_( "#version 330 \n" );
+	vertexShader = new c0de4un::GLShader( "vertexShader", GL_VERTEX_SHADER, &glslCode_, nullptr );
+	fragmentShader = new c0de4un::GLShader( "fragmentShader", GL_FRAGMENT_SHADER, &glslCode_, nullptr );
+	shaderProgram = new c0de4un::GLShaderProgram( "shaderProgram", *vertexShader, *fragmentShader, "a_Position", "a_TexCoord", "a_Color", "s_texture", "", "a_Model", "u_ViewProj", "a_UVRect" );
+	if ( !shaderProgram->Load( ) )
+		throw std::runtime_error( "micro_bench::Initialize - failed to load Shader Program" );
+
+	// 2D-Texture
+	glGenTextures( 1, &texture );
+
+}
+
+/*
+ * Runs benchmarks.
+ *
+ * @param microBench_ - MicroBench.
+ * @throws - can throw exception.
+*/
+void Run( c0de4un::MicroBench & microBench_ )
+{
+
+	// SpriteSystem
+	for ( const unsigned int spritesCount_ : SPRITES_COUNTS )
+	{
+
+		// Limit
+		const std::string count_( std::to_string( spritesCount_ ) );
+		if ( spritesCount_ > maxSprites || ( !microBench_.isSelected( "sprite_update/" + count_ ) && !microBench_.isSelected( "sprite_snapshot/" + count_ ) ) )
+			continue;
+
+		// Sprites
+		SpritesBench bench_;
+		bench_.spritesSystem_ = new c0de4un::SpriteSystem( randomizer, jobSystem, WORLD_WIDTH, WORLD_HEIGHT, spritesCount_ );
+		for ( unsigned int i = 0; i < spritesCount_; i++ )
+			bench_.spritesSystem_->addSprite( *shaderProgram, texture, glRenderer );
+
+		// Run
+		microBench_.Run( "sprite_update/" + count_, "sprites", spritesCount_, benchSpriteUpdate, &bench_ );
+		microBench_.Run( "sprite_snapshot/" + count_, "sprites", spritesCount_, benchSpriteSnapshot, &bench_ );
+
+		// Remove Sprites
+		bench_.spritesSystem_->Stop( glRenderer );
+		delete bench_.spritesSystem_;
+
+	}
+
+	// GLRenderer churn
+	for ( const unsigned int drawablesCount_ : DRAWABLES_COUNTS )
+	{
+
+		// Filter
+		const std::string name_( "renderer_churn/" + std::to_string( drawablesCount_ ) );
+		if ( !microBench_.isSelected( name_ ) )
+			continue;
+
+		// Resident Drawables
+		ChurnBench bench_;
+		bench_.drawables_.reset( new c0de4un::Drawable[drawablesCount_] );
+		bench_.count_ = drawablesCount_;
+		bench_.next_ = 0;
+		c0de4un::BatchRequest batchRequest_;
+		for ( unsigned int i = 0; i < drawablesCount_; i++ )
+		{
+			c0de4un::Drawable & drawable_( bench_.drawables_[i] );
+			drawable_.shaderProgram_ = shaderProgram->getProgramObject( );
+			drawable_.textureObject_ = texture + i % CHURN_TEXTURES_COUNT;
+			fillBatchRequest( batchRequest_, drawable_ );
+			glRenderer->addDrawable( batchRequest_ );
+		}
+
+		// Run, remove & add per iteration
+		microBench_.Run( name_, "operations", 2, benchRendererChurn, &bench_ );
+
+		// Remove Drawables
+		for ( unsigned int i = 0; i < drawablesCount_; i++ )
+			glRenderer->removeDrawable( &bench_.drawables_[i], bench_.drawables_[i].shaderProgram_, bench_.drawables_[i].textureObject_ );
+
+	}
+
+	// MVP
+	if ( microBench_.isSelected( "mvp/" + std::to_string( MVP_INSTANCES_COUNT ) ) )
+	{
+
+		// Render-Instances, random 2D affine transforms
+		MVPBench bench_;
+		bench_.instances_.resize( MVP_INSTANCES_COUNT );
+		for ( c0de4un::RenderInstance & instance_ : bench_.instances_ )
+		{
+			for ( float & value_ : instance_.model_ )
+				value_ = randomizer->getFloat( -64.0f, 64.0f );
+		}
+		bench_.viewProjMat_ = glm::ortho( 0.0f, static_cast<float>( WORLD_WIDTH ), 0.0f, static_cast<float>( WORLD_HEIGHT ), 0.0f, 1.0f );
+
+		// Run
+		microBench_.Run( "mvp/" + std::to_string( MVP_INSTANCES_COUNT ), "instances", MVP_INSTANCES_COUNT, benchMVP, &bench_ );
+
+	}
+
+	// PNG
+	for ( const unsigned int size_ : PNG_SIZES )
+	{
+
+		// Filter
+		const std::string name_( "png_load/" + std::to_string( size_ ) + "x" + std::to_string( size_ ) );
+		if ( !microBench_.isSelected( name_ ) )
+			continue;
+
+		// Generated PNG file
+		const std::string file_( ( std::filesystem::temp_directory_path( ) / ( "c0de4un_bench_" + std::to_string( size_ ) + ".png" ) ).string( ) );
+		if ( !writePNG( file_, size_ ) )
+			throw std::runtime_error( "micro_bench::Run - failed to write PNG image" );
+
+		// Run
+		PNGBench bench_;
+		bench_.image_ = new c0de4un::PNGImage( file_ );
+		microBench_.Run( name_, "pixels", static_cast<uint64_t>( size_ ) * size_, benchPNGLoad, &bench_ );
+
+		// Remove
+		delete bench_.image_;
+		std::remove( file_.c_str( ) );
+
+	}
+
+	// Random
+	microBench_.Run( "random_uint32", "numbers", RANDOM_NUMBERS_COUNT, benchRandom, nullptr );
+
+}
+
+/*
+ * Unloads objects & releases memory.
+*/
+void Stop( ) noexcept
+{
+
+	// Guarded-Block
+	try
+	{
+
+		// Shader Program & Shaders
+		if ( shaderProgram != nullptr )
+			shaderProgram->Unload( );
+		delete shaderProgram;
+		shaderProgram = nullptr;
+		delete vertexShader;
+		vertexShader = nullptr;
+		delete fragmentShader;
+		fragmentShader = nullptr;
+
+		// Objects
+		if ( glRenderer != nullptr )
+			glRenderer->unloadBatches( );
+		delete glRenderer;
+		glRenderer = nullptr;
+		delete jobSystem;
+		jobSystem = nullptr;
+		delete randomizer;
+		randomizer = nullptr;
+
+	}
+	catch ( const std::exception & exception_ )
+	{
+
+		// Log-message
+		std::string logMsg( "micro_bench::Stop - ERROR: " );
+		logMsg += exception_.what( );
+
+		// Print to the Log
+		c0de4un::Log::printError( logMsg.c_str( ) );
+
+	}
+
+}
+
+/* MAIN */
+int main( int argc, char *argv[] )
+{
+
+	// Arguments
+	double minTime_( 0.5 );
+	std::string filter_;
+	std::string jsonFile_;
+	if ( !parseArguments( argc, argv, minTime_, filter_, jsonFile_ ) )
+		return( EXIT_FAILURE );
+
+	// DEBUG-level messages not measured
+	c0de4un::Log::setDebugEnabled( false );
+
+	// Guarded-Block
+	bool result_( true );
+	try
+	{
+
+		// Run
+		c0de4un::MicroBench microBench_( minTime_, filter_ );
+		Initialize( );
+		Run( microBench_ );
+
+		// JSON
+		if ( !jsonFile_.empty( ) )
+			result_ = microBench_.writeJSON( jsonFile_ );
+
+	}
+	catch ( const std::exception & exception_ )
+	{
+
+		// Log-message
+		std::string logMsg( "micro_bench - ERROR: " );
+		logMsg += exception_.what( );
+
+		// Print to the Log
+		c0de4un::Log::printError( logMsg.c_str( ) );
+
+		result_ = false;
+
+	}
+
+	// Stop
+	Stop( );
+
+	// Return
+	return( result_ ? EXIT_SUCCESS : EXIT_FAILURE );
+
+}
\ No newline at end of file
@@ -0,0 +1,962 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+/*
+ * Headless render benchmark.
+ *
+ * SpriteSystem & GLRenderer draw N frames into a framebuffer object, without window:
+ * EGL context (Mesa surfaceless, llvmpipe on machines without GPU), or NullGL (--null, no context).
+ * Per-frame CPU timings (update, snapshot, draw submit) & GPU time (GL_TIME_ELAPSED) written as JSON,
+ * with GPU time of each Shader Program pass (GLRenderer GPUTimer).
+ *
+ * Usage: gl_sprite_bench [--frames N] [--warmup N] [--sprites N] [--textures N] [--programs N]
+ *        [--width N] [--height N] [--out FILE] [--trace FILE] [--null] [--texture-array]
+ * --trace writes CPU zones of the measured frames as Chrome trace JSON (ROOT_PROJECT_PROFILER_ENABLED builds).
+ * --texture-array puts the textures into layers of one 2D-Texture Array (TextureArrayPool, sampler2DArray),
+ * so sprites of all textures drawn by one batch per Shader Program.
+*/
+
+// Include STL
+#include <iostream> // cout
+#include <fstream> // ofstream
+#include <cstdlib> // strtoul, EXIT_SUCCESS, EXIT_FAILURE
+#include <cstring> // strcmp
+#include <cstdint> // uint64_t
+#include <chrono> // steady_clock
+#include <algorithm> // sort, min, max
+#include <utility> // move
+
+// Include opengl
+#ifndef __c0de4un_opengl_hpp__
+#include "../cfg/opengl.hpp"
+#endif // !__c0de4un_opengl_hpp__
+
+// Include Log
+#ifndef __c0de4un_log_hpp__
+#include "../utils/log/Log.hpp"
+#endif // !__c0de4un_log_hpp__
+
+// Include ProfileScope
+#ifndef __c0de4un_profile_scope_hpp__
+#include "../utils/profiler/ProfileScope.hpp"
+#endif // !__c0de4un_profile_scope_hpp__
+
+// Include HeadlessContext
+#ifndef __c0de4un_headless_context_hpp__
+#include "HeadlessContext.hpp"
+#endif // !__c0de4un_headless_context_hpp__
+
+// Include NullGL
+#ifndef __c0de4un_null_gl_hpp__
+#include "../renderer/dispatch/NullGL.hpp"
+#endif // !__c0de4un_null_gl_hpp__
+
+// Include GLRenderer
+#ifndef __c0de4un_gl_renderer_hpp__
+#include "../renderer/GLRenderer.hpp"
+#endif // !__c0de4un_gl_renderer_hpp__
+
+// Include RenderSnapshot
+#ifndef __c0de4un_render_snapshot_hpp__
+#include "../renderer/snapshot/RenderSnapshot.hpp"
+#endif // !__c0de4un_render_snapshot_hpp__
+
+// Include GLShader
+#ifndef __c0de4un_gl_shader_hpp__
+#include "../assets/shader/GLShader.hpp"
+#endif // !__c0de4un_gl_shader_hpp__
+
+// Include GLShaderProgram
+#ifndef __c0de4un_gl_shader_program_hpp__
+#include "../assets/shader/GLShaderProgram.hpp"
+#endif // !__c0de4un_gl_shader_program_hpp__
+
+// Include ShaderCompiler
+#ifndef __c0de4un_shader_compiler_hpp__
+#include "../assets/shader/ShaderCompiler.hpp"
+#endif // !__c0de4un_shader_compiler_hpp__
+
+// Include GLCamera2D
+#ifndef __c0de4un_gl_camera_2D_hpp__
+#include "../camera/GLCamera2D.hpp"
+#endif // !__c0de4un_gl_camera_2D_hpp__
+
+// Include Random
+#ifndef __c0de4un_random_hpp__
+#include "../utils/random/Random.hpp"
+#endif // !__c0de4un_random_hpp__
+
+// Include JobSystem
+#ifndef __c0de4un_job_system_hpp__
+#include "../utils/jobs/JobSystem.hpp"
+#endif // !__c0de4un_job_system_hpp__
+
+// Include SpriteSystem
+#ifndef __c0de4un_sprite_system_hpp__
+#include "../systems/SpriteSystem.hpp"
+#endif // !__c0de4un_sprite_system_hpp__
+
+// Include TextureArrayPool
+#ifndef __c0de4un_texture_array_pool_hpp__
+#include "../assets/texture/TextureArrayPool.hpp"
+#endif // !__c0de4un_texture_array_pool_hpp__
+
+/* GPU time queries in flight, result read this many frames later */
+static const unsigned int GPU_QUERIES_COUNT = 4;
+
+/* Generated 2D-Textures size (pixels) */
+static const GLsizei TEXTURE_SIZE = 64;
+
+/* Frame time step (seconds) */
+static const double FRAME_TIME = 1.0 / 60.0;
+
+/* Measured frames */
+static unsigned int framesCount( 600 );
+
+/* Frames not measured, before measured ones */
+static unsigned int warmupFrames( 30 );
+
+/* Sprites count */
+static unsigned int spritesCount( 10000 );
+
+/* 2D-Textures count, sprites split between them */
+static unsigned int texturesCount( 4 );
+
+/* Shader Programs count, sprites split between them */
+static unsigned int programsCount( 1 );
+
+/* Framebuffer size */
+static unsigned int surfaceWidth( 1280 ), surfaceHeight( 720 );
+
+/* JSON report file */
+static std::string outputFile( "bench.json" );
+
+/* Chrome trace file of the measured frames, empty if not profiled */
+static std::string traceFile;
+
+/* NullGL used instead of the EGL context */
+static bool nullBackend( false );
+
+/* Textures are layers of 2D-Texture Array, sampler2DArray programs */
+static bool textureArray( false );
+
+/* Frame timings, milliseconds */
+struct FrameTimings
+{
+
+	/* SpriteSystem::Update */
+	double update_;
+
+	/* SpriteSystem::Snapshot */
+	double snapshot_;
+
+	/* Clear & GLRenderer::Draw (submit) */
+	double draw_;
+
+	/* Whole frame (CPU) */
+	double frame_;
+
+	/* GPU, GL_TIME_ELAPSED */
+	double gpu_;
+
+	/* OpenGL calls (NullGL) */
+	uint64_t calls_;
+
+	/* Draw calls (NullGL) */
+	uint64_t draws_;
+
+};
+
+/* Headless OpenGL context */
+static c0de4un::HeadlessContext * context( nullptr );
+
+/* Random numbers generator (wrapper) */
+static c0de4un::Random * randomizer( nullptr );
+
+/* Job system - worker threads pool */
+static c0de4un::JobSystem * jobSystem( nullptr );
+
+/* 2D Camera */
+static c0de4un::GLCamera2D * glCamera2D( nullptr );
+
+/* GLRenderer */
+static c0de4un::GLRenderer * glRenderer( nullptr );
+
+/* SpriteSystem */
+static c0de4un::SpriteSystem * spritesSystem( nullptr );
+
+/* Shaders, vertex & fragment per Shader Program */
+static std::vector<c0de4un::GLShader*> shaders;
+
+/* Shader Programs */
+static std::vector<c0de4un::GLShaderProgram*> shaderPrograms;
+
+/* Generated 2D-Textures */
+static std::vector<GLuint> textures;
+
+/* 2D-Texture Arrays of the generated textures (--texture-array) */
+static c0de4un::TextureArrayPool * texturePool( nullptr );
+
+/* Names of the generated 2D-Texture Array layers (--texture-array), acquired until cleanup */
+static std::vector<std::string> textureLayers;
+
+/* Framebuffer object & its color 2D-Texture */
+static GLuint framebuffer( 0 ), framebufferTexture( 0 );
+
+/* GPU time queries */
+static GLuint gpuQueries[GPU_QUERIES_COUNT] = { };
+
+/* OpenGL renderer name */
+static std::string rendererName;
+
+/* Measured frames timings */
+static std::vector<FrameTimings> timings;
+
+/*
+ * Parses command-line arguments.
+ *
+ * @return - 'false' if unknown argument, usage printed.
+*/
+const bool parseArguments( const int argc, char *const argv[] )
+{
+
+	for ( int i = 1; i < argc; i++ )
+	{
+
+		// Flags
+		if ( std::strcmp( argv[i], "--null" ) == 0 )
+		{
+			nullBackend = true;
+			continue;
+		}
+		if ( std::strcmp( argv[i], "--texture-array" ) == 0 )
+		{
+			textureArray = true;
+			continue;
+		}
+
+		// Values
+		if ( i + 1 < argc )
+		{
+
+			const char *const value_( argv[i + 1] );
+			const unsigned int number_( static_cast<unsigned int>( std::strtoul( value_, nullptr, 10 ) ) );
+			bool parsed_( true );
+
+			if ( std::strcmp( argv[i], "--frames" ) == 0 )
+				framesCount = std::max( number_, 1u );
+			else if ( std::strcmp( argv[i], "--warmup" ) == 0 )
+				warmupFrames = number_;
+			else if ( std::strcmp( argv[i], "--sprites" ) == 0 )
+				spritesCount = number_;
+			else if ( std::strcmp( argv[i], "--textures" ) == 0 )
+				texturesCount = std::max( number_, 1u );
+			else if ( std::strcmp( argv[i], "--programs" ) == 0 )
+				programsCount = std::max( number_, 1u );
+			else if ( std::strcmp( argv[i], "--width" ) == 0 )
+				surfaceWidth = std::max( number_, 1u );
+			else if ( std::strcmp( argv[i], "--height" ) == 0 )
+				surfaceHeight = std::max( number_, 1u );
+			else if ( std::strcmp( argv[i], "--out" ) == 0 )
+				outputFile = value_;
+			else if ( std::strcmp( argv[i], "--trace" ) == 0 )
+				traceFile = value_;
+			else
+				parsed_ = false;
+
+			if ( parsed_ )
+			{
+				i++;
+				continue;
+			}
+
+		}
+
+		// Usage
+		std::cout << "Usage: " << argv[0] << " [--frames N] [--warmup N] [--sprites N] [--textures N] [--programs N] [--width N] [--height N] [--out FILE] [--trace FILE] [--null] [--texture-array]" << std::endl;
+
+		// Return FALSE
+		return( false );
+
+	}
+
+	// Return TRUE
+	return( true );
+
+}
+
+/*
+ * Creates OpenGL context (or NullGL) & framebuffer object.
+ *
+ * @return - 'true' if OK.
+*/
+const bool Initialize( ) noexcept
+{
+
+	// Print to the Log
+	c0de4un::Log::printInfo( "bench::Initialize" );
+
+	// Guarded-Block
+	try
+	{
+
+		// NullGL, no context
+		if ( nullBackend )
+			c0de4un::GLDispatch::useNull( );
+		else
+		{
+
+			// Create headless context
+			context = new c0de4un::HeadlessContext( );
+			if ( !context->Create( 3, 3 ) )
+				return( false );
+
+			// Entry points, GLEW not initialized (no window-system)
+			if ( !c0de4un::GLDispatch::useLoader( c0de4un::HeadlessContext::getProcAddress ) )
+				return( false );
+
+		}
+
+		// Renderer name
+		const GLubyte *const renderer_( glGetString( GL_RENDERER ) );
+		rendererName = renderer_ != nullptr ? reinterpret_cast<const char*>( renderer_ ) : "unknown";
+
+		// Color 2D-Texture
+		glGenTextures( 1, &framebufferTexture );
+		glBindTexture( GL_TEXTURE_2D, framebufferTexture );
+		glTexImage2D( GL_TEXTURE_2D, 0, GL_RGBA8, static_cast<GLsizei>( surfaceWidth ), static_cast<GLsizei>( surfaceHeight ), 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr );
+		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_NEAREST );
+		glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_NEAREST );
+		glBindTexture( GL_TEXTURE_2D, 0 );
+
+		// Framebuffer object, stays bound
+		glGenFramebuffers( 1, &framebuffer );
+		glBindFramebuffer( GL_FRAMEBUFFER, framebuffer );
+		glFramebufferTexture2D( GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_TEXTURE_2D, framebufferTexture, 0 );
+		if ( glCheckFramebufferStatus( GL_FRAMEBUFFER ) != GL_FRAMEBUFFER_COMPLETE )
+		{
+			c0de4un::Log::printError( "bench::Initialize - framebuffer incomplete" );
+			return( false );
+		}
+
+		// Viewport & clear color, like main
+		glViewport( 0, 0, static_cast<GLsizei>( surfaceWidth ), static_cast<GLsizei>( surfaceHeight ) );
+		glClearColor( 0.0f, 0.6f, 0.8f, 1.0f );
+
+		// GPU time queries
+		if ( !nullBackend )
+			glGenQueries( GPU_QUERIES_COUNT, gpuQueries );
+
+		// Create GLRenderer
+		glRenderer = new c0de4un::GLRenderer( );
+
+		// GPU time of the Shader Program passes
+		if ( !nullBackend )
+			glRenderer->getGPUTimer( ).Load( );
+
+	}
+	catch ( const std::exception & exception_ )
+	{
+
+		// Log-message
+		std::string logMsg( "bench::Initialize - ERROR: " );
+		logMsg += exception_.what( );
+
+		// Print to the Log
+		c0de4un::Log::printError( logMsg.c_str( ) );
+
+		// Return FALSE
+		return( false );
+
+	}
+
+	// Return TRUE
+	return( true );
+
+}
+
+/*
+ * Creates Shader Programs, 2D-Textures & Sprites.
+ *
+ * @return - 'true' if OK.
+*/
+const bool Load( ) noexcept
+{
+
+	// Print to the Log
+	c0de4un::Log::printInfo( "bench::Load" );
+
+	// Guarded-Block
+	try
+	{
+
+		// Create 2D-Camera, Randomizer, JobSystem
+		glCamera2D = new c0de4un::GLCamera2D( 0, 0, static_cast<float>( surfaceWidth ), static_cast<float>( surfaceHeight ), 0, 1 );
+		randomizer = new c0de4un::Random( );
+		jobSystem = new c0de4un::JobSystem( c0de4un::JobSystem::getDefaultWorkersCount( ) );
+
+		// Shader Programs, sources differ so each one compiled & linked separately (main.cpp shaders)
+		c0de4un::ShaderCompiler shaderCompiler_;
+		for ( unsigned int i = 0; i < programsCount; i++ )
+		{
+
+			// Program ID
+			const std::string id_( std::to_string( i ) );
+
+			// Vertex Shader Source-Code, instanced & textured, array layer per instance (--texture-array)
+			const std::string vertexCode_(
+				"#version 330 \n"
+				"// program #" + id_ + " \n"
+				"in vec4 a_Position; \n"
+				"in vec2 a_TexCoord; \n"
+				"in mat2x4 a_Model; \n"
+				"in vec4 a_Color; \n"
+				"in vec4 a_UVRect; \n"
+				+ std::string( textureArray ? "in float a_TexLayer; \n" "flat out float v_TexLayer; \n" : "" ) +
+				"uniform mat4 u_ViewProj; \n"
+				"out vec2 v_TexCoord; \n"
+				"out vec4 v_Color; \n"
+				"void main() \n"
+				"{ \n"
+				"gl_Position = u_ViewProj * vec4( dot( a_Model[0], a_Position ), dot( a_Model[1], a_Position ), a_Position.zw ); \n"
+				"v_TexCoord = a_UVRect.xy + a_TexCoord * a_UVRect.zw; \n"
+				"v_Color = a_Color; \n"
+				+ std::string( textureArray ? "v_TexLayer = a_TexLayer; \n" : "" ) +
+				"} \n" );
+
+			// Fragment Shader Source-Code, tinted with sprite color
+			const std::string fragmentCode_(
+				"#version 330 \n"
+				"// program #" + id_ + " \n"
+				"in vec2 v_TexCoord; \n"
+				"in vec4 v_Color; \n"
+				"out vec4 fragColor; \n"
+				+ std::string( textureArray ? "flat in float v_TexLayer; \n" "uniform sampler2DArray s_texture; \n" : "uniform sampler2D s_texture; \n" ) +
+				"void main() \n"
+				"{ \n"
+				+ std::string( textureArray ? "fragColor = texture(s_texture, vec3(v_TexCoord, v_TexLayer)) * v_Color; \n" : "fragColor = texture(s_texture, v_TexCoord) * v_Color; \n" ) +
+				"} \n" );
+
+			// Create Shaders
+			c0de4un::GLShader *const vertexShader_( new c0de4un::GLShader( "vertexShader#" + id_, GL_VERTEX_SHADER, &vertexCode_, nullptr ) );
+			shaders.push_back( vertexShader_ );
+			c0de4un::GLShader *const fragmentShader_( new c0de4un::GLShader( "fragmentShader#" + id_, GL_FRAGMENT_SHADER, &fragmentCode_, nullptr ) );
+			shaders.push_back( fragmentShader_ );
+
+			// Create Shader Program
+			shaderPrograms.push_back( new c0de4un::GLShaderProgram( "shaderProgram#" + id_, *vertexShader_, *fragmentShader_, "a_Position", "a_TexCoord", "a_Color", "s_texture", "", "a_Model", "u_ViewProj", "a_UVRect", textureArray ? "a_TexLayer" : "" ) );
+			shaderCompiler_.Add( *shaderPrograms.back( ) );
+
+		}
+
+		// Load Shader Programs in parallel
+		shaderCompiler_.Start( );
+		if ( !shaderCompiler_.Wait( ) )
+		{
+			c0de4un::Log::printError( "bench::Load - failed to load Shader Programs" );
+			return( false );
+		}
+
+		// Generated 2D-Textures, checkers tinted per texture
+		std::vector<GLubyte> pixels_( static_cast<std::size_t>( TEXTURE_SIZE * TEXTURE_SIZE * 4 ) );
+		if ( textureArray )
+		{
+			texturePool = new c0de4un::TextureArrayPool( );
+			textureLayers.reserve( texturesCount );
+		}
+		else
+		{
+			textures.resize( texturesCount, 0 );
+			glGenTextures( static_cast<GLsizei>( texturesCount ), textures.data( ) );
+		}
+		for ( unsigned int i = 0; i < texturesCount; i++ )
+		{
+
+			// Pixels
+			for ( GLsizei y = 0; y < TEXTURE_SIZE; y++ )
+			{
+				for ( GLsizei x = 0; x < TEXTURE_SIZE; x++ )
+				{
+					GLubyte *const pixel_( &pixels_[static_cast<std::size_t>( ( y * TEXTURE_SIZE + x ) * 4 )] );
+					const GLubyte value_( ( ( x / 8 + y / 8 ) & 1 ) != 0 ? 255 : 96 );
+					pixel_[0] = static_cast<GLubyte>( value_ * ( ( i & 1 ) != 0 ? 1 : 0 ) );
+					pixel_[1] = static_cast<GLubyte>( value_ * ( ( i & 2 ) != 0 ? 1 : 0 ) );
+					pixel_[2] = static_cast<GLubyte>( ( i & 3 ) == 0 ? value_ : 0 );
+					pixel_[3] = 255;
+				}
+			}
+
+			// Upload to the 2D-Texture Array layer, same size so one array
+			if ( textureArray )
+			{
+				c0de4un::TextureLayer layer_{ 0, 0, 0, 0 };
+				std::string name_( "bench#" );
+				name_ += std::to_string( i );
+				if ( !texturePool->Acquire( name_, TEXTURE_SIZE, TEXTURE_SIZE, pixels_.data( ), layer_ ) )
+				{
+					c0de4un::Log::printError( "bench::Load - failed to allocate 2D-Texture Array layer" );
+					return( false );
+				}
+				textureLayers.push_back( std::move( name_ ) );
+				continue;
+			}
+
+			// Upload, single level (sampler uses mipmap filter)
+			glBindTexture( GL_TEXTURE_2D, textures[i] );
+			glTexImage2D( GL_TEXTURE_2D, 0, GL_RGBA8, TEXTURE_SIZE, TEXTURE_SIZE, 0, GL_RGBA, GL_UNSIGNED_BYTE, pixels_.data( ) );
+			glTexParameteri( GL_TEXTURE_2D, GL_TEXTURE_MAX_LEVEL, 0 );
+
+		}
+		glBindTexture( GL_TEXTURE_2D, 0 );
+
+		// OpenGL state set above unknown to the state cache
+		glRenderer->getStateCache( ).Invalidate( );
+
+		// Create SpriteSystem & Sprites
+		spritesSystem = new c0de4un::SpriteSystem( randomizer, jobSystem, surfaceWidth, surfaceHeight, std::max( spritesCount, 1u ) );
+		for ( unsigned int i = 0; i < spritesCount; i++ )
+		{
+			if ( textureArray )
+				spritesSystem->addSprite( *shaderPrograms[i % programsCount], *texturePool, textureLayers[i % texturesCount], glRenderer );
+			else
+				spritesSystem->addSprite( *shaderPrograms[i % programsCount], textures[i % texturesCount], glRenderer );
+		}
+
+	}
+	catch ( const std::exception & exception_ )
+	{
+
+		// Log-message
+		std::string logMsg( "bench::Load - ERROR: " );
+		logMsg += exception_.what( );
+
+		// Print to the Log
+		c0de4un::Log::printError( logMsg.c_str( ) );
+
+		// Return FALSE
+		return( false );
+
+	}
+
+	// Return TRUE
+	return( true );
+
+}
+
+/*
+ * Returns milliseconds between two time points.
+*/
+static double elapsedMs( const std::chrono::steady_clock::time_point & from_, const std::chrono::steady_clock::time_point & to_ ) noexcept
+{ return( std::chrono::duration<double, std::milli>( to_ - from_ ).count( ) ); }
+
+/*
+ * Reads GPU time query of the measured frame, waits if not available.
+ *
+ * @param frame_ - frame index, warmup included.
+*/
+static void readGPUTime( const unsigned int frame_ ) noexcept
+{
+
+	// Result
+	GLuint64 elapsed_( 0 );
+	glGetQueryObjectui64v( gpuQueries[frame_ % GPU_QUERIES_COUNT], GL_QUERY_RESULT, &elapsed_ );
+
+	// Warmup frame
+	if ( frame_ < warmupFrames )
+		return;
+
+	timings[frame_ - warmupFrames].gpu_ = static_cast<double>( elapsed_ ) / 1000000.0;
+
+}
+
+/*
+ * Draws warmup & measured frames.
+ *
+ * @return - 'true' if OK.
+*/
+const bool Run( ) noexcept
+{
+
+	// Print to the Log
+	c0de4un::Log::printInfo( "bench::Run" );
+
+	// Guarded-Block
+	try
+	{
+
+		// Frames
+		c0de4un::RenderSnapshot snapshot_;
+		const unsigned int frames_( warmupFrames + framesCount );
+		timings.assign( framesCount, FrameTimings( ) );
+		for ( unsigned int frame_ = 0; frame_ < frames_; frame_++ )
+		{
+
+			// NullGL counters per frame
+			if ( nullBackend )
+				c0de4un::NullGL::Reset( );
+
+			// GPU passes of the warmup frames discarded
+			if ( frame_ == warmupFrames )
+				glRenderer->getGPUTimer( ).Reset( );
+
+			// Update SpriteSystem
+			const std::chrono::steady_clock::time_point start_( std::chrono::steady_clock::now( ) );
+			spritesSystem->Update( FRAME_TIME );
+
+			// Write Render-Snapshot
+			const std::chrono::steady_clock::time_point updated_( std::chrono::steady_clock::now( ) );
+			spritesSystem->Snapshot( snapshot_ );
+
+			// Draw Render-Snapshot, GPU time measured
+			const std::chrono::steady_clock::time_point snapshotted_( std::chrono::steady_clock::now( ) );
+			if ( !nullBackend )
+				glBeginQuery( GL_TIME_ELAPSED, gpuQueries[frame_ % GPU_QUERIES_COUNT] );
+			glClear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT );
+			glRenderer->Draw( snapshot_, glCamera2D );
+			if ( !nullBackend )
+			{
+				glEndQuery( GL_TIME_ELAPSED );
+				glFlush( );
+			}
+			const std::chrono::steady_clock::time_point drawn_( std::chrono::steady_clock::now( ) );
+
+			// End frame
+			C0DE4UN_PROFILE_FRAME( );
+
+			// Oldest GPU time query, not measured (CPU runs ahead of the GPU like with Swap Buffers)
+			if ( !nullBackend && frame_ + 1 >= GPU_QUERIES_COUNT )
+				readGPUTime( frame_ + 1 - GPU_QUERIES_COUNT );
+
+			// Warmup frame
+			if ( frame_ < warmupFrames )
+				continue;
+
+			// Timings
+			FrameTimings & timings_( timings[frame_ - warmupFrames] );
+			timings_.update_ = elapsedMs( start_, updated_ );
+			timings_.snapshot_ = elapsedMs( updated_, snapshotted_ );
+			timings_.draw_ = elapsedMs( snapshotted_, drawn_ );
+			timings_.frame_ = elapsedMs( start_, drawn_ );
+			if ( nullBackend )
+			{
+				timings_.calls_ = c0de4un::NullGL::getTotalCallsCount( );
+				timings_.draws_ = c0de4un::NullGL::getDrawCallsCount( );
+			}
+
+		}
+
+		// Remaining GPU time queries
+		if ( !nullBackend )
+		{
+			glRenderer->getGPUTimer( ).Wait( );
+			const unsigned int first_( frames_ >= GPU_QUERIES_COUNT ? frames_ + 1 - GPU_QUERIES_COUNT : 0 );
+			for ( unsigned int frame_ = first_; frame_ < frames_; frame_++ )
+				readGPUTime( frame_ );
+		}
+
+	}
+	catch ( const std::exception & exception_ )
+	{
+
+		// Log-message
+		std::string logMsg( "bench::Run - ERROR: " );
+		logMsg += exception_.what( );
+
+		// Print to the Log
+		c0de4un::Log::printError( logMsg.c_str( ) );
+
+		// Return FALSE
+		return( false );
+
+	}
+
+	// Return TRUE
+	return( true );
+
+}
+
+/*
+ * Writes statistics of the frames timings field as JSON object.
+ *
+ * @param output_ - JSON output.
+ * @param name_ - field name.
+ * @param field_ - FrameTimings field.
+*/
+static void writeStats( std::ostream & output_, const char *const name_, double FrameTimings::*const field_ )
+{
+
+	// Sorted values
+	std::vector<double> values_;
+	values_.reserve( timings.size( ) );
+	double sum_( 0.0 );
+	for ( const FrameTimings & timings_ : timings )
+	{
+		values_.push_back( timings_.*field_ );
+		sum_ += timings_.*field_;
+	}
+	std::sort( values_.begin( ), values_.end( ) );
+
+	// Percentile
+	const auto percentile_ = [&values_]( const double rank_ ) -> double
+	{ return( values_[std::min( values_.size( ) - 1, static_cast<std::size_t>( rank_ * static_cast<double>( values_.size( ) ) ) )] ); };
+
+	output_ << "\"" << name_ << "\": { \"min\": " << values_.front( )
+		<< ", \"avg\": " << sum_ / static_cast<double>( values_.size( ) )
+		<< ", \"p50\": " << percentile_( 0.50 )
+		<< ", \"p95\": " << percentile_( 0.95 )
+		<< ", \"p99\": " << percentile_( 0.99 )
+		<< ", \"max\": " << values_.back( ) << " }";
+
+}
+
+/*
+ * Writes JSON report.
+ *
+ * @return - 'true' if written.
+*/
+const bool Report( )
+{
+
+	// Open
+	std::ofstream output_( outputFile, std::ios_base::out | std::ios_base::trunc );
+	if ( !output_.is_open( ) )
+	{
+		std::string logMsg( "bench::Report - failed to open " );
+		logMsg += outputFile;
+		c0de4un::Log::printError( logMsg.c_str( ) );
+		return( false );
+	}
+
+	// Renderer name, quotes & backslashes escaped
+	std::string renderer_;
+	for ( const char char_ : rendererName )
+	{
+		if ( char_ == '"' || char_ == '\\' )
+			renderer_ += '\\';
+		renderer_ += char_;
+	}
+
+	// Config
+	output_ << "{\n\"config\": { \"backend\": \"" << ( nullBackend ? "null" : "egl" )
+		<< "\", \"platform\": \"" << ( context != nullptr ? context->getPlatform( ) : std::string( "none" ) )
+		<< "\", \"renderer\": \"" << renderer_
+		<< "\", \"frames\": " << framesCount
+		<< ", \"warmup\": " << warmupFrames
+		<< ", \"sprites\": " << spritesCount
+		<< ", \"textures\": " << texturesCount
+		<< ", \"texture_array\": " << ( textureArray ? "true" : "false" )
+		<< ", \"programs\": " << programsCount
+		<< ", \"width\": " << surfaceWidth
+		<< ", \"height\": " << surfaceHeight << " },\n";
+
+	// Summary
+	output_ << "\"summary\": {\n";
+	writeStats( output_, "update_ms", &FrameTimings::update_ );
+	output_ << ",\n";
+	writeStats( output_, "snapshot_ms", &FrameTimings::snapshot_ );
+	output_ << ",\n";
+	writeStats( output_, "draw_ms", &FrameTimings::draw_ );
+	output_ << ",\n";
+	writeStats( output_, "frame_ms", &FrameTimings::frame_ );
+	output_ << ",\n";
+	writeStats( output_, "gpu_ms", &FrameTimings::gpu_ );
+	output_ << "\n},\n";
+
+	// GPU passes, statistics of the last measured frames (GPUTimer::HISTORY_FRAMES)
+	const c0de4un::GPUTimer & gpuTimer_( glRenderer->getGPUTimer( ) );
+	const std::vector<GLuint> passes_( gpuTimer_.getPasses( ) );
+	output_ << "\"gpu_passes\": [";
+	for ( std::size_t i = 0; i < passes_.size( ); i++ )
+	{
+
+		c0de4un::GPUTimings passTimings_;
+		gpuTimer_.getTimings( passes_[i], passTimings_ );
+		output_ << ( i > 0 ? ",\n" : "\n" ) << "{ \"pass\": \"";
+		if ( passes_[i] == c0de4un::GPUTimer::FRAME_PASS )
+			output_ << "frame";
+		else
+			output_ << "program_" << passes_[i];
+		output_ << "\", \"samples\": " << passTimings_.samples_
+			<< ", \"min_ms\": " << passTimings_.min_
+			<< ", \"avg_ms\": " << passTimings_.avg_
+			<< ", \"p99_ms\": " << passTimings_.p99_ << " }";
+
+	}
+	output_ << "\n],\n\"gpu_dropped_frames\": " << gpuTimer_.getDroppedCount( ) << ",\n";
+
+	// Frames
+	output_ << "\"frames\": [\n";
+	for ( std::size_t i = 0; i < timings.size( ); i++ )
+	{
+
+		const FrameTimings & timings_( timings[i] );
+		output_ << "{ \"frame\": " << i
+			<< ", \"update_ms\": " << timings_.update_
+			<< ", \"snapshot_ms\": " << timings_.snapshot_
+			<< ", \"draw_ms\": " << timings_.draw_
+			<< ", \"frame_ms\": " << timings_.frame_
+			<< ", \"gpu_ms\": " << timings_.gpu_;
+		if ( nullBackend )
+			output_ << ", \"gl_calls\": " << timings_.calls_ << ", \"draw_calls\": " << timings_.draws_;
+		output_ << ( i + 1 < timings.size( ) ? " },\n" : " }\n" );
+
+	}
+	output_ << "]\n}\n";
+
+	// Return TRUE if written
+	return( output_.good( ) );
+
+}
+
+/*
+ * Unloads OpenGL objects & releases memory.
+*/
+void Stop( ) noexcept
+{
+
+	// Print to the Log
+	c0de4un::Log::printInfo( "bench::Stop" );
+
+	// Guarded-Block
+	try
+	{
+
+		// Sprites & Sprite-Batches
+		if ( spritesSystem != nullptr )
+			spritesSystem->Stop( glRenderer );
+		if ( glRenderer != nullptr )
+			glRenderer->unloadBatches( );
+
+		// Shader Programs
+		for ( c0de4un::GLShaderProgram *const shaderProgram_ : shaderPrograms )
+		{
+			shaderProgram_->Unload( );
+			delete shaderProgram_;
+		}
+		shaderPrograms.clear( );
+
+		// Shaders
+		for ( c0de4un::GLShader *const shader_ : shaders )
+			delete shader_;
+		shaders.clear( );
+
+		// OpenGL objects
+		if ( context != nullptr || nullBackend )
+		{
+
+			if ( !textures.empty( ) )
+				glDeleteTextures( static_cast<GLsizei>( textures.size( ) ), textures.data( ) );
+			if ( framebuffer != 0 )
+				glDeleteFramebuffers( 1, &framebuffer );
+			if ( framebufferTexture != 0 )
+				glDeleteTextures( 1, &framebufferTexture );
+			if ( gpuQueries[0] != 0 )
+				glDeleteQueries( GPU_QUERIES_COUNT, gpuQueries );
+
+		}
+		textures.clear( );
+
+		// 2D-Texture Arrays
+		for ( const std::string & layer_ : textureLayers )
+			texturePool->Release( layer_ );
+		if ( texturePool != nullptr && ( context != nullptr || nullBackend ) )
+			texturePool->Unload( );
+		delete texturePool;
+		texturePool = nullptr;
+		textureLayers.clear( );
+
+		// Objects
+		delete spritesSystem;
+		spritesSystem = nullptr;
+		delete jobSystem;
+		jobSystem = nullptr;
+		delete randomizer;
+		randomizer = nullptr;
+		delete glCamera2D;
+		glCamera2D = nullptr;
+		delete glRenderer;
+		glRenderer = nullptr;
+
+		// Context
+		delete context;
+		context = nullptr;
+
+	}
+	catch ( const std::exception & exception_ )
+	{
+
+		// Log-message
+		std::string logMsg( "bench::Stop - ERROR: " );
+		logMsg += exception_.what( );
+
+		// Print to the Log
+		c0de4un::Log::printError( logMsg.c_str( ) );
+
+	}
+
+}
+
+/* MAIN */
+int main( int argc, char *argv[] )
+{
+
+	// Arguments
+	if ( !parseArguments( argc, argv ) )
+		return( EXIT_FAILURE );
+
+	// Profile measured frames
+	if ( !traceFile.empty( ) )
+	{
+#ifdef _C0DE4UN_PROFILER_ENABLED_ // PROFILER
+		C0DE4UN_PROFILE_THREAD( "Main" );
+		c0de4un::Profiler::Capture( warmupFrames, framesCount );
+#else // !PROFILER
+		c0de4un::Log::printWarning( "bench - profiler compiled out, --trace ignored (ROOT_PROJECT_PROFILER_ENABLED)" );
+#endif // PROFILER
+	}
+
+	// Run
+	bool result_( Initialize( ) && Load( ) && Run( ) );
+
+#ifdef _C0DE4UN_PROFILER_ENABLED_ // PROFILER
+	// Write captured frames
+	if ( result_ && !traceFile.empty( ) )
+		result_ = c0de4un::Profiler::writeChromeTrace( traceFile.c_str( ) );
+#endif // PROFILER
+
+	// Report
+	if ( result_ )
+	{
+
+		// Guarded-Block
+		try
+		{ result_ = Report( ); }
+		catch ( const std::exception & exception_ )
+		{
+			c0de4un::Log::printError( exception_.what( ) );
+			result_ = false;
+		}
+
+		// Summary
+		if ( result_ )
+		{
+			std::string logMsg( "bench - " );
+			logMsg += std::to_string( framesCount );
+			logMsg += " frames written to ";
+			logMsg += outputFile;
+			c0de4un::Log::printInfo( logMsg.c_str( ) );
+		}
+
+	}
+
+	// Stop
+	Stop( );
+
+	// Return
+	return( result_ ? EXIT_SUCCESS : EXIT_FAILURE );
+
+}
\ No newline at end of file
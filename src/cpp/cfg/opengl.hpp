@@ -31,4 +31,11 @@
 #error "opengl.hpp - configuration required"
 #endif // PC
 
+// gl* calls redirected to the active backend (driver or NullGL)
+#ifdef _C0DE4UN_GL_DISPATCH_ENABLED_
+#ifndef __c0de4un_gl_dispatch_hpp__
+#include "../renderer/dispatch/GLDispatch.hpp"
+#endif // !__c0de4un_gl_dispatch_hpp__
+#endif // _C0DE4UN_GL_DISPATCH_ENABLED_
+
 #endif // !__c0de4un_opengl_hpp__
\ No newline at end of file
@@ -0,0 +1,45 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_simd_hpp__
+#define __c0de4un_simd_hpp__
+
+// x86 & x86-64
+#if defined( _M_X64 ) || defined( _M_IX86 ) || defined( __x86_64__ ) || defined( __i386__ )
+#define __c0de4un_x86__ 1
+#endif // x86
+
+#ifdef __c0de4un_x86__
+
+// Include intrinsics
+#include <immintrin.h>
+
+#ifdef _MSC_VER // MSVC
+
+// Include __cpuid, _xgetbv
+#include <intrin.h>
+
+// MSVC allows any intrinsics without target flags
+#define __c0de4un_target_sse2__
+#define __c0de4un_target_avx2__
+#define __c0de4un_target_avx512__
+
+#else // GCC, Clang
+
+// Include __get_cpuid
+#include <cpuid.h>
+
+// Per-function instruction set, so project compiled without -mavx2 / -mavx512f
+#define __c0de4un_target_sse2__ __attribute__( ( target( "sse2" ) ) )
+#define __c0de4un_target_avx2__ __attribute__( ( target( "avx2" ) ) )
+#define __c0de4un_target_avx512__ __attribute__( ( target( "avx512f" ) ) )
+
+#endif // _MSC_VER
+
+#endif // __c0de4un_x86__
+
+#endif // !__c0de4un_simd_hpp__
\ No newline at end of file
@@ -8,11 +8,6 @@
 #ifndef __c0de4un_scale_hpp__
 #define __c0de4un_scale_hpp__
 
-// Include mutex
-#ifndef __c0de4un_mutex_hpp__
-#include "../cfg/mutex.hpp"
-#endif // !__c0de4un_mutex_hpp__
-
 // Include glm
 #ifndef __c0de4un_glm_hpp__
 #include "../cfg/glm.hpp"
@@ -41,9 +36,6 @@ namespace c0de4un
 		/* Scale vector */
 		glm::vec3 vec3_;
 
-		/* Shared (between systems) Thread-Lock */
-		std::unique_lock<std::mutex> * lock_;
-
 	};
 
 }
@@ -0,0 +1,48 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_sprite_handle_hpp__
+#define __c0de4un_sprite_handle_hpp__
+
+// Include STL
+#include <cstdint> // uint32_t
+
+// SpriteHandle declared
+#define __c0de4un_sprite_handle_decl__
+
+// Enable structure-data (fields, variables) alignment (by compilator) to 1 byte
+#pragma pack( push, 1 )
+
+namespace c0de4un
+{
+
+	/*
+	 * SpriteHandle - stable reference to the Sprite data in the SpriteStore.
+	 *
+	 * Sprite data moves inside SpriteStore (swap & pop on remove), so
+	 * handle stores slot index, resolved to the data index by SpriteStore.
+	 * Generation used to detect handles to removed Sprites.
+	 *
+	 * @version 1.0
+	*/
+	struct SpriteHandle final
+	{
+
+		/* Slot index */
+		uint32_t slot_;
+
+		/* Slot generation, changed each time slot released */
+		uint32_t generation_;
+
+	};
+
+}
+
+// Restore structure-data alignment to default (8-byte on MSVC)
+#pragma pack( pop )
+
+#endif // !__c0de4un_sprite_handle_hpp__
\ No newline at end of file
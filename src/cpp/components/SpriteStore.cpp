@@ -0,0 +1,552 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+// HEADER
+#ifndef __c0de4un_sprite_store_hpp__
+#include "SpriteStore.hpp"
+#endif // !__c0de4un_sprite_store_hpp__
+
+// Include RenderQueue
+#ifndef __c0de4un_render_queue_hpp__
+#include "../renderer/queue/RenderQueue.hpp"
+#endif // !__c0de4un_render_queue_hpp__
+
+// Include Log
+#ifndef __c0de4un_log_hpp__
+#include "../utils/log/Log.hpp"
+#endif // !__c0de4un_log_hpp__
+
+// Include STL
+#include <new> // std::align_val_t
+#include <cstring> // memcpy
+
+namespace c0de4un
+{
+
+	// -------------------------------------------------------- \\
+
+	// ===========================================================
+	// Utils
+	// ===========================================================
+
+	/*
+	 * Allocates aligned array & copies data of the previous one.
+	 *
+	 * @param pArray - previous array, released. Can be null.
+	 * @param size_ - number of elements to copy.
+	 * @param capacity_ - new array capacity.
+	 * @return - new array.
+	 * @throws - std::bad_alloc.
+	*/
+	template <typename T>
+	static T * reallocateArray( T *const pArray, const uint32_t size_, const uint32_t capacity_ )
+	{
+
+		// Allocate aligned memory
+		T *const result_( static_cast<T*>( ::operator new( sizeof( T ) * capacity_, std::align_val_t( SpriteStore::ALIGNMENT ) ) ) );
+
+		// Copy & release previous array
+		if ( pArray != nullptr )
+		{
+
+			// Copy
+			std::memcpy( result_, pArray, sizeof( T ) * size_ );
+
+			// Release
+			::operator delete( pArray, std::align_val_t( SpriteStore::ALIGNMENT ) );
+
+		}
+
+		// Return new array
+		return( result_ );
+
+	}
+
+	/*
+	 * Releases aligned array.
+	 *
+	 * @param pArray - array, set to null.
+	*/
+	template <typename T>
+	static void releaseArray( T *& pArray ) noexcept
+	{
+
+		// Release
+		if ( pArray != nullptr )
+			::operator delete( pArray, std::align_val_t( SpriteStore::ALIGNMENT ) );
+
+		// Reset pointer-value
+		pArray = nullptr;
+
+	}
+
+	/*
+	 * Moves bit between bitmask words.
+	 *
+	 * @param pWords - bitmask.
+	 * @param from_ - source bit index.
+	 * @param to_ - destination bit index.
+	*/
+	static void moveBit( uint64_t *const pWords, const uint32_t from_, const uint32_t to_ ) noexcept
+	{
+
+		// Destination bit
+		const uint64_t bit_( uint64_t( 1 ) << ( to_ % SpriteStore::CAPACITY_STEP ) );
+
+		// Copy bit
+		if ( ( pWords[from_ / SpriteStore::CAPACITY_STEP] >> ( from_ % SpriteStore::CAPACITY_STEP ) ) & 1 )
+			pWords[to_ / SpriteStore::CAPACITY_STEP] |= bit_;
+		else
+			pWords[to_ / SpriteStore::CAPACITY_STEP] &= ~bit_;
+
+	}
+
+	// ===========================================================
+	// Constructor & destructor
+	// ===========================================================
+
+	/*
+	 * SpriteStore constructor
+	 *
+	 * @param capacity_ - initial capacity (number of Sprites).
+	 * @throws - std::bad_alloc.
+	*/
+	SpriteStore::SpriteStore( const uint32_t capacity_ )
+		: mSize( 0 ),
+		mCapacity( 0 ),
+		mPosX( nullptr ),
+		mPosY( nullptr ),
+		mVelX( nullptr ),
+		mVelY( nullptr ),
+		mScaleX( nullptr ),
+		mScaleY( nullptr ),
+		mRotation( nullptr ),
+		mXAxisX( nullptr ),
+		mXAxisY( nullptr ),
+		mYAxisX( nullptr ),
+		mYAxisY( nullptr ),
+		mChanged( nullptr ),
+		mTransformChanged( nullptr ),
+		mSlots( ),
+		mIndices( ),
+		mGenerations( ),
+		mFreeSlots( ),
+		mDrawables( ),
+		mMutex( ),
+		mLock( mMutex, std::defer_lock )
+	{
+
+		// Log
+		Log::printDebug( "SpriteStore::constructor" );
+
+		// Allocate arrays
+		Reserve( capacity_ > 0 ? capacity_ : CAPACITY_STEP );
+
+	}
+
+	/* SpriteStore destructor */
+	SpriteStore::~SpriteStore( )
+	{
+
+		// Log
+		Log::printDebug( "SpriteStore::destructor" );
+
+		// Release arrays
+		Release( );
+
+	}
+
+	// ===========================================================
+	// Getter & Setter
+	// ===========================================================
+
+	/* Returns number of Sprites */
+	const uint32_t & SpriteStore::getSize( ) const noexcept
+	{ return( mSize ); }
+
+	/* Returns capacity (number of Sprites) */
+	const uint32_t & SpriteStore::getCapacity( ) const noexcept
+	{ return( mCapacity ); }
+
+	/* Returns X-positions array */
+	float * SpriteStore::getPosX( ) const noexcept
+	{ return( mPosX ); }
+
+	/* Returns Y-positions array */
+	float * SpriteStore::getPosY( ) const noexcept
+	{ return( mPosY ); }
+
+	/* Returns X-velocities array */
+	float * SpriteStore::getVelX( ) const noexcept
+	{ return( mVelX ); }
+
+	/* Returns Y-velocities array */
+	float * SpriteStore::getVelY( ) const noexcept
+	{ return( mVelY ); }
+
+	/* Returns X-scales (width) array */
+	float * SpriteStore::getScaleX( ) const noexcept
+	{ return( mScaleX ); }
+
+	/* Returns Y-scales (height) array */
+	float * SpriteStore::getScaleY( ) const noexcept
+	{ return( mScaleY ); }
+
+	/* Returns Z-rotations (degrees) array */
+	float * SpriteStore::getRotation( ) const noexcept
+	{ return( mRotation ); }
+
+	/* Returns Model X-axis x-components ( cos * scaleX ) array */
+	float * SpriteStore::getXAxisX( ) const noexcept
+	{ return( mXAxisX ); }
+
+	/* Returns Model X-axis y-components ( sin * scaleX ) array */
+	float * SpriteStore::getXAxisY( ) const noexcept
+	{ return( mXAxisY ); }
+
+	/* Returns Model Y-axis x-components ( -sin * scaleY ) array */
+	float * SpriteStore::getYAxisX( ) const noexcept
+	{ return( mYAxisX ); }
+
+	/* Returns Model Y-axis y-components ( cos * scaleY ) array */
+	float * SpriteStore::getYAxisY( ) const noexcept
+	{ return( mYAxisY ); }
+
+	/*
+	 * Returns 'changed' bitmask, one bit per Sprite (word = index / 64, bit = index % 64).
+	 * Bit set - Sprite moved (rotated, scaled).
+	*/
+	uint64_t * SpriteStore::getChanged( ) const noexcept
+	{ return( mChanged ); }
+
+	/*
+	 * Returns 'transform-changed' bitmask, one bit per Sprite.
+	 * Bit must be set after scale or rotation written, so Model axes rebuilt by TransformKernel.
+	 * Position is not part of it, moving Sprite never dirties its transform.
+	*/
+	uint64_t * SpriteStore::getTransformChanged( ) const noexcept
+	{ return( mTransformChanged ); }
+
+	/*
+	 * Returns Thread-Lock to synchronize access to all Sprites data.
+	 *
+	 * @thread_safety - thread-safe.
+	*/
+	std::unique_lock<std::mutex> & SpriteStore::getLock( ) noexcept
+	{ return( mLock ); }
+
+	/*
+	 * Returns 'true' if handle references existing Sprite.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @param handle_ - Sprite handle.
+	*/
+	const bool SpriteStore::isValid( const SpriteHandle & handle_ ) const noexcept
+	{ return( handle_.slot_ < mGenerations.size( ) && mGenerations[handle_.slot_] == handle_.generation_ ); }
+
+	/*
+	 * Returns data index of the Sprite.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @param handle_ - Sprite handle, must be valid.
+	*/
+	const uint32_t & SpriteStore::getIndex( const SpriteHandle & handle_ ) const noexcept
+	{
+
+#ifdef DEBUG // DEBUG
+		assert( isValid( handle_ ) );
+#endif // DEBUG
+
+		// Return data index
+		return( mIndices[handle_.slot_] );
+
+	}
+
+	/*
+	 * Returns handle of the Sprite at data index.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @param index_ - data index.
+	*/
+	const SpriteHandle SpriteStore::getHandle( const uint32_t & index_ ) const noexcept
+	{
+
+#ifdef DEBUG // DEBUG
+		assert( index_ < mSize );
+#endif // DEBUG
+
+		// Slot
+		const uint32_t slot_( mSlots[index_] );
+
+		// Return handle
+		return( SpriteHandle{ slot_, mGenerations[slot_] } );
+
+	}
+
+	/*
+	 * Returns Drawable of the Sprite.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @param handle_ - Sprite handle, must be valid.
+	*/
+	Drawable & SpriteStore::getDrawable( const SpriteHandle & handle_ ) noexcept
+	{
+
+#ifdef DEBUG // DEBUG
+		assert( isValid( handle_ ) );
+#endif // DEBUG
+
+		// Return Drawable
+		return( mDrawables[handle_.slot_] );
+
+	}
+
+	// ===========================================================
+	// Methods
+	// ===========================================================
+
+	/*
+	 * Re-allocates arrays & copies data.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @param capacity_ - new capacity, rounded up to the CAPACITY_STEP.
+	 * @throws - std::bad_alloc.
+	*/
+	void SpriteStore::Reserve( const uint32_t capacity_ )
+	{
+
+		// Round capacity up to the CAPACITY_STEP, so SIMD loops never run out of arrays
+		const uint32_t alignedCapacity_( ( ( capacity_ + CAPACITY_STEP - 1 ) / CAPACITY_STEP ) * CAPACITY_STEP );
+
+		// Cancel
+		if ( alignedCapacity_ <= mCapacity )
+			return;
+
+		// Re-allocate arrays
+		mPosX = reallocateArray( mPosX, mSize, alignedCapacity_ );
+		mPosY = reallocateArray( mPosY, mSize, alignedCapacity_ );
+		mVelX = reallocateArray( mVelX, mSize, alignedCapacity_ );
+		mVelY = reallocateArray( mVelY, mSize, alignedCapacity_ );
+		mScaleX = reallocateArray( mScaleX, mSize, alignedCapacity_ );
+		mScaleY = reallocateArray( mScaleY, mSize, alignedCapacity_ );
+		mRotation = reallocateArray( mRotation, mSize, alignedCapacity_ );
+		mXAxisX = reallocateArray( mXAxisX, mSize, alignedCapacity_ );
+		mXAxisY = reallocateArray( mXAxisY, mSize, alignedCapacity_ );
+		mYAxisX = reallocateArray( mYAxisX, mSize, alignedCapacity_ );
+		mYAxisY = reallocateArray( mYAxisY, mSize, alignedCapacity_ );
+		mChanged = reallocateArray( mChanged, mCapacity / CAPACITY_STEP, alignedCapacity_ / CAPACITY_STEP );
+		mTransformChanged = reallocateArray( mTransformChanged, mCapacity / CAPACITY_STEP, alignedCapacity_ / CAPACITY_STEP );
+
+		// Clear new changed-words
+		std::memset( mChanged + mCapacity / CAPACITY_STEP, 0, sizeof( uint64_t ) * ( ( alignedCapacity_ - mCapacity ) / CAPACITY_STEP ) );
+		std::memset( mTransformChanged + mCapacity / CAPACITY_STEP, 0, sizeof( uint64_t ) * ( ( alignedCapacity_ - mCapacity ) / CAPACITY_STEP ) );
+
+		// Reserve slots
+		mSlots.reserve( alignedCapacity_ );
+		mIndices.reserve( alignedCapacity_ );
+		mGenerations.reserve( alignedCapacity_ );
+
+		// Set capacity
+		mCapacity = alignedCapacity_;
+
+	}
+
+	/*
+	 * Releases arrays.
+	 *
+	 * @thread_safety - not thread-safe.
+	*/
+	void SpriteStore::Release( ) noexcept
+	{
+
+		// Release arrays
+		releaseArray( mPosX );
+		releaseArray( mPosY );
+		releaseArray( mVelX );
+		releaseArray( mVelY );
+		releaseArray( mScaleX );
+		releaseArray( mScaleY );
+		releaseArray( mRotation );
+		releaseArray( mXAxisX );
+		releaseArray( mXAxisY );
+		releaseArray( mYAxisX );
+		releaseArray( mYAxisY );
+		releaseArray( mChanged );
+		releaseArray( mTransformChanged );
+
+		// Reset size & capacity
+		mSize = 0;
+		mCapacity = 0;
+
+	}
+
+	/*
+	 * Add Sprite with default attributes.
+	 * Grows arrays, if capacity reached.
+	 *
+	 * @thread_safety - not thread-safe, lock required.
+	 * @return - Sprite handle.
+	 * @throws - std::bad_alloc.
+	*/
+	const SpriteHandle SpriteStore::Add( )
+	{
+
+		// Grow arrays
+		if ( mSize >= mCapacity )
+			Reserve( mCapacity * 2 );
+
+		// Slot
+		uint32_t slot_( 0 );
+
+		// Reuse released slot
+		if ( !mFreeSlots.empty( ) )
+		{
+
+			// Get slot
+			slot_ = mFreeSlots.back( );
+
+			// Remove from released slots
+			mFreeSlots.pop_back( );
+
+		}
+		else
+		{// New slot
+
+			// Slot index
+			slot_ = static_cast<uint32_t>( mIndices.size( ) );
+
+			// Add slot
+			mIndices.push_back( 0 );
+			mGenerations.push_back( 0 );
+			mDrawables.emplace_back( );
+
+		}
+
+		// Data index
+		const uint32_t index_( mSize++ );
+
+		// Link slot & data
+		mSlots.push_back( slot_ );
+		mIndices[slot_] = index_;
+
+		// Default attributes
+		mPosX[index_] = 0.0f;
+		mPosY[index_] = 0.0f;
+		mVelX[index_] = 0.0f;
+		mVelY[index_] = 0.0f;
+		mScaleX[index_] = 1.0f;
+		mScaleY[index_] = 1.0f;
+		mRotation[index_] = 0.0f;
+		mXAxisX[index_] = 1.0f;
+		mXAxisY[index_] = 0.0f;
+		mYAxisX[index_] = 0.0f;
+		mYAxisY[index_] = 1.0f;
+		mChanged[index_ / CAPACITY_STEP] |= uint64_t( 1 ) << ( index_ % CAPACITY_STEP );
+		mTransformChanged[index_ / CAPACITY_STEP] |= uint64_t( 1 ) << ( index_ % CAPACITY_STEP );
+
+		// Handle
+		const SpriteHandle handle_{ slot_, mGenerations[slot_] };
+
+		// Reset Drawable
+		Drawable & drawable_ = mDrawables[slot_];
+		drawable_.textureObject_ = 0;
+		drawable_.shaderProgram_ = 0;
+		drawable_.texSamplerLoc_ = -1;
+		drawable_.uvRect_[0] = 0.0f;
+		drawable_.uvRect_[1] = 0.0f;
+		drawable_.uvRect_[2] = 1.0f;
+		drawable_.uvRect_[3] = 1.0f;
+		drawable_.atlasRegion_ = 0;
+		drawable_.textureLayer_ = 0.0f;
+		drawable_.depth_ = 0.0f;
+		drawable_.layer_ = 0;
+		drawable_.blend_ = RenderQueue::BLEND_ALPHA;
+		drawable_.store_ = this;
+		drawable_.handle_ = handle_;
+
+		// Return handle
+		return( handle_ );
+
+	}
+
+	/*
+	 * Remove Sprite.
+	 * The last Sprite data moved to the removed Sprite data index.
+	 *
+	 * @thread_safety - not thread-safe, lock required.
+	 * @param handle_ - Sprite handle.
+	*/
+	void SpriteStore::Remove( const SpriteHandle & handle_ ) noexcept
+	{
+
+		// Cancel
+		if ( !isValid( handle_ ) )
+			return;
+
+		// Removed data index
+		const uint32_t index_( mIndices[handle_.slot_] );
+
+		// Last data index
+		const uint32_t lastIndex_( --mSize );
+
+		// Move last Sprite data to the removed one
+		if ( index_ != lastIndex_ )
+		{
+
+			// Move data
+			mPosX[index_] = mPosX[lastIndex_];
+			mPosY[index_] = mPosY[lastIndex_];
+			mVelX[index_] = mVelX[lastIndex_];
+			mVelY[index_] = mVelY[lastIndex_];
+			mScaleX[index_] = mScaleX[lastIndex_];
+			mScaleY[index_] = mScaleY[lastIndex_];
+			mRotation[index_] = mRotation[lastIndex_];
+			mXAxisX[index_] = mXAxisX[lastIndex_];
+			mXAxisY[index_] = mXAxisY[lastIndex_];
+			mYAxisX[index_] = mYAxisX[lastIndex_];
+			mYAxisY[index_] = mYAxisY[lastIndex_];
+
+			// Move changed bits
+			moveBit( mChanged, lastIndex_, index_ );
+			moveBit( mTransformChanged, lastIndex_, index_ );
+
+			// Re-link moved Sprite slot
+			const uint32_t movedSlot_( mSlots[lastIndex_] );
+			mSlots[index_] = movedSlot_;
+			mIndices[movedSlot_] = index_;
+
+		}
+
+		// Pop
+		mSlots.pop_back( );
+		mChanged[lastIndex_ / CAPACITY_STEP] &= ~( uint64_t( 1 ) << ( lastIndex_ % CAPACITY_STEP ) );
+		mTransformChanged[lastIndex_ / CAPACITY_STEP] &= ~( uint64_t( 1 ) << ( lastIndex_ % CAPACITY_STEP ) );
+
+		// Invalidate handles to the removed Sprite
+		mGenerations[handle_.slot_]++;
+
+		// Release slot
+		mFreeSlots.push_back( handle_.slot_ );
+
+	}
+
+	/*
+	 * Clears 'changed' bits, before the update phase sets them.
+	 *
+	 * @thread_safety - update phase only.
+	*/
+	void SpriteStore::ClearChanged( ) noexcept
+	{
+
+		// Words of the Sprites
+		std::memset( mChanged, 0, sizeof( uint64_t ) * ( ( mSize + CAPACITY_STEP - 1 ) / CAPACITY_STEP ) );
+
+	}
+
+	// -------------------------------------------------------- \\
+
+}
\ No newline at end of file
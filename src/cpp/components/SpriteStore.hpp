@@ -0,0 +1,333 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_sprite_store_hpp__
+#define __c0de4un_sprite_store_hpp__
+
+// Include std::vector
+#ifndef __c0de4un_vector_hpp__
+#include "../cfg/vector.hpp"
+#endif // !__c0de4un_vector_hpp__
+
+// Include mutex
+#ifndef __c0de4un_mutex_hpp__
+#include "../cfg/mutex.hpp" // std::mutex, std::unique_lock
+#endif // !__c0de4un_mutex_hpp__
+
+// Include SpriteHandle
+#ifndef __c0de4un_sprite_handle_hpp__
+#include "SpriteHandle.hpp"
+#endif // !__c0de4un_sprite_handle_hpp__
+
+// Include Drawable
+#ifndef __c0de4un_drawable_hpp__
+#include "../renderer/batch/Drawable.hpp"
+#endif // !__c0de4un_drawable_hpp__
+
+// Include STL
+#include <deque> // Drawables (stable addresses)
+
+// SpriteStore declared
+#define __c0de4un_sprite_store_decl__
+
+namespace c0de4un
+{
+
+	/*
+	 * SpriteStore - Structure-of-Arrays storage of Sprites data.
+	 *
+	 * Each attribute (position, velocity, scale, etc) stored in separate
+	 * contiguous & aligned array, indexed by Sprite data index [0; size),
+	 * so systems stream through memory linearly (auto-vectorization, SIMD).
+	 * Removed Sprite replaced by the last one (swap & pop), SpriteHandle
+	 * used to reference Sprite regardless of its data index.
+	 *
+	 * Drawables stored per slot, their addresses never change,
+	 * so they can be passed to the GLRenderer.
+	 *
+	 * Frame-phased ownership: update phase clears & writes 'changed' bits with Sprites data,
+	 * snapshot phase copies render state, each holding the store mutex once, no per-Sprite locks.
+	 * Phases must not overlap. Store mutex also guards structural changes (add, remove, show, hide).
+	 *
+	 * @version 1.0
+	*/
+	class SpriteStore final
+	{
+
+	public:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Config
+		// ===========================================================
+
+		/* Arrays alignment in bytes (cache-line) */
+		static constexpr std::size_t ALIGNMENT = 64;
+
+		/* Capacity granularity (number of Sprites, bits per changed-word), arrays capacity always multiple of it */
+		static constexpr uint32_t CAPACITY_STEP = 64;
+
+		// ===========================================================
+		// Constructor & destructor
+		// ===========================================================
+
+		/*
+		 * SpriteStore constructor
+		 *
+		 * @param capacity_ - initial capacity (number of Sprites).
+		 * @throws - std::bad_alloc.
+		*/
+		explicit SpriteStore( const uint32_t capacity_ );
+
+		/* SpriteStore destructor */
+		~SpriteStore( );
+
+		// ===========================================================
+		// Getter & Setter
+		// ===========================================================
+
+		/* Returns number of Sprites */
+		const uint32_t & getSize( ) const noexcept;
+
+		/* Returns capacity (number of Sprites) */
+		const uint32_t & getCapacity( ) const noexcept;
+
+		/* Returns X-positions array */
+		float * getPosX( ) const noexcept;
+
+		/* Returns Y-positions array */
+		float * getPosY( ) const noexcept;
+
+		/* Returns X-velocities array */
+		float * getVelX( ) const noexcept;
+
+		/* Returns Y-velocities array */
+		float * getVelY( ) const noexcept;
+
+		/* Returns X-scales (width) array */
+		float * getScaleX( ) const noexcept;
+
+		/* Returns Y-scales (height) array */
+		float * getScaleY( ) const noexcept;
+
+		/* Returns Z-rotations (degrees) array */
+		float * getRotation( ) const noexcept;
+
+		/* Returns Model X-axis x-components ( cos * scaleX ) array */
+		float * getXAxisX( ) const noexcept;
+
+		/* Returns Model X-axis y-components ( sin * scaleX ) array */
+		float * getXAxisY( ) const noexcept;
+
+		/* Returns Model Y-axis x-components ( -sin * scaleY ) array */
+		float * getYAxisX( ) const noexcept;
+
+		/* Returns Model Y-axis y-components ( cos * scaleY ) array */
+		float * getYAxisY( ) const noexcept;
+
+		/*
+		 * Returns 'changed' bitmask, one bit per Sprite (word = index / 64, bit = index % 64).
+		 * Bit set - Sprite moved (rotated, scaled).
+		*/
+		uint64_t * getChanged( ) const noexcept;
+
+		/*
+		 * Returns 'transform-changed' bitmask, one bit per Sprite.
+		 * Bit must be set after scale or rotation written, so Model axes rebuilt by TransformKernel.
+		 * Position is not part of it, moving Sprite never dirties its transform.
+		*/
+		uint64_t * getTransformChanged( ) const noexcept;
+
+		/*
+		 * Returns Thread-Lock to synchronize access to all Sprites data.
+		 *
+		 * @thread_safety - thread-safe.
+		*/
+		std::unique_lock<std::mutex> & getLock( ) noexcept;
+
+		/*
+		 * Returns 'true' if handle references existing Sprite.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param handle_ - Sprite handle.
+		*/
+		const bool isValid( const SpriteHandle & handle_ ) const noexcept;
+
+		/*
+		 * Returns data index of the Sprite.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param handle_ - Sprite handle, must be valid.
+		*/
+		const uint32_t & getIndex( const SpriteHandle & handle_ ) const noexcept;
+
+		/*
+		 * Returns handle of the Sprite at data index.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param index_ - data index.
+		*/
+		const SpriteHandle getHandle( const uint32_t & index_ ) const noexcept;
+
+		/*
+		 * Returns Drawable of the Sprite.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param handle_ - Sprite handle, must be valid.
+		*/
+		Drawable & getDrawable( const SpriteHandle & handle_ ) noexcept;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Add Sprite with default attributes.
+		 * Grows arrays, if capacity reached.
+		 *
+		 * @thread_safety - not thread-safe, lock required.
+		 * @return - Sprite handle.
+		 * @throws - std::bad_alloc.
+		*/
+		const SpriteHandle Add( );
+
+		/*
+		 * Remove Sprite.
+		 * The last Sprite data moved to the removed Sprite data index.
+		 *
+		 * @thread_safety - not thread-safe, lock required.
+		 * @param handle_ - Sprite handle.
+		*/
+		void Remove( const SpriteHandle & handle_ ) noexcept;
+
+		/*
+		 * Clears 'changed' bits, before the update phase sets them.
+		 *
+		 * @thread_safety - update phase only.
+		*/
+		void ClearChanged( ) noexcept;
+
+		// -------------------------------------------------------- \\
+
+	private:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Fields
+		// ===========================================================
+
+		/* Number of Sprites */
+		uint32_t mSize;
+
+		/* Capacity */
+		uint32_t mCapacity;
+
+		/* X-positions */
+		float * mPosX;
+
+		/* Y-positions */
+		float * mPosY;
+
+		/* X-velocities */
+		float * mVelX;
+
+		/* Y-velocities */
+		float * mVelY;
+
+		/* X-scales */
+		float * mScaleX;
+
+		/* Y-scales */
+		float * mScaleY;
+
+		/* Z-rotations (degrees) */
+		float * mRotation;
+
+		/* Model X-axis x-components */
+		float * mXAxisX;
+
+		/* Model X-axis y-components */
+		float * mXAxisY;
+
+		/* Model Y-axis x-components */
+		float * mYAxisX;
+
+		/* Model Y-axis y-components */
+		float * mYAxisY;
+
+		/* Changed bitmask */
+		uint64_t * mChanged;
+
+		/* Transform-changed bitmask */
+		uint64_t * mTransformChanged;
+
+		/* Data index -> slot */
+		std::vector<uint32_t> mSlots;
+
+		/* Slot -> data index */
+		std::vector<uint32_t> mIndices;
+
+		/* Slot -> generation */
+		std::vector<uint32_t> mGenerations;
+
+		/* Released slots */
+		std::vector<uint32_t> mFreeSlots;
+
+		/* Slot -> Drawable */
+		std::deque<Drawable> mDrawables;
+
+		/* Mutex */
+		std::mutex mMutex;
+
+		/* Thread-lock to synchronize access to the Sprites data */
+		std::unique_lock<std::mutex> mLock;
+
+		// ===========================================================
+		// Deleted
+		// ===========================================================
+
+		/* @deleted SpriteStore const copy constructor */
+		SpriteStore( const SpriteStore & ) = delete;
+
+		/* @deleted SpriteStore const copy assignment operator */
+		SpriteStore & operator=( const SpriteStore & ) = delete;
+
+		/* @deleted SpriteStore move constructor */
+		SpriteStore( SpriteStore && ) = delete;
+
+		/* @deleted SpriteStore move assignment operator */
+		SpriteStore & operator=( SpriteStore && ) = delete;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Re-allocates arrays & copies data.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param capacity_ - new capacity, rounded up to the CAPACITY_STEP.
+		 * @throws - std::bad_alloc.
+		*/
+		void Reserve( const uint32_t capacity_ );
+
+		/*
+		 * Releases arrays.
+		 *
+		 * @thread_safety - not thread-safe.
+		*/
+		void Release( ) noexcept;
+
+		// -------------------------------------------------------- \\
+
+	};
+
+}
+
+#endif // !__c0de4un_sprite_store_hpp__
\ No newline at end of file
@@ -8,6 +8,8 @@
 // Include STL
 #include <iostream> // cout, cin, cin.get
 #include <cstdlib> // std
+#include <thread> // thread
+#include <atomic> // atomic
 
 // Include opengl
 #ifndef __c0de4un_opengl_hpp__
@@ -19,11 +21,21 @@
 #include "utils/log/Log.hpp"
 #endif // !__c0de4un_log_hpp__
 
+// Include ProfileScope
+#ifndef __c0de4un_profile_scope_hpp__
+#include "utils/profiler/ProfileScope.hpp"
+#endif // !__c0de4un_profile_scope_hpp__
+
 // Include GLRenderer
 #ifndef __c0de4un_gl_renderer_hpp__
 #include "renderer/GLRenderer.hpp"
 #endif // !__c0de4un_gl_renderer_hpp__
 
+// Include SnapshotBuffer
+#ifndef __c0de4un_snapshot_buffer_hpp__
+#include "renderer/snapshot/SnapshotBuffer.hpp"
+#endif // !__c0de4un_snapshot_buffer_hpp__
+
 // Include GLShader
 #ifndef __c0de4un_gl_shader_hpp__
 #include "assets/shader/GLShader.hpp"
@@ -34,6 +46,16 @@
 #include "assets/shader/GLShaderProgram.hpp"
 #endif // !__c0de4un_gl_shader_program_hpp__
 
+// Include ProgramCache
+#ifndef __c0de4un_program_cache_hpp__
+#include "assets/shader/ProgramCache.hpp"
+#endif // !__c0de4un_program_cache_hpp__
+
+// Include ShaderCompiler
+#ifndef __c0de4un_shader_compiler_hpp__
+#include "assets/shader/ShaderCompiler.hpp"
+#endif // !__c0de4un_shader_compiler_hpp__
+
 // Include Sprite
 #ifndef __c0de4un_sprite_hpp__
 #include "objects/sprite/Sprite.hpp"
@@ -49,11 +71,61 @@
 #include "assets/texture/GLTexture2D.hpp"
 #endif // !__c0de4un_gl_texture_2D_hpp__
 
+// Include PNGImage
+#ifndef __c0de4un_png_image_hpp__
+#include "assets/image/PNGImage.hpp"
+#endif // !__c0de4un_png_image_hpp__
+
+// Include TextureCache
+#ifndef __c0de4un_texture_cache_hpp__
+#include "assets/image/TextureCache.hpp"
+#endif // !__c0de4un_texture_cache_hpp__
+
+// Include CompressedImage
+#ifndef __c0de4un_compressed_image_hpp__
+#include "assets/image/CompressedImage.hpp"
+#endif // !__c0de4un_compressed_image_hpp__
+
+// Include TextureFormats
+#ifndef __c0de4un_texture_formats_hpp__
+#include "assets/image/TextureFormats.hpp"
+#endif // !__c0de4un_texture_formats_hpp__
+
+// Include MappedFile
+#ifndef __c0de4un_mapped_file_hpp__
+#include "utils/io/MappedFile.hpp"
+#endif // !__c0de4un_mapped_file_hpp__
+
+// Include AssetPack
+#ifndef __c0de4un_asset_pack_hpp__
+#include "utils/io/AssetPack.hpp"
+#endif // !__c0de4un_asset_pack_hpp__
+
+// Include AssetLoader
+#ifndef __c0de4un_asset_loader_hpp__
+#include "assets/loader/AssetLoader.hpp"
+#endif // !__c0de4un_asset_loader_hpp__
+
+// Include TextureUploader
+#ifndef __c0de4un_texture_uploader_hpp__
+#include "assets/loader/TextureUploader.hpp"
+#endif // !__c0de4un_texture_uploader_hpp__
+
+// Include TextureAtlas
+#ifndef __c0de4un_texture_atlas_hpp__
+#include "assets/atlas/TextureAtlas.hpp"
+#endif // !__c0de4un_texture_atlas_hpp__
+
 // Include Random
 #ifndef __c0de4un_random_hpp__
 #include "utils/random/Random.hpp"
 #endif // !__c0de4un_random_hpp__
 
+// Include JobSystem
+#ifndef __c0de4un_job_system_hpp__
+#include "utils/jobs/JobSystem.hpp"
+#endif // !__c0de4un_job_system_hpp__
+
 // Include SpriteSystem
 #ifndef __c0de4un_sprite_system_hpp__
 #include "systems/SpriteSystem.hpp"
@@ -62,12 +134,51 @@
 /* Window & Viewport & Back Buffer Size */
 static const GLuint WINDOW_WIDTH = 1280, WINDOW_HEIGHT = 720;
 
+/* Asset pack, files read from it if built (main --pack) */
+static const char *const ASSET_PACK_FILE = "../../../assets/assets.pak";
+
+/* Decoded 2D-Textures passed to the uploader per frame, streaming (AssetLoader) */
+static const unsigned int UPLOADS_PER_FRAME = 4;
+
+/* Pixel bytes uploaded per frame, streaming (TextureUploader) */
+static const unsigned int UPLOAD_BUDGET_BYTES = 2 * 1024 * 1024;
+
+/* Sprite textures compressed to BC1/BC3 if supported (GLTexture2D) */
+static const bool COMPRESS_TEXTURES = true;
+
+/* Directory of the Shader Program binaries (ProgramCache) */
+static const char *const PROGRAM_CACHE_DIRECTORY = "../../../assets/";
+
+/* Frames between OpenGL state cache (DEBUG) & GPU time (main --gpu-timer) reports */
+static const unsigned int STATE_STATS_FRAMES = 600;
+
+/* First frame captured by the profiler (main --profile), after warm-up */
+static const unsigned long long PROFILE_FIRST_FRAME = 120;
+
+/* Frames captured by the profiler (main --profile) */
+static const unsigned long long PROFILE_FRAMES = 60;
+
+/* GPU time of the frame & Shader Program passes measured and reported (main --gpu-timer) */
+static bool gpuTimerEnabled( false );
+
 /* GLFW Window */
 static GLFWwindow *mGLFWWindow = nullptr;
 
 /* Random numbers generator (wrapper) */
 c0de4un::Random * randomizer;
 
+/* Job system - worker threads pool */
+c0de4un::JobSystem * jobSystem;
+
+/* Asset pack - mapped archive of assets, mounted if opened */
+c0de4un::AssetPack * assetPack;
+
+/* Asset loader - decodes 2D-Textures on own threads, uploads them on the render-thread */
+c0de4un::AssetLoader * assetLoader;
+
+/* Texture uploader - streams decoded 2D-Textures through PBOs on the render-thread */
+c0de4un::TextureUploader * textureUploader;
+
 /*
  * 2D Camera
 */
@@ -91,6 +202,14 @@ c0de4un::GLShaderProgram * shaderProgram;
 */
 c0de4un::GLTexture2D * texture2D;
 
+/*
+ * Texture Atlas, sprites images packed into shared pages
+*/
+c0de4un::TextureAtlas * textureAtlas;
+
+/* Sprite image region in the Texture Atlas, #0 - not packed */
+static uint32_t spriteRegion( 0 );
+
 /*
  * SpriteSystem - handles (manages) sprites.
 */
@@ -107,6 +226,15 @@ c0de4un::SpriteSystem * spritesSystem;
 */
 static c0de4un::GLRenderer * glRenderer( nullptr );
 
+/* Render-Snapshots triple buffer, written by simulation (main) thread & read by render-thread */
+static c0de4un::SnapshotBuffer * renderSnapshots( nullptr );
+
+/* Render-Thread, owns OpenGL context while main-loop runs */
+static std::thread renderThread;
+
+/* Render-Thread running flag */
+static std::atomic<bool> renderThreadRunning( false );
+
 /* GLFW Errors Callback */
 void glfwErrorCallback( int errorCode, const char* errorDescription ) noexcept
 {
@@ -189,7 +317,15 @@ void glfwMouseButtonCallback( GLFWwindow * pWindow, int pButton, int pAction, in
 
 		// Left
 		if ( pButton == GLFW_MOUSE_BUTTON_LEFT && pAction == GLFW_RELEASE )
-			spritesSystem->addSprite( *shaderProgram, texture2D, glRenderer );
+		{
+
+			// Texture Atlas region, or own 2D-Texture
+			if ( spriteRegion > 0 )
+				spritesSystem->addSprite( *shaderProgram, *textureAtlas, spriteRegion, glRenderer );
+			else
+				spritesSystem->addSprite( *shaderProgram, texture2D, glRenderer );
+
+		}
 
 	}
 	catch ( const std::exception & exception_ )
@@ -287,10 +423,27 @@ void Unload( ) noexcept
 		if ( spritesSystem != nullptr )
 			spritesSystem->Stop( glRenderer );
 
+		// Unload Sprite-Batches
+		if ( glRenderer != nullptr )
+			glRenderer->unloadBatches( );
+
+		// Finish decoding
+		if ( assetLoader != nullptr )
+			assetLoader->Wait( );
+
+		// Delete PBOs, drop queued uploads
+		if ( textureUploader != nullptr )
+			textureUploader->Unload( );
+
 		// Unload 2D-Texture
 		if ( texture2D != nullptr )
 			texture2D->Unload( );
 
+		// Unload Texture Atlas pages
+		if ( textureAtlas != nullptr )
+			textureAtlas->Unload( );
+		spriteRegion = 0;
+
 		// Unload Sprite
 		//if ( sprite_ )
 			//sprite_->Hide( glRenderer );
@@ -351,6 +504,18 @@ void Stop( ) noexcept
 
 		}
 
+		// Release Render-Snapshots
+		if ( renderSnapshots != nullptr )
+		{
+
+			// Delete SnapshotBuffer
+			delete renderSnapshots;
+
+			// Reset pointer-value
+			renderSnapshots = nullptr;
+
+		}
+
 		// Release SpriteSystem
 		if ( spritesSystem != nullptr )
 		{
@@ -363,6 +528,18 @@ void Stop( ) noexcept
 
 		}
 
+		// Release JobSystem (after SpriteSystem)
+		if ( jobSystem != nullptr )
+		{
+
+			// Delete JobSystem, joins worker threads
+			delete jobSystem;
+
+			// Reset pointer-value
+			jobSystem = nullptr;
+
+		}
+
 		// Release 2D-Camera
 		if ( glCamera2D )
 		{
@@ -375,6 +552,45 @@ void Stop( ) noexcept
 
 		}
 
+		// Release AssetLoader (before 2D-Textures), joins decode threads
+		if ( assetLoader != nullptr )
+		{
+
+			// Delete AssetLoader
+			delete assetLoader;
+
+			// Reset pointer-value
+			assetLoader = nullptr;
+
+		}
+
+		// Release TextureUploader
+		if ( textureUploader != nullptr )
+		{
+
+			// Delete TextureUploader
+			delete textureUploader;
+
+			// Reset pointer-value
+			textureUploader = nullptr;
+
+		}
+
+		// Release AssetPack (after decode threads stopped)
+		if ( assetPack != nullptr )
+		{
+
+			// Unmount
+			c0de4un::AssetPack::Mount( nullptr );
+
+			// Delete AssetPack
+			delete assetPack;
+
+			// Reset pointer-value
+			assetPack = nullptr;
+
+		}
+
 		// Release 2D-Texture
 		if ( texture2D != nullptr )
 		{
@@ -387,6 +603,18 @@ void Stop( ) noexcept
 
 		}
 
+		// Release Texture Atlas
+		if ( textureAtlas != nullptr )
+		{
+
+			// Delete TextureAtlas instance
+			delete textureAtlas;
+
+			// Reset pointer-value
+			textureAtlas = nullptr;
+
+		}
+
 		// Release Shader Program
 		if ( shaderProgram )
 		{
@@ -464,7 +692,183 @@ void Stop( ) noexcept
 }
 
 /*
- * Main-Loop
+ * Render-Loop, draws the latest Render-Snapshot.
+ * Runs on the Render-Thread, OpenGL context current to it.
+*/
+void renderLoop( ) noexcept
+{
+
+	// Print to the Log
+	c0de4un::Log::printInfo( "main::renderLoop" );
+
+	// Make OpenGL context current to the Render-Thread
+	glfwMakeContextCurrent( mGLFWWindow );
+
+	// Profile
+	C0DE4UN_PROFILE_THREAD( "Render" );
+
+	// Guarded-Block
+	try
+	{
+
+		// Frames since last OpenGL state cache report
+		unsigned int statsFrames_( 0 );
+
+		// OpenGL state set on the Main-Thread (loading) unknown to the state cache
+		glRenderer->getStateCache( ).Invalidate( );
+
+		// GPU time of the frame & Shader Program passes, reported with the state cache statistics
+		if ( gpuTimerEnabled )
+			glRenderer->getGPUTimer( ).Load( );
+
+		// Render-Loop
+		while ( renderThreadRunning.load( std::memory_order_acquire ) )
+		{
+
+			// Wait for the next Render-Snapshot
+			if ( !renderSnapshots->Acquire( ) )
+			{
+				renderSnapshots->WaitPublished( );
+				continue;
+			}
+
+			// Profile
+			C0DE4UN_PROFILE_SCOPE( "main::renderFrame" );
+
+			// Pass decoded 2D-Textures to the uploader
+			assetLoader->Update( UPLOADS_PER_FRAME, textureUploader );
+
+			// Stream pixels through PBOs, bytes limited per frame (uploads bypass the state cache)
+			if ( textureUploader->Update( UPLOAD_BUDGET_BYTES ) )
+				glRenderer->getStateCache( ).Invalidate( );
+
+			// Clear Surface
+			glClear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT );
+
+			// Draw Render-Snapshot
+			glRenderer->Draw( renderSnapshots->getReadSnapshot( ), glCamera2D );
+
+			// Swap Buffers
+			{
+				C0DE4UN_PROFILE_SCOPE( "glfwSwapBuffers" );
+				glfwSwapBuffers( mGLFWWindow );
+			}
+
+			// Report OpenGL state cache statistics
+			if ( ++statsFrames_ >= STATE_STATS_FRAMES )
+			{
+
+#ifdef DEBUG // DEBUG
+				// OpenGL state cache
+				const c0de4un::GLStateCache & stateCache_ = glRenderer->getStateCache( );
+
+				// Log-message
+				std::string logMsg( "main::renderLoop - GL state calls per " );
+				logMsg += std::to_string( STATE_STATS_FRAMES );
+				logMsg += " frames, issued ";
+				logMsg += std::to_string( stateCache_.getIssuedTotal( ) );
+				logMsg += ", elided ";
+				logMsg += std::to_string( stateCache_.getElidedTotal( ) );
+
+				// Calls
+				for ( unsigned char call_ = 0; call_ < c0de4un::GLStateCache::CALLS_COUNT; call_++ )
+				{
+					logMsg += "; ";
+					logMsg += c0de4un::GLStateCache::getCallName( call_ );
+					logMsg += ": ";
+					logMsg += std::to_string( stateCache_.getIssued( call_ ) );
+					logMsg += "/";
+					logMsg += std::to_string( stateCache_.getElided( call_ ) );
+				}
+
+				// Print to the Log
+				c0de4un::Log::printDebug( logMsg.c_str( ) );
+#endif // DEBUG
+
+				// GPU time of the frame & Shader Program passes, last frames
+				if ( gpuTimerEnabled )
+				{
+
+					// Log-message
+					const c0de4un::GPUTimer & gpuTimer_ = glRenderer->getGPUTimer( );
+					std::string logMsg( "main::renderLoop - GPU ms (min/avg/p99)" );
+					for ( const GLuint pass_ : gpuTimer_.getPasses( ) )
+					{
+
+						// Statistics
+						c0de4un::GPUTimings timings_;
+						if ( !gpuTimer_.getTimings( pass_, timings_ ) )
+							continue;
+
+						// Pass
+						if ( pass_ == c0de4un::GPUTimer::FRAME_PASS )
+							logMsg += "; frame: ";
+						else
+						{
+							logMsg += "; program #";
+							logMsg += std::to_string( pass_ );
+							logMsg += ": ";
+						}
+						logMsg += std::to_string( timings_.min_ );
+						logMsg += "/";
+						logMsg += std::to_string( timings_.avg_ );
+						logMsg += "/";
+						logMsg += std::to_string( timings_.p99_ );
+
+					}
+					logMsg += "; dropped frames: ";
+					logMsg += std::to_string( gpuTimer_.getDroppedCount( ) );
+
+					// Print to the Log
+					c0de4un::Log::printInfo( logMsg.c_str( ) );
+
+				}
+
+				// Reset counters
+				glRenderer->getStateCache( ).ResetCounters( );
+				statsFrames_ = 0;
+
+			}
+
+		}
+
+	}
+	catch ( const std::exception & exception_ )
+	{
+
+		// Log-message
+		std::string logMsg( "main::renderLoop - ERROR: " );
+		logMsg += exception_.what( );
+
+		// Print to the Log
+		c0de4un::Log::printError( logMsg.c_str( ) );
+
+		// Close GLFW Window
+		glfwSetWindowShouldClose( mGLFWWindow, true );
+
+	}
+	catch ( ... )
+	{
+
+		// Print to the Log
+		c0de4un::Log::printError( "main::renderLoop - unknown error !" );
+
+		// Close GLFW Window
+		glfwSetWindowShouldClose( mGLFWWindow, true );
+
+	}
+
+	// Wake Main-Thread waiting for Render-Snapshot consumption
+	renderSnapshots->Close( );
+
+	// Release OpenGL context
+	glfwMakeContextCurrent( nullptr );
+
+}
+
+/*
+ * Main-Loop.
+ * Simulation of frame N+1 runs while Render-Thread submits frame N.
 */
 void mainLoop( )
 {
@@ -476,26 +880,40 @@ void mainLoop( )
 	try
 	{
 
+		// Pass OpenGL context to the Render-Thread
+		glfwMakeContextCurrent( nullptr );
+
+		// Start Render-Thread
+		renderThreadRunning.store( true, std::memory_order_release );
+		renderThread = std::thread( renderLoop );
+
 		// Main-Loop
 		while ( !glfwWindowShouldClose( mGLFWWindow ) )
 		{
 
 			// Poll Events (Input Key, Mouse etc)
-			glfwPollEvents( );
-
-			// Clear Surface
-			glClear( GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT );
+			{
+				C0DE4UN_PROFILE_SCOPE( "glfwPollEvents" );
+				glfwPollEvents( );
+			}
 
 			// Update SpriteSystem
-			if ( spritesSystem != nullptr )
-				spritesSystem->Update( 0.016 );
+			spritesSystem->Update( 0.016 );
 
-			// Draw Sprite-Batch
-			if ( glRenderer )
-				glRenderer->Draw( glCamera2D );
+			// Write Render-Snapshot
+			spritesSystem->Snapshot( renderSnapshots->getWriteSnapshot( ) );
 
-			// Swap Buffers
-			glfwSwapBuffers( mGLFWWindow );
+			// Publish Render-Snapshot
+			renderSnapshots->Publish( );
+
+			// Run no more than one frame ahead of the Render-Thread (paced by its Swap Buffers)
+			{
+				C0DE4UN_PROFILE_SCOPE( "main::waitRender" );
+				renderSnapshots->WaitConsumed( );
+			}
+
+			// End frame
+			C0DE4UN_PROFILE_FRAME( );
 
 		}
 
@@ -519,6 +937,15 @@ void mainLoop( )
 
 	}
 
+	// Stop Render-Thread
+	renderThreadRunning.store( false, std::memory_order_release );
+	renderSnapshots->Close( );
+	if ( renderThread.joinable( ) )
+		renderThread.join( );
+
+	// Take OpenGL context back, to unload resources
+	glfwMakeContextCurrent( mGLFWWindow );
+
 }
 
 /*
@@ -533,6 +960,9 @@ const bool Load( ) noexcept
 	// Print to the Log
 	c0de4un::Log::printInfo( "main::Load" );
 
+	// Profile
+	C0DE4UN_PROFILE_SCOPE( "main::Load" );
+
 	// Guarded-Block
 	try
 	{
@@ -545,6 +975,31 @@ const bool Load( ) noexcept
 		if ( randomizer == nullptr )
 			randomizer = new c0de4un::Random( );
 
+		// Create JobSystem
+		if ( jobSystem == nullptr )
+			jobSystem = new c0de4un::JobSystem( c0de4un::JobSystem::getDefaultWorkersCount( ) );
+
+		// Mount asset pack, if built
+		if ( assetPack == nullptr )
+		{
+
+			// Create AssetPack
+			assetPack = new c0de4un::AssetPack( );
+
+			// Mount, files not packed read from disk
+			if ( assetPack->Open( ASSET_PACK_FILE ) )
+				c0de4un::AssetPack::Mount( assetPack );
+
+		}
+
+		// Create AssetLoader
+		if ( assetLoader == nullptr )
+			assetLoader = new c0de4un::AssetLoader( );
+
+		// Create TextureUploader, PBOs created by the Render-Thread
+		if ( textureUploader == nullptr )
+			textureUploader = new c0de4un::TextureUploader( );
+
 		// Create Vertex Shader
 		if ( vertexShader == nullptr )
 		{
@@ -566,24 +1021,52 @@ const bool Load( ) noexcept
 			//"v_Color = a_Color; \n"
 			//"} \n" );
 
+			///*
+			// * Vertex Shader Source-Code
+			// * No texture
+			// *
+			// * @attribute a_Position - vertex position.
+			// * @attribute a_Color - primitive color.
+			// * @attribute a_MVP - Model View Projection Matrix.
+			//*/
+			//const std::string glslCode_(
+			//	"#version 330 \n"
+			//	"in vec4 a_Position; \n"
+			//	"in vec2 a_TexCoord; \n"
+			//	"uniform mat4 u_MVP; \n"
+			//	"out vec2 v_TexCoord; \n"
+			//	"void main() \n"
+			//	"{ \n"
+			//	"gl_Position = ( u_MVP * a_Position ); \n"
+			//	"v_TexCoord = a_TexCoord; \n"
+			//	"} \n" );
+
 			/*
 			 * Vertex Shader Source-Code
-			 * No texture
+			 * Instanced, textured
 			 *
 			 * @attribute a_Position - vertex position.
-			 * @attribute a_Color - primitive color.
-			 * @attribute a_MVP - Model View Projection Matrix.
+			 * @attribute a_TexCoord - vertex texture coordinates.
+			 * @attribute a_Model - 2D affine Model Matrix rows (per-instance).
+			 * @attribute a_Color - sprite color (per-instance).
+			 * @attribute a_UVRect - 2D-Texture region ( u, v, width, height ) (per-instance).
+			 * @uniform u_ViewProj - Camera View-Projection Matrix (per-batch).
 			*/
 			const std::string glslCode_(
 				"#version 330 \n"
 				"in vec4 a_Position; \n"
 				"in vec2 a_TexCoord; \n"
-				"uniform mat4 u_MVP; \n"
+				"in mat2x4 a_Model; \n"
+				"in vec4 a_Color; \n"
+				"in vec4 a_UVRect; \n"
+				"uniform mat4 u_ViewProj; \n"
 				"out vec2 v_TexCoord; \n"
+				"out vec4 v_Color; \n"
 				"void main() \n"
 				"{ \n"
-				"gl_Position = ( u_MVP * a_Position ); \n"
-				"v_TexCoord = a_TexCoord; \n"
+				"gl_Position = u_ViewProj * vec4( dot( a_Model[0], a_Position ), dot( a_Model[1], a_Position ), a_Position.zw ); \n"
+				"v_TexCoord = a_UVRect.xy + a_TexCoord * a_UVRect.zw; \n"
+				"v_Color = a_Color; \n"
 				"} \n" );
 
 			// Create Vertex Shader
@@ -591,20 +1074,6 @@ const bool Load( ) noexcept
 
 		}
 
-		// Load Vertex Shader
-		if ( !vertexShader->Load( ) )
-		{
-
-			// Print to the Log
-			std::string logMsg( "main::Load - failed to load Vertex Shader#" );
-			logMsg += vertexShader->getName( );
-			c0de4un::Log::printWarning( logMsg.c_str( ) );
-
-			// Cancel
-			return( false );
-
-		}
-
 		// Create Fragment Shader
 		if ( fragmentShader == nullptr )
 		{
@@ -626,18 +1095,19 @@ const bool Load( ) noexcept
 
 			/*
 			 * Fragment Shader Source-Code
-			 * No texture
+			 * Textured, tinted with sprite color
 			 *
 			*/
 			const std::string glslCode_(
 				"#version 330 \n"
 				"precision mediump float; \n"
 				"in vec2 v_TexCoord; \n"
+				"in vec4 v_Color; \n"
 				"out vec4 fragColor; \n"
 				"uniform sampler2D s_texture; \n"
 				"void main() \n"
 				"{ \n"
-				"fragColor = texture(s_texture, v_TexCoord); \n"
+				"fragColor = texture(s_texture, v_TexCoord) * v_Color; \n"
 				"} \n" );
 
 			// Create Fragment Shader
@@ -645,26 +1115,15 @@ const bool Load( ) noexcept
 
 		}
 
-		// Load Fragment Shader
-		if ( !fragmentShader->Load( ) )
-		{
-
-			// Print to the Log
-			std::string logMsg( "main::Load - failed to load Fragment Shader#" );
-			logMsg += fragmentShader->getName( );
-			c0de4un::Log::printWarning( logMsg.c_str( ) );
-
-			// Cancel
-			return( false );
-
-		}
-
 		// Create Shader Program
 		if ( shaderProgram == nullptr )
-			shaderProgram = new c0de4un::GLShaderProgram( "shaderProgram", *vertexShader, *fragmentShader, "a_Position", "a_TexCoord", "", "s_texture", "u_MVP" );
+			shaderProgram = new c0de4un::GLShaderProgram( "shaderProgram", *vertexShader, *fragmentShader, "a_Position", "a_TexCoord", "a_Color", "s_texture", "", "a_Model", "u_ViewProj", "a_UVRect" );
 
-		// Load Shader Program
-		if ( !shaderProgram->Load( ) )
+		// Load Shader Programs in parallel, Shaders compiled only if program binary not cached
+		c0de4un::ShaderCompiler shaderCompiler_;
+		shaderCompiler_.Add( *shaderProgram );
+		shaderCompiler_.Start( );
+		if ( !shaderCompiler_.Wait( ) )
 		{
 
 			// Print to the Log
@@ -679,19 +1138,33 @@ const bool Load( ) noexcept
 
 		// Create 2D-Texture
 		if ( texture2D == nullptr )
-			texture2D = new c0de4un::GLTexture2D( "smile", "../../../assets/smiley_PNG188.png" );
+			texture2D = new c0de4un::GLTexture2D( "smile", "../../../assets/smiley_PNG188.png", COMPRESS_TEXTURES );
+
+		// Stream 2D-Texture, uploaded by the Render-Thread
+		assetLoader->Request( *texture2D );
 
-		// Load 2D-Texture
-		if ( !texture2D->Load( ) )
+		// Create Texture Atlas
+		if ( textureAtlas == nullptr )
+			textureAtlas = new c0de4un::TextureAtlas( );
+
+		// Pack sprite image into the Texture Atlas
+		if ( spriteRegion < 1 )
 		{
 
-			// Print to the Log
-			std::string logMsg( "main::Load - failed to load 2D Texture#" );
-			logMsg += texture2D->mName;
-			c0de4un::Log::printWarning( logMsg.c_str( ) );
+			// Sprite image
+			c0de4un::PNGImage image_( "../../../assets/smiley_PNG188.png" );
 
-			// Cancel
-			return( false );
+			// Load & pack
+			if ( image_.Load( ) )
+				spriteRegion = textureAtlas->Insert( image_ );
+
+			// Insert can defragment pages (regions UVs changed)
+			if ( spritesSystem != nullptr )
+				spritesSystem->refreshAtlas( *textureAtlas );
+
+			// Own 2D-Texture used, if not packed
+			if ( spriteRegion < 1 )
+				c0de4un::Log::printWarning( "main::Load - failed to pack sprite image into the Texture Atlas" );
 
 		}
 
@@ -705,9 +1178,13 @@ const bool Load( ) noexcept
 		// Show Sprite
 		//sprite_->Show( glRenderer );
 
+		// Create Render-Snapshots buffer
+		if ( renderSnapshots == nullptr )
+			renderSnapshots = new c0de4un::SnapshotBuffer( );
+
 		// Create SpriteSystem
 		if ( spritesSystem == nullptr )
-			spritesSystem = new c0de4un::SpriteSystem( randomizer, WINDOW_WIDTH, WINDOW_HEIGHT, 10 );
+			spritesSystem = new c0de4un::SpriteSystem( randomizer, jobSystem, WINDOW_WIDTH, WINDOW_HEIGHT, 10 );
 
 	}
 	catch ( const std::exception & exception_ )
@@ -772,8 +1249,8 @@ const bool Initialize( ) noexcept
 		// Set Major OpenGL Version
 		glfwWindowHint( GLFW_CONTEXT_VERSION_MAJOR, 3 );
 
-		// Set Minor OpenGL Version
-		glfwWindowHint( GLFW_CONTEXT_VERSION_MINOR, 0 );
+		// Set Minor OpenGL Version (3.3 - instanced attributes divisor)
+		glfwWindowHint( GLFW_CONTEXT_VERSION_MINOR, 3 );
 
 		// Crete GLFW Window
 		mGLFWWindow = glfwCreateWindow( WINDOW_WIDTH, WINDOW_HEIGHT, "OpenGL Sprite Batching", nullptr, nullptr );
@@ -810,6 +1287,17 @@ const bool Initialize( ) noexcept
 			return( false );
 		}
 
+#ifdef _C0DE4UN_GL_DISPATCH_ENABLED_
+		// Driver backend, after entry points loaded by GLEW
+		c0de4un::GLDispatch::useDriver( );
+#endif // _C0DE4UN_GL_DISPATCH_ENABLED_
+
+		// Detect compressed texture formats, before textures decoded
+		c0de4un::TextureFormats::Detect( );
+
+		// Shader Program binaries stored with assets
+		c0de4un::ProgramCache::setDirectory( PROGRAM_CACHE_DIRECTORY );
+
 		//Get OpenGL Surface Width
 		int surfaceWidth, surfaceHeight;
 
@@ -857,10 +1345,129 @@ const bool Initialize( ) noexcept
 
 }
 
+/*
+ * Cooks PNG images offline (see TextureCache), no window or OpenGL context required.
+ *
+ * @param filesCount_ - files count.
+ * @param files_ - PNG image paths.
+ * @param compress_ - 'true' to cook BC1/BC3 DDS files too (format support not checked).
+ * @return - process exit code, 0 if all cooked.
+*/
+int CookTextures( const int filesCount_, char** files_, const bool compress_ ) noexcept
+{
+
+	// Failed images count
+	int failed_( 0 );
+
+	// Cook images
+	for ( int i = 0; i < filesCount_; i++ )
+	{
+
+		// Guarded-Block
+		try
+		{
+
+			// Source hash
+			uint64_t sourceHash_( 0 );
+			const bool hashed_( c0de4un::TextureCache::HashFile( files_[i], sourceHash_ ) );
+
+			// Decode & cook, or map up-to-date cooked file
+			c0de4un::PNGImage image_( files_[i] );
+			const bool loaded_( hashed_ && image_.Load( sourceHash_, true ) );
+
+			// Check cooked file
+			c0de4un::MappedFile cooked_;
+			const bool cookedOK_( loaded_ && c0de4un::TextureCache::Open( image_.mFile, sourceHash_, cooked_ ) );
+
+			// Print to the console
+			std::cout << ( cookedOK_ ? "cooked " : "FAILED " ) << c0de4un::TextureCache::getCookedFile( image_.mFile ) << std::endl;
+
+			// Count failed
+			if ( !cookedOK_ )
+				failed_++;
+
+			// Encode & cook compressed image, then check it
+			if ( compress_ && cookedOK_ )
+			{
+
+				// Encode & write DDS
+				c0de4un::CompressedImage compressed_( c0de4un::TextureCache::getCompressedFile( image_.mFile ) );
+				c0de4un::TextureCache::CookCompressed( image_, sourceHash_, compressed_ );
+
+				// Load written DDS
+				compressed_.Unload( );
+				const bool compressedOK_( compressed_.Load( ) && compressed_.mSourceHash == sourceHash_ );
+
+				// Print to the console
+				std::cout << ( compressedOK_ ? "cooked " : "FAILED " ) << compressed_.mFile << std::endl;
+
+				// Count failed
+				if ( !compressedOK_ )
+					failed_++;
+
+			}
+
+		}
+		catch ( const std::exception & exception_ )
+		{
+
+			// Print to the console
+			std::cout << "FAILED " << files_[i] << " - " << exception_.what( ) << std::endl;
+
+			// Count failed
+			failed_++;
+
+		}
+
+	}
+
+	// Return exit code
+	return( failed_ );
+
+}
+
 /* MAIN */
 int main( int argC, char** argV )
 {
 
+	// Cook textures offline: --cook <png files>, --cook-bc <png files> (BC1/BC3 DDS too)
+	if ( argC > 1 && ( std::string( argV[1] ) == "--cook" || std::string( argV[1] ) == "--cook-bc" ) )
+		return( CookTextures( argC - 2, argV + 2, std::string( argV[1] ) == "--cook-bc" ) );
+
+	// Build asset pack offline: --pack <pack file> <files in the pack directory>
+	if ( argC > 2 && std::string( argV[1] ) == "--pack" )
+	{
+
+		// Write pack, entries compressed if smaller
+		const bool packed_( c0de4un::AssetPack::Write( argV[2], std::vector<std::string>( argV + 3, argV + argC ), true ) );
+
+		// Print to the console
+		std::cout << ( packed_ ? "packed " : "FAILED " ) << argV[2] << std::endl;
+
+		// Return exit code
+		return( packed_ ? 0 : 1 );
+
+	}
+
+	// Measure GPU time of the frame & Shader Program passes: --gpu-timer, last argument
+	gpuTimerEnabled = argC > 1 && std::string( argV[argC - 1] ) == "--gpu-timer";
+	if ( gpuTimerEnabled )
+		argC--;
+
+	// Profile frames: --profile <trace file> [first frame] [frames count], Chrome trace JSON written on exit
+#ifdef _C0DE4UN_PROFILER_ENABLED_ // PROFILER
+	const char *const traceFile_( argC > 2 && std::string( argV[1] ) == "--profile" ? argV[2] : nullptr );
+	if ( traceFile_ != nullptr )
+		c0de4un::Profiler::Capture( argC > 3 ? std::strtoull( argV[3], nullptr, 10 ) : PROFILE_FIRST_FRAME,
+			argC > 4 ? std::strtoull( argV[4], nullptr, 10 ) : PROFILE_FRAMES );
+#else // !PROFILER
+	if ( argC > 1 && std::string( argV[1] ) == "--profile" )
+		std::cout << "main - profiler compiled out, build with ROOT_PROJECT_PROFILER_ENABLED" << std::endl;
+#endif // PROFILER
+
+	// Profile
+	C0DE4UN_PROFILE_THREAD( "Main" );
+
 	// Print "Hello World !"
 	std::cout << "Hello World !" << std::endl;
 
@@ -903,6 +1510,12 @@ int main( int argC, char** argV )
 	// Main-Loop
 	mainLoop( );
 
+#ifdef _C0DE4UN_PROFILER_ENABLED_ // PROFILER
+	// Write captured frames, Render-Thread stopped
+	if ( traceFile_ != nullptr )
+		c0de4un::Profiler::writeChromeTrace( traceFile_ );
+#endif // PROFILER
+
 	// Unload Resources
 	Unload( );
 
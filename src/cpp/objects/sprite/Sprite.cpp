@@ -20,6 +20,11 @@
 #include "../../assets/texture/GLTexture2D.hpp"
 #endif // !__c0de4un_gl_texture_2D_hpp__
 
+// Include SpriteStore
+#ifndef __c0de4un_sprite_store_hpp__
+#include "../../components/SpriteStore.hpp"
+#endif // !__c0de4un_sprite_store_hpp__
+
 // Include BatchRequest
 #ifndef __c0de4un_batch_request_hpp__
 #include "../../renderer/batch/BatchRequest.hpp"
@@ -48,22 +53,34 @@ namespace c0de4un
 	 * Sprite constructor
 	 *
 	 * @param pName - Name.
+	 * @param store_ - Sprites data storage.
 	 * @param shaderProgram_ - Shader Program.
 	 * @param texture2D_ - 2D Texture.
+	 * @throws - std::bad_alloc.
 	*/
-	Sprite::Sprite( const std::string & pName, GLShaderProgram & shaderprogram_, GLTexture2D *const texture2D_ )
+	Sprite::Sprite( const std::string & pName, SpriteStore & store_, GLShaderProgram & shaderprogram_, GLTexture2D *const texture2D_ )
 		: GameObject( pName ),
 		mShaderProgram( shaderprogram_ ),
 		mGLTexture2D( texture2D_ ),
 		mVisible( false ),
-		mDrawable( ),
-		mLock( mMutex, std::defer_lock ),
-		mPosition { false, glm::vec3( 0.0f, 0.0f, 0.0f ), &mLock },
-		mRotation { false, glm::vec3( 0.0f, 0.0f, 0.0f ), &mLock },
-		mScale { false, glm::vec3( 100.0f, 100.0f, 0.0f ), &mLock },
-		mVelocity{ false, glm::vec3( 0.0f, 0.0f, 0.0f ), &mLock }
+		mStore( store_ ),
+		mHandle{ 0, 0 }
 	{
 
+		// Lock SpriteStore
+		mStore.getLock( ).lock( );
+
+		// Add Sprite data
+		mHandle = mStore.Add( );
+
+		// Default size
+		const uint32_t index_( mStore.getIndex( mHandle ) );
+		mStore.getScaleX( )[index_] = 100.0f;
+		mStore.getScaleY( )[index_] = 100.0f;
+
+		// Unlock SpriteStore
+		mStore.getLock( ).unlock( );
+
 		// Log
 		std::string logMsg( "Sprite#" );
 		logMsg += mName;
@@ -82,6 +99,15 @@ namespace c0de4un
 		logMsg += "::destructor";
 		Log::printDebug( logMsg.c_str( ) );
 
+		// Lock SpriteStore
+		mStore.getLock( ).lock( );
+
+		// Remove Sprite data
+		mStore.Remove( mHandle );
+
+		// Unlock SpriteStore
+		mStore.getLock( ).unlock( );
+
 	}
 
 	// ===========================================================
@@ -92,17 +118,22 @@ namespace c0de4un
 	const bool Sprite::isVisible( ) const noexcept
 	{ return( mVisible ); }
 
+	/* Returns Sprite handle in the SpriteStore */
+	const SpriteHandle & Sprite::getHandle( ) const noexcept
+	{ return( mHandle ); }
+
 	// ===========================================================
 	// Methods
 	// ===========================================================
 
 	/*
 	 * Make this Sprite visible.
-	 * Also load texture & shaders if required.
+	 * No GL calls: Shader Program loaded & 2D-Texture uploaded (AssetLoader) by the render thread first,
+	 * 'false' returned until then, Show must be called again later.
 	 *
-	 * @thread_safety - render-thread only.
+	 * @thread_safety - main thread, Shader Program & 2D-Texture must be already loaded.
 	 * @param renderSystem_ - GLRenderer. Used for Sprite-Batching.
-	 * @return - 'true' if OK.
+	 * @return - 'true' if OK, 'false' if Shader Program or 2D-Texture not loaded.
 	 * @throws - can throw exception.
 	*/
 	const bool Sprite::Show( GLRenderer *const renderSystem_ )
@@ -112,23 +143,24 @@ namespace c0de4un
 		if ( mVisible )
 			return( true );
 
-		// Lock
-		mLock.lock( );
-
 		// Log
 		std::string logMsg( "Sprite#" );
 		logMsg += mName;
 		logMsg += "::Show";
 		Log::printDebug( logMsg.c_str( ) );
 
-		// Load Shader Program
-		if ( !mShaderProgram.Load( ) )
+#ifdef DEBUG // DEBUG
+		assert( mShaderProgram.isLoaded( ) && "Sprite::Show - Shader Program must be loaded by the render thread first" );
+#endif // DEBUG
+
+		// Cancel, if Shader Program not loaded (GL calls are render-thread only)
+		if ( !mShaderProgram.isLoaded( ) )
 		{
 
 			// Log
 			logMsg = "Sprite#";
 			logMsg += mName;
-			logMsg += "::Show - failed to load shader program#";
+			logMsg += "::Show - shader program not loaded#";
 			logMsg += mShaderProgram.getName( );
 			Log::printDebug( logMsg.c_str( ) );
 
@@ -137,15 +169,14 @@ namespace c0de4un
 
 		}
 
-		// Load 2D-Texture
-		if ( mGLTexture2D != nullptr && !mGLTexture2D->Load( ) )
+		// Cancel, if 2D-Texture not uploaded yet (AssetLoader uploads on the render thread)
+		if ( mGLTexture2D != nullptr && !mGLTexture2D->isLoaded( ) )
 		{
 
 			// Log
 			logMsg = "Sprite#";
 			logMsg += mName;
-			logMsg += "::Show - failed to load shader program#";
-			logMsg += mShaderProgram.getName( );
+			logMsg += "::Show - 2D-Texture not loaded yet";
 			Log::printDebug( logMsg.c_str( ) );
 
 			// Cancel
@@ -153,56 +184,28 @@ namespace c0de4un
 
 		}
 
-		// Set OpenGL Texture Object ID
-		mDrawable.textureObject_ = mGLTexture2D != nullptr ? mGLTexture2D->getTextureObject( ) : 0;
-		mDrawable.texSamplerLoc_ = mDrawable.textureObject_ > 0 ? mShaderProgram.getTextureSamplerLocation( ) : -1;
-
-		// Set OpenGL Shader Program ID
-		mDrawable.shaderProgram_ = mShaderProgram.getProgramObject( );
-
-		// Set Drawable Position
-		mDrawable.position_ = &mPosition;
-		mDrawable.position_->changed_ = true;
-
-		// Set Drawable Rotation
-		mDrawable.rotation_ = &mRotation;
-		mDrawable.rotation_->changed_ = true;
+		// Lock SpriteStore
+		mStore.getLock( ).lock( );
 
-		// Set Drawable Scale
-		mDrawable.scale_ = &mScale;
-		mDrawable.scale_->changed_ = true;
+		// Get Drawable
+		Drawable & drawable_ = mStore.getDrawable( mHandle );
 
-		// Set Drawable Lock
-		mDrawable.lock_ = &mLock;
+		// Set OpenGL Texture Object ID
+		drawable_.textureObject_ = mGLTexture2D != nullptr ? mGLTexture2D->getTextureObject( ) : 0;
+		drawable_.texSamplerLoc_ = drawable_.textureObject_ > 0 ? mShaderProgram.getTextureSamplerLocation( ) : -1;
 
-		// Set State changed flag
-		mDrawable.stateChanged_ = true;
+		// Set OpenGL Shader Program ID
+		drawable_.shaderProgram_ = mShaderProgram.getProgramObject( );
 
-		// Create BatchRequest
+		// Create BatchRequest, Shader Program locations
 		BatchRequest batchRequest_;
-
-		// Set Shader Program Object
-		batchRequest_.shaderProgram_ = mDrawable.shaderProgram_;
+		mShaderProgram.getBatchRequest( batchRequest_ );
 
 		// Set Texture Object ID
-		batchRequest_.textureObject_ = mDrawable.textureObject_;
-
-		// Set Vertex Position attribute location/index
-		batchRequest_.vertexPosAttrIndex_ = mShaderProgram.getVertexPosAttrIndex( );
-
-		// Set Vertex Color attribute location/index
-		batchRequest_.colorAttrIndex_ = mShaderProgram.getColorAttrIndex( );
-
-		// Set Vertex 2D-Texture Coordinates attribute location/index
-		batchRequest_.texCoordsAttrIndex_ = mShaderProgram.getVertexTexCoordsAttrIndex( );
-
-		// Set MVP (Model View Projection) Matrix uniform location/index
-		batchRequest_.mvpMatUniformIndex_ = mShaderProgram.getMVPUniform( );
+		batchRequest_.textureObject_ = drawable_.textureObject_;
 
 		// Set Drawable
-		batchRequest_.drawable_ = &mDrawable;
-
-		// Set 2D-Texture Sampler
+		batchRequest_.drawable_ = &drawable_;
 
 		// Add Drawable to batching
 		renderSystem_->addDrawable( batchRequest_ );
@@ -210,8 +213,8 @@ namespace c0de4un
 		// Set Visible flag
 		mVisible = true;
 
-		// Unlock
-		mLock.unlock( );
+		// Unlock SpriteStore
+		mStore.getLock( ).unlock( );
 
 		// Return TRUE
 		return( true );
@@ -238,17 +241,23 @@ namespace c0de4un
 		logMsg += "::Hide";
 		Log::printDebug( logMsg.c_str( ) );
 
-		// Lock
-		mLock.lock( );
+		// Lock SpriteStore
+		mStore.getLock( ).lock( );
+
+		// Get Drawable
+		Drawable & drawable_ = mStore.getDrawable( mHandle );
 
 		// Remove Drawable
-		renderSystem_->removeDrawable( &mDrawable, mShaderProgram.getProgramObject( ), mGLTexture2D != nullptr ? mGLTexture2D->getTextureObject( ) : 0 );
+		renderSystem_->removeDrawable( &drawable_, mShaderProgram.getProgramObject( ), drawable_.textureObject_ );
+
+		// Exclude from RenderSnapshots
+		drawable_.shaderProgram_ = 0;
 
 		// Set Visible flag
 		mVisible = false;
 
-		// Unlock
-		mLock.unlock( );
+		// Unlock SpriteStore
+		mStore.getLock( ).unlock( );
 
 	}
 
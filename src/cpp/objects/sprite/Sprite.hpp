@@ -8,11 +8,6 @@
 #ifndef __c0de4un_sprite_hpp__
 #define __c0de4un_sprite_hpp__
 
-// Include mutex
-#ifndef __c0de4un_mutex_hpp__
-#include "../../cfg/mutex.hpp" // std::mutex, std::unique_lock
-#endif // !__c0de4un_mutex_hpp__
-
 // Include GameObject
 #ifndef __c0de4un_game_object_hpp__
 #include "../GameObject.hpp"
@@ -36,30 +31,16 @@ namespace c0de4un { class GLTexture2D; }
 namespace c0de4un { class GLRenderer; }
 #endif // !__c0de4un_gl_renderer_decl__
 
-// Include Drawable
-#ifndef __c0de4un_drawable_hpp__
-#include "../../renderer/batch/Drawable.hpp"
-#endif // !__c0de4un_drawable_hpp__
-
-// Include Position
-#ifndef __c0de4un_position_hpp__
-#include "../../components/Position.hpp"
-#endif // !__c0de4un_position_hpp__
-
-// Include Rotation
-#ifndef __c0de4un_rotation_hpp__
-#include "../../components/Rotation.hpp"
-#endif // !__c0de4un_rotation_hpp__
+// Include SpriteHandle
+#ifndef __c0de4un_sprite_handle_hpp__
+#include "../../components/SpriteHandle.hpp"
+#endif // !__c0de4un_sprite_handle_hpp__
 
-// Include Scale
-#ifndef __c0de4un_scale_hpp__
-#include "../../components/Scale.hpp"
-#endif // !__c0de4un_scale_hpp__
-
-// Include Velocity
-#ifndef __c0de4un_velocity_hpp__
-#include "../../components/Velocity.hpp"
-#endif // !__c0de4un_velocity_hpp__
+// Forward-declaration of SpriteStore
+#ifndef __c0de4un_sprite_store_decl__
+#define __c0de4un_sprite_store_decl__
+namespace c0de4un { class SpriteStore; }
+#endif // !__c0de4un_sprite_store_decl__
 
 // Sprite declared
 #define __c0de4un_sprite_decl__
@@ -69,6 +50,8 @@ namespace c0de4un
 
 	/*
 	 * Sprite - sprite game object.
+	 * Sprite data (position, velocity, scale, Drawable) stored in the SpriteStore,
+	 * Sprite only references it by handle.
 	 *
 	 * @version 1.0
 	*/
@@ -92,8 +75,11 @@ namespace c0de4un
 		/* Visibility flag */
 		bool mVisible;
 
-		/* Mutex */
-		std::mutex mMutex;
+		/* Sprites data storage */
+		SpriteStore & mStore;
+
+		/* Sprite handle in the SpriteStore */
+		SpriteHandle mHandle;
 
 		// ===========================================================
 		// Deleted
@@ -117,28 +103,6 @@ namespace c0de4un
 
 		// -------------------------------------------------------- \\
 
-		// ===========================================================
-		// Fields
-		// ===========================================================
-
-		/* Drawable */
-		Drawable mDrawable;
-
-		/* Position component. */
-		Position mPosition;
-
-		/* Rotation component */
-		Rotation mRotation;
-
-		/* Scale component */
-		Scale mScale;
-
-		/* Velocity */
-		Velocity mVelocity;
-
-		/* Thread-Lock */
-		std::unique_lock<std::mutex> mLock;
-
 		// ===========================================================
 		// Constructor & destructor
 		// ===========================================================
@@ -147,10 +111,12 @@ namespace c0de4un
 		 * Sprite constructor
 		 *
 		 * @param pName - Name.
+		 * @param store_ - Sprites data storage.
 		 * @param shaderProgram_ - Shader Program.
 		 * @param texture2D_ - 2D Texture.
+		 * @throws - std::bad_alloc.
 		*/
-		explicit Sprite( const std::string & pName, GLShaderProgram & shaderprogram_, GLTexture2D *const texture2D_ );
+		explicit Sprite( const std::string & pName, SpriteStore & store_, GLShaderProgram & shaderprogram_, GLTexture2D *const texture2D_ );
 
 		/* Sprite destructor */
 		virtual ~Sprite( );
@@ -162,17 +128,21 @@ namespace c0de4un
 		/* Returns 'TRUE' if visible (added in Sprite-Batching) */
 		const bool isVisible( ) const noexcept;
 
+		/* Returns Sprite handle in the SpriteStore */
+		const SpriteHandle & getHandle( ) const noexcept;
+
 		// ===========================================================
 		// Methods
 		// ===========================================================
 
 		/*
 		 * Make this Sprite visible.
-		 * Also load texture & shaders if required.
+		 * No GL calls: Shader Program loaded & 2D-Texture uploaded (AssetLoader) by the render thread first,
+		 * 'false' returned until then, Show must be called again later.
 		 *
-		 * @thread_safety - render-thread only.
+		 * @thread_safety - main thread, Shader Program & 2D-Texture must be already loaded.
 		 * @param renderSystem_ - GLRenderer. Used for Sprite-Batching.
-		 * @return - 'true' if OK.
+		 * @return - 'true' if OK, 'false' if Shader Program or 2D-Texture not loaded.
 		 * @throws - can throw exception.
 		*/
 		const bool Show( GLRenderer *const renderSystem_ );
@@ -8,11 +8,6 @@
 #ifndef __c0de4un_body_hpp__
 #define __c0de4un_body_hpp__
 
-// Include mutex
-#ifndef __c0de4un_mutex_hpp__
-#include "../cfg/mutex.hpp" // std::mutex, std::unique_lock
-#endif // !__c0de4un_mutex_hpp__
-
 // Body declared
 #define __c0de4un_body_decl__
 
@@ -27,9 +22,6 @@ namespace c0de4un
 	struct Body final
 	{
 		
-		/* Thread-Lock */
-		std::unique_lock<std::mutex> * lock_;
-
 		/* Position-vector */
 
 		/* Position changed-flag */
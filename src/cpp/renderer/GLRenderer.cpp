@@ -15,21 +15,47 @@
 #include "batch/BatchInfo.hpp"
 #endif // !__c0de4un_batch_info_hpp__
 
+// Include InstanceData
+#ifndef __c0de4un_instance_data_hpp__
+#include "batch/InstanceData.hpp"
+#endif // !__c0de4un_instance_data_hpp__
+
 // Include BatchRequest
 #ifndef __c0de4un_batch_request_hpp__
 #include "batch/BatchRequest.hpp"
 #endif // !__c0de4un_batch_request_hpp__
 
+// Include RenderSnapshot
+#ifndef __c0de4un_render_snapshot_hpp__
+#include "snapshot/RenderSnapshot.hpp"
+#endif // !__c0de4un_render_snapshot_hpp__
+
 // Include GLCamera2D
 #ifndef __c0de4un_gl_camera_2D_hpp__
 #include "../camera/GLCamera2D.hpp"
 #endif // !__c0de4un_gl_camera_2D_hpp__
 
+// Include RenderQueue
+#ifndef __c0de4un_render_queue_hpp__
+#include "queue/RenderQueue.hpp"
+#endif // !__c0de4un_render_queue_hpp__
+
 // Include Log
 #ifndef __c0de4un_log_hpp__
 #include "../utils/log/Log.hpp"
 #endif // !__c0de4un_log_hpp__
 
+// Include ProfileScope
+#ifndef __c0de4un_profile_scope_hpp__
+#include "../utils/profiler/ProfileScope.hpp"
+#endif // !__c0de4un_profile_scope_hpp__
+
+// Include STL
+#include <cstddef> // offsetof
+#include <cstring> // memcpy
+#include <algorithm> // find
+#include <stdexcept> // runtime_error
+
 namespace c0de4un
 {
 
@@ -77,6 +103,28 @@ namespace c0de4un
 
 	}
 
+	// ===========================================================
+	// Getter & Setter
+	// ===========================================================
+
+	/*
+	 * Returns OpenGL state cache (issued & elided calls counters).
+	 * Must be invalidated after OpenGL state changed outside renderer.
+	 *
+	 * @thread_safety - render-thread only.
+	*/
+	GLStateCache & GLRenderer::getStateCache( ) noexcept
+	{ return( mStateCache ); }
+
+	/*
+	 * Returns GPU timer of Draw: whole frame & each Shader Program pass.
+	 * Frames measured once loaded (GPUTimer::Load), Query Objects deleted by unloadBatches.
+	 *
+	 * @thread_safety - render-thread only.
+	*/
+	GPUTimer & GLRenderer::getGPUTimer( ) noexcept
+	{ return( mGPUTimer ); }
+
 	// ===========================================================
 	// Methods
 	// ===========================================================
@@ -98,12 +146,15 @@ namespace c0de4un
 		assert( batchInfo.vaoID_ < 1 ); // Already Loaded
 #endif // DEBUG
 
+		// Unbind VAO, so Indices Buffer Object binding doesn't change bound Sprite-Batch
+		mStateCache.BindVertexArray( 0 );
+
 		// Create OpenGL Vertex Buffer Objects (VBOs)
-		glGenBuffers( 3, &batchInfo.vboIDs_[0] );
+		glGenBuffers( BatchInfo::VBO_COUNT, &batchInfo.vboIDs_[0] );
 
 		// Check VBOs
-		if ( batchInfo.vboIDs_[2] < 1 )
-			throw std::exception( "GLRenderer::loadSpriteBatch - failed to create VBO !" );
+		if ( batchInfo.vboIDs_[BatchInfo::VBO_COUNT - 1] < 1 )
+			throw std::runtime_error( "GLRenderer::loadSpriteBatch - failed to create VBO !" );
 
 		// Create OpenGL Vertex Array Object
 		glGenVertexArrays( 1, &batchInfo.vaoID_ );
@@ -113,10 +164,10 @@ namespace c0de4un
 		{
 
 			// Delete VBOs
-			glDeleteBuffers( 3, &batchInfo.vboIDs_[0] );
+			glDeleteBuffers( BatchInfo::VBO_COUNT, &batchInfo.vboIDs_[0] );
 
 			// Throw exception
-			throw std::exception( "GLRenderer::loadSpriteBatch - failed to create VAO !" );
+			throw std::runtime_error( "GLRenderer::loadSpriteBatch - failed to create VAO !" );
 
 		}
 
@@ -154,7 +205,7 @@ namespace c0de4un
 		}
 
 		// Bind VAO (OpenGL Vertex Array Object)
-		glBindVertexArray( batchInfo.vaoID_ );
+		mStateCache.BindVertexArray( batchInfo.vaoID_ );
 
 		// 2D-Texture
 		if ( hasTexture )
@@ -183,8 +234,71 @@ namespace c0de4un
 		// Bind Indices Buffer Object ('IBO')
 		glBindBuffer( GL_ELEMENT_ARRAY_BUFFER, batchInfo.vboIDs_[BatchInfo::INDICES_VBO] );
 
+		// Per-Instance Attributes (Model, Color)
+		if ( batchInfo.modelMatAttrIndex_ >= 0 )
+		{
+
+			// Create Per-Instance Buffer Object (one region per frame)
+			batchInfo.instancesBuffer_.Load( MIN_INSTANCES_CAPACITY * sizeof( InstanceData ) );
+
+			// Model Matrix rows
+			for ( unsigned char row_ = 0; row_ < INSTANCE_MODEL_ROWS; row_++ )
+			{
+
+				// Enable 'Model Matrix row' Attribute Array
+				glEnableVertexAttribArray( batchInfo.modelMatAttrIndex_ + row_ );
+
+				// Advance Attribute once per instance
+				glVertexAttribDivisor( batchInfo.modelMatAttrIndex_ + row_, 1 );
+
+			}
+
+			// Color
+			if ( batchInfo.colorAttrIndex_ >= 0 )
+			{
+
+				// Enable 'Color' Attribute Array
+				glEnableVertexAttribArray( batchInfo.colorAttrIndex_ );
+
+				// Advance Attribute once per instance
+				glVertexAttribDivisor( batchInfo.colorAttrIndex_, 1 );
+
+			}
+
+			// 2D-Texture region
+			if ( batchInfo.uvRectAttrIndex_ >= 0 )
+			{
+
+				// Enable '2D-Texture region' Attribute Array
+				glEnableVertexAttribArray( batchInfo.uvRectAttrIndex_ );
+
+				// Advance Attribute once per instance
+				glVertexAttribDivisor( batchInfo.uvRectAttrIndex_, 1 );
+
+			}
+
+			// 2D-Texture Array layer
+			if ( batchInfo.texLayerAttrIndex_ >= 0 )
+			{
+
+				// Enable '2D-Texture Array layer' Attribute Array
+				glEnableVertexAttribArray( batchInfo.texLayerAttrIndex_ );
+
+				// Advance Attribute once per instance
+				glVertexAttribDivisor( batchInfo.texLayerAttrIndex_, 1 );
+
+			}
+
+			// Point OpenGL to the first instance
+			setInstanceAttributes( batchInfo, 0 );
+
+		}
+
 		// Unbind VAO
-		glBindVertexArray( 0 );
+		mStateCache.BindVertexArray( 0 );
+
+		// Unbind Buffer Object
+		glBindBuffer( GL_ARRAY_BUFFER, 0 );
 
 		// Return OK
 		return( true );
@@ -206,11 +320,17 @@ namespace c0de4un
 		assert( batchInfo.vboIDs_[0] > 0 ); // Not Loaded ?
 #endif // DEBUG
 
+		// Forget VAO binding
+		mStateCache.ForgetVertexArray( batchInfo.vaoID_ );
+
 		// Delete VAO
 		glDeleteVertexArrays( 1, &batchInfo.vaoID_ );
 
 		// Delete VBOs
-		glDeleteBuffers( 3, &batchInfo.vboIDs_[0] );
+		glDeleteBuffers( BatchInfo::VBO_COUNT, &batchInfo.vboIDs_[0] );
+
+		// Delete Per-Instance Buffer Object
+		batchInfo.instancesBuffer_.Unload( );
 
 	}
 
@@ -228,13 +348,34 @@ namespace c0de4un
 	const bool GLRenderer::loadShader( GLuint & shaderObject_, const char *const sourceCode_, const GLenum & shaderType_ )
 	{
 
+		// Create & compile
+		compileShader( shaderObject_, sourceCode_, shaderType_ );
+
+		// Wait & check compile status
+		return( checkShader( shaderObject_ ) );
+
+	}
+
+	/*
+	 * Creates Shader Object & starts compilation, compile status not checked (see checkShader).
+	 * Driver can compile in background (GL_KHR_parallel_shader_compile).
+	 *
+	 * @thread_safety - render-thread only.
+	 * @param shaderObject_ - output Shader Object ID.
+	 * @param sourceCode_ - RAW GLSL source-code.
+	 * @param shaderType_ - shader type.
+	 * @throws - can throw exception.
+	*/
+	void GLRenderer::compileShader( GLuint & shaderObject_, const char *const sourceCode_, const GLenum & shaderType_ )
+	{
+
 #ifdef DEBUG // DEBUG
 		assert( shaderObject_ == 0 );
 		assert( sourceCode_ != nullptr );
 #endif // DEBUG
 
 		// Log-message
-		std::string logMsg( "GLRenderer::loadShader - source-code=" );
+		std::string logMsg( "GLRenderer::compileShader - source-code=" );
 		logMsg += sourceCode_;
 
 		// Print to the Log
@@ -245,7 +386,7 @@ namespace c0de4un
 
 		// Check that Shader Object Pointer/ID is Valid
 		if ( shaderObject_ < 1 )
-			throw std::exception( "GLRenderer::loadShader - failed to create Shader Object !" );
+			throw std::runtime_error( "GLRenderer::compileShader - failed to create Shader Object !" );
 
 		// Upload Shader Source Code
 		glShaderSource( shaderObject_, 1, &sourceCode_, nullptr );
@@ -253,6 +394,20 @@ namespace c0de4un
 		// Compile Shader Source-Code
 		glCompileShader( shaderObject_ );
 
+	}
+
+	/*
+	 * Checks compile status of the Shader Object, waits if still compiling.
+	 * Failed Shader Object deleted.
+	 *
+	 * @thread_safety - render-thread only.
+	 * @param shaderObject_ - Shader Object ID, reset to 0 if failed.
+	 * @return - 'TRUE' if OK, false if failed.
+	 * @throws - can throw exception.
+	*/
+	const bool GLRenderer::checkShader( GLuint & shaderObject_ )
+	{
+
 		// Shader Compile Status
 		GLint compileStatus( 0 );
 
@@ -278,7 +433,7 @@ namespace c0de4un
 				glGetShaderInfoLog( shaderObject_, infoLen, nullptr, infoString );
 
 				// Error Details
-				std::string errMsg( "GLRenderer::loadShader - compilation failed, details: \n" );
+				std::string errMsg( "GLRenderer::checkShader - compilation failed, details: \n" );
 
 				// Append Log-Info
 				errMsg += infoString;
@@ -296,7 +451,7 @@ namespace c0de4un
 				Log::printError( errMsg.c_str( ) );
 
 				// Throw Exception
-				throw std::exception( errMsg.c_str( ), 5 );
+				throw std::runtime_error( errMsg.c_str( ) );
 			}
 			else // Throw Exception
 			{
@@ -307,10 +462,10 @@ namespace c0de4un
 				shaderObject_ = 0;
 
 				// Print Error to Log
-				Log::printError( "GLRenderer::loadShader - compilation failed, no log-info !" );
+				Log::printError( "GLRenderer::checkShader - compilation failed, no log-info !" );
 
 				// Throw Exception
-				throw std::exception( "GLRenderer::loadShader - compilation failed, no log-info !", 4 );
+				throw std::runtime_error( "GLRenderer::checkShader - compilation failed, no log-info !" );
 			}
 
 			// Return FALSE
@@ -335,6 +490,27 @@ namespace c0de4un
 	const bool GLRenderer::loadProgram( GLuint & shaderProgram_, const GLuint & vertexShader_, const GLuint & fragmentShader_ )
 	{
 
+		// Create & link
+		linkProgram( shaderProgram_, vertexShader_, fragmentShader_ );
+
+		// Wait & check link status
+		return( checkProgram( shaderProgram_ ) );
+
+	}
+
+	/*
+	 * Creates Shader Program & starts linking, link status not checked (see checkProgram).
+	 * Shaders can be still compiling, driver can link in background (GL_KHR_parallel_shader_compile).
+	 *
+	 * @thread_safety - render-thread only.
+	 * @param shaderProgram_ - output Shader Program Object ID.
+	 * @param vertexShader_ - Vertex Shader Object ID.
+	 * @param fragmentShader_ - Fragment Shader Object ID.
+	 * @throws - can throw exception.
+	*/
+	void GLRenderer::linkProgram( GLuint & shaderProgram_, const GLuint & vertexShader_, const GLuint & fragmentShader_ )
+	{
+
 #ifdef DEBUG // DEBUG
 		assert( vertexShader_ > 0 );
 		assert( fragmentShader_ > 0 );
@@ -345,7 +521,11 @@ namespace c0de4un
 
 		// Check Shader Program Object ID
 		if ( shaderProgram_ < 1 )
-			throw std::exception( "GLRenderer::loadProgram - failed to create Shader Program Object !" );
+			throw std::runtime_error( "GLRenderer::linkProgram - failed to create Shader Program Object !" );
+
+		// Allow glGetProgramBinary after link (see ProgramCache)
+		if ( GLEW_ARB_get_program_binary || GLEW_VERSION_4_1 )
+			glProgramParameteri( shaderProgram_, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE );
 
 		// Attach Vertex Shader
 		glAttachShader( shaderProgram_, vertexShader_ );
@@ -356,6 +536,19 @@ namespace c0de4un
 		// Link Shader Program
 		glLinkProgram( shaderProgram_ );
 
+	}
+
+	/*
+	 * Checks link status of the Shader Program, waits if still linking.
+	 *
+	 * @thread_safety - render-thread only.
+	 * @param shaderProgram_ - Shader Program Object ID.
+	 * @return - 'true' if OK.
+	 * @throws - can throw exception.
+	*/
+	const bool GLRenderer::checkProgram( const GLuint & shaderProgram_ )
+	{
+
 		// Link Status
 		GLint linkStatus;
 
@@ -381,7 +574,7 @@ namespace c0de4un
 				glGetProgramInfoLog( shaderProgram_, infoLen, nullptr, logStr );
 
 				// Error Message
-				std::string errMsg( "GLRenderer::loadProgram - Failed to link shader program object, \nDetails: " );
+				std::string errMsg( "GLRenderer::checkProgram - Failed to link shader program object, \nDetails: " );
 
 				// Append Details
 				errMsg += logStr;
@@ -393,7 +586,7 @@ namespace c0de4un
 				Log::printError ( errMsg.c_str( ) );
 
 				// Throw ShaderException
-				throw std::exception( errMsg.c_str( ) );
+				throw std::runtime_error( errMsg.c_str( ) );
 			}
 
 			// Return FALSE
@@ -407,9 +600,33 @@ namespace c0de4un
 	}
 
 	/*
-	 * Add Drawable-Object to the Sprite Batching.
+	 * Returns 'true' if Shader Program compile & link finished (status query won't block).
+	 * Always 'true' without GL_KHR_parallel_shader_compile (or ARB version).
 	 *
 	 * @thread_safety - render-thread only.
+	 * @param shaderProgram_ - Shader Program Object ID.
+	*/
+	const bool GLRenderer::isProgramCompleted( const GLuint & shaderProgram_ ) noexcept
+	{
+
+		// Cancel, if completion status not supported
+		if ( !GLEW_KHR_parallel_shader_compile && !GLEW_ARB_parallel_shader_compile )
+			return( true );
+
+		// Completion status (same value for KHR & ARB)
+		GLint completed_( GL_TRUE );
+		glGetProgramiv( shaderProgram_, GL_COMPLETION_STATUS_KHR, &completed_ );
+
+		// Return TRUE if completed
+		return( completed_ == GL_TRUE );
+
+	}
+
+	/*
+	 * Add Drawable-Object to the Sprite Batching.
+	 * Sprite-Batch OpenGL objects created by render-thread on the next Draw.
+	 *
+	 * @thread_safety - thread-lock used.
 	 * @param batchRequest - Batch Request.
 	 * @throws - can throw exception.
 	*/
@@ -421,16 +638,19 @@ namespace c0de4un
 		assert( batchRequest.shaderProgram_ > 0 );
 #endif // DEBUG
 
-		// Search BatchInfo
-		programs_map_t::const_iterator programsIterator_ = mPrograms.find( batchRequest.shaderProgram_ );
-		
+		// Lock Sprite-Batches
+		std::lock_guard<std::mutex> lock_( mMutex );
+
 		// Get BatchInfo
 		BatchInfo & batchInfo_ = mPrograms[batchRequest.shaderProgram_];
 
 		// SpriteBatch empty
-		if ( batchInfo_.vboIDs_[0] < 1 && batchInfo_.vertexPosAttrIndex_ < 0 )
+		if ( batchInfo_.vaoID_ < 1 && batchInfo_.vertexPosAttrIndex_ < 0 )
 		{
 
+			// Set SpriteBatch Shader Program
+			batchInfo_.shaderProgram_ = batchRequest.shaderProgram_;
+
 			// Set SpriteBatch 'Vertex Position' attribute index
 			batchInfo_.vertexPosAttrIndex_ = batchRequest.vertexPosAttrIndex_;
 
@@ -443,8 +663,20 @@ namespace c0de4un
 			// MVP (Model View Projection) Matrix uniform location/index
 			batchInfo_.mvpMatUniformLoc_ = batchRequest.mvpMatUniformIndex_;
 
-			// Load Sprite-Batch
-			loadSpriteBatch( batchRequest.textureObject_ > 0, batchInfo_ );
+			// 2D affine Model Matrix per-instance attribute location/index
+			batchInfo_.modelMatAttrIndex_ = batchRequest.modelMatAttrIndex_;
+
+			// View-Projection Matrix uniform location/index
+			batchInfo_.viewProjMatUniformLoc_ = batchRequest.viewProjMatUniformIndex_;
+
+			// 2D-Texture region attribute location/index
+			batchInfo_.uvRectAttrIndex_ = batchRequest.uvRectAttrIndex_;
+
+			// 2D-Texture Array layer attribute location/index
+			batchInfo_.texLayerAttrIndex_ = batchRequest.texLayerAttrIndex_;
+
+			// Texture target of the Shader Program sampler
+			batchInfo_.textureTarget_ = batchRequest.textureTarget_;
 
 		}
 
@@ -455,8 +687,9 @@ namespace c0de4un
 
 	/*
 	 * Remove Drawable-Object form the Sprite Batching.
+	 * Sprite-Batch without Drawables unloaded by render-thread on the next Draw.
 	 *
-	 * @thread_safety - render-thread only.
+	 * @thread_safety - thread-lock used.
 	 * @param pDrawable - Drawable-Object.
 	 * @param shaderProgram_ - OpenGL Shader Program ID (Pointer).
 	 * @param texture2D_ - OpenGL 2D Texture Object ID/Pointer.
@@ -470,6 +703,9 @@ namespace c0de4un
 		assert( shaderProgram_ > 0 );
 #endif // DEBUG
 
+		// Lock Sprite-Batches
+		std::lock_guard<std::mutex> lock_( mMutex );
+
 		// Search BatchInfo
 		programs_map_t::iterator batchInfoPos_ = mPrograms.find( shaderProgram_ );
 
@@ -485,269 +721,604 @@ namespace c0de4un
 
 		// Cancel if not found
 		if ( drawableObjectsPos_ == batchInfo_.textureObjects_.end( ) )
-		{
-
-			// Check BatchInfo size
-			if ( batchInfo_.textureObjects_.empty( ) )
-				unloadSpriteBatch( batchInfo_ ); // mPrograms.erase( shaderProgram_ );
-
-			// Return
 			return;
 
-		}
-
 		// Get 'reference' to the Drawable-Objects vector
 		std::vector<Drawable*> & drawableObjects_ = drawableObjectsPos_->second;
 
 		// Search Drawable
 		std::vector<Drawable*>::iterator drawableIterator_ = std::find( drawableObjects_.begin( ), drawableObjects_.end( ), pDrawable );
 
-		// Cancel if not found
-		if ( drawableIterator_ == drawableObjects_.end( ) )
-		{
-
-			// Remove Drawable-Objects vector
-			if ( batchInfo_.textureObjects_.size( ) > 1 )
-				batchInfo_.textureObjects_.erase( texture2D_ );
-			else // Remove BatchInfo
-				unloadSpriteBatch( batchInfo_ );  // mPrograms.erase( shaderProgram_ );
-
-			// Return
-			return;
-
-		}
-
 		// Swap & pop
-		if ( drawableObjects_.size( ) > 2 )
+		if ( drawableIterator_ != drawableObjects_.end( ) )
 		{
+
 			// Swap
 			std::swap( *drawableIterator_, drawableObjects_.back( ) );
-			//std::iter_swap( drawableIterator_, drawableObjects_.back( ) );
 
 			// Pop
 			drawableObjects_.pop_back( );
+
 		}
-		else
-			drawableObjects_.erase( drawableIterator_ );
 
 		// Remove Drawable-Objects vector
 		if ( drawableObjects_.empty( ) )
+			batchInfo_.textureObjects_.erase( drawableObjectsPos_ );
+
+	}
+
+	/*
+	 * Loads new Sprite-Batches & unloads Sprite-Batches without Drawables.
+	 * OpenGL work of the addDrawable & removeDrawable, deferred to the render-thread.
+	 *
+	 * @thread_safety - render-thread only, thread-lock must be locked.
+	 * @throws - can throw exception.
+	*/
+	void GLRenderer::syncBatches( )
+	{
+
+		// Profile
+		C0DE4UN_PROFILE_SCOPE( "GLRenderer::syncBatches" );
+
+		// Get Shader Programs map iterator
+		programs_map_t::iterator programsIterator_ = mPrograms.begin( );
+
+		// Shader Programs
+		while ( programsIterator_ != mPrograms.end( ) )
+		{
+
+			// Get BatchInfo
+			BatchInfo & batchInfo_ = programsIterator_->second;
+
+			// Sprite-Batch without Drawables
+			if ( batchInfo_.textureObjects_.empty( ) )
+			{
+
+				// Unload Sprite-Batch
+				if ( batchInfo_.vaoID_ > 0 )
+					unloadSpriteBatch( batchInfo_ );
+
+				// Forget Shader Program state (uniforms)
+				mStateCache.ForgetProgram( programsIterator_->first );
+
+				// Remove BatchInfo
+				programsIterator_ = mPrograms.erase( programsIterator_ );
+
+				// Next
+				continue;
+
+			}
+
+			// Load Sprite-Batch
+			if ( batchInfo_.vaoID_ < 1 )
+				loadSpriteBatch( batchInfo_.textureObjects_.rbegin( )->first > 0, batchInfo_ );
+
+			// Next
+			programsIterator_++;
+
+		}
+
+	}
+
+	/*
+	 * Calculates MVP (Model View Projection) Matrix of the given Render-Instance.
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param instance_ - Render-Instance.
+	 * @param viewProjMat_ - Camera Projection * View Matrix.
+	 * @param mvpMat_ - output MVP Matrix.
+	*/
+	void GLRenderer::calculateMVP( const RenderInstance & instance_, const glm::mat4 & viewProjMat_, glm::mat4 & mvpMat_ ) noexcept
+	{
+
+		// Model Matrix rows
+		const float *const model_( instance_.model_ );
+
+		// Model Matrix (column-major): X-axis, Y-axis, Z-axis, translation
+		const glm::mat4 modelMat_( model_[0], model_[4], 0.0f, 0.0f,
+			model_[1], model_[5], 0.0f, 0.0f,
+			0.0f, 0.0f, 1.0f, 0.0f,
+			model_[3], model_[7], 0.0f, 1.0f );
+
+		// Model-View-Projection Matrix (MVP)
+		mvpMat_ = viewProjMat_ * modelMat_;
+
+	}
+
+	/*
+	 * Draws Render-Instances one by one, MVP Matrix passed as uniform.
+	 * Used when Shader Program doesn't support instancing.
+	 *
+	 * @thread_safety - render-thread only.
+	 * @param batchInfo - Sprite-Batching component. VAO & Shader Program must be bound.
+	 * @param pInstances - Render-Instances of the Shader Program, sorted by 2D-Texture.
+	 * @param count_ - Render-Instances count.
+	 * @param viewProjMat_ - Camera Projection * View Matrix.
+	*/
+	void GLRenderer::drawSprites( const BatchInfo & batchInfo, const RenderInstance *const pInstances, const GLsizei count_, const glm::mat4 & viewProjMat_ )
+	{
+
+		// MVP Matrix
+		glm::mat4 mvpMat_;
+
+		// Render-Instances
+		for ( GLsizei i = 0; i < count_; i++ )
 		{
 
-			// Remove Drawable-Objects vector
-			if ( batchInfo_.textureObjects_.size( ) > 1 )
-				batchInfo_.textureObjects_.erase( texture2D_ );
-			else // Remove BatchInfo
-				unloadSpriteBatch( batchInfo_ );  // mPrograms.erase( shaderProgram_ );
+			// Render-Instance
+			const RenderInstance & instance_ = pInstances[i];
+
+			// Bind 2D-Texture or 2D-Texture Array to Texture Unit #0 (skipped, if already bound)
+			if ( batchInfo.textureTarget_ == GL_TEXTURE_2D_ARRAY )
+				mStateCache.BindTexture2DArray( 0, instance_.textureObject_ );
+			else
+				mStateCache.BindTexture2D( 0, instance_.textureObject_ );
+
+			// Set Shader Uniform Texture Sampler 2D to Texture Unit #0 (skipped, if already set)
+			if ( instance_.textureObject_ > 0 )
+				mStateCache.UniformSampler( instance_.texSamplerLoc_, 0 );
+
+			// Transfer (Upload) current Color-values (same color for all vertices)
+			if ( batchInfo.colorAttrIndex_ >= 0 )
+				glVertexAttrib4fv( batchInfo.colorAttrIndex_, instance_.color_ );
+
+			// Transfer 2D-Texture region (TextureAtlas UVs)
+			if ( batchInfo.uvRectAttrIndex_ >= 0 )
+				glVertexAttrib4fv( batchInfo.uvRectAttrIndex_, instance_.uvRect_ );
+
+			// Transfer 2D-Texture Array layer
+			if ( batchInfo.texLayerAttrIndex_ >= 0 )
+				glVertexAttrib1f( batchInfo.texLayerAttrIndex_, instance_.textureLayer_ );
+
+			// Calculate MVP Matrix
+			calculateMVP( instance_, viewProjMat_, mvpMat_ );
+
+			// Upload Mesh (Sprite) Model-View-Projection Matrix to the Vertex Shader
+			glUniformMatrix4fv( batchInfo.mvpMatUniformLoc_, 1, GL_FALSE, glm::value_ptr( mvpMat_ ) );
+
+			// Draw Elements (render with indices)
+			glDrawElements( GL_TRIANGLES, INDICES_COUNT, GL_UNSIGNED_SHORT, (const void *) 0 );
 
 		}
 
 	}
 
 	/*
-	 * Draws given Drawable-Object (Sprite).
+	 * Points per-instance Attributes (Model, Color, 2D-Texture region & layer) to the Per-Instance Buffer Object.
 	 *
 	 * @thread_safety - render-thread only.
-	 * @param pDrawable - Drawable-Component.
-	 * @param mvpMatUniformIndex_ - Model View Projection Matrix location/index.
-	 * @param pCamera2D - 2D Camera.
+	 * @param batchInfo - Sprite-Batching component. VAO must be bound.
+	 * @param offset_ - offset of the first instance in the Per-Instance Buffer Object, in bytes.
 	*/
-	void GLRenderer::drawSprite( Drawable *const pDrawable, const GLuint & mvpMatUniformIndex_, const GLCamera2D *const pCamera2D )
+	void GLRenderer::setInstanceAttributes( const BatchInfo & batchInfo, const GLintptr offset_ )
 	{
 
-#ifdef DEBUG // DEBUG
-		assert( pDrawable != nullptr );
-		assert( mvpMatUniformIndex_ >= 0 );
-#endif // DEBUG
+		// Bind Per-Instance Buffer Object
+		glBindBuffer( GL_ARRAY_BUFFER, batchInfo.instancesBuffer_.getBufferObject( ) );
+
+		// Point OpenGL to 'Model Matrix' rows data
+		for ( unsigned char row_ = 0; row_ < INSTANCE_MODEL_ROWS; row_++ )
+			glVertexAttribPointer( batchInfo.modelMatAttrIndex_ + row_, 4, GL_FLOAT, GL_FALSE, sizeof( InstanceData ), (GLvoid*) ( offset_ + offsetof( InstanceData, modelMat_ ) + row_ * 4 * sizeof( float ) ) );
+
+		// Point OpenGL to 'Color' data
+		if ( batchInfo.colorAttrIndex_ >= 0 )
+			glVertexAttribPointer( batchInfo.colorAttrIndex_, 4, GL_FLOAT, GL_FALSE, sizeof( InstanceData ), (GLvoid*) ( offset_ + offsetof( InstanceData, color_ ) ) );
+
+		// Point OpenGL to '2D-Texture region' data
+		if ( batchInfo.uvRectAttrIndex_ >= 0 )
+			glVertexAttribPointer( batchInfo.uvRectAttrIndex_, 4, GL_FLOAT, GL_FALSE, sizeof( InstanceData ), (GLvoid*) ( offset_ + offsetof( InstanceData, uvRect_ ) ) );
+
+		// Point OpenGL to '2D-Texture Array layer' data
+		if ( batchInfo.texLayerAttrIndex_ >= 0 )
+			glVertexAttribPointer( batchInfo.texLayerAttrIndex_, 1, GL_FLOAT, GL_FALSE, sizeof( InstanceData ), (GLvoid*) ( offset_ + offsetof( InstanceData, textureLayer_ ) ) );
+
+	}
 
-		// Update Matrices
-		if ( !pCamera2D->updated_ || pDrawable->stateChanged_ )
+	/*
+	 * Returns Sprite-Batch of the Shader Program used by the current frame.
+	 * Flat list of the frame Sprite-Batches searched first (few Shader Programs per frame),
+	 * Sprite-Batches map searched once per Shader Program per frame.
+	 *
+	 * @thread_safety - render-thread only, thread-lock must be locked.
+	 * @param program_ - OpenGL Shader Program ID.
+	 * @return - BatchInfo, or null if Sprite-Batch not loaded (Drawables can be removed after snapshot).
+	 * @throws - std::bad_alloc.
+	*/
+	BatchInfo * GLRenderer::getFrameBatch( const GLuint program_ )
+	{
+
+		// Search frame Sprite-Batches
+		for ( BatchInfo *const batchInfo_ : mFrameBatches )
+		{
+
+			// Return BatchInfo
+			if ( batchInfo_->shaderProgram_ == program_ )
+				return( batchInfo_ );
+
+		}
+
+		// Search BatchInfo
+		const programs_map_t::iterator batchInfoPos_ = mPrograms.find( program_ );
+
+		// Cancel, if Sprite-Batch not loaded
+		if ( batchInfoPos_ == mPrograms.end( ) || batchInfoPos_->second.vaoID_ < 1 )
+			return( nullptr );
+
+		// Get BatchInfo
+		BatchInfo *const batchInfo_( &batchInfoPos_->second );
+
+		// Reset frame state
+		batchInfo_->frameCount_ = 0;
+		batchInfo_->frameCursor_ = 0;
+		batchInfo_->frameOffset_ = 0;
+		batchInfo_->frameInstances_ = nullptr;
+
+		// Add to the frame Sprite-Batches
+		mFrameBatches.push_back( batchInfo_ );
+
+		// Return BatchInfo
+		return( batchInfo_ );
+
+	}
+
+	/*
+	 * Writes per-instance data (Model, Color, 2D-Texture region & layer) of all instanced Sprite-Batches of the frame.
+	 * Each Per-Instance Buffer Object mapped once, instances written in submission order,
+	 * so every run of the Render-Snapshot is contiguous in its Sprite-Batch region.
+	 *
+	 * @thread_safety - render-thread only, thread-lock must be locked.
+	 * @param pInstances - Render-Instances, in RenderQueue order.
+	 * @param count_ - Render-Instances count.
+	 * @throws - can throw exception.
+	*/
+	void GLRenderer::writeInstances( const RenderInstance *const pInstances, const GLsizei count_ )
+	{
+
+		// Profile
+		C0DE4UN_PROFILE_SCOPE( "GLRenderer::writeInstances" );
+
+		// Map instanced Sprite-Batches
+		for ( BatchInfo *const batchInfo_ : mFrameBatches )
 		{
 
-			// Model Identity-Matrix
-			glm::mat4 modelMat_( 1.0f );
+			// Skip not instanced Sprite-Batch
+			if ( batchInfo_->modelMatAttrIndex_ < 0 )
+				continue;
+
+			// Map current frame region (waits, if GPU still reads it)
+			batchInfo_->frameInstances_ = static_cast<InstanceData*>( batchInfo_->instancesBuffer_.Map( batchInfo_->frameCount_ * sizeof( InstanceData ), batchInfo_->frameOffset_ ) );
+
+			// Check mapped memory
+			if ( batchInfo_->frameInstances_ == nullptr )
+				Log::printError( "GLRenderer::writeInstances - failed to map Per-Instance Buffer Object !" );
+
+		}
+
+		// Current Shader Program
+		GLuint program_( 0 );
+
+		// Current Sprite-Batch
+		BatchInfo * batchInfo_( nullptr );
+
+		// Render-Instances
+		for ( GLsizei i = 0; i < count_; i++ )
+		{
+
+			// Render-Instance
+			const RenderInstance & instance_ = pInstances[i];
+
+			// Switch Sprite-Batch
+			if ( instance_.shaderProgram_ != program_ )
+			{
+
+				// Set Shader Program
+				program_ = instance_.shaderProgram_;
+
+				// Get Sprite-Batch
+				batchInfo_ = getFrameBatch( program_ );
+
+			}
+
+			// Skip not loaded, not instanced or not mapped Sprite-Batch
+			if ( batchInfo_ == nullptr || batchInfo_->frameInstances_ == nullptr )
+				continue;
 
-			// Translate Model Matrix
-			modelMat_ = glm::translate( modelMat_, pDrawable->position_->vec3_ );
+			// Instance data (mapped memory, write-only)
+			InstanceData & data_ = batchInfo_->frameInstances_[batchInfo_->frameCursor_++];
 
-			// Rotate Model Matrix
-			modelMat_ = glm::rotate( modelMat_, glm::radians( pDrawable->rotation_->vec3_.x ), glm::vec3( 1.0f, 0.0f, 0.0f ) ); // X
-			modelMat_ = glm::rotate( modelMat_, glm::radians( pDrawable->rotation_->vec3_.y ), glm::vec3( 0.0f, 1.0f, 0.0f ) ); // Y
-			modelMat_ = glm::rotate( modelMat_, glm::radians( pDrawable->rotation_->vec3_.z ), glm::vec3( 0.0f, 0.0f, 1.0f ) ); // Z
+			// Write Model Matrix, already built by TransformKernel
+			std::memcpy( data_.modelMat_, instance_.model_, sizeof( data_.modelMat_ ) );
 
-			// Scale Model Matrix
-			modelMat_ = glm::scale( modelMat_, pDrawable->scale_->vec3_ );
+			// Write Color
+			std::memcpy( data_.color_, instance_.color_, sizeof( data_.color_ ) );
 
-			// Model-View-Projection Matrix (MVP)
-			pDrawable->mvpMat_ = pCamera2D->projectionMat_ * pCamera2D->viewMat_ * modelMat_;
+			// Write 2D-Texture region
+			std::memcpy( data_.uvRect_, instance_.uvRect_, sizeof( data_.uvRect_ ) );
 
-			// Set Drawable state changed flag
-			pDrawable->stateChanged_ = false;
+			// Write 2D-Texture Array layer
+			data_.textureLayer_ = instance_.textureLayer_;
 
 		}
 
-		// Upload Mesh (Sprite) Model-View-Projection Matrix to the Vertex Shader
-		glUniformMatrix4fv( mvpMatUniformIndex_, 1, GL_FALSE, glm::value_ptr( pDrawable->mvpMat_ ) );
-
-		//// Model Matrix
-		//glm::mat4 modelMat_( 1.0f );
-		//modelMat_ = glm::translate( modelMat_, glm::vec3( 0.0f, 0.0f, 0.0f ) );
-		//modelMat_ = glm::rotate( modelMat_, glm::radians(0.0f), glm::vec3( 1.0f, 0.0f, 0.0f ) );
-		//modelMat_ = glm::rotate( modelMat_, glm::radians( 0.0f ), glm::vec3( 0.0f, 1.0f, 0.0f ) );
-		//modelMat_ = glm::rotate( modelMat_, glm::radians( 0.0f ), glm::vec3( 0.0f, 0.0f, 1.0f ) );
-		//modelMat_ = glm::scale( modelMat_, glm::vec3( 100.0f, 100.0f, 0.0f ) );
-		//
-		//// View Matrix
-		//glm::vec3 camPos_( 0.0f, 0.0f, 0.0f );
-		//glm::vec3 camUp_( 0.0f, 1.0f, 0.0f );
-		//glm::vec3 camFront_( 0.0f, 0.0f, -1.0f );
-		//glm::mat4 viewMat_( 1.0f );
-		//viewMat_ = glm::lookAt( camPos_, camPos_ + camFront_, camUp_ );
-		//
-		//// Projection Matrix
-		//const float nearZ = 0.01f;
-		//const float farZ = 2.0f;
-		//glm::mat4 projectionMat_( 1.0f );
-		//projectionMat_ = glm::ortho( 0.0f, 1280.0f, 0.0f, 720.0f, 0.f, 1.f );
-
-		//// View & Projection
-		//const glm::mat4 mvpMat_ = projectionMat_ * viewMat_ * modelMat_;
-
-		//// Upload Mesh (Sprite) Model-View-Projection Matrix to the Vertex Shader
-		//glUniformMatrix4fv( mvpMatUniformIndex_, 1, GL_FALSE, glm::value_ptr( mvpMat_ ) );
-
-		// Draw Elements (render with indices)
-		glDrawElements( GL_TRIANGLES, INDICES_COUNT, GL_UNSIGNED_SHORT, (const void *) 0 );
+		// Finish writing
+		for ( BatchInfo *const frameBatch_ : mFrameBatches )
+		{
+
+			// Unmap
+			if ( frameBatch_->frameInstances_ != nullptr )
+				frameBatch_->instancesBuffer_.Unmap( );
+
+			// Reset cursor for drawing
+			frameBatch_->frameCursor_ = 0;
+
+		}
+
+	}
+
+	/*
+	 * Draws run of Render-Instances (same Sprite-Batch, 2D-Texture & blend mode) using instancing:
+	 * one glDrawElementsInstanced call, per-instance data written by writeInstances.
+	 *
+	 * @thread_safety - render-thread only.
+	 * @param batchInfo - Sprite-Batching component. VAO & Shader Program must be bound, region mapped & written.
+	 * @param instance_ - first Render-Instance of the run.
+	 * @param count_ - Render-Instances count.
+	*/
+	void GLRenderer::drawInstanced( BatchInfo & batchInfo, const RenderInstance & instance_, const GLsizei count_ )
+	{
+
+		// Bind 2D-Texture or 2D-Texture Array to Texture Unit #0 (skipped, if already bound)
+		if ( batchInfo.textureTarget_ == GL_TEXTURE_2D_ARRAY )
+			mStateCache.BindTexture2DArray( 0, instance_.textureObject_ );
+		else
+			mStateCache.BindTexture2D( 0, instance_.textureObject_ );
+
+		// Set Shader Uniform Texture Sampler 2D to Texture Unit #0 (skipped, if already set)
+		if ( instance_.textureObject_ > 0 )
+			mStateCache.UniformSampler( instance_.texSamplerLoc_, 0 );
+
+		// Point per-instance Attributes to the first instance of this run
+		setInstanceAttributes( batchInfo, batchInfo.frameOffset_ + batchInfo.frameCursor_ * sizeof( InstanceData ) );
+
+		// Draw all Sprites of this run
+		glDrawElementsInstanced( GL_TRIANGLES, INDICES_COUNT, GL_UNSIGNED_SHORT, (const void *) 0, count_ );
+
+		// Next run
+		batchInfo.frameCursor_ += count_;
 
 	}
 
 	/*
-	 * Draw (render).
+	 * Draw (render) Render-Snapshot.
+	 * Render-Thread doesn't access simulation data (Sprites, Drawables), only snapshot.
+	 * Instances walked once in RenderQueue order, contiguous runs with the same
+	 * Shader Program, 2D-Texture & blend mode drawn with one call.
 	 *
 	 * @thread_safety - render-thread only.
+	 * @param snapshot_ - Render-Snapshot, instances in RenderQueue order.
 	 * @param pCamera - 2D-Camera.
 	 * @throws - can throw exception.
 	*/
-	void GLRenderer::Draw( GLCamera2D *const pCamera2D )
+	void GLRenderer::Draw( const RenderSnapshot & snapshot_, GLCamera2D *const pCamera2D )
 	{
 
-		// Get Shader Programs map iterator
-		programs_map_t::iterator programsIterator_ = mPrograms.begin( );
+		// Profile
+		C0DE4UN_PROFILE_SCOPE( "GLRenderer::Draw" );
 
-		// Get Shader Programs map end-iterator
-		const programs_map_t::iterator programsEnd_ = mPrograms.end( );
+		// Lock Sprite-Batches
+		std::lock_guard<std::mutex> lock_( mMutex );
 
-		// Enable Blending
-		glEnable( GL_BLEND );
+		// GPU time of the frame, results of the previous frames read if available
+		mGPUTimer.BeginFrame( );
 
-		// Set Blending Function
-		glBlendFunc( GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA );
+		// Load & unload Sprite-Batches
+		syncBatches( );
 
-		// Shader Programs
-		while ( programsIterator_ != programsEnd_ )
+		// Lock the Camera thread-lock
+		pCamera2D->lock_.lock( );
+
+		// Update Camera View & Projection Matrices
+		if ( !pCamera2D->updated_ )
 		{
 
-			// Use OpenGL Shader Program
-			glUseProgram( programsIterator_->first );
+			// Calculate View Matrix
+			const glm::vec3 cameraUp_( 0.0f, 1.0f, 0.0f );
+			const glm::vec3 cameraFront_( 0.0f, 0.0f, -1.0f );
+			pCamera2D->viewMat_ = glm::lookAt( pCamera2D->position_, pCamera2D->position_ + cameraFront_, cameraUp_ );
 
-			// Get BatchInfo
-			BatchInfo & batchInfo_ = programsIterator_->second;
+			// Calculate Projection Matrix
+			pCamera2D->projectionMat_ = glm::ortho( pCamera2D->frustum_[0], pCamera2D->frustum_[1], pCamera2D->frustum_[2], pCamera2D->frustum_[3], pCamera2D->frustum_[4], pCamera2D->frustum_[5] );
+
+			// Reset Camera Matrices Update flag
+			pCamera2D->updated_ = true;
+
+		}
+
+		// Camera Projection * View Matrix, same for all Sprites
+		const glm::mat4 viewProjMat_( pCamera2D->projectionMat_ * pCamera2D->viewMat_ );
 
-			// Bind VAO
-			glBindVertexArray( batchInfo_.vaoID_ );
+		// Unlock the Camera thread-lock
+		pCamera2D->lock_.unlock( );
 
-			// Get Textures map iterator
-			std::map<const GLuint, std::vector<Drawable*>>::iterator texturesIterator_ = batchInfo_.textureObjects_.begin( );
+		// Render-Instances
+		const RenderInstance *const instances_( snapshot_.instances_.data( ) );
 
-			// Get Textures map end-iterator
-			std::map<const GLuint, std::vector<Drawable*>>::const_iterator texturesEnd_ = batchInfo_.textureObjects_.cend( );
+		// Render-Instances count
+		const GLsizei count_( static_cast<GLsizei>( snapshot_.instances_.size( ) ) );
 
-			// Lock the Camera thread-lock
-			pCamera2D->lock_.lock( );
+		// Reset frame Sprite-Batches
+		mFrameBatches.clear( );
 
-			// Update Camera View & Projection Matrices
-			if ( !pCamera2D->updated_ )
+		// Current Shader Program
+		GLuint program_( 0 );
+
+		// Current Sprite-Batch
+		BatchInfo * batchInfo_( nullptr );
+
+		// Count instances per Sprite-Batch
+		for ( GLsizei i = 0; i < count_; i++ )
+		{
+
+			// Switch Sprite-Batch
+			if ( instances_[i].shaderProgram_ != program_ )
 			{
 
-				// Calculate View Matrix
-				const glm::vec3 cameraUp_( 0.0f, 1.0f, 0.0f );
-				const glm::vec3 cameraFront_( 0.0f, 0.0f, -1.0f );
-				pCamera2D->viewMat_ = glm::lookAt( pCamera2D->position_, pCamera2D->position_ + cameraFront_, cameraUp_ );
+				// Set Shader Program
+				program_ = instances_[i].shaderProgram_;
 
-				// Calculate Projection Matrix
-				pCamera2D->projectionMat_ = glm::ortho( pCamera2D->frustum_[0], pCamera2D->frustum_[1], pCamera2D->frustum_[2], pCamera2D->frustum_[3], pCamera2D->frustum_[4], pCamera2D->frustum_[5] );
+				// Get Sprite-Batch
+				batchInfo_ = getFrameBatch( program_ );
 
 			}
 
-			// Textures
-			while ( texturesIterator_ != texturesEnd_ )
+			// Count
+			if ( batchInfo_ != nullptr )
+				batchInfo_->frameCount_++;
+
+		}
+
+		// Write per-instance data, one map per Sprite-Batch
+		writeInstances( instances_, count_ );
+
+		// Set Blending Function, Blending enabled for translucent runs only
+		mStateCache.BlendFunc( GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA );
+
+		// Bind shared sprites Sampler Object, all Sprite-Batches sample Texture Unit #0
+		mStateCache.BindSampler( 0, mSamplerCache.getSampler( SamplerCache::SPRITE ) );
+
+		// Reset current Shader Program & Sprite-Batch
+		program_ = 0;
+		batchInfo_ = nullptr;
+
+		// First instance of the current run
+		GLsizei firstInstance_( 0 );
+
+		// Runs
+		while ( firstInstance_ < count_ )
+		{
+
+			// First Render-Instance
+			const RenderInstance & instance_ = instances_[firstInstance_];
+
+			// Blend mode
+			const unsigned char blend_( RenderQueue::getBlend( instance_.sortKey_ ) );
+
+			// Instances count of this run (same Shader Program, 2D-Texture & blend mode)
+			GLsizei runCount_( 1 );
+			while ( firstInstance_ + runCount_ < count_ && instances_[firstInstance_ + runCount_].shaderProgram_ == instance_.shaderProgram_
+				&& instances_[firstInstance_ + runCount_].textureObject_ == instance_.textureObject_
+				&& RenderQueue::getBlend( instances_[firstInstance_ + runCount_].sortKey_ ) == blend_ )
+				runCount_++;
+
+			// Switch Sprite-Batch
+			if ( instance_.shaderProgram_ != program_ )
 			{
 
-				// Get Drawable-Objects vector
-				std::vector<Drawable*> & drawableObjects_ = texturesIterator_->second;
+				// Set Shader Program
+				program_ = instance_.shaderProgram_;
+
+				// GPU time of the Shader Program pass
+				mGPUTimer.BeginPass( program_ );
+
+				// Get Sprite-Batch
+				batchInfo_ = getFrameBatch( program_ );
 
-				// Drawable-Object
-				for ( Drawable *const drawable_ : drawableObjects_ )
+				// Bind Sprite-Batch
+				if ( batchInfo_ != nullptr )
 				{
 
-					// Bind Texture
-					if ( texturesIterator_->first > 0 )
-					{
+					// Use OpenGL Shader Program
+					mStateCache.UseProgram( program_ );
 
-						// Make 2D Texture Unit #0 Active
-						glActiveTexture( GL_TEXTURE0 );
+					// Bind VAO
+					mStateCache.BindVertexArray( batchInfo_->vaoID_ );
 
-						// Bind 2D-Texture
-						glBindTexture( GL_TEXTURE_2D, texturesIterator_->first );
+					// Upload Camera View-Projection Matrix, once per Sprite-Batch bind
+					if ( batchInfo_->modelMatAttrIndex_ >= 0 )
+						glUniformMatrix4fv( batchInfo_->viewProjMatUniformLoc_, 1, GL_FALSE, glm::value_ptr( viewProjMat_ ) );
 
-						// Set Shader Uniform Texture Sampler 2D to Texture Unit #0
-						glUniform1i( drawable_->texSamplerLoc_, 0 );
+				}
 
-					}
+			}
 
-					// Lock Drawable
-					drawable_->lock_->lock( );
+			// Draw, if Sprite-Batch loaded
+			if ( batchInfo_ != nullptr )
+			{
 
-					// Transfer (Upload) current Color-values (same color for all vertices)
-					if ( batchInfo_.colorAttrIndex_ >= 0 )
-						glVertexAttrib4fv( batchInfo_.colorAttrIndex_, drawable_->color_ );
+				// Enable Blending for translucent run (skipped, if not changed)
+				mStateCache.SetBlend( blend_ != RenderQueue::BLEND_OPAQUE );
 
-					// Draw Sprite
-					drawSprite( drawable_, batchInfo_.mvpMatUniformLoc_, pCamera2D );
+				// Draw with instancing
+				if ( batchInfo_->modelMatAttrIndex_ >= 0 )
+				{
 
-					// Unlock Drawable
-					drawable_->lock_->unlock( );
+					// Draw, if Per-Instance Buffer Object mapped
+					if ( batchInfo_->frameInstances_ != nullptr )
+						drawInstanced( *batchInfo_, instance_, runCount_ );
 
 				}
+				else // Draw one by one
+					drawSprites( *batchInfo_, instances_ + firstInstance_, runCount_, viewProjMat_ );
 
-				// Unbind Texture
-				if ( texturesIterator_->first > 0 )
-					glBindTexture( GL_TEXTURE_2D, 0 );
+			}
 
-				// Next
-				texturesIterator_++;
+			// Next
+			firstInstance_ += runCount_;
 
-			}
+		}
 
-			// Reset Camera Matrices Update flag
-			pCamera2D->updated_ = true;
+		// Unbind Per-Instance Buffer Object (Shader Program, VAO, 2D-Texture & Blending kept for the next frame)
+		glBindBuffer( GL_ARRAY_BUFFER, 0 );
 
-			// Unlock the Camera thread-lock
-			pCamera2D->lock_.unlock( );
+		// End GPU time of the frame
+		mGPUTimer.EndFrame( );
 
-			// Unbind (bind the default) VAO
-			glBindVertexArray( 0 );
+		// Guard frame regions until GPU finished reading them
+		for ( BatchInfo *const frameBatch_ : mFrameBatches )
+		{
 
-			// Reset current OpenGL Shader Program
-			glUseProgram( 0 );
+			// Fence
+			if ( frameBatch_->frameInstances_ != nullptr )
+				frameBatch_->instancesBuffer_.Fence( );
 
-			// Next
-			programsIterator_++;
+			// Reset mapped region
+			frameBatch_->frameInstances_ = nullptr;
 
 		}
 
-		// Disable Blending
-		glDisable( GL_BLEND );
+	}
+
+	/*
+	 * Unload all Sprite-Batches & Sampler Objects.
+	 * Used when all Drawables removed & render-thread stopped.
+	 *
+	 * @thread_safety - render-thread only.
+	 * @throws - can throw exception.
+	*/
+	void GLRenderer::unloadBatches( )
+	{
+
+		// Lock Sprite-Batches
+		std::lock_guard<std::mutex> lock_( mMutex );
+
+		// Shader Programs
+		for ( std::pair<const GLuint, BatchInfo> & program_ : mPrograms )
+		{
+
+			// Unload Sprite-Batch
+			if ( program_.second.vaoID_ > 0 )
+				unloadSpriteBatch( program_.second );
+
+		}
+
+		// Remove BatchInfos
+		mPrograms.clear( );
+
+		// Delete Sampler Objects
+		mSamplerCache.Unload( mStateCache );
+
+		// Delete Query Objects
+		mGPUTimer.Unload( );
 
 	}
 
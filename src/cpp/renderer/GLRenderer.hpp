@@ -23,11 +23,36 @@
 #include "../cfg/opengl.hpp"
 #endif // !__c0de4un_opengl_hpp__
 
+// Include mutex
+#ifndef __c0de4un_mutex_hpp__
+#include "../cfg/mutex.hpp" // std::mutex, std::lock_guard
+#endif // !__c0de4un_mutex_hpp__
+
+// Include glm
+#ifndef __c0de4un_glm_hpp__
+#include "../cfg/glm.hpp"
+#endif // !__c0de4un_glm_hpp__
+
 // Include Drawable
 #ifndef __c0de4un_drawable_hpp__
 #include "batch/Drawable.hpp"
 #endif // !__c0de4un_drawable_hpp__
 
+// Include GLStateCache
+#ifndef __c0de4un_gl_state_cache_hpp__
+#include "state/GLStateCache.hpp"
+#endif // !__c0de4un_gl_state_cache_hpp__
+
+// Include SamplerCache
+#ifndef __c0de4un_sampler_cache_hpp__
+#include "state/SamplerCache.hpp"
+#endif // !__c0de4un_sampler_cache_hpp__
+
+// Include GPUTimer
+#ifndef __c0de4un_gpu_timer_hpp__
+#include "timing/GPUTimer.hpp"
+#endif // !__c0de4un_gpu_timer_hpp__
+
 // Forward-declaration of BatchInfo
 #ifndef __c0de4un_batch_info_decl__
 #define __c0de4un_batch_info_decl__
@@ -40,6 +65,18 @@ namespace c0de4un { struct BatchInfo; }
 namespace c0de4un { struct BatchRequest; }
 #endif // !__c0de4un_batch_request_decl__
 
+// Forward-declaration of RenderInstance
+#ifndef __c0de4un_render_instance_decl__
+#define __c0de4un_render_instance_decl__
+namespace c0de4un { struct RenderInstance; }
+#endif // !__c0de4un_render_instance_decl__
+
+// Forward-declaration of RenderSnapshot
+#ifndef __c0de4un_render_snapshot_decl__
+#define __c0de4un_render_snapshot_decl__
+namespace c0de4un { struct RenderSnapshot; }
+#endif // !__c0de4un_render_snapshot_decl__
+
 // Forward-declare GLCamera2D
 #ifndef __c0de4un_gl_camera_2D_decl__
 #define __c0de4un_gl_camera_2D_decl__
@@ -58,6 +95,7 @@ namespace c0de4un
 	 * @features
 	 * - sprite-batching ;
 	 * - OpenGL 3+ API (VAO, VBO, instancing) ;
+	 * - draws immutable RenderSnapshots, so can run on a dedicated render-thread ;
 	 * 
 	 * @version 1.0
 	*/
@@ -103,6 +141,12 @@ namespace c0de4un
 		/* Texture Coordinates Size (not length, but number of elements) */
 		static constexpr unsigned char TEXTURE_COORD_SIZE = 2;
 
+		/* 2D affine Model Matrix per-instance Attribute rows (vec4) count */
+		static constexpr unsigned char INSTANCE_MODEL_ROWS = 2;
+
+		/* Min. Per-Instance Buffer capacity (number of instances) */
+		static constexpr GLsizeiptr MIN_INSTANCES_CAPACITY = 256;
+
 		// ===========================================================
 		// Constants
 		// ===========================================================
@@ -120,9 +164,24 @@ namespace c0de4un
 		// Fields
 		// ===========================================================
 
-		/* Map to sort Drawable-Objects by Shader Programs & Textures */
+		/* Sprite-Batches by Shader Program (load, unload & Drawables bookkeeping, not traversed per frame) */
 		programs_map_t mPrograms;
 
+		/* Sprite-Batches used by the current frame, render-thread only */
+		std::vector<BatchInfo*> mFrameBatches;
+
+		/* Sprite-Batches mutex, Drawables added & removed by simulation thread */
+		std::mutex mMutex;
+
+		/* OpenGL state shadow, redundant state changes skipped. Render-thread only */
+		GLStateCache mStateCache;
+
+		/* Shared Sampler Objects (sprites filtering & wrapping). Render-thread only */
+		SamplerCache mSamplerCache;
+
+		/* GPU time of the frame & Shader Program passes (Draw). Render-thread only */
+		GPUTimer mGPUTimer;
+
 		// ===========================================================
 		// Deleted
 		// ===========================================================
@@ -144,14 +203,69 @@ namespace c0de4un
 		// ===========================================================
 
 		/*
-		 * Draws given Drawable-Object (Sprite).
+		 * Loads new Sprite-Batches & unloads Sprite-Batches without Drawables.
+		 * OpenGL work of the addDrawable & removeDrawable, deferred to the render-thread.
+		 *
+		 * @thread_safety - render-thread only, thread-lock must be locked.
+		 * @throws - can throw exception.
+		*/
+		void syncBatches( );
+
+		/*
+		 * Draws Render-Instances one by one, MVP Matrix passed as uniform.
+		 * Used when Shader Program doesn't support instancing.
+		 *
+		 * @thread_safety - render-thread only.
+		 * @param batchInfo - Sprite-Batching component. VAO & Shader Program must be bound.
+		 * @param pInstances - Render-Instances of the Shader Program, sorted by 2D-Texture.
+		 * @param count_ - Render-Instances count.
+		 * @param viewProjMat_ - Camera Projection * View Matrix.
+		*/
+		void drawSprites( const BatchInfo & batchInfo, const RenderInstance *const pInstances, const GLsizei count_, const glm::mat4 & viewProjMat_ );
+
+		/*
+		 * Returns Sprite-Batch of the Shader Program used by the current frame.
+		 * Flat list of the frame Sprite-Batches searched first (few Shader Programs per frame),
+		 * Sprite-Batches map searched once per Shader Program per frame.
+		 *
+		 * @thread_safety - render-thread only, thread-lock must be locked.
+		 * @param program_ - OpenGL Shader Program ID.
+		 * @return - BatchInfo, or null if Sprite-Batch not loaded (Drawables can be removed after snapshot).
+		 * @throws - std::bad_alloc.
+		*/
+		BatchInfo * getFrameBatch( const GLuint program_ );
+
+		/*
+		 * Writes per-instance data (Model, Color, 2D-Texture region & layer) of all instanced Sprite-Batches of the frame.
+		 * Each Per-Instance Buffer Object mapped once, instances written in submission order,
+		 * so every run of the Render-Snapshot is contiguous in its Sprite-Batch region.
+		 *
+		 * @thread_safety - render-thread only, thread-lock must be locked.
+		 * @param pInstances - Render-Instances, in RenderQueue order.
+		 * @param count_ - Render-Instances count.
+		 * @throws - can throw exception.
+		*/
+		void writeInstances( const RenderInstance *const pInstances, const GLsizei count_ );
+
+		/*
+		 * Draws run of Render-Instances (same Sprite-Batch, 2D-Texture & blend mode) using instancing:
+		 * one glDrawElementsInstanced call, per-instance data written by writeInstances.
 		 *
 		 * @thread_safety - render-thread only.
-		 * @param pDrawable - Drawable-Component.
-		 * @param mvpMatUniformIndex_ - Model View Projection Matrix location/index.
-		 * @param pCamera2D - 2D Camera.
+		 * @param batchInfo - Sprite-Batching component. VAO & Shader Program must be bound, region mapped & written.
+		 * @param instance_ - first Render-Instance of the run.
+		 * @param count_ - Render-Instances count.
 		*/
-		void drawSprite( Drawable *const pDrawable, const GLuint & mvpMatUniformIndex_, const GLCamera2D *const pCamera2D );
+		void drawInstanced( BatchInfo & batchInfo, const RenderInstance & instance_, const GLsizei count_ );
+
+		/*
+		 * Points per-instance Attributes (Model, Color, 2D-Texture region & layer) to the Per-Instance Buffer Object.
+		 *
+		 * @thread_safety - render-thread only.
+		 * @param batchInfo - Sprite-Batching component. VAO must be bound.
+		 * @param offset_ - offset of the first instance in the Per-Instance Buffer Object, in bytes.
+		*/
+		void setInstanceAttributes( const BatchInfo & batchInfo, const GLintptr offset_ );
 
 		/*
 		 * Load Sprite-Batch.
@@ -195,6 +309,26 @@ namespace c0de4un
 		/* GLRenderer destructor */
 		~GLRenderer( );
 
+		// ===========================================================
+		// Getter & Setter
+		// ===========================================================
+
+		/*
+		 * Returns OpenGL state cache (issued & elided calls counters).
+		 * Must be invalidated after OpenGL state changed outside renderer.
+		 *
+		 * @thread_safety - render-thread only.
+		*/
+		GLStateCache & getStateCache( ) noexcept;
+
+		/*
+		 * Returns GPU timer of Draw: whole frame & each Shader Program pass.
+		 * Frames measured once loaded (GPUTimer::Load), Query Objects deleted by unloadBatches.
+		 *
+		 * @thread_safety - render-thread only.
+		*/
+		GPUTimer & getGPUTimer( ) noexcept;
+
 		// ===========================================================
 		// Methods
 		// ===========================================================
@@ -212,6 +346,29 @@ namespace c0de4un
 		*/
 		static const bool loadShader( GLuint & shaderObject_, const char *const sourceCode_, const GLenum & shaderType_ );
 
+		/*
+		 * Creates Shader Object & starts compilation, compile status not checked (see checkShader).
+		 * Driver can compile in background (GL_KHR_parallel_shader_compile).
+		 *
+		 * @thread_safety - render-thread only.
+		 * @param shaderObject_ - output Shader Object ID.
+		 * @param sourceCode_ - RAW GLSL source-code.
+		 * @param shaderType_ - shader type.
+		 * @throws - can throw exception.
+		*/
+		static void compileShader( GLuint & shaderObject_, const char *const sourceCode_, const GLenum & shaderType_ );
+
+		/*
+		 * Checks compile status of the Shader Object, waits if still compiling.
+		 * Failed Shader Object deleted.
+		 *
+		 * @thread_safety - render-thread only.
+		 * @param shaderObject_ - Shader Object ID, reset to 0 if failed.
+		 * @return - 'TRUE' if OK, false if failed.
+		 * @throws - can throw exception.
+		*/
+		static const bool checkShader( GLuint & shaderObject_ );
+
 		/*
 		 * Create & link Shader Program with Shaders.
 		 * 
@@ -224,6 +381,49 @@ namespace c0de4un
 		*/
 		static const bool loadProgram( GLuint & shaderProgram_, const GLuint & vertexShader_, const GLuint & fragmentShader_ );
 
+		/*
+		 * Creates Shader Program & starts linking, link status not checked (see checkProgram).
+		 * Shaders can be still compiling, driver can link in background (GL_KHR_parallel_shader_compile).
+		 *
+		 * @thread_safety - render-thread only.
+		 * @param shaderProgram_ - output Shader Program Object ID.
+		 * @param vertexShader_ - Vertex Shader Object ID.
+		 * @param fragmentShader_ - Fragment Shader Object ID.
+		 * @throws - can throw exception.
+		*/
+		static void linkProgram( GLuint & shaderProgram_, const GLuint & vertexShader_, const GLuint & fragmentShader_ );
+
+		/*
+		 * Checks link status of the Shader Program, waits if still linking.
+		 *
+		 * @thread_safety - render-thread only.
+		 * @param shaderProgram_ - Shader Program Object ID.
+		 * @return - 'true' if OK.
+		 * @throws - can throw exception.
+		*/
+		static const bool checkProgram( const GLuint & shaderProgram_ );
+
+		/*
+		 * Returns 'true' if Shader Program compile & link finished (status query won't block).
+		 * Always 'true' without GL_KHR_parallel_shader_compile (or ARB version).
+		 *
+		 * @thread_safety - render-thread only.
+		 * @param shaderProgram_ - Shader Program Object ID.
+		*/
+		static const bool isProgramCompleted( const GLuint & shaderProgram_ ) noexcept;
+
+		/*
+		 * Calculates MVP (Model View Projection) Matrix of the given Render-Instance,
+		 * expands 2D affine Model Matrix rows (no trigonometry).
+		 * Used only when Shader Program doesn't support instancing.
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param instance_ - Render-Instance.
+		 * @param viewProjMat_ - Camera Projection * View Matrix.
+		 * @param mvpMat_ - output MVP Matrix.
+		*/
+		static void calculateMVP( const RenderInstance & instance_, const glm::mat4 & viewProjMat_, glm::mat4 & mvpMat_ ) noexcept;
+
 		/*
 		 * Add Drawable-Object to the Sprite Batching.
 		 * 
@@ -245,13 +445,26 @@ namespace c0de4un
 		void removeDrawable( const Drawable *const pDrawable, const GLuint & shaderProgram_, const GLuint & texture2D_ );
 
 		/*
-		 * Draw (render).
+		 * Draw (render) Render-Snapshot.
+		 * Render-Thread doesn't access simulation data (Sprites, Drawables), only snapshot.
+		 * Instances walked once in RenderQueue order, contiguous runs with the same
+		 * Shader Program, 2D-Texture & blend mode drawn with one call.
 		 *
 		 * @thread_safety - render-thread only.
+		 * @param snapshot_ - Render-Snapshot, instances in RenderQueue order.
 		 * @param pCamera - 2D-Camera.
 		 * @throws - can throw exception.
 		*/
-		void Draw( GLCamera2D *const pCamera2D );
+		void Draw( const RenderSnapshot & snapshot_, GLCamera2D *const pCamera2D );
+
+		/*
+		 * Unload all Sprite-Batches & Sampler Objects.
+		 * Used when all Drawables removed & render-thread stopped.
+		 *
+		 * @thread_safety - render-thread only.
+		 * @throws - can throw exception.
+		*/
+		void unloadBatches( );
 
 		// -------------------------------------------------------- \\
 
@@ -23,6 +23,17 @@
 #include "../../cfg/vector.hpp"
 #endif // !__c0de4un_vector_hpp__
 
+// Include StreamBuffer
+#ifndef __c0de4un_stream_buffer_hpp__
+#include "StreamBuffer.hpp"
+#endif // !__c0de4un_stream_buffer_hpp__
+
+// Forward-declaration of InstanceData
+#ifndef __c0de4un_instance_data_decl__
+#define __c0de4un_instance_data_decl__
+namespace c0de4un { struct InstanceData; }
+#endif // !__c0de4un_instance_data_decl__
+
 // Forward-declaration of Drawable
 #ifndef __c0de4un_drawable_decl__
 #define __c0de4un_drawable_decl__
@@ -56,6 +67,9 @@ namespace c0de4un
 		/* ID for Vertices 2D-Texture Coordinates Buffer Object */
 		static constexpr unsigned char TEXTURE_COORDS_VBO = 2;
 
+		/* Buffer Objects count */
+		static constexpr unsigned char VBO_COUNT = 3;
+
 		/* Vertex Position Attribute Index (ID) */
 		GLint vertexPosAttrIndex_;
 
@@ -68,16 +82,62 @@ namespace c0de4un
 		/* MVP (Model View Projection) Matrix uniform index */
 		GLint mvpMatUniformLoc_;
 
+		/*
+		 * 2D affine Model Matrix (mat2x4) per-instance attribute index.
+		 * Matrix uses 2 sequential attribute locations (one per row).
+		 * #-1 - instancing not supported by Shader Program, MVP uniform used.
+		*/
+		GLint modelMatAttrIndex_;
+
+		/* View-Projection Matrix uniform index, set once per batch (instanced Shader Program) */
+		GLint viewProjMatUniformLoc_;
+
+		/*
+		 * 2D-Texture region (u, v, width, height) attribute index, TextureAtlas regions.
+		 * Per-instance with instancing, constant attribute value otherwise.
+		*/
+		GLint uvRectAttrIndex_;
+
+		/*
+		 * 2D-Texture Array layer attribute index, TextureArrayPool layers.
+		 * Per-instance with instancing, constant attribute value otherwise.
+		*/
+		GLint texLayerAttrIndex_;
+
+		/* Texture target of the Shader Program sampler ( GL_TEXTURE_2D or GL_TEXTURE_2D_ARRAY ) */
+		GLenum textureTarget_;
+
 		/*
 		 * Vertex Buffer Objects
 		*/
-		GLuint vboIDs_[3];
+		GLuint vboIDs_[VBO_COUNT];
+
+		/*
+		 * Per-Instance Data (Model, Color) Buffer Object.
+		 * Rewritten every frame, directly in the mapped memory.
+		*/
+		StreamBuffer instancesBuffer_;
 
 		/*
 		 * Vertex Array Object
 		*/
 		GLuint vaoID_;
 
+		/* OpenGL Shader Program ID */
+		GLuint shaderProgram_;
+
+		/* Frame: instances count of this Sprite-Batch in the Render-Snapshot */
+		GLsizei frameCount_;
+
+		/* Frame: written (drawn) instances count */
+		GLsizei frameCursor_;
+
+		/* Frame: offset of the mapped region in the Per-Instance Buffer Object */
+		GLintptr frameOffset_;
+
+		/* Frame: mapped Per-Instance Buffer Object region, null if not mapped */
+		InstanceData * frameInstances_;
+
 		/*
 		 * 2D Texture Objects IDs map.
 		 * Used to sort Drawable-Objects by 2D-Texture.
@@ -90,8 +150,19 @@ namespace c0de4un
 			texCoordsAttrIndex_( -1 ),
 			colorAttrIndex_( -1 ),
 			mvpMatUniformLoc_( -1 ),
+			modelMatAttrIndex_( -1 ),
+			viewProjMatUniformLoc_( -1 ),
+			uvRectAttrIndex_( -1 ),
+			texLayerAttrIndex_( -1 ),
+			textureTarget_( GL_TEXTURE_2D ),
 			vboIDs_{ 0, 0, 0 },
+			instancesBuffer_( ),
 			vaoID_( 0 ),
+			shaderProgram_( 0 ),
+			frameCount_( 0 ),
+			frameCursor_( 0 ),
+			frameOffset_( 0 ),
+			frameInstances_( nullptr ),
 			textureObjects_( )
 		{
 		}
@@ -54,6 +54,21 @@ namespace c0de4un
 		/* Model View Projection (MVP) Uniform index */
 		GLint mvpMatUniformIndex_;
 
+		/* 2D affine Model Matrix per-instance Attribute index */
+		GLint modelMatAttrIndex_;
+
+		/* View-Projection Matrix Uniform index (instanced Shader Program) */
+		GLint viewProjMatUniformIndex_;
+
+		/* 2D-Texture region (TextureAtlas) Attribute index */
+		GLint uvRectAttrIndex_;
+
+		/* 2D-Texture Array layer (TextureArrayPool) Attribute index */
+		GLint texLayerAttrIndex_;
+
+		/* Texture target ( GL_TEXTURE_2D or GL_TEXTURE_2D_ARRAY ) */
+		GLenum textureTarget_;
+
 		/* Drawable-Object */
 		Drawable * drawable_;
 
@@ -65,6 +80,11 @@ namespace c0de4un
 			colorAttrIndex_( -1 ),
 			textureObject_( 0 ),
 			mvpMatUniformIndex_( -1 ),
+			modelMatAttrIndex_( -1 ),
+			viewProjMatUniformIndex_( -1 ),
+			uvRectAttrIndex_( -1 ),
+			texLayerAttrIndex_( -1 ),
+			textureTarget_( GL_TEXTURE_2D ),
 			drawable_( nullptr )
 		{
 		}
@@ -13,25 +13,16 @@
 #include "../../cfg/opengl.hpp"
 #endif // !__c0de4un_opengl_hpp__
 
-// Include glm
-#ifndef __c0de4un_glm_hpp__
-#include "../../cfg/glm.hpp"
-#endif // !__c0de4un_glm_hpp__
-
-// Include Position
-#ifndef __c0de4un_position_hpp__
-#include "../../components/Position.hpp"
-#endif // !__c0de4un_position_hpp__
-
-// Include Rotation
-#ifndef __c0de4un_rotation_hpp__
-#include "../../components/Rotation.hpp"
-#endif // !__c0de4un_rotation_hpp__
-
-// Include Scale
-#ifndef __c0de4un_scale_hpp__
-#include "../../components/Scale.hpp"
-#endif // !__c0de4un_scale_hpp__
+// Include SpriteHandle
+#ifndef __c0de4un_sprite_handle_hpp__
+#include "../../components/SpriteHandle.hpp"
+#endif // !__c0de4un_sprite_handle_hpp__
+
+// Forward-declaration of SpriteStore
+#ifndef __c0de4un_sprite_store_decl__
+#define __c0de4un_sprite_store_decl__
+namespace c0de4un { class SpriteStore; }
+#endif // !__c0de4un_sprite_store_decl__
 
 // Drawable declared
 #define __c0de4un_drawable_decl__
@@ -45,7 +36,8 @@ namespace c0de4un
 	/*
 	 * Drawable - data-structure about drawable-object.
 	 * 
-	 * Contains position, rotation & scale (size) vectors, matrices & quaternions.
+	 * References position, rotation & scale (size) data in the SpriteStore,
+	 * copied to the RenderSnapshot each frame.
 	 * Also stores 'OpenGL 2D Texture Object' id/pointer & 'OpenGL Shader Program' id/pointer.
 	 * 
 	 * @version 1.0
@@ -53,9 +45,6 @@ namespace c0de4un
 	struct Drawable final
 	{
 
-		/* State changed flag */
-		bool stateChanged_;
-
 		/*
 		 * OpenGL 2D Texture Object ID.
 		 * #0 - no texture.
@@ -71,51 +60,66 @@ namespace c0de4un
 		GLint texSamplerLoc_;
 
 		/*
-		 * Object Position component
+		 * Sprites data storage (position, rotation, scale, changed flag).
 		*/
-		Position * position_;
+		SpriteStore * store_;
 
 		/*
-		 * Rotation vector in degrees.
+		 * Sprite handle in the SpriteStore.
 		*/
-		Rotation * rotation_;
+		SpriteHandle handle_;
 
 		/*
-		 * Scale vector
+		 * Color values in RGBA format.
 		*/
-		Scale * scale_;
+		float color_[4];
 
 		/*
-		 * Thread-Lock to synchronize access.
-		 * Used shareable between Components thread-lock,
-		 * owned by Game Object (Entity, Node, etc).
+		 * 2D-Texture region ( u, v, width, height ), copy of the TextureAtlas region UVs.
+		 * Whole texture - ( 0, 0, 1, 1 ).
 		*/
-		std::unique_lock<std::mutex> * lock_;
+		float uvRect_[4];
 
 		/*
-		 * MVP (Model View Projection) Matrix [Projection * View * Model(Translation * Rotation * Scale)]
-		 * Used to avoid calculating MVP matrix each frame if not required.
-		 * Depends on Camera used for render (draw).
+		 * TextureAtlas region ID, #0 - own 2D-Texture (not in atlas).
 		*/
-		glm::mat4 mvpMat_;
+		uint32_t atlasRegion_;
 
 		/*
-		 * Color values in RGBA format.
+		 * 2D-Texture Array layer, textureObject_ is GL_TEXTURE_2D_ARRAY (TextureArrayPool).
 		*/
-		float color_[4];
+		float textureLayer_;
+
+		/*
+		 * Depth in [0; 1], 0 - nearest.
+		 * Translucent Drawables drawn back-to-front.
+		*/
+		float depth_;
+
+		/*
+		 * Layer, lower layers drawn first.
+		*/
+		unsigned char layer_;
+
+		/*
+		 * Blend mode, RenderQueue::BLEND_OPAQUE or RenderQueue::BLEND_ALPHA.
+		*/
+		unsigned char blend_;
 
 		/* Drawable default constructor */
 		Drawable( )
-			: stateChanged_( false ),
-			textureObject_( 0 ),
+			: textureObject_( 0 ),
 			shaderProgram_( 0 ),
-			position_( nullptr ),
-			rotation_( nullptr ),
-			scale_( nullptr ),
-			lock_( nullptr ),
-			mvpMat_( ),
 			texSamplerLoc_( -1 ),
-			color_{ 1.0f, 1.0f, 1.0f, 1.0f }
+			store_( nullptr ),
+			handle_{ 0, 0 },
+			color_{ 1.0f, 1.0f, 1.0f, 1.0f },
+			uvRect_{ 0.0f, 0.0f, 1.0f, 1.0f },
+			atlasRegion_( 0 ),
+			textureLayer_( 0.0f ),
+			depth_( 0.0f ),
+			layer_( 0 ),
+			blend_( 1 ) // RenderQueue::BLEND_ALPHA
 		{
 		}
 
@@ -0,0 +1,48 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_instance_data_hpp__
+#define __c0de4un_instance_data_hpp__
+
+// InstanceData declared
+#define __c0de4un_instance_data_decl__
+
+// Enable structure-data (fields, variables) alignment (by compilator) to 1 byte
+#pragma pack( push, 1 )
+
+namespace c0de4un
+{
+
+	/*
+	 * InstanceData - per-instance (per-sprite) vertex attributes data.
+	 * Layout matches per-instance attributes of the instanced Shader Program.
+	 *
+	 * @version 1.0
+	*/
+	struct InstanceData final
+	{
+
+		/* 2D affine Model Matrix rows (mat2x4 attribute, 2 x vec4), View-Projection applied by uniform */
+		float modelMat_[8];
+
+		/* Color values in RGBA format */
+		float color_[4];
+
+		/* 2D-Texture region ( u, v, width, height ) */
+		float uvRect_[4];
+
+		/* 2D-Texture Array layer */
+		float textureLayer_;
+
+	};
+
+}
+
+// Restore structure-data alignment to default (8-byte on MSVC)
+#pragma pack( pop )
+
+#endif // !__c0de4un_instance_data_hpp__
\ No newline at end of file
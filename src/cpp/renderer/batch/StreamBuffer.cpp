@@ -0,0 +1,371 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+// HEADER
+#ifndef __c0de4un_stream_buffer_hpp__
+#include "StreamBuffer.hpp"
+#endif // !__c0de4un_stream_buffer_hpp__
+
+// Include Log
+#ifndef __c0de4un_log_hpp__
+#include "../../utils/log/Log.hpp"
+#endif // !__c0de4un_log_hpp__
+
+// Include STL
+#include <string> // to_string
+#include <stdexcept> // runtime_error
+
+namespace c0de4un
+{
+
+	// -------------------------------------------------------- \\
+
+	// ===========================================================
+	// Constructor & destructor
+	// ===========================================================
+
+	/* StreamBuffer constructor */
+	StreamBuffer::StreamBuffer( )
+		: mBufferObject( 0 ),
+		mRegionSize( 0 ),
+		mRegion( 0 ),
+		mPersistent( false ),
+		mPersistentPtr( nullptr ),
+		mFences{ nullptr, nullptr, nullptr }
+	{
+	}
+
+	/* StreamBuffer destructor */
+	StreamBuffer::~StreamBuffer( )
+	{
+	}
+
+	// ===========================================================
+	// Getter & Setter
+	// ===========================================================
+
+	/* Returns OpenGL Buffer Object ID */
+	const GLuint & StreamBuffer::getBufferObject( ) const noexcept
+	{ return( mBufferObject ); }
+
+	/* Returns 'true' if persistent-mapped storage used */
+	const bool StreamBuffer::isPersistent( ) const noexcept
+	{ return( mPersistent ); }
+
+	// ===========================================================
+	// Methods
+	// ===========================================================
+
+	/*
+	 * Waits until GPU finished reading the given region & deletes its fence.
+	 *
+	 * @thread_safety - render-thread only.
+	 * @param region_ - region index.
+	*/
+	void StreamBuffer::waitRegion( const unsigned char region_ )
+	{
+
+		// Fence
+		GLsync & fence_ = mFences[region_];
+
+		// Cancel
+		if ( fence_ == nullptr )
+			return;
+
+		// Wait for GPU (flush commands on first wait, 1 ms timeout per try)
+		GLbitfield waitFlags_( GL_SYNC_FLUSH_COMMANDS_BIT );
+		while ( true )
+		{
+
+			// Wait
+			const GLenum waitResult_ = glClientWaitSync( fence_, waitFlags_, 1000000 );
+
+			// Signaled
+			if ( waitResult_ == GL_ALREADY_SIGNALED || waitResult_ == GL_CONDITION_SATISFIED )
+				break;
+
+			// Failed
+			if ( waitResult_ == GL_WAIT_FAILED )
+			{
+
+				// Log
+				Log::printWarning( "StreamBuffer::waitRegion - glClientWaitSync failed !" );
+
+				// Stop waiting
+				break;
+
+			}
+
+			// Commands already flushed
+			waitFlags_ = 0;
+
+		}
+
+		// Delete fence
+		glDeleteSync( fence_ );
+
+		// Reset fence
+		fence_ = nullptr;
+
+	}
+
+	/*
+	 * Create Buffer Object.
+	 *
+	 * @thread_safety - render-thread only.
+	 * @param regionSize_ - region (one frame data) size in bytes.
+	 * @return - 'true' if OK.
+	 * @throws - can throw exception.
+	*/
+	const bool StreamBuffer::Load( const GLsizeiptr regionSize_ )
+	{
+
+#ifdef DEBUG // DEBUG
+		assert( regionSize_ > 0 );
+#endif // DEBUG
+
+		// Cancel
+		if ( mBufferObject > 0 )
+			return( true );
+
+		// Create Buffer Object
+		glGenBuffers( 1, &mBufferObject );
+
+		// Check Buffer Object
+		if ( mBufferObject < 1 )
+			throw std::runtime_error( "StreamBuffer::Load - failed to create Buffer Object !" );
+
+		// Set region size
+		mRegionSize = regionSize_;
+
+		// Reset region
+		mRegion = 0;
+
+		// Bind Buffer Object
+		glBindBuffer( GL_ARRAY_BUFFER, mBufferObject );
+
+		// Persistent-mapped storage supported
+		mPersistent = GLEW_ARB_buffer_storage == GL_TRUE;
+
+		// Persistent-mapped storage
+		if ( mPersistent )
+		{
+
+			// Storage & Mapping flags
+			const GLbitfield flags_( GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT );
+
+			// Allocate immutable storage for all regions
+			glBufferStorage( GL_ARRAY_BUFFER, mRegionSize * REGIONS_COUNT, nullptr, flags_ );
+
+			// Map whole storage once
+			mPersistentPtr = static_cast<unsigned char*>( glMapBufferRange( GL_ARRAY_BUFFER, 0, mRegionSize * REGIONS_COUNT, flags_ ) );
+
+			// Fallback to orphaning
+			if ( mPersistentPtr == nullptr )
+			{
+
+				// Log
+				Log::printWarning( "StreamBuffer::Load - failed to map persistent storage, orphaning used." );
+
+				// Immutable storage can't be re-allocated, re-create Buffer Object
+				glBindBuffer( GL_ARRAY_BUFFER, 0 );
+				glDeleteBuffers( 1, &mBufferObject );
+				glGenBuffers( 1, &mBufferObject );
+				glBindBuffer( GL_ARRAY_BUFFER, mBufferObject );
+
+				// Reset flag
+				mPersistent = false;
+
+			}
+
+		}
+
+		// Orphaning
+		if ( !mPersistent )
+			glBufferData( GL_ARRAY_BUFFER, mRegionSize, nullptr, GL_STREAM_DRAW ); // STREAM_DRAW, because buffer data rewritten every frame.
+
+		// Unbind Buffer Object
+		glBindBuffer( GL_ARRAY_BUFFER, 0 );
+
+		// Return OK
+		return( true );
+
+	}
+
+	/*
+	 * Delete Buffer Object.
+	 * Waits until GPU finished reading all regions.
+	 *
+	 * @thread_safety - render-thread only.
+	*/
+	void StreamBuffer::Unload( )
+	{
+
+		// Cancel
+		if ( mBufferObject < 1 )
+			return;
+
+		// Wait for all regions
+		for ( unsigned char region_ = 0; region_ < REGIONS_COUNT; region_++ )
+			waitRegion( region_ );
+
+		// Unmap persistent storage
+		if ( mPersistentPtr != nullptr )
+		{
+
+			// Bind Buffer Object
+			glBindBuffer( GL_ARRAY_BUFFER, mBufferObject );
+
+			// Unmap
+			glUnmapBuffer( GL_ARRAY_BUFFER );
+
+			// Unbind Buffer Object
+			glBindBuffer( GL_ARRAY_BUFFER, 0 );
+
+			// Reset pointer-value
+			mPersistentPtr = nullptr;
+
+		}
+
+		// Delete Buffer Object
+		glDeleteBuffers( 1, &mBufferObject );
+
+		// Reset Buffer Object ID
+		mBufferObject = 0;
+
+		// Reset region size
+		mRegionSize = 0;
+
+		// Reset persistent flag
+		mPersistent = false;
+
+	}
+
+	/*
+	 * Returns pointer to the write-only memory of the current region.
+	 * Grows storage, if region size is less than required.
+	 * Blocks, if GPU still reads current region.
+	 *
+	 * (!) Buffer Object can be re-created, attributes must be re-pointed after Map.
+	 *
+	 * @thread_safety - render-thread only.
+	 * @param size_ - bytes to write.
+	 * @param offset_ - offset of the returned memory in the Buffer Object.
+	 * @return - pointer to the mapped memory, or null if failed.
+	 * @throws - can throw exception.
+	*/
+	void * StreamBuffer::Map( const GLsizeiptr size_, GLintptr & offset_ )
+	{
+
+#ifdef DEBUG // DEBUG
+		assert( mBufferObject > 0 ); // Not Loaded
+#endif // DEBUG
+
+		// Grow storage
+		if ( size_ > mRegionSize )
+		{
+
+			// New region size
+			GLsizeiptr regionSize_( mRegionSize > 0 ? mRegionSize : size_ );
+			while ( regionSize_ < size_ )
+				regionSize_ *= 2;
+
+			// Log
+			std::string logMsg( "StreamBuffer::Map - growing region to " );
+			logMsg += std::to_string( regionSize_ );
+			logMsg += " bytes";
+			Log::printDebug( logMsg.c_str( ) );
+
+			// Re-create Buffer Object
+			Unload( );
+			Load( regionSize_ );
+
+		}
+
+		// Persistent-mapped storage
+		if ( mPersistent )
+		{
+
+			// Wait until GPU finished reading this region
+			waitRegion( mRegion );
+
+			// Region offset
+			offset_ = mRegion * mRegionSize;
+
+			// Return pointer to the region
+			return( mPersistentPtr + offset_ );
+
+		}
+
+		// Orphaning: whole Buffer Object used as single region
+		offset_ = 0;
+
+		// Bind Buffer Object
+		glBindBuffer( GL_ARRAY_BUFFER, mBufferObject );
+
+		// Orphan previous storage, so driver allocates new one instead of waiting for GPU
+		glBufferData( GL_ARRAY_BUFFER, mRegionSize, nullptr, GL_STREAM_DRAW );
+
+		// Map
+		void *const mappedPtr_ = glMapBufferRange( GL_ARRAY_BUFFER, 0, size_, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT );
+
+		// Unbind Buffer Object
+		glBindBuffer( GL_ARRAY_BUFFER, 0 );
+
+		// Return mapped memory
+		return( mappedPtr_ );
+
+	}
+
+	/*
+	 * Finish writing to the current region.
+	 * Must be called after Map & before draw-calls that read data.
+	 *
+	 * @thread_safety - render-thread only.
+	*/
+	void StreamBuffer::Unmap( )
+	{
+
+		// Persistent storage stays mapped (coherent)
+		if ( mPersistent )
+			return;
+
+		// Bind Buffer Object
+		glBindBuffer( GL_ARRAY_BUFFER, mBufferObject );
+
+		// Unmap
+		glUnmapBuffer( GL_ARRAY_BUFFER );
+
+		// Unbind Buffer Object
+		glBindBuffer( GL_ARRAY_BUFFER, 0 );
+
+	}
+
+	/*
+	 * Insert fence after draw-calls that read the current region
+	 * & switch to the next region.
+	 *
+	 * @thread_safety - render-thread only.
+	*/
+	void StreamBuffer::Fence( )
+	{
+
+		// Orphaning doesn't require fences
+		if ( !mPersistent )
+			return;
+
+		// Insert fence
+		mFences[mRegion] = glFenceSync( GL_SYNC_GPU_COMMANDS_COMPLETE, 0 );
+
+		// Next region
+		mRegion = ( mRegion + 1 ) % REGIONS_COUNT;
+
+	}
+
+	// -------------------------------------------------------- \\
+
+}
\ No newline at end of file
@@ -0,0 +1,184 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_stream_buffer_hpp__
+#define __c0de4un_stream_buffer_hpp__
+
+// Include opengl
+#ifndef __c0de4un_opengl_hpp__
+#include "../../cfg/opengl.hpp"
+#endif // !__c0de4un_opengl_hpp__
+
+// StreamBuffer declared
+#define __c0de4un_stream_buffer_decl__
+
+namespace c0de4un
+{
+
+	/*
+	 * StreamBuffer - ring-buffered OpenGL Buffer Object for data rewritten every frame
+	 * (per-instance attributes).
+	 *
+	 * Buffer storage split into REGIONS_COUNT regions, one region written per frame.
+	 * Each region guarded by a fence, so CPU never writes a region GPU still reads.
+	 *
+	 * @features
+	 * - persistent-mapped storage, if GL_ARB_buffer_storage supported (no map/unmap per frame) ;
+	 * - orphaning (glBufferData with null) fallback ;
+	 *
+	 * @version 1.0
+	*/
+	class StreamBuffer final
+	{
+
+	public:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Config
+		// ===========================================================
+
+		/* Regions count (triple-buffering) */
+		static constexpr unsigned char REGIONS_COUNT = 3;
+
+		// ===========================================================
+		// Constructor & destructor
+		// ===========================================================
+
+		/* StreamBuffer constructor */
+		explicit StreamBuffer( );
+
+		/* StreamBuffer destructor */
+		~StreamBuffer( );
+
+		// ===========================================================
+		// Getter & Setter
+		// ===========================================================
+
+		/* Returns OpenGL Buffer Object ID */
+		const GLuint & getBufferObject( ) const noexcept;
+
+		/* Returns 'true' if persistent-mapped storage used */
+		const bool isPersistent( ) const noexcept;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Create Buffer Object.
+		 *
+		 * @thread_safety - render-thread only.
+		 * @param regionSize_ - region (one frame data) size in bytes.
+		 * @return - 'true' if OK.
+		 * @throws - can throw exception.
+		*/
+		const bool Load( const GLsizeiptr regionSize_ );
+
+		/*
+		 * Delete Buffer Object.
+		 * Waits until GPU finished reading all regions.
+		 *
+		 * @thread_safety - render-thread only.
+		*/
+		void Unload( );
+
+		/*
+		 * Returns pointer to the write-only memory of the current region.
+		 * Grows storage, if region size is less than required.
+		 * Blocks, if GPU still reads current region.
+		 *
+		 * (!) Buffer Object can be re-created, attributes must be re-pointed after Map.
+		 *
+		 * @thread_safety - render-thread only.
+		 * @param size_ - bytes to write.
+		 * @param offset_ - offset of the returned memory in the Buffer Object.
+		 * @return - pointer to the mapped memory, or null if failed.
+		 * @throws - can throw exception.
+		*/
+		void * Map( const GLsizeiptr size_, GLintptr & offset_ );
+
+		/*
+		 * Finish writing to the current region.
+		 * Must be called after Map & before draw-calls that read data.
+		 *
+		 * @thread_safety - render-thread only.
+		*/
+		void Unmap( );
+
+		/*
+		 * Insert fence after draw-calls that read the current region
+		 * & switch to the next region.
+		 *
+		 * @thread_safety - render-thread only.
+		*/
+		void Fence( );
+
+		// -------------------------------------------------------- \\
+
+	private:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Fields
+		// ===========================================================
+
+		/* OpenGL Buffer Object ID */
+		GLuint mBufferObject;
+
+		/* Region size in bytes */
+		GLsizeiptr mRegionSize;
+
+		/* Current region index */
+		unsigned char mRegion;
+
+		/* Persistent-mapped storage flag */
+		bool mPersistent;
+
+		/* Persistent-mapped memory (whole Buffer Object), or null */
+		unsigned char * mPersistentPtr;
+
+		/* Regions fences */
+		GLsync mFences[REGIONS_COUNT];
+
+		// ===========================================================
+		// Deleted
+		// ===========================================================
+
+		/* @deleted StreamBuffer const copy constructor */
+		StreamBuffer( const StreamBuffer & ) = delete;
+
+		/* @deleted StreamBuffer const copy assignment operator */
+		StreamBuffer & operator=( const StreamBuffer & ) = delete;
+
+		/* @deleted StreamBuffer move constructor */
+		StreamBuffer( StreamBuffer && ) = delete;
+
+		/* @deleted StreamBuffer move assignment operator */
+		StreamBuffer & operator=( StreamBuffer && ) = delete;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Waits until GPU finished reading the given region & deletes its fence.
+		 *
+		 * @thread_safety - render-thread only.
+		 * @param region_ - region index.
+		*/
+		void waitRegion( const unsigned char region_ );
+
+		// -------------------------------------------------------- \\
+
+	};
+
+}
+
+#endif // !__c0de4un_stream_buffer_hpp__
\ No newline at end of file
@@ -0,0 +1,160 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+// Driver entry points used, not redirected
+#define __c0de4un_gl_dispatch_impl__
+
+// HEADER
+#ifndef __c0de4un_gl_dispatch_hpp__
+#include "GLDispatch.hpp"
+#endif // !__c0de4un_gl_dispatch_hpp__
+
+// Include NullGL
+#ifndef __c0de4un_null_gl_hpp__
+#include "NullGL.hpp"
+#endif // !__c0de4un_null_gl_hpp__
+
+// Include Log
+#ifndef __c0de4un_log_hpp__
+#include "../../utils/log/Log.hpp"
+#endif // !__c0de4un_log_hpp__
+
+// Include string
+#ifndef __c0de4un_string_hpp__
+#include "../../cfg/string.hpp"
+#endif // !__c0de4un_string_hpp__
+
+namespace c0de4un
+{
+
+	// -------------------------------------------------------- \\
+
+	/* Active entry points */
+	GLDispatchTable glDispatchTable = { };
+
+	/* 'true' if NullGL used */
+	static bool null_( false );
+
+	/* OpenGL functions names */
+	static const char *const names_[GLDispatch::FUNCTIONS_COUNT] =
+	{
+#define C0DE4UN_GL_DISPATCH_NAME( name ) "gl" #name,
+		C0DE4UN_GL_FUNCTIONS( C0DE4UN_GL_DISPATCH_NAME )
+#undef C0DE4UN_GL_DISPATCH_NAME
+	};
+
+	/*
+	 * Returns entry point of the loader, missing logged.
+	 *
+	 * @param loader_ - loader.
+	 * @param name_ - OpenGL function name.
+	 * @param loaded_ - reset to 'false' if missing.
+	*/
+	static void * load( void *( *const loader_ )( const char *const ), const char *const name_, bool & loaded_ ) noexcept
+	{
+
+		// Entry point
+		void *const function_( loader_( name_ ) );
+
+		// Missing
+		if ( function_ == nullptr )
+		{
+			std::string logMsg( "GLDispatch::useLoader - not found #" );
+			logMsg += name_;
+			Log::printWarning( logMsg.c_str( ) );
+			loaded_ = false;
+		}
+
+		// Return entry point
+		return( function_ );
+
+	}
+
+	// ===========================================================
+	// Getter & Setter
+	// ===========================================================
+
+	/*
+	 * Returns OpenGL function name.
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param function_ - FUNCTION_BindBuffer, etc.
+	*/
+	const char * GLDispatch::getName( const unsigned short function_ ) noexcept
+	{ return( function_ < FUNCTIONS_COUNT ? names_[function_] : "unknown" ); }
+
+	/*
+	 * Returns 'true' if NullGL backend used.
+	 *
+	 * @thread_safety - not thread-safe.
+	*/
+	const bool GLDispatch::isNull( ) noexcept
+	{ return( null_ ); }
+
+	// ===========================================================
+	// Methods
+	// ===========================================================
+
+	/*
+	 * Uses OpenGL driver entry points.
+	 *
+	 * @thread_safety - not thread-safe, call after glewInit, before any gl* call.
+	*/
+	void GLDispatch::useDriver( ) noexcept
+	{
+
+		// GL 1.1 exports & GLEW pointers (loaded by glewInit)
+#define C0DE4UN_GL_DISPATCH_DRIVER( name ) glDispatchTable.name = gl##name;
+		C0DE4UN_GL_FUNCTIONS( C0DE4UN_GL_DISPATCH_DRIVER )
+#undef C0DE4UN_GL_DISPATCH_DRIVER
+
+		null_ = false;
+
+	}
+
+	/*
+	 * Uses OpenGL entry points of the loader (eglGetProcAddress, etc), without GLEW.
+	 * GLEW_* extension flags stay false, so only OpenGL 3.3 paths used.
+	 *
+	 * @thread_safety - not thread-safe, call with the context current, before any gl* call.
+	 * @param loader_ - returns entry point by name, null if not found.
+	 * @return - 'true' if all entry points found, missing ones logged.
+	*/
+	const bool GLDispatch::useLoader( void *( *const loader_ )( const char *const ) ) noexcept
+	{
+
+		// Load, missing extension functions (KHR, ARB) not called without GLEW flags
+		bool loaded_( true );
+#define C0DE4UN_GL_DISPATCH_LOADER( name ) glDispatchTable.name = reinterpret_cast<decltype( glDispatchTable.name )>( load( loader_, "gl" #name, loaded_ ) );
+		C0DE4UN_GL_FUNCTIONS( C0DE4UN_GL_DISPATCH_LOADER )
+#undef C0DE4UN_GL_DISPATCH_LOADER
+
+		null_ = false;
+
+		// Return TRUE if all found
+		return( loaded_ );
+
+	}
+
+	/*
+	 * Uses NullGL: calls counted, nothing drawn, no context required.
+	 *
+	 * @thread_safety - not thread-safe, call before any gl* call.
+	*/
+	void GLDispatch::useNull( ) noexcept
+	{
+
+		// NullGL entry points
+		NullGL::Install( glDispatchTable );
+
+		null_ = true;
+
+	}
+
+	// -------------------------------------------------------- \\
+
+}
\ No newline at end of file
@@ -0,0 +1,416 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_gl_dispatch_hpp__
+#define __c0de4un_gl_dispatch_hpp__
+
+// Include OpenGL
+#ifndef __c0de4un_opengl_hpp__
+#include "../../cfg/opengl.hpp"
+#endif // !__c0de4un_opengl_hpp__
+
+// Include STL
+#include <type_traits> // decay_t
+
+// GLDispatch declared
+#define __c0de4un_gl_dispatch_decl__
+
+/*
+ * OpenGL functions dispatched through GLDispatchTable, X( name ) per gl<name>.
+ * Function added here when used by the renderer or assets.
+*/
+#define C0DE4UN_GL_FUNCTIONS( X ) \
+	X( ActiveTexture ) \
+	X( AttachShader ) \
+	X( BeginQuery ) \
+	X( BindBuffer ) \
+	X( BindFramebuffer ) \
+	X( BindSampler ) \
+	X( BindTexture ) \
+	X( BindVertexArray ) \
+	X( BlendFunc ) \
+	X( BufferData ) \
+	X( BufferStorage ) \
+	X( CheckFramebufferStatus ) \
+	X( Clear ) \
+	X( ClearColor ) \
+	X( ClientWaitSync ) \
+	X( CompileShader ) \
+	X( CompressedTexImage2D ) \
+	X( CopyTexSubImage3D ) \
+	X( CreateProgram ) \
+	X( CreateShader ) \
+	X( DeleteBuffers ) \
+	X( DeleteFramebuffers ) \
+	X( DeleteProgram ) \
+	X( DeleteQueries ) \
+	X( DeleteSamplers ) \
+	X( DeleteShader ) \
+	X( DeleteSync ) \
+	X( DeleteTextures ) \
+	X( DeleteVertexArrays ) \
+	X( Disable ) \
+	X( DrawElements ) \
+	X( DrawElementsInstanced ) \
+	X( Enable ) \
+	X( EnableVertexAttribArray ) \
+	X( EndQuery ) \
+	X( FenceSync ) \
+	X( Finish ) \
+	X( Flush ) \
+	X( FramebufferTexture2D ) \
+	X( FramebufferTextureLayer ) \
+	X( GenBuffers ) \
+	X( GenFramebuffers ) \
+	X( GenQueries ) \
+	X( GenSamplers ) \
+	X( GenTextures ) \
+	X( GenVertexArrays ) \
+	X( GenerateMipmap ) \
+	X( GetActiveUniformsiv ) \
+	X( GetAttribLocation ) \
+	X( GetIntegerv ) \
+	X( GetProgramBinary ) \
+	X( GetProgramInfoLog ) \
+	X( GetProgramiv ) \
+	X( GetQueryObjectiv ) \
+	X( GetQueryObjectui64v ) \
+	X( GetShaderInfoLog ) \
+	X( GetShaderiv ) \
+	X( GetString ) \
+	X( GetUniformIndices ) \
+	X( GetUniformLocation ) \
+	X( LinkProgram ) \
+	X( MapBufferRange ) \
+	X( MaxShaderCompilerThreadsARB ) \
+	X( MaxShaderCompilerThreadsKHR ) \
+	X( PixelStorei ) \
+	X( ProgramBinary ) \
+	X( ProgramParameteri ) \
+	X( QueryCounter ) \
+	X( ReadBuffer ) \
+	X( SamplerParameteri ) \
+	X( ShaderSource ) \
+	X( TexImage2D ) \
+	X( TexImage3D ) \
+	X( TexParameteri ) \
+	X( TexSubImage2D ) \
+	X( TexSubImage3D ) \
+	X( Uniform1i ) \
+	X( UniformMatrix4fv ) \
+	X( UnmapBuffer ) \
+	X( UseProgram ) \
+	X( VertexAttrib1f ) \
+	X( VertexAttrib4fv ) \
+	X( VertexAttribDivisor ) \
+	X( VertexAttribPointer ) \
+	X( Viewport )
+
+namespace c0de4un
+{
+
+	/*
+	 * GLDispatchTable - OpenGL entry points of the active backend (driver or NullGL).
+	 *
+	 * @version 1.0
+	*/
+	struct GLDispatchTable final
+	{
+
+		/* Entry points, same signatures as GLEW (GL 1.1 functions & GLEW pointers) */
+#define C0DE4UN_GL_DISPATCH_FIELD( name ) std::decay_t<decltype( gl##name )> name;
+		C0DE4UN_GL_FUNCTIONS( C0DE4UN_GL_DISPATCH_FIELD )
+#undef C0DE4UN_GL_DISPATCH_FIELD
+
+	};
+
+	/* Active entry points, set by GLDispatch::useDriver or GLDispatch::useNull */
+	extern GLDispatchTable glDispatchTable;
+
+	/*
+	 * GLDispatch - pluggable OpenGL backend (_C0DE4UN_GL_DISPATCH_ENABLED_ builds).
+	 *
+	 * gl* calls of the renderer & assets redirected (by macros) to glDispatchTable,
+	 * so the same code runs with the driver or NullGL (no context, no GPU),
+	 * used to measure CPU submission cost (GLRenderer::Draw) on headless machines.
+	 * GLEW_* extension flags not dispatched: false with NullGL (glewInit not called).
+	 *
+	 * @version 1.0
+	*/
+	class GLDispatch final
+	{
+
+	public:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Constants
+		// ===========================================================
+
+		/* Dispatched functions, FUNCTION_<name> (see getName) */
+		enum : unsigned short
+		{
+#define C0DE4UN_GL_DISPATCH_INDEX( name ) FUNCTION_##name,
+			C0DE4UN_GL_FUNCTIONS( C0DE4UN_GL_DISPATCH_INDEX )
+#undef C0DE4UN_GL_DISPATCH_INDEX
+			FUNCTIONS_COUNT
+		};
+
+		// ===========================================================
+		// Getter & Setter
+		// ===========================================================
+
+		/*
+		 * Returns OpenGL function name.
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param function_ - FUNCTION_BindBuffer, etc.
+		*/
+		static const char * getName( const unsigned short function_ ) noexcept;
+
+		/*
+		 * Returns 'true' if NullGL backend used.
+		 *
+		 * @thread_safety - not thread-safe.
+		*/
+		static const bool isNull( ) noexcept;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Uses OpenGL driver entry points.
+		 *
+		 * @thread_safety - not thread-safe, call after glewInit, before any gl* call.
+		*/
+		static void useDriver( ) noexcept;
+
+		/*
+		 * Uses OpenGL entry points of the loader (eglGetProcAddress, etc), without GLEW.
+		 * GLEW_* extension flags stay false, so only OpenGL 3.3 paths used.
+		 *
+		 * @thread_safety - not thread-safe, call with the context current, before any gl* call.
+		 * @param loader_ - returns entry point by name, null if not found.
+		 * @return - 'true' if all entry points found, missing ones logged.
+		*/
+		static const bool useLoader( void *( *const loader_ )( const char *const ) ) noexcept;
+
+		/*
+		 * Uses NullGL: calls counted, nothing drawn, no context required.
+		 *
+		 * @thread_safety - not thread-safe, call before any gl* call.
+		*/
+		static void useNull( ) noexcept;
+
+		// -------------------------------------------------------- \\
+
+	private:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Deleted
+		// ===========================================================
+
+		/* @deleted GLDispatch constructor */
+		GLDispatch( ) = delete;
+
+		/* @deleted GLDispatch const copy constructor */
+		GLDispatch( const GLDispatch & ) = delete;
+
+		/* @deleted GLDispatch const copy assignment operator */
+		GLDispatch & operator=( const GLDispatch & ) = delete;
+
+		/* @deleted GLDispatch move constructor */
+		GLDispatch( GLDispatch && ) = delete;
+
+		/* @deleted GLDispatch move assignment operator */
+		GLDispatch & operator=( GLDispatch && ) = delete;
+
+		// -------------------------------------------------------- \\
+
+	};
+
+}
+
+// Redirect gl* calls to the active backend, GLDispatch.cpp uses driver entry points
+#ifndef __c0de4un_gl_dispatch_impl__
+#undef glActiveTexture
+#define glActiveTexture c0de4un::glDispatchTable.ActiveTexture
+#undef glAttachShader
+#define glAttachShader c0de4un::glDispatchTable.AttachShader
+#undef glBeginQuery
+#define glBeginQuery c0de4un::glDispatchTable.BeginQuery
+#undef glBindBuffer
+#define glBindBuffer c0de4un::glDispatchTable.BindBuffer
+#undef glBindFramebuffer
+#define glBindFramebuffer c0de4un::glDispatchTable.BindFramebuffer
+#undef glBindSampler
+#define glBindSampler c0de4un::glDispatchTable.BindSampler
+#undef glBindTexture
+#define glBindTexture c0de4un::glDispatchTable.BindTexture
+#undef glBindVertexArray
+#define glBindVertexArray c0de4un::glDispatchTable.BindVertexArray
+#undef glBlendFunc
+#define glBlendFunc c0de4un::glDispatchTable.BlendFunc
+#undef glBufferData
+#define glBufferData c0de4un::glDispatchTable.BufferData
+#undef glBufferStorage
+#define glBufferStorage c0de4un::glDispatchTable.BufferStorage
+#undef glCheckFramebufferStatus
+#define glCheckFramebufferStatus c0de4un::glDispatchTable.CheckFramebufferStatus
+#undef glClear
+#define glClear c0de4un::glDispatchTable.Clear
+#undef glClearColor
+#define glClearColor c0de4un::glDispatchTable.ClearColor
+#undef glClientWaitSync
+#define glClientWaitSync c0de4un::glDispatchTable.ClientWaitSync
+#undef glCompileShader
+#define glCompileShader c0de4un::glDispatchTable.CompileShader
+#undef glCompressedTexImage2D
+#define glCompressedTexImage2D c0de4un::glDispatchTable.CompressedTexImage2D
+#undef glCopyTexSubImage3D
+#define glCopyTexSubImage3D c0de4un::glDispatchTable.CopyTexSubImage3D
+#undef glCreateProgram
+#define glCreateProgram c0de4un::glDispatchTable.CreateProgram
+#undef glCreateShader
+#define glCreateShader c0de4un::glDispatchTable.CreateShader
+#undef glDeleteBuffers
+#define glDeleteBuffers c0de4un::glDispatchTable.DeleteBuffers
+#undef glDeleteFramebuffers
+#define glDeleteFramebuffers c0de4un::glDispatchTable.DeleteFramebuffers
+#undef glDeleteProgram
+#define glDeleteProgram c0de4un::glDispatchTable.DeleteProgram
+#undef glDeleteQueries
+#define glDeleteQueries c0de4un::glDispatchTable.DeleteQueries
+#undef glDeleteSamplers
+#define glDeleteSamplers c0de4un::glDispatchTable.DeleteSamplers
+#undef glDeleteShader
+#define glDeleteShader c0de4un::glDispatchTable.DeleteShader
+#undef glDeleteSync
+#define glDeleteSync c0de4un::glDispatchTable.DeleteSync
+#undef glDeleteTextures
+#define glDeleteTextures c0de4un::glDispatchTable.DeleteTextures
+#undef glDeleteVertexArrays
+#define glDeleteVertexArrays c0de4un::glDispatchTable.DeleteVertexArrays
+#undef glDisable
+#define glDisable c0de4un::glDispatchTable.Disable
+#undef glDrawElements
+#define glDrawElements c0de4un::glDispatchTable.DrawElements
+#undef glDrawElementsInstanced
+#define glDrawElementsInstanced c0de4un::glDispatchTable.DrawElementsInstanced
+#undef glEnable
+#define glEnable c0de4un::glDispatchTable.Enable
+#undef glEnableVertexAttribArray
+#define glEnableVertexAttribArray c0de4un::glDispatchTable.EnableVertexAttribArray
+#undef glEndQuery
+#define glEndQuery c0de4un::glDispatchTable.EndQuery
+#undef glFenceSync
+#define glFenceSync c0de4un::glDispatchTable.FenceSync
+#undef glFinish
+#define glFinish c0de4un::glDispatchTable.Finish
+#undef glFlush
+#define glFlush c0de4un::glDispatchTable.Flush
+#undef glFramebufferTexture2D
+#define glFramebufferTexture2D c0de4un::glDispatchTable.FramebufferTexture2D
+#undef glFramebufferTextureLayer
+#define glFramebufferTextureLayer c0de4un::glDispatchTable.FramebufferTextureLayer
+#undef glGenBuffers
+#define glGenBuffers c0de4un::glDispatchTable.GenBuffers
+#undef glGenFramebuffers
+#define glGenFramebuffers c0de4un::glDispatchTable.GenFramebuffers
+#undef glGenQueries
+#define glGenQueries c0de4un::glDispatchTable.GenQueries
+#undef glGenSamplers
+#define glGenSamplers c0de4un::glDispatchTable.GenSamplers
+#undef glGenTextures
+#define glGenTextures c0de4un::glDispatchTable.GenTextures
+#undef glGenVertexArrays
+#define glGenVertexArrays c0de4un::glDispatchTable.GenVertexArrays
+#undef glGenerateMipmap
+#define glGenerateMipmap c0de4un::glDispatchTable.GenerateMipmap
+#undef glGetActiveUniformsiv
+#define glGetActiveUniformsiv c0de4un::glDispatchTable.GetActiveUniformsiv
+#undef glGetAttribLocation
+#define glGetAttribLocation c0de4un::glDispatchTable.GetAttribLocation
+#undef glGetIntegerv
+#define glGetIntegerv c0de4un::glDispatchTable.GetIntegerv
+#undef glGetProgramBinary
+#define glGetProgramBinary c0de4un::glDispatchTable.GetProgramBinary
+#undef glGetProgramInfoLog
+#define glGetProgramInfoLog c0de4un::glDispatchTable.GetProgramInfoLog
+#undef glGetProgramiv
+#define glGetProgramiv c0de4un::glDispatchTable.GetProgramiv
+#undef glGetQueryObjectiv
+#define glGetQueryObjectiv c0de4un::glDispatchTable.GetQueryObjectiv
+#undef glGetQueryObjectui64v
+#define glGetQueryObjectui64v c0de4un::glDispatchTable.GetQueryObjectui64v
+#undef glGetShaderInfoLog
+#define glGetShaderInfoLog c0de4un::glDispatchTable.GetShaderInfoLog
+#undef glGetShaderiv
+#define glGetShaderiv c0de4un::glDispatchTable.GetShaderiv
+#undef glGetString
+#define glGetString c0de4un::glDispatchTable.GetString
+#undef glGetUniformIndices
+#define glGetUniformIndices c0de4un::glDispatchTable.GetUniformIndices
+#undef glGetUniformLocation
+#define glGetUniformLocation c0de4un::glDispatchTable.GetUniformLocation
+#undef glLinkProgram
+#define glLinkProgram c0de4un::glDispatchTable.LinkProgram
+#undef glMapBufferRange
+#define glMapBufferRange c0de4un::glDispatchTable.MapBufferRange
+#undef glMaxShaderCompilerThreadsARB
+#define glMaxShaderCompilerThreadsARB c0de4un::glDispatchTable.MaxShaderCompilerThreadsARB
+#undef glMaxShaderCompilerThreadsKHR
+#define glMaxShaderCompilerThreadsKHR c0de4un::glDispatchTable.MaxShaderCompilerThreadsKHR
+#undef glPixelStorei
+#define glPixelStorei c0de4un::glDispatchTable.PixelStorei
+#undef glProgramBinary
+#define glProgramBinary c0de4un::glDispatchTable.ProgramBinary
+#undef glProgramParameteri
+#define glProgramParameteri c0de4un::glDispatchTable.ProgramParameteri
+#undef glQueryCounter
+#define glQueryCounter c0de4un::glDispatchTable.QueryCounter
+#undef glReadBuffer
+#define glReadBuffer c0de4un::glDispatchTable.ReadBuffer
+#undef glSamplerParameteri
+#define glSamplerParameteri c0de4un::glDispatchTable.SamplerParameteri
+#undef glShaderSource
+#define glShaderSource c0de4un::glDispatchTable.ShaderSource
+#undef glTexImage2D
+#define glTexImage2D c0de4un::glDispatchTable.TexImage2D
+#undef glTexImage3D
+#define glTexImage3D c0de4un::glDispatchTable.TexImage3D
+#undef glTexParameteri
+#define glTexParameteri c0de4un::glDispatchTable.TexParameteri
+#undef glTexSubImage2D
+#define glTexSubImage2D c0de4un::glDispatchTable.TexSubImage2D
+#undef glTexSubImage3D
+#define glTexSubImage3D c0de4un::glDispatchTable.TexSubImage3D
+#undef glUniform1i
+#define glUniform1i c0de4un::glDispatchTable.Uniform1i
+#undef glUniformMatrix4fv
+#define glUniformMatrix4fv c0de4un::glDispatchTable.UniformMatrix4fv
+#undef glUnmapBuffer
+#define glUnmapBuffer c0de4un::glDispatchTable.UnmapBuffer
+#undef glUseProgram
+#define glUseProgram c0de4un::glDispatchTable.UseProgram
+#undef glVertexAttrib1f
+#define glVertexAttrib1f c0de4un::glDispatchTable.VertexAttrib1f
+#undef glVertexAttrib4fv
+#define glVertexAttrib4fv c0de4un::glDispatchTable.VertexAttrib4fv
+#undef glVertexAttribDivisor
+#define glVertexAttribDivisor c0de4un::glDispatchTable.VertexAttribDivisor
+#undef glVertexAttribPointer
+#define glVertexAttribPointer c0de4un::glDispatchTable.VertexAttribPointer
+#undef glViewport
+#define glViewport c0de4un::glDispatchTable.Viewport
+#endif // !__c0de4un_gl_dispatch_impl__
+
+#endif // !__c0de4un_gl_dispatch_hpp__
\ No newline at end of file
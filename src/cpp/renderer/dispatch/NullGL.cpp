@@ -0,0 +1,534 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+// HEADER
+#ifndef __c0de4un_null_gl_hpp__
+#include "NullGL.hpp"
+#endif // !__c0de4un_null_gl_hpp__
+
+// Include std::map
+#ifndef __c0de4un_map_hpp__
+#include "../../cfg/map.hpp"
+#endif // !__c0de4un_map_hpp__
+
+// Include std::vector
+#ifndef __c0de4un_vector_hpp__
+#include "../../cfg/vector.hpp"
+#endif // !__c0de4un_vector_hpp__
+
+// Include string
+#ifndef __c0de4un_string_hpp__
+#include "../../cfg/string.hpp"
+#endif // !__c0de4un_string_hpp__
+
+// Include Log
+#ifndef __c0de4un_log_hpp__
+#include "../../utils/log/Log.hpp"
+#endif // !__c0de4un_log_hpp__
+
+// Include STL
+#include <cstddef> // size_t
+#include <cstdint> // uintptr_t
+
+namespace c0de4un
+{
+
+	// -------------------------------------------------------- \\
+
+	/* Calls count per function */
+	static uint64_t calls_[GLDispatch::FUNCTIONS_COUNT] = { };
+
+	/* Draw calls, instances & indices counts */
+	static uint64_t drawCalls_( 0 );
+	static uint64_t instances_( 0 );
+	static uint64_t elements_( 0 );
+
+	/* Last fake object ID, shared by all object types */
+	static GLuint lastObject_( 0 );
+
+	/* Last fake fence */
+	static uintptr_t lastSync_( 0 );
+
+	/* Bound buffer per target */
+	static std::map<GLenum, GLuint> bindings_;
+
+	/* Mapped memory per buffer, grown on map */
+	static std::map<GLuint, std::vector<unsigned char>> buffers_;
+
+	/* Shaders & programs with sampler2DArray */
+	static std::map<GLuint, bool> arraySamplers_;
+
+	/*
+	 * Counted call without output: arguments ignored, default result returned.
+	 *
+	 * @param FUNCTION - GLDispatch::FUNCTION_BindBuffer, etc.
+	 * @param T - entry point type.
+	*/
+	template <unsigned short FUNCTION, typename T>
+	struct NullCall;
+
+	template <unsigned short FUNCTION, typename R, typename... A>
+	struct NullCall<FUNCTION, R ( GLAPIENTRY * )( A... )> final
+	{
+
+		/* Counts call, returns default result */
+		static R GLAPIENTRY call( A... )
+		{
+			calls_[FUNCTION]++;
+			return( R( ) );
+		}
+
+	};
+
+	/*
+	 * Sets fake object IDs.
+	 *
+	 * @param count_ - IDs count.
+	 * @param objects_ - output IDs.
+	*/
+	static void generate( const GLsizei count_, GLuint *const objects_ )
+	{
+		for ( GLsizei i = 0; i < count_; i++ )
+			objects_[i] = ++lastObject_;
+	}
+
+	/*
+	 * Returns fake location of the attribute or uniform, stable per name.
+	 *
+	 * @param name_ - attribute or uniform name.
+	*/
+	static GLint locate( const GLchar *const name_ )
+	{
+		GLuint hash_( 0 );
+		for ( const GLchar * c = name_; *c != 0; c++ )
+			hash_ = hash_ * 31 + static_cast<unsigned char>( *c );
+		return( static_cast<GLint>( hash_ % 16 ) );
+	}
+
+	/* glGenBuffers */
+	static void GLAPIENTRY genBuffers( GLsizei n, GLuint * buffers )
+	{
+		calls_[GLDispatch::FUNCTION_GenBuffers]++;
+		generate( n, buffers );
+	}
+
+	/* glGenFramebuffers */
+	static void GLAPIENTRY genFramebuffers( GLsizei n, GLuint * framebuffers )
+	{
+		calls_[GLDispatch::FUNCTION_GenFramebuffers]++;
+		generate( n, framebuffers );
+	}
+
+	/* glGenQueries */
+	static void GLAPIENTRY genQueries( GLsizei n, GLuint * ids )
+	{
+		calls_[GLDispatch::FUNCTION_GenQueries]++;
+		generate( n, ids );
+	}
+
+	/* glGenSamplers */
+	static void GLAPIENTRY genSamplers( GLsizei n, GLuint * samplers )
+	{
+		calls_[GLDispatch::FUNCTION_GenSamplers]++;
+		generate( n, samplers );
+	}
+
+	/* glGenTextures */
+	static void GLAPIENTRY genTextures( GLsizei n, GLuint * textures )
+	{
+		calls_[GLDispatch::FUNCTION_GenTextures]++;
+		generate( n, textures );
+	}
+
+	/* glGenVertexArrays */
+	static void GLAPIENTRY genVertexArrays( GLsizei n, GLuint * arrays )
+	{
+		calls_[GLDispatch::FUNCTION_GenVertexArrays]++;
+		generate( n, arrays );
+	}
+
+	/* glCreateProgram */
+	static GLuint GLAPIENTRY createProgram( )
+	{
+		calls_[GLDispatch::FUNCTION_CreateProgram]++;
+		return( ++lastObject_ );
+	}
+
+	/* glCreateShader */
+	static GLuint GLAPIENTRY createShader( GLenum )
+	{
+		calls_[GLDispatch::FUNCTION_CreateShader]++;
+		return( ++lastObject_ );
+	}
+
+	/* glShaderSource, shader with sampler2DArray remembered */
+	static void GLAPIENTRY shaderSource( GLuint shader, GLsizei count, const GLchar * const * string, const GLint * length )
+	{
+		calls_[GLDispatch::FUNCTION_ShaderSource]++;
+		for ( GLsizei i = 0; i < count; i++ )
+		{
+			const std::string source_( length == nullptr || length[i] < 0 ? std::string( string[i] ) : std::string( string[i], length[i] ) );
+			if ( source_.find( "sampler2DArray" ) != std::string::npos )
+				arraySamplers_[shader] = true;
+		}
+	}
+
+	/* glAttachShader, program samples 2D-Texture Array if the shader does */
+	static void GLAPIENTRY attachShader( GLuint program, GLuint shader )
+	{
+		calls_[GLDispatch::FUNCTION_AttachShader]++;
+		if ( arraySamplers_.count( shader ) > 0 )
+			arraySamplers_[program] = true;
+	}
+
+	/* glGetIntegerv, limits of the minimal OpenGL 3.3 context */
+	static void GLAPIENTRY getIntegerv( GLenum pname, GLint * data )
+	{
+		calls_[GLDispatch::FUNCTION_GetIntegerv]++;
+		switch ( pname )
+		{
+		case GL_MAX_ARRAY_TEXTURE_LAYERS:
+			*data = 256;
+			break;
+		case GL_MAX_TEXTURE_SIZE:
+			*data = 4096;
+			break;
+		case GL_MAX_COMBINED_TEXTURE_IMAGE_UNITS:
+			*data = 48;
+			break;
+		default:
+			*data = 0;
+			break;
+		}
+	}
+
+	/* glGetString */
+	static const GLubyte * GLAPIENTRY getString( GLenum name )
+	{
+		calls_[GLDispatch::FUNCTION_GetString]++;
+		const char * string_( "" );
+		if ( name == GL_VENDOR || name == GL_RENDERER )
+			string_ = "NullGL";
+		else if ( name == GL_VERSION )
+			string_ = "3.3 NullGL";
+		return( reinterpret_cast<const GLubyte*>( string_ ) );
+	}
+
+	/* glGetShaderiv, compiled */
+	static void GLAPIENTRY getShaderiv( GLuint, GLenum pname, GLint * params )
+	{
+		calls_[GLDispatch::FUNCTION_GetShaderiv]++;
+		*params = pname == GL_COMPILE_STATUS || pname == GL_COMPLETION_STATUS_KHR ? GL_TRUE : 0;
+	}
+
+	/* glGetProgramiv, linked */
+	static void GLAPIENTRY getProgramiv( GLuint, GLenum pname, GLint * params )
+	{
+		calls_[GLDispatch::FUNCTION_GetProgramiv]++;
+		*params = pname == GL_LINK_STATUS || pname == GL_COMPLETION_STATUS_KHR ? GL_TRUE : 0;
+	}
+
+	/* glCheckFramebufferStatus, complete */
+	static GLenum GLAPIENTRY checkFramebufferStatus( GLenum )
+	{
+		calls_[GLDispatch::FUNCTION_CheckFramebufferStatus]++;
+		return( GL_FRAMEBUFFER_COMPLETE );
+	}
+
+	/* glGetQueryObjectiv, result available */
+	static void GLAPIENTRY getQueryObjectiv( GLuint, GLenum pname, GLint * params )
+	{
+		calls_[GLDispatch::FUNCTION_GetQueryObjectiv]++;
+		*params = pname == GL_QUERY_RESULT_AVAILABLE ? GL_TRUE : 0;
+	}
+
+	/* glGetQueryObjectui64v, no GPU time */
+	static void GLAPIENTRY getQueryObjectui64v( GLuint, GLenum, GLuint64 * params )
+	{
+		calls_[GLDispatch::FUNCTION_GetQueryObjectui64v]++;
+		*params = 0;
+	}
+
+	/* glGetAttribLocation */
+	static GLint GLAPIENTRY getAttribLocation( GLuint, const GLchar * name )
+	{
+		calls_[GLDispatch::FUNCTION_GetAttribLocation]++;
+		return( locate( name ) );
+	}
+
+	/* glGetUniformLocation */
+	static GLint GLAPIENTRY getUniformLocation( GLuint, const GLchar * name )
+	{
+		calls_[GLDispatch::FUNCTION_GetUniformLocation]++;
+		return( locate( name ) );
+	}
+
+	/* glGetUniformIndices */
+	static void GLAPIENTRY getUniformIndices( GLuint, GLsizei uniformCount, const GLchar * const * uniformNames, GLuint * uniformIndices )
+	{
+		calls_[GLDispatch::FUNCTION_GetUniformIndices]++;
+		for ( GLsizei i = 0; i < uniformCount; i++ )
+			uniformIndices[i] = static_cast<GLuint>( locate( uniformNames[i] ) );
+	}
+
+	/* glGetActiveUniformsiv, samplers 2D or 2D Array (attached shaders) */
+	static void GLAPIENTRY getActiveUniformsiv( GLuint program, GLsizei uniformCount, const GLuint *, GLenum pname, GLint * params )
+	{
+		calls_[GLDispatch::FUNCTION_GetActiveUniformsiv]++;
+		const GLint sampler_( arraySamplers_.count( program ) > 0 ? GL_SAMPLER_2D_ARRAY : GL_SAMPLER_2D );
+		for ( GLsizei i = 0; i < uniformCount; i++ )
+			params[i] = pname == GL_UNIFORM_TYPE ? sampler_ : 0;
+	}
+
+	/* glBindBuffer */
+	static void GLAPIENTRY bindBuffer( GLenum target, GLuint buffer )
+	{
+		calls_[GLDispatch::FUNCTION_BindBuffer]++;
+		bindings_[target] = buffer;
+	}
+
+	/* glDeleteBuffers, mapped memory released */
+	static void GLAPIENTRY deleteBuffers( GLsizei n, const GLuint * buffers )
+	{
+		calls_[GLDispatch::FUNCTION_DeleteBuffers]++;
+		for ( GLsizei i = 0; i < n; i++ )
+			buffers_.erase( buffers[i] );
+	}
+
+	/* glMapBufferRange, CPU memory of the bound buffer */
+	static void * GLAPIENTRY mapBufferRange( GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield )
+	{
+
+		calls_[GLDispatch::FUNCTION_MapBufferRange]++;
+
+		// Bound buffer memory, grown to the range
+		std::vector<unsigned char> & memory_( buffers_[bindings_[target]] );
+		const std::size_t end_( static_cast<std::size_t>( offset + length ) );
+		if ( memory_.size( ) < end_ )
+			memory_.resize( end_ );
+
+		// Return range
+		return( memory_.data( ) + offset );
+
+	}
+
+	/* glUnmapBuffer */
+	static GLboolean GLAPIENTRY unmapBuffer( GLenum )
+	{
+		calls_[GLDispatch::FUNCTION_UnmapBuffer]++;
+		return( GL_TRUE );
+	}
+
+	/* glFenceSync */
+	static GLsync GLAPIENTRY fenceSync( GLenum, GLbitfield )
+	{
+		calls_[GLDispatch::FUNCTION_FenceSync]++;
+		return( reinterpret_cast<GLsync>( ++lastSync_ ) );
+	}
+
+	/* glClientWaitSync, signaled */
+	static GLenum GLAPIENTRY clientWaitSync( GLsync, GLbitfield, GLuint64 )
+	{
+		calls_[GLDispatch::FUNCTION_ClientWaitSync]++;
+		return( GL_ALREADY_SIGNALED );
+	}
+
+	/* glDrawElements */
+	static void GLAPIENTRY drawElements( GLenum, GLsizei count, GLenum, const void * )
+	{
+		calls_[GLDispatch::FUNCTION_DrawElements]++;
+		drawCalls_++;
+		instances_++;
+		elements_ += static_cast<uint64_t>( count );
+	}
+
+	/* glDrawElementsInstanced */
+	static void GLAPIENTRY drawElementsInstanced( GLenum, GLsizei count, GLenum, const void *, GLsizei primcount )
+	{
+		calls_[GLDispatch::FUNCTION_DrawElementsInstanced]++;
+		drawCalls_++;
+		instances_ += static_cast<uint64_t>( primcount );
+		elements_ += static_cast<uint64_t>( count ) * static_cast<uint64_t>( primcount );
+	}
+
+	// ===========================================================
+	// Getter & Setter
+	// ===========================================================
+
+	/*
+	 * Returns calls count of the OpenGL function since Install or Reset.
+	 *
+	 * @thread_safety - not thread-safe, gl* calls from one thread.
+	 * @param function_ - GLDispatch::FUNCTION_BindBuffer, etc.
+	*/
+	const uint64_t NullGL::getCallsCount( const unsigned short function_ ) noexcept
+	{ return( function_ < GLDispatch::FUNCTIONS_COUNT ? calls_[function_] : 0 ); }
+
+	/*
+	 * Returns calls count of all OpenGL functions since Install or Reset.
+	 *
+	 * @thread_safety - not thread-safe, gl* calls from one thread.
+	*/
+	const uint64_t NullGL::getTotalCallsCount( ) noexcept
+	{
+
+		// Sum
+		uint64_t total_( 0 );
+		for ( const uint64_t calls : calls_ )
+			total_ += calls;
+
+		// Return total
+		return( total_ );
+
+	}
+
+	/*
+	 * Returns draw calls count (glDrawElements & glDrawElementsInstanced).
+	 *
+	 * @thread_safety - not thread-safe, gl* calls from one thread.
+	*/
+	const uint64_t NullGL::getDrawCallsCount( ) noexcept
+	{ return( drawCalls_ ); }
+
+	/*
+	 * Returns drawn instances count, 1 per not instanced draw call.
+	 *
+	 * @thread_safety - not thread-safe, gl* calls from one thread.
+	*/
+	const uint64_t NullGL::getInstancesCount( ) noexcept
+	{ return( instances_ ); }
+
+	/*
+	 * Returns drawn indices count, of all instances.
+	 *
+	 * @thread_safety - not thread-safe, gl* calls from one thread.
+	*/
+	const uint64_t NullGL::getElementsCount( ) noexcept
+	{ return( elements_ ); }
+
+	// ===========================================================
+	// Methods
+	// ===========================================================
+
+	/*
+	 * Sets NullGL entry points & resets counters.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @param table_ - dispatch table.
+	*/
+	void NullGL::Install( GLDispatchTable & table_ ) noexcept
+	{
+
+		// Counted calls without output
+#define C0DE4UN_NULL_GL_CALL( name ) table_.name = &NullCall<GLDispatch::FUNCTION_##name, decltype( table_.name )>::call;
+		C0DE4UN_GL_FUNCTIONS( C0DE4UN_NULL_GL_CALL )
+#undef C0DE4UN_NULL_GL_CALL
+
+		// Objects
+		table_.GenBuffers = &genBuffers;
+		table_.GenFramebuffers = &genFramebuffers;
+		table_.GenQueries = &genQueries;
+		table_.GenSamplers = &genSamplers;
+		table_.GenTextures = &genTextures;
+		table_.GenVertexArrays = &genVertexArrays;
+		table_.CreateProgram = &createProgram;
+		table_.CreateShader = &createShader;
+		table_.ShaderSource = &shaderSource;
+		table_.AttachShader = &attachShader;
+
+		// Queries
+		table_.GetIntegerv = &getIntegerv;
+		table_.GetString = &getString;
+		table_.GetShaderiv = &getShaderiv;
+		table_.GetProgramiv = &getProgramiv;
+		table_.GetAttribLocation = &getAttribLocation;
+		table_.GetUniformLocation = &getUniformLocation;
+		table_.GetUniformIndices = &getUniformIndices;
+		table_.GetActiveUniformsiv = &getActiveUniformsiv;
+		table_.CheckFramebufferStatus = &checkFramebufferStatus;
+		table_.GetQueryObjectiv = &getQueryObjectiv;
+		table_.GetQueryObjectui64v = &getQueryObjectui64v;
+
+		// Buffers & sync
+		table_.BindBuffer = &bindBuffer;
+		table_.DeleteBuffers = &deleteBuffers;
+		table_.MapBufferRange = &mapBufferRange;
+		table_.UnmapBuffer = &unmapBuffer;
+		table_.FenceSync = &fenceSync;
+		table_.ClientWaitSync = &clientWaitSync;
+
+		// Draw
+		table_.DrawElements = &drawElements;
+		table_.DrawElementsInstanced = &drawElementsInstanced;
+
+		// Reset counters
+		Reset( );
+
+	}
+
+	/*
+	 * Resets counters, objects & mapped memory kept.
+	 *
+	 * @thread_safety - not thread-safe, gl* calls from one thread.
+	*/
+	void NullGL::Reset( ) noexcept
+	{
+
+		// Calls
+		for ( uint64_t & calls : calls_ )
+			calls = 0;
+
+		// Draws
+		drawCalls_ = 0;
+		instances_ = 0;
+		elements_ = 0;
+
+	}
+
+	/*
+	 * Prints called functions & counts to the Log.
+	 *
+	 * @thread_safety - not thread-safe, gl* calls from one thread.
+	*/
+	void NullGL::Print( ) noexcept
+	{
+
+		// Guarded-Block
+		try
+		{
+
+			// Called functions
+			for ( unsigned short i = 0; i < GLDispatch::FUNCTIONS_COUNT; i++ )
+			{
+				if ( calls_[i] == 0 )
+					continue;
+
+				std::string logMsg( "NullGL::Print - " );
+				logMsg += GLDispatch::getName( i );
+				logMsg += "=";
+				logMsg += std::to_string( calls_[i] );
+				Log::printInfo( logMsg.c_str( ) );
+			}
+
+			// Draws
+			std::string logMsg( "NullGL::Print - draw calls=" );
+			logMsg += std::to_string( drawCalls_ );
+			logMsg += ", instances=";
+			logMsg += std::to_string( instances_ );
+			logMsg += ", elements=";
+			logMsg += std::to_string( elements_ );
+			Log::printInfo( logMsg.c_str( ) );
+
+		}
+		catch ( const std::exception & )
+		{ Log::printWarning( "NullGL::Print - failed to format counters" ); }
+
+	}
+
+	// -------------------------------------------------------- \\
+
+}
\ No newline at end of file
@@ -0,0 +1,140 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_null_gl_hpp__
+#define __c0de4un_null_gl_hpp__
+
+// Include GLDispatch
+#ifndef __c0de4un_gl_dispatch_hpp__
+#include "GLDispatch.hpp"
+#endif // !__c0de4un_gl_dispatch_hpp__
+
+// Include STL
+#include <cstdint> // uint64_t
+
+// NullGL declared
+#define __c0de4un_null_gl_decl__
+
+namespace c0de4un
+{
+
+	/*
+	 * NullGL - recording OpenGL backend without driver (see GLDispatch::useNull).
+	 *
+	 * Calls counted by function, object IDs faked (sequential), nothing uploaded or drawn.
+	 * Queries report success: shaders compiled, programs linked, attributes & uniforms found,
+	 * samplers 2D (2D Array if attached shader source declares sampler2DArray), fences signaled, framebuffers complete, query results available (0 ns).
+	 * Mapped buffers backed by CPU memory, so streaming code writes vertices as with the driver.
+	 * No extensions (GLEW_* flags false).
+	 *
+	 * @version 1.0
+	*/
+	class NullGL final
+	{
+
+	public:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Getter & Setter
+		// ===========================================================
+
+		/*
+		 * Returns calls count of the OpenGL function since Install or Reset.
+		 *
+		 * @thread_safety - not thread-safe, gl* calls from one thread.
+		 * @param function_ - GLDispatch::FUNCTION_BindBuffer, etc.
+		*/
+		static const uint64_t getCallsCount( const unsigned short function_ ) noexcept;
+
+		/*
+		 * Returns calls count of all OpenGL functions since Install or Reset.
+		 *
+		 * @thread_safety - not thread-safe, gl* calls from one thread.
+		*/
+		static const uint64_t getTotalCallsCount( ) noexcept;
+
+		/*
+		 * Returns draw calls count (glDrawElements & glDrawElementsInstanced).
+		 *
+		 * @thread_safety - not thread-safe, gl* calls from one thread.
+		*/
+		static const uint64_t getDrawCallsCount( ) noexcept;
+
+		/*
+		 * Returns drawn instances count, 1 per not instanced draw call.
+		 *
+		 * @thread_safety - not thread-safe, gl* calls from one thread.
+		*/
+		static const uint64_t getInstancesCount( ) noexcept;
+
+		/*
+		 * Returns drawn indices count, of all instances.
+		 *
+		 * @thread_safety - not thread-safe, gl* calls from one thread.
+		*/
+		static const uint64_t getElementsCount( ) noexcept;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Sets NullGL entry points & resets counters.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param table_ - dispatch table.
+		*/
+		static void Install( GLDispatchTable & table_ ) noexcept;
+
+		/*
+		 * Resets counters, objects & mapped memory kept.
+		 *
+		 * @thread_safety - not thread-safe, gl* calls from one thread.
+		*/
+		static void Reset( ) noexcept;
+
+		/*
+		 * Prints called functions & counts to the Log.
+		 *
+		 * @thread_safety - not thread-safe, gl* calls from one thread.
+		*/
+		static void Print( ) noexcept;
+
+		// -------------------------------------------------------- \\
+
+	private:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Deleted
+		// ===========================================================
+
+		/* @deleted NullGL constructor */
+		NullGL( ) = delete;
+
+		/* @deleted NullGL const copy constructor */
+		NullGL( const NullGL & ) = delete;
+
+		/* @deleted NullGL const copy assignment operator */
+		NullGL & operator=( const NullGL & ) = delete;
+
+		/* @deleted NullGL move constructor */
+		NullGL( NullGL && ) = delete;
+
+		/* @deleted NullGL move assignment operator */
+		NullGL & operator=( NullGL && ) = delete;
+
+		// -------------------------------------------------------- \\
+
+	};
+
+}
+
+#endif // !__c0de4un_null_gl_hpp__
\ No newline at end of file
@@ -0,0 +1,44 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_render_item_hpp__
+#define __c0de4un_render_item_hpp__
+
+// Include STL
+#include <cstdint> // uint64_t, uint32_t
+
+// RenderItem declared
+#define __c0de4un_render_item_decl__
+
+// Enable structure-data (fields, variables) alignment (by compilator) to 1 byte
+#pragma pack( push, 1 )
+
+namespace c0de4un
+{
+
+	/*
+	 * RenderItem - RenderQueue entry, sort key & index of the submitted object.
+	 *
+	 * @version 1.0
+	*/
+	struct RenderItem final
+	{
+
+		/* Sort key (layer | blend | program | texture | depth) */
+		uint64_t key_;
+
+		/* Submitted object index (Sprite data index) */
+		uint32_t index_;
+
+	};
+
+}
+
+// Restore structure-data alignment to default (8-byte on MSVC)
+#pragma pack( pop )
+
+#endif // !__c0de4un_render_item_hpp__
\ No newline at end of file
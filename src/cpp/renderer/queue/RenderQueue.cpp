@@ -0,0 +1,223 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+// HEADER
+#ifndef __c0de4un_render_queue_hpp__
+#include "RenderQueue.hpp"
+#endif // !__c0de4un_render_queue_hpp__
+
+// Include STL
+#include <cstring> // memset
+#include <utility> // swap
+
+namespace c0de4un
+{
+
+	// -------------------------------------------------------- \\
+
+	// ===========================================================
+	// Config
+	// ===========================================================
+
+	/* Radix bits per pass */
+	static constexpr unsigned char RADIX_BITS = 8;
+
+	/* Buckets per pass */
+	static constexpr uint32_t RADIX_BUCKETS = 1u << RADIX_BITS;
+
+	/* Passes count (64-bit key) */
+	static constexpr unsigned char RADIX_PASSES = 64 / RADIX_BITS;
+
+	/* 16-bit ID mask */
+	static constexpr uint64_t ID_MASK = 0xFFFF;
+
+	// ===========================================================
+	// Constructor & destructor
+	// ===========================================================
+
+	/* RenderQueue constructor */
+	RenderQueue::RenderQueue( )
+		: mItems( ),
+		mScratch( )
+	{
+	}
+
+	/* RenderQueue destructor */
+	RenderQueue::~RenderQueue( )
+	{
+	}
+
+	// ===========================================================
+	// Getter & Setter
+	// ===========================================================
+
+	/*
+	 * Builds sort key.
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param layer_ - layer, lower layers drawn first.
+	 * @param blend_ - BLEND_OPAQUE or BLEND_ALPHA.
+	 * @param program_ - OpenGL Shader Program ID.
+	 * @param texture_ - OpenGL 2D Texture Object ID.
+	 * @param depth_ - depth in [0; 1], 0 - nearest. Clamped.
+	 * @return - sort key.
+	*/
+	const uint64_t RenderQueue::MakeKey( const unsigned char layer_, const unsigned char blend_, const GLuint program_, const GLuint texture_, const float depth_ ) noexcept
+	{
+
+		// Quantized depth (NaN & negative - nearest)
+		const uint64_t depth( depth_ > 0.0f ? ( depth_ < 1.0f ? static_cast<uint64_t>( depth_ * static_cast<float>( DEPTH_MAX ) ) : DEPTH_MAX ) : 0 );
+
+		// Layer & blend
+		const uint64_t key_( ( static_cast<uint64_t>( layer_ ) << LAYER_SHIFT ) | ( static_cast<uint64_t>( blend_ != BLEND_OPAQUE ) << BLEND_SHIFT ) );
+
+		// Translucent: back-to-front, then state
+		if ( blend_ != BLEND_OPAQUE )
+			return( key_ | ( ( DEPTH_MAX - depth ) << 32 ) | ( ( program_ & ID_MASK ) << 16 ) | ( texture_ & ID_MASK ) );
+
+		// Opaque: state, then front-to-back
+		return( key_ | ( ( program_ & ID_MASK ) << ( DEPTH_BITS + 16 ) ) | ( ( texture_ & ID_MASK ) << DEPTH_BITS ) | depth );
+
+	}
+
+	/*
+	 * Returns blend mode of the sort key.
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param key_ - sort key.
+	*/
+	const unsigned char RenderQueue::getBlend( const uint64_t key_ ) noexcept
+	{ return( static_cast<unsigned char>( ( key_ >> BLEND_SHIFT ) & 1 ) ); }
+
+	/*
+	 * Returns layer of the sort key.
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param key_ - sort key.
+	*/
+	const unsigned char RenderQueue::getLayer( const uint64_t key_ ) noexcept
+	{ return( static_cast<unsigned char>( key_ >> LAYER_SHIFT ) ); }
+
+	/* Returns items, sorted after Sort */
+	const std::vector<RenderItem> & RenderQueue::getItems( ) const noexcept
+	{ return( mItems ); }
+
+	// ===========================================================
+	// Methods
+	// ===========================================================
+
+	/*
+	 * Removes all items, capacity kept.
+	 *
+	 * @thread_safety - not thread-safe.
+	*/
+	void RenderQueue::Clear( ) noexcept
+	{ mItems.clear( ); }
+
+	/*
+	 * Reserves space for items.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @param capacity_ - number of items.
+	 * @throws - std::bad_alloc.
+	*/
+	void RenderQueue::Reserve( const std::size_t capacity_ )
+	{
+
+		// Reserve items
+		mItems.reserve( capacity_ );
+
+		// Reserve scratch
+		mScratch.reserve( capacity_ );
+
+	}
+
+	/*
+	 * Submits item.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @param key_ - sort key (see MakeKey).
+	 * @param index_ - submitted object index.
+	 * @throws - std::bad_alloc.
+	*/
+	void RenderQueue::Push( const uint64_t key_, const uint32_t index_ )
+	{ mItems.push_back( RenderItem{ key_, index_ } ); }
+
+	/*
+	 * Sorts items by key: LSD radix sort, 8 passes of 8 bits, O(n).
+	 * Passes where all keys share the same byte (layer, blend, etc) skipped.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @throws - std::bad_alloc.
+	*/
+	void RenderQueue::Sort( )
+	{
+
+		// Items count
+		const std::size_t size_( mItems.size( ) );
+
+		// Cancel
+		if ( size_ < 2 )
+			return;
+
+		// Scratch buffer
+		mScratch.resize( size_ );
+
+		// Histograms of all passes, one read of the keys
+		uint32_t histograms_[RADIX_PASSES][RADIX_BUCKETS];
+		std::memset( histograms_, 0, sizeof( histograms_ ) );
+		for ( const RenderItem & item_ : mItems )
+		{
+			for ( unsigned char pass_ = 0; pass_ < RADIX_PASSES; pass_++ )
+				histograms_[pass_][( item_.key_ >> ( pass_ * RADIX_BITS ) ) & ( RADIX_BUCKETS - 1 )]++;
+		}
+
+		// Source & destination
+		RenderItem * pSource( mItems.data( ) );
+		RenderItem * pDestination( mScratch.data( ) );
+
+		// Passes, least significant byte first
+		for ( unsigned char pass_ = 0; pass_ < RADIX_PASSES; pass_++ )
+		{
+
+			// Pass histogram
+			uint32_t *const histogram_( histograms_[pass_] );
+
+			// Shift
+			const unsigned char shift_( pass_ * RADIX_BITS );
+
+			// Skip pass, if all keys share this byte
+			if ( histogram_[( pSource[0].key_ >> shift_ ) & ( RADIX_BUCKETS - 1 )] == size_ )
+				continue;
+
+			// Buckets offsets (exclusive prefix sum)
+			uint32_t offset_( 0 );
+			for ( uint32_t bucket_ = 0; bucket_ < RADIX_BUCKETS; bucket_++ )
+			{
+				const uint32_t count_( histogram_[bucket_] );
+				histogram_[bucket_] = offset_;
+				offset_ += count_;
+			}
+
+			// Scatter (stable)
+			for ( std::size_t i = 0; i < size_; i++ )
+				pDestination[histogram_[( pSource[i].key_ >> shift_ ) & ( RADIX_BUCKETS - 1 )]++] = pSource[i];
+
+			// Swap buffers
+			std::swap( pSource, pDestination );
+
+		}
+
+		// Sorted items in the scratch buffer
+		if ( pSource != mItems.data( ) )
+			mItems.swap( mScratch );
+
+	}
+
+	// -------------------------------------------------------- \\
+
+}
\ No newline at end of file
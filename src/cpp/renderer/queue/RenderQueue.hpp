@@ -0,0 +1,197 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_render_queue_hpp__
+#define __c0de4un_render_queue_hpp__
+
+// Include opengl
+#ifndef __c0de4un_opengl_hpp__
+#include "../../cfg/opengl.hpp"
+#endif // !__c0de4un_opengl_hpp__
+
+// Include std::vector
+#ifndef __c0de4un_vector_hpp__
+#include "../../cfg/vector.hpp"
+#endif // !__c0de4un_vector_hpp__
+
+// Include RenderItem
+#ifndef __c0de4un_render_item_hpp__
+#include "RenderItem.hpp"
+#endif // !__c0de4un_render_item_hpp__
+
+// RenderQueue declared
+#define __c0de4un_render_queue_decl__
+
+namespace c0de4un
+{
+
+	/*
+	 * RenderQueue - flat array of 64-bit sort keys, radix-sorted once per frame.
+	 *
+	 * Key layout (most significant first):
+	 * - layer (8 bits), lower layers drawn first ;
+	 * - blend (1 bit), opaque drawn before translucent within layer ;
+	 * - opaque: program (16) | texture (16) | depth (23, front-to-back), minimal state changes ;
+	 * - translucent: inverted depth (23, back-to-front) | program (16) | texture (16), correct blending ;
+	 * Program & texture IDs truncated to 16 bits, only affects grouping,
+	 * renderer splits runs by real IDs. Sort is stable (submission order kept for equal keys).
+	 *
+	 * @version 1.0
+	*/
+	class RenderQueue final
+	{
+
+	public:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Constants
+		// ===========================================================
+
+		/* Opaque, blending disabled */
+		static constexpr unsigned char BLEND_OPAQUE = 0;
+
+		/* Translucent, alpha blending ( SRC_ALPHA, ONE_MINUS_SRC_ALPHA ), sorted back-to-front */
+		static constexpr unsigned char BLEND_ALPHA = 1;
+
+		/* Layer bits offset */
+		static constexpr unsigned char LAYER_SHIFT = 56;
+
+		/* Blend bit offset */
+		static constexpr unsigned char BLEND_SHIFT = 55;
+
+		/* Depth bits count */
+		static constexpr unsigned char DEPTH_BITS = 23;
+
+		/* Max. quantized depth */
+		static constexpr uint32_t DEPTH_MAX = ( 1u << DEPTH_BITS ) - 1;
+
+		// ===========================================================
+		// Constructor & destructor
+		// ===========================================================
+
+		/* RenderQueue constructor */
+		explicit RenderQueue( );
+
+		/* RenderQueue destructor */
+		~RenderQueue( );
+
+		// ===========================================================
+		// Getter & Setter
+		// ===========================================================
+
+		/*
+		 * Builds sort key.
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param layer_ - layer, lower layers drawn first.
+		 * @param blend_ - BLEND_OPAQUE or BLEND_ALPHA.
+		 * @param program_ - OpenGL Shader Program ID.
+		 * @param texture_ - OpenGL 2D Texture Object ID.
+		 * @param depth_ - depth in [0; 1], 0 - nearest. Clamped.
+		 * @return - sort key.
+		*/
+		static const uint64_t MakeKey( const unsigned char layer_, const unsigned char blend_, const GLuint program_, const GLuint texture_, const float depth_ ) noexcept;
+
+		/*
+		 * Returns blend mode of the sort key.
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param key_ - sort key.
+		*/
+		static const unsigned char getBlend( const uint64_t key_ ) noexcept;
+
+		/*
+		 * Returns layer of the sort key.
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param key_ - sort key.
+		*/
+		static const unsigned char getLayer( const uint64_t key_ ) noexcept;
+
+		/* Returns items, sorted after Sort */
+		const std::vector<RenderItem> & getItems( ) const noexcept;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Removes all items, capacity kept.
+		 *
+		 * @thread_safety - not thread-safe.
+		*/
+		void Clear( ) noexcept;
+
+		/*
+		 * Reserves space for items.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param capacity_ - number of items.
+		 * @throws - std::bad_alloc.
+		*/
+		void Reserve( const std::size_t capacity_ );
+
+		/*
+		 * Submits item.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param key_ - sort key (see MakeKey).
+		 * @param index_ - submitted object index.
+		 * @throws - std::bad_alloc.
+		*/
+		void Push( const uint64_t key_, const uint32_t index_ );
+
+		/*
+		 * Sorts items by key: LSD radix sort, 8 passes of 8 bits, O(n).
+		 * Passes where all keys share the same byte (layer, blend, etc) skipped.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @throws - std::bad_alloc.
+		*/
+		void Sort( );
+
+		// -------------------------------------------------------- \\
+
+	private:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Fields
+		// ===========================================================
+
+		/* Items */
+		std::vector<RenderItem> mItems;
+
+		/* Sort scratch buffer */
+		std::vector<RenderItem> mScratch;
+
+		// ===========================================================
+		// Deleted
+		// ===========================================================
+
+		/* @deleted RenderQueue const copy constructor */
+		RenderQueue( const RenderQueue & ) = delete;
+
+		/* @deleted RenderQueue const copy assignment operator */
+		RenderQueue & operator=( const RenderQueue & ) = delete;
+
+		/* @deleted RenderQueue move constructor */
+		RenderQueue( RenderQueue && ) = delete;
+
+		/* @deleted RenderQueue move assignment operator */
+		RenderQueue & operator=( RenderQueue && ) = delete;
+
+		// -------------------------------------------------------- \\
+
+	};
+
+}
+
+#endif // !__c0de4un_render_queue_hpp__
\ No newline at end of file
@@ -0,0 +1,73 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_render_instance_hpp__
+#define __c0de4un_render_instance_hpp__
+
+// Include opengl
+#ifndef __c0de4un_opengl_hpp__
+#include "../../cfg/opengl.hpp"
+#endif // !__c0de4un_opengl_hpp__
+
+// Include STL
+#include <cstdint> // uint64_t
+
+// RenderInstance declared
+#define __c0de4un_render_instance_decl__
+
+// Enable structure-data (fields, variables) alignment (by compilator) to 1 byte
+#pragma pack( push, 1 )
+
+namespace c0de4un
+{
+
+	/*
+	 * RenderInstance - immutable copy of the Sprite render state,
+	 * produced by simulation & consumed by render-thread.
+	 * Plain data, no pointers to the simulation objects.
+	 *
+	 * @version 1.0
+	*/
+	struct RenderInstance final
+	{
+
+		/* OpenGL Shader Program ID */
+		GLuint shaderProgram_;
+
+		/* OpenGL 2D Texture Object ID, #0 - no texture */
+		GLuint textureObject_;
+
+		/* 2D-Texture #0 Sampler Location/Index */
+		GLint texSamplerLoc_;
+
+		/* RenderQueue sort key (layer, blend mode, etc) */
+		uint64_t sortKey_;
+
+		/*
+		 * 2D affine Model Matrix rows (x', y'), each ( Xaxis, Yaxis, 0, translation ),
+		 * so x' = dot( row0, position ) & y' = dot( row1, position ).
+		 * Camera View & Projection not included, applied once per batch.
+		*/
+		float model_[8];
+
+		/* Color values in RGBA format */
+		float color_[4];
+
+		/* 2D-Texture region ( u, v, width, height ), whole texture ( 0, 0, 1, 1 ) */
+		float uvRect_[4];
+
+		/* 2D-Texture Array layer, textureObject_ is GL_TEXTURE_2D_ARRAY */
+		float textureLayer_;
+
+	};
+
+}
+
+// Restore structure-data alignment to default (8-byte on MSVC)
+#pragma pack( pop )
+
+#endif // !__c0de4un_render_instance_hpp__
\ No newline at end of file
@@ -0,0 +1,68 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_render_snapshot_hpp__
+#define __c0de4un_render_snapshot_hpp__
+
+// Include std::vector
+#ifndef __c0de4un_vector_hpp__
+#include "../../cfg/vector.hpp"
+#endif // !__c0de4un_vector_hpp__
+
+// Include RenderInstance
+#ifndef __c0de4un_render_instance_hpp__
+#include "RenderInstance.hpp"
+#endif // !__c0de4un_render_instance_hpp__
+
+// RenderSnapshot declared
+#define __c0de4un_render_snapshot_decl__
+
+namespace c0de4un
+{
+
+	/*
+	 * RenderSnapshot - all Sprites render state of one simulation frame.
+	 * Instances in submission order (RenderQueue sort key): layers, opaque grouped by
+	 * Shader Program & 2D-Texture, translucent back-to-front, so renderer draws contiguous runs.
+	 * Storage reused between frames (no allocations once capacity reached).
+	 *
+	 * @version 1.0
+	*/
+	struct RenderSnapshot final
+	{
+
+		/* Render instances */
+		std::vector<RenderInstance> instances_;
+
+		/* RenderSnapshot default constructor */
+		RenderSnapshot( )
+			: instances_( )
+		{
+		}
+
+		/* RenderSnapshot destructor */
+		~RenderSnapshot( )
+		{
+		}
+
+		/* @deleted RenderSnapshot const copy constructor */
+		RenderSnapshot( const RenderSnapshot & ) = delete;
+
+		/* @deleted RenderSnapshot copy assignment operator */
+		RenderSnapshot & operator=( const RenderSnapshot & ) = delete;
+
+		/* @deleted RenderSnapshot move constructor */
+		RenderSnapshot( RenderSnapshot && ) = delete;
+
+		/* @deleted RenderSnapshot move assignment operator */
+		RenderSnapshot & operator=( RenderSnapshot && ) = delete;
+
+	};
+
+}
+
+#endif // !__c0de4un_render_snapshot_hpp__
\ No newline at end of file
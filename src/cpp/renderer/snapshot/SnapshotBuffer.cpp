@@ -0,0 +1,184 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+// HEADER
+#ifndef __c0de4un_snapshot_buffer_hpp__
+#include "SnapshotBuffer.hpp"
+#endif // !__c0de4un_snapshot_buffer_hpp__
+
+namespace c0de4un
+{
+
+	// -------------------------------------------------------- \\
+
+	// ===========================================================
+	// Constructor & destructor
+	// ===========================================================
+
+	/* SnapshotBuffer constructor */
+	SnapshotBuffer::SnapshotBuffer( )
+		: mSnapshots( ),
+		mWriteIndex( 0 ),
+		mReadIndex( 1 ),
+		mMiddle( 2 ),
+		mClosed( false ),
+		mWaitMutex( ),
+		mWaitCondition( )
+	{
+	}
+
+	/* SnapshotBuffer destructor */
+	SnapshotBuffer::~SnapshotBuffer( )
+	{
+	}
+
+	// ===========================================================
+	// Getter & Setter
+	// ===========================================================
+
+	/*
+	 * Returns snapshot to write.
+	 *
+	 * @thread_safety - producer only.
+	*/
+	RenderSnapshot & SnapshotBuffer::getWriteSnapshot( ) noexcept
+	{ return( mSnapshots[mWriteIndex] ); }
+
+	/*
+	 * Returns last acquired snapshot.
+	 *
+	 * @thread_safety - consumer only.
+	*/
+	const RenderSnapshot & SnapshotBuffer::getReadSnapshot( ) const noexcept
+	{ return( mSnapshots[mReadIndex] ); }
+
+	/*
+	 * Returns 'true' if last published snapshot acquired by consumer.
+	 * Used by producer to run no more than one frame ahead.
+	 *
+	 * @thread_safety - thread-safe.
+	*/
+	const bool SnapshotBuffer::isConsumed( ) const noexcept
+	{ return( ( mMiddle.load( std::memory_order_acquire ) & PUBLISHED_BIT ) == 0 ); }
+
+	// ===========================================================
+	// Methods
+	// ===========================================================
+
+	/*
+	 * Publish written snapshot, replaces not acquired one.
+	 *
+	 * @thread_safety - producer only.
+	*/
+	void SnapshotBuffer::Publish( ) noexcept
+	{
+
+		// Swap written snapshot with the middle one (release written data, acquire consumer's reads completion)
+		mWriteIndex = mMiddle.exchange( static_cast<unsigned char>( mWriteIndex | PUBLISHED_BIT ), std::memory_order_acq_rel ) & INDEX_MASK;
+
+		// Wake consumer
+		Notify( );
+
+	}
+
+	/*
+	 * Acquire the latest published snapshot.
+	 *
+	 * @thread_safety - consumer only.
+	 * @return - 'false' if nothing published since previous call.
+	*/
+	const bool SnapshotBuffer::Acquire( ) noexcept
+	{
+
+		// Cancel
+		if ( ( mMiddle.load( std::memory_order_relaxed ) & PUBLISHED_BIT ) == 0 )
+			return( false );
+
+		// Swap read snapshot with the published one
+		mReadIndex = mMiddle.exchange( mReadIndex, std::memory_order_acq_rel ) & INDEX_MASK;
+
+		// Wake producer
+		Notify( );
+
+		// Return OK
+		return( true );
+
+	}
+
+	/*
+	 * Blocks until a snapshot published, or closed.
+	 *
+	 * @thread_safety - consumer only.
+	*/
+	void SnapshotBuffer::WaitPublished( ) noexcept
+	{
+
+		// Lock
+		std::unique_lock<std::mutex> lock_( mWaitMutex );
+
+		// Wait
+		mWaitCondition.wait( lock_, [this]( ) { return( mClosed || ( mMiddle.load( std::memory_order_relaxed ) & PUBLISHED_BIT ) != 0 ); } );
+
+	}
+
+	/*
+	 * Blocks until the last published snapshot acquired, or closed.
+	 *
+	 * @thread_safety - producer only.
+	*/
+	void SnapshotBuffer::WaitConsumed( ) noexcept
+	{
+
+		// Lock
+		std::unique_lock<std::mutex> lock_( mWaitMutex );
+
+		// Wait
+		mWaitCondition.wait( lock_, [this]( ) { return( mClosed || isConsumed( ) ); } );
+
+	}
+
+	/*
+	 * Wakes waiting threads, further waits return at once.
+	 * Called when producer or consumer stops.
+	 *
+	 * @thread_safety - thread-safe.
+	*/
+	void SnapshotBuffer::Close( ) noexcept
+	{
+
+		// Set flag under lock, so waiter can't miss it between check & wait
+		{
+			std::lock_guard<std::mutex> lock_( mWaitMutex );
+			mClosed = true;
+		}
+
+		// Wake all
+		mWaitCondition.notify_all( );
+
+	}
+
+	/*
+	 * Wakes waiting threads.
+	 *
+	 * @thread_safety - thread-safe.
+	*/
+	void SnapshotBuffer::Notify( ) noexcept
+	{
+
+		// Empty critical section orders exchange before waiter's check & wait
+		{
+			std::lock_guard<std::mutex> lock_( mWaitMutex );
+		}
+
+		// Wake
+		mWaitCondition.notify_all( );
+
+	}
+
+	// -------------------------------------------------------- \\
+
+}
\ No newline at end of file
@@ -0,0 +1,204 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_snapshot_buffer_hpp__
+#define __c0de4un_snapshot_buffer_hpp__
+
+// Include RenderSnapshot
+#ifndef __c0de4un_render_snapshot_hpp__
+#include "RenderSnapshot.hpp"
+#endif // !__c0de4un_render_snapshot_hpp__
+
+// Include STL
+#include <atomic> // atomic
+#include <mutex> // mutex, unique_lock
+#include <condition_variable> // condition_variable
+
+// SnapshotBuffer declared
+#define __c0de4un_snapshot_buffer_decl__
+
+namespace c0de4un
+{
+
+	/*
+	 * SnapshotBuffer - lock-free triple buffer of RenderSnapshots.
+	 *
+	 * Producer (simulation thread) writes back snapshot & publishes it,
+	 * consumer (render thread) acquires the latest published one.
+	 * Published snapshot exchanged through single atomic index,
+	 * Publish & Acquire never wait for each other. Threads without
+	 * work block in WaitPublished & WaitConsumed, until signaled
+	 * by Publish, Acquire or Close.
+	 *
+	 * @version 1.0
+	*/
+	class SnapshotBuffer final
+	{
+
+	public:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Config
+		// ===========================================================
+
+		/* Snapshots count */
+		static constexpr unsigned char SNAPSHOTS_COUNT = 3;
+
+		// ===========================================================
+		// Constructor & destructor
+		// ===========================================================
+
+		/* SnapshotBuffer constructor */
+		explicit SnapshotBuffer( );
+
+		/* SnapshotBuffer destructor */
+		~SnapshotBuffer( );
+
+		// ===========================================================
+		// Getter & Setter
+		// ===========================================================
+
+		/*
+		 * Returns snapshot to write.
+		 *
+		 * @thread_safety - producer only.
+		*/
+		RenderSnapshot & getWriteSnapshot( ) noexcept;
+
+		/*
+		 * Returns last acquired snapshot.
+		 *
+		 * @thread_safety - consumer only.
+		*/
+		const RenderSnapshot & getReadSnapshot( ) const noexcept;
+
+		/*
+		 * Returns 'true' if last published snapshot acquired by consumer.
+		 * Used by producer to run no more than one frame ahead.
+		 *
+		 * @thread_safety - thread-safe.
+		*/
+		const bool isConsumed( ) const noexcept;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Publish written snapshot, replaces not acquired one.
+		 *
+		 * @thread_safety - producer only.
+		*/
+		void Publish( ) noexcept;
+
+		/*
+		 * Acquire the latest published snapshot.
+		 *
+		 * @thread_safety - consumer only.
+		 * @return - 'false' if nothing published since previous call.
+		*/
+		const bool Acquire( ) noexcept;
+
+		/*
+		 * Blocks until a snapshot published, or closed.
+		 *
+		 * @thread_safety - consumer only.
+		*/
+		void WaitPublished( ) noexcept;
+
+		/*
+		 * Blocks until the last published snapshot acquired, or closed.
+		 *
+		 * @thread_safety - producer only.
+		*/
+		void WaitConsumed( ) noexcept;
+
+		/*
+		 * Wakes waiting threads, further waits return at once.
+		 * Called when producer or consumer stops.
+		 *
+		 * @thread_safety - thread-safe.
+		*/
+		void Close( ) noexcept;
+
+		// -------------------------------------------------------- \\
+
+	private:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Config
+		// ===========================================================
+
+		/* Snapshot index bits */
+		static constexpr unsigned char INDEX_MASK = 0x03;
+
+		/* 'Published, not acquired' flag */
+		static constexpr unsigned char PUBLISHED_BIT = 0x04;
+
+		// ===========================================================
+		// Fields
+		// ===========================================================
+
+		/* Snapshots */
+		RenderSnapshot mSnapshots[SNAPSHOTS_COUNT];
+
+		/* Producer snapshot index */
+		unsigned char mWriteIndex;
+
+		/* Consumer snapshot index */
+		unsigned char mReadIndex;
+
+		/* Exchanged snapshot index & PUBLISHED_BIT */
+		std::atomic<unsigned char> mMiddle;
+
+		/* Closed flag, guarded by mWaitMutex */
+		bool mClosed;
+
+		/* Wait mutex */
+		std::mutex mWaitMutex;
+
+		/* Signaled by Publish, Acquire & Close */
+		std::condition_variable mWaitCondition;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Wakes waiting threads.
+		 *
+		 * @thread_safety - thread-safe.
+		*/
+		void Notify( ) noexcept;
+
+		// ===========================================================
+		// Deleted
+		// ===========================================================
+
+		/* @deleted SnapshotBuffer const copy constructor */
+		SnapshotBuffer( const SnapshotBuffer & ) = delete;
+
+		/* @deleted SnapshotBuffer const copy assignment operator */
+		SnapshotBuffer & operator=( const SnapshotBuffer & ) = delete;
+
+		/* @deleted SnapshotBuffer move constructor */
+		SnapshotBuffer( SnapshotBuffer && ) = delete;
+
+		/* @deleted SnapshotBuffer move assignment operator */
+		SnapshotBuffer & operator=( SnapshotBuffer && ) = delete;
+
+		// -------------------------------------------------------- \\
+
+	};
+
+}
+
+#endif // !__c0de4un_snapshot_buffer_hpp__
\ No newline at end of file
@@ -0,0 +1,519 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+// HEADER
+#ifndef __c0de4un_gl_state_cache_hpp__
+#include "GLStateCache.hpp"
+#endif // !__c0de4un_gl_state_cache_hpp__
+
+// Include Log
+#ifndef __c0de4un_log_hpp__
+#include "../../utils/log/Log.hpp"
+#endif // !__c0de4un_log_hpp__
+
+// Include STL
+#include <cstring> // memset
+
+namespace c0de4un
+{
+
+	// -------------------------------------------------------- \\
+
+	// ===========================================================
+	// Constructor & destructor
+	// ===========================================================
+
+	/* GLStateCache constructor */
+	GLStateCache::GLStateCache( )
+		: mIssued{ },
+		mElided{ },
+		mProgram( UNKNOWN_ID ),
+		mVertexArray( UNKNOWN_ID ),
+		mActiveUnit( UNKNOWN_ID ),
+		mTextures2D{ },
+		mTextureArrays{ },
+		mSamplerObjects{ },
+		mBlend( BLEND_UNKNOWN ),
+		mBlendSrc( UNKNOWN_ENUM ),
+		mBlendDst( UNKNOWN_ENUM ),
+		mSamplers( )
+	{
+
+		// State unknown
+		Invalidate( );
+
+	}
+
+	/* GLStateCache destructor */
+	GLStateCache::~GLStateCache( )
+	{
+	}
+
+	// ===========================================================
+	// Getter & Setter
+	// ===========================================================
+
+	/*
+	 * Returns name of the tracked call.
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param call_ - CALL_USE_PROGRAM, CALL_BIND_TEXTURE, etc.
+	*/
+	const char * GLStateCache::getCallName( const unsigned char call_ ) noexcept
+	{
+
+		// Names
+		static const char *const names_[CALLS_COUNT] = { "glUseProgram", "glBindVertexArray", "glActiveTexture", "glBindTexture", "glEnable/glDisable(GL_BLEND)", "glBlendFunc", "glUniform1i(sampler)", "glBindSampler" };
+
+		// Return name
+		return( call_ < CALLS_COUNT ? names_[call_] : "unknown" );
+
+	}
+
+	/*
+	 * Returns issued (passed to OpenGL) calls count since ResetCounters.
+	 *
+	 * @thread_safety - render-thread only.
+	 * @param call_ - CALL_USE_PROGRAM, CALL_BIND_TEXTURE, etc.
+	*/
+	const uint64_t GLStateCache::getIssued( const unsigned char call_ ) const noexcept
+	{ return( call_ < CALLS_COUNT ? mIssued[call_] : 0 ); }
+
+	/*
+	 * Returns elided (skipped, redundant) calls count since ResetCounters.
+	 *
+	 * @thread_safety - render-thread only.
+	 * @param call_ - CALL_USE_PROGRAM, CALL_BIND_TEXTURE, etc.
+	*/
+	const uint64_t GLStateCache::getElided( const unsigned char call_ ) const noexcept
+	{ return( call_ < CALLS_COUNT ? mElided[call_] : 0 ); }
+
+	/* Returns issued calls count of all tracked calls */
+	const uint64_t GLStateCache::getIssuedTotal( ) const noexcept
+	{
+
+		// Total
+		uint64_t total_( 0 );
+		for ( unsigned char call_ = 0; call_ < CALLS_COUNT; call_++ )
+			total_ += mIssued[call_];
+
+		// Return total
+		return( total_ );
+
+	}
+
+	/* Returns elided calls count of all tracked calls */
+	const uint64_t GLStateCache::getElidedTotal( ) const noexcept
+	{
+
+		// Total
+		uint64_t total_( 0 );
+		for ( unsigned char call_ = 0; call_ < CALLS_COUNT; call_++ )
+			total_ += mElided[call_];
+
+		// Return total
+		return( total_ );
+
+	}
+
+	// ===========================================================
+	// Methods
+	// ===========================================================
+
+	/*
+	 * Counts call.
+	 *
+	 * @param call_ - CALL_USE_PROGRAM, CALL_BIND_TEXTURE, etc.
+	 * @param issued_ - 'true' if issued, 'false' if elided.
+	 * @return - issued_.
+	*/
+	const bool GLStateCache::count( const unsigned char call_, const bool issued_ ) noexcept
+	{
+
+		// Count
+		if ( issued_ )
+			mIssued[call_]++;
+		else
+			mElided[call_]++;
+
+		// Return issued flag
+		return( issued_ );
+
+	}
+
+	/*
+	 * Use Shader Program.
+	 *
+	 * @thread_safety - render-thread only.
+	 * @param program_ - OpenGL Shader Program ID, 0 to reset.
+	*/
+	void GLStateCache::UseProgram( const GLuint program_ ) noexcept
+	{
+
+		// Skip, if already used
+		if ( !count( CALL_USE_PROGRAM, mProgram != program_ ) )
+			return;
+
+		// Use Shader Program
+		glUseProgram( program_ );
+
+		// Set Shader Program
+		mProgram = program_;
+
+	}
+
+	/*
+	 * Bind VAO.
+	 *
+	 * @thread_safety - render-thread only.
+	 * @param vao_ - OpenGL Vertex Array Object ID, 0 to unbind.
+	*/
+	void GLStateCache::BindVertexArray( const GLuint vao_ ) noexcept
+	{
+
+		// Skip, if already bound
+		if ( !count( CALL_BIND_VERTEX_ARRAY, mVertexArray != vao_ ) )
+			return;
+
+		// Bind VAO
+		glBindVertexArray( vao_ );
+
+		// Set VAO
+		mVertexArray = vao_;
+
+	}
+
+	/*
+	 * Bind 2D-Texture to the Texture Unit, unit activated if required.
+	 *
+	 * @thread_safety - render-thread only.
+	 * @param unit_ - Texture Unit index (0 for GL_TEXTURE0), less than MAX_TEXTURE_UNITS.
+	 * @param texture_ - OpenGL 2D Texture Object ID, 0 to unbind.
+	*/
+	void GLStateCache::BindTexture2D( const unsigned char unit_, const GLuint texture_ ) noexcept
+	{
+
+#ifdef DEBUG // DEBUG
+		assert( unit_ < MAX_TEXTURE_UNITS && "GLStateCache::BindTexture2D - Texture Unit not tracked !" );
+#endif // DEBUG
+
+		// Skip, if already bound
+		if ( !count( CALL_BIND_TEXTURE, mTextures2D[unit_] != texture_ ) )
+			return;
+
+		// Activate Texture Unit
+		if ( count( CALL_ACTIVE_TEXTURE, mActiveUnit != unit_ ) )
+		{
+
+			// Make Texture Unit Active
+			glActiveTexture( GL_TEXTURE0 + unit_ );
+
+			// Set active Texture Unit
+			mActiveUnit = unit_;
+
+		}
+
+		// Bind 2D-Texture
+		glBindTexture( GL_TEXTURE_2D, texture_ );
+
+		// Set 2D-Texture
+		mTextures2D[unit_] = texture_;
+
+	}
+
+	/*
+	 * Bind 2D-Texture Array to the Texture Unit, unit activated if required.
+	 *
+	 * @thread_safety - render-thread only.
+	 * @param unit_ - Texture Unit index (0 for GL_TEXTURE0), less than MAX_TEXTURE_UNITS.
+	 * @param texture_ - OpenGL 2D Texture Array Object ID, 0 to unbind.
+	*/
+	void GLStateCache::BindTexture2DArray( const unsigned char unit_, const GLuint texture_ ) noexcept
+	{
+
+#ifdef DEBUG // DEBUG
+		assert( unit_ < MAX_TEXTURE_UNITS && "GLStateCache::BindTexture2DArray - Texture Unit not tracked !" );
+#endif // DEBUG
+
+		// Skip, if already bound
+		if ( !count( CALL_BIND_TEXTURE, mTextureArrays[unit_] != texture_ ) )
+			return;
+
+		// Activate Texture Unit
+		if ( count( CALL_ACTIVE_TEXTURE, mActiveUnit != unit_ ) )
+		{
+
+			// Make Texture Unit Active
+			glActiveTexture( GL_TEXTURE0 + unit_ );
+
+			// Set active Texture Unit
+			mActiveUnit = unit_;
+
+		}
+
+		// Bind 2D-Texture Array
+		glBindTexture( GL_TEXTURE_2D_ARRAY, texture_ );
+
+		// Set 2D-Texture Array
+		mTextureArrays[unit_] = texture_;
+
+	}
+
+	/*
+	 * Bind Sampler Object to the Texture Unit (no unit activation required).
+	 *
+	 * @thread_safety - render-thread only.
+	 * @param unit_ - Texture Unit index (0 for GL_TEXTURE0), less than MAX_TEXTURE_UNITS.
+	 * @param sampler_ - OpenGL Sampler Object ID, 0 to use texture parameters.
+	*/
+	void GLStateCache::BindSampler( const unsigned char unit_, const GLuint sampler_ ) noexcept
+	{
+
+#ifdef DEBUG // DEBUG
+		assert( unit_ < MAX_TEXTURE_UNITS && "GLStateCache::BindSampler - Texture Unit not tracked !" );
+#endif // DEBUG
+
+		// Skip, if already bound
+		if ( !count( CALL_BIND_SAMPLER, mSamplerObjects[unit_] != sampler_ ) )
+			return;
+
+		// Bind Sampler Object, unit passed directly
+		glBindSampler( unit_, sampler_ );
+
+		// Set Sampler Object
+		mSamplerObjects[unit_] = sampler_;
+
+	}
+
+	/*
+	 * Enable or disable blending.
+	 *
+	 * @thread_safety - render-thread only.
+	 * @param enabled_ - 'true' to enable GL_BLEND.
+	*/
+	void GLStateCache::SetBlend( const bool enabled_ ) noexcept
+	{
+
+		// Blending state
+		const unsigned char blend_( enabled_ ? 1 : 0 );
+
+		// Skip, if already set
+		if ( !count( CALL_BLEND, mBlend != blend_ ) )
+			return;
+
+		// Enable or disable Blending
+		if ( enabled_ )
+			glEnable( GL_BLEND );
+		else
+			glDisable( GL_BLEND );
+
+		// Set Blending state
+		mBlend = blend_;
+
+	}
+
+	/*
+	 * Set blending function.
+	 *
+	 * @thread_safety - render-thread only.
+	 * @param src_ - source factor.
+	 * @param dst_ - destination factor.
+	*/
+	void GLStateCache::BlendFunc( const GLenum src_, const GLenum dst_ ) noexcept
+	{
+
+		// Skip, if already set
+		if ( !count( CALL_BLEND_FUNC, mBlendSrc != src_ || mBlendDst != dst_ ) )
+			return;
+
+		// Set Blending Function
+		glBlendFunc( src_, dst_ );
+
+		// Set factors
+		mBlendSrc = src_;
+		mBlendDst = dst_;
+
+	}
+
+	/*
+	 * Set sampler uniform of the current Shader Program to the Texture Unit.
+	 * Uniform values belong to Shader Program, so shadowed per program.
+	 *
+	 * @thread_safety - render-thread only.
+	 * @param location_ - uniform location, ignored if less than 0.
+	 * @param unit_ - Texture Unit index.
+	 * @throws - std::bad_alloc.
+	*/
+	void GLStateCache::UniformSampler( const GLint location_, const GLint unit_ )
+	{
+
+		// Cancel, if uniform not active
+		if ( location_ < 0 )
+			return;
+
+#ifdef DEBUG // DEBUG
+		assert( mProgram != UNKNOWN_ID && mProgram > 0 && "GLStateCache::UniformSampler - Shader Program not used !" );
+#endif // DEBUG
+
+		// Search shadowed value
+		for ( SamplerValue & sampler_ : mSamplers )
+		{
+
+			// Other uniform
+			if ( sampler_.program_ != mProgram || sampler_.location_ != location_ )
+				continue;
+
+			// Skip, if already set
+			if ( !count( CALL_UNIFORM_SAMPLER, sampler_.unit_ != unit_ ) )
+				return;
+
+			// Set Shader Uniform Texture Sampler 2D
+			glUniform1i( location_, unit_ );
+
+			// Set value
+			sampler_.unit_ = unit_;
+
+			// Return
+			return;
+
+		}
+
+		// Count
+		count( CALL_UNIFORM_SAMPLER, true );
+
+		// Set Shader Uniform Texture Sampler 2D
+		glUniform1i( location_, unit_ );
+
+		// Add shadowed value
+		mSamplers.push_back( SamplerValue{ mProgram, location_, unit_ } );
+
+	}
+
+	/*
+	 * Drops shadowed state of the Shader Program (deleted or reloaded, ID can be reused).
+	 *
+	 * @thread_safety - render-thread only.
+	 * @param program_ - OpenGL Shader Program ID.
+	*/
+	void GLStateCache::ForgetProgram( const GLuint program_ ) noexcept
+	{
+
+		// Remove sampler uniforms of the Shader Program (swap with last)
+		for ( std::size_t i = 0; i < mSamplers.size( ); )
+		{
+
+			// Keep other Shader Program uniform
+			if ( mSamplers[i].program_ != program_ )
+			{
+				i++;
+				continue;
+			}
+
+			// Remove
+			mSamplers[i] = mSamplers.back( );
+			mSamplers.pop_back( );
+
+		}
+
+		// Used Shader Program unknown
+		if ( mProgram == program_ )
+			mProgram = UNKNOWN_ID;
+
+	}
+
+	/*
+	 * Drops shadowed binding of the VAO (deleted VAO unbound by OpenGL).
+	 *
+	 * @thread_safety - render-thread only.
+	 * @param vao_ - OpenGL Vertex Array Object ID.
+	*/
+	void GLStateCache::ForgetVertexArray( const GLuint vao_ ) noexcept
+	{
+
+		// Deleted bound VAO reverts binding to 0
+		if ( mVertexArray == vao_ )
+			mVertexArray = 0;
+
+	}
+
+	/*
+	 * Drops shadowed bindings of the Sampler Object (deleted Sampler Object unbound by OpenGL).
+	 *
+	 * @thread_safety - render-thread only.
+	 * @param sampler_ - OpenGL Sampler Object ID.
+	*/
+	void GLStateCache::ForgetSampler( const GLuint sampler_ ) noexcept
+	{
+
+		// Deleted bound Sampler Object reverts binding to 0
+		for ( unsigned char unit_ = 0; unit_ < MAX_TEXTURE_UNITS; unit_++ )
+		{
+			if ( mSamplerObjects[unit_] == sampler_ )
+				mSamplerObjects[unit_] = 0;
+		}
+
+	}
+
+	/*
+	 * Marks all state unknown, next calls issued.
+	 * Used after OpenGL calls outside cache & when context changed.
+	 *
+	 * @thread_safety - render-thread only.
+	*/
+	void GLStateCache::Invalidate( ) noexcept
+	{
+
+		// Shader Program
+		mProgram = UNKNOWN_ID;
+
+		// VAO
+		mVertexArray = UNKNOWN_ID;
+
+		// Active Texture Unit
+		mActiveUnit = UNKNOWN_ID;
+
+		// 2D-Textures
+		for ( unsigned char unit_ = 0; unit_ < MAX_TEXTURE_UNITS; unit_++ )
+			mTextures2D[unit_] = UNKNOWN_ID;
+
+		// 2D-Texture Arrays
+		for ( unsigned char unit_ = 0; unit_ < MAX_TEXTURE_UNITS; unit_++ )
+			mTextureArrays[unit_] = UNKNOWN_ID;
+
+		// Sampler Objects
+		for ( unsigned char unit_ = 0; unit_ < MAX_TEXTURE_UNITS; unit_++ )
+			mSamplerObjects[unit_] = UNKNOWN_ID;
+
+		// Blending
+		mBlend = BLEND_UNKNOWN;
+		mBlendSrc = UNKNOWN_ENUM;
+		mBlendDst = UNKNOWN_ENUM;
+
+		// Sampler uniforms
+		mSamplers.clear( );
+
+	}
+
+	/*
+	 * Resets issued & elided counters.
+	 *
+	 * @thread_safety - render-thread only.
+	*/
+	void GLStateCache::ResetCounters( ) noexcept
+	{
+
+		// Issued
+		std::memset( mIssued, 0, sizeof( mIssued ) );
+
+		// Elided
+		std::memset( mElided, 0, sizeof( mElided ) );
+
+	}
+
+	// -------------------------------------------------------- \\
+
+}
\ No newline at end of file
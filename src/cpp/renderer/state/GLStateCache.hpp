@@ -0,0 +1,355 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_gl_state_cache_hpp__
+#define __c0de4un_gl_state_cache_hpp__
+
+// Include opengl
+#ifndef __c0de4un_opengl_hpp__
+#include "../../cfg/opengl.hpp"
+#endif // !__c0de4un_opengl_hpp__
+
+// Include std::vector
+#ifndef __c0de4un_vector_hpp__
+#include "../../cfg/vector.hpp"
+#endif // !__c0de4un_vector_hpp__
+
+// Include STL
+#include <cstdint> // uint64_t
+
+// GLStateCache declared
+#define __c0de4un_gl_state_cache_decl__
+
+namespace c0de4un
+{
+
+	/*
+	 * GLStateCache - shadow copy of the OpenGL state used by the renderer.
+	 * Calls that don't change the state are skipped (elided).
+	 *
+	 * Tracked: bound Shader Program, VAO, active Texture Unit, 2D-Texture, 2D-Texture Array & Sampler Object per unit,
+	 * blending (enabled, function) & sampler uniforms (per Shader Program).
+	 * State is unknown after construction & Invalidate, first calls always issued.
+	 *
+	 * (!) OpenGL calls outside cache (texture loading, etc) that change tracked state
+	 * must be followed by Invalidate.
+	 *
+	 * @version 1.0
+	*/
+	class GLStateCache final
+	{
+
+	public:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Constants
+		// ===========================================================
+
+		/* Max. tracked Texture Units */
+		static constexpr unsigned char MAX_TEXTURE_UNITS = 16;
+
+		/* glUseProgram */
+		static constexpr unsigned char CALL_USE_PROGRAM = 0;
+
+		/* glBindVertexArray */
+		static constexpr unsigned char CALL_BIND_VERTEX_ARRAY = 1;
+
+		/* glActiveTexture */
+		static constexpr unsigned char CALL_ACTIVE_TEXTURE = 2;
+
+		/* glBindTexture */
+		static constexpr unsigned char CALL_BIND_TEXTURE = 3;
+
+		/* glEnable & glDisable ( GL_BLEND ) */
+		static constexpr unsigned char CALL_BLEND = 4;
+
+		/* glBlendFunc */
+		static constexpr unsigned char CALL_BLEND_FUNC = 5;
+
+		/* glUniform1i (sampler) */
+		static constexpr unsigned char CALL_UNIFORM_SAMPLER = 6;
+
+		/* glBindSampler */
+		static constexpr unsigned char CALL_BIND_SAMPLER = 7;
+
+		/* Tracked calls count */
+		static constexpr unsigned char CALLS_COUNT = 8;
+
+		// ===========================================================
+		// Constructor & destructor
+		// ===========================================================
+
+		/* GLStateCache constructor */
+		explicit GLStateCache( );
+
+		/* GLStateCache destructor */
+		~GLStateCache( );
+
+		// ===========================================================
+		// Getter & Setter
+		// ===========================================================
+
+		/*
+		 * Returns name of the tracked call.
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param call_ - CALL_USE_PROGRAM, CALL_BIND_TEXTURE, etc.
+		*/
+		static const char * getCallName( const unsigned char call_ ) noexcept;
+
+		/*
+		 * Returns issued (passed to OpenGL) calls count since ResetCounters.
+		 *
+		 * @thread_safety - render-thread only.
+		 * @param call_ - CALL_USE_PROGRAM, CALL_BIND_TEXTURE, etc.
+		*/
+		const uint64_t getIssued( const unsigned char call_ ) const noexcept;
+
+		/*
+		 * Returns elided (skipped, redundant) calls count since ResetCounters.
+		 *
+		 * @thread_safety - render-thread only.
+		 * @param call_ - CALL_USE_PROGRAM, CALL_BIND_TEXTURE, etc.
+		*/
+		const uint64_t getElided( const unsigned char call_ ) const noexcept;
+
+		/* Returns issued calls count of all tracked calls */
+		const uint64_t getIssuedTotal( ) const noexcept;
+
+		/* Returns elided calls count of all tracked calls */
+		const uint64_t getElidedTotal( ) const noexcept;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Use Shader Program.
+		 *
+		 * @thread_safety - render-thread only.
+		 * @param program_ - OpenGL Shader Program ID, 0 to reset.
+		*/
+		void UseProgram( const GLuint program_ ) noexcept;
+
+		/*
+		 * Bind VAO.
+		 *
+		 * @thread_safety - render-thread only.
+		 * @param vao_ - OpenGL Vertex Array Object ID, 0 to unbind.
+		*/
+		void BindVertexArray( const GLuint vao_ ) noexcept;
+
+		/*
+		 * Bind 2D-Texture to the Texture Unit, unit activated if required.
+		 *
+		 * @thread_safety - render-thread only.
+		 * @param unit_ - Texture Unit index (0 for GL_TEXTURE0), less than MAX_TEXTURE_UNITS.
+		 * @param texture_ - OpenGL 2D Texture Object ID, 0 to unbind.
+		*/
+		void BindTexture2D( const unsigned char unit_, const GLuint texture_ ) noexcept;
+
+		/*
+		 * Bind 2D-Texture Array to the Texture Unit, unit activated if required.
+		 *
+		 * @thread_safety - render-thread only.
+		 * @param unit_ - Texture Unit index (0 for GL_TEXTURE0), less than MAX_TEXTURE_UNITS.
+		 * @param texture_ - OpenGL 2D Texture Array Object ID, 0 to unbind.
+		*/
+		void BindTexture2DArray( const unsigned char unit_, const GLuint texture_ ) noexcept;
+
+		/*
+		 * Bind Sampler Object to the Texture Unit (no unit activation required).
+		 *
+		 * @thread_safety - render-thread only.
+		 * @param unit_ - Texture Unit index (0 for GL_TEXTURE0), less than MAX_TEXTURE_UNITS.
+		 * @param sampler_ - OpenGL Sampler Object ID, 0 to use texture parameters.
+		*/
+		void BindSampler( const unsigned char unit_, const GLuint sampler_ ) noexcept;
+
+		/*
+		 * Enable or disable blending.
+		 *
+		 * @thread_safety - render-thread only.
+		 * @param enabled_ - 'true' to enable GL_BLEND.
+		*/
+		void SetBlend( const bool enabled_ ) noexcept;
+
+		/*
+		 * Set blending function.
+		 *
+		 * @thread_safety - render-thread only.
+		 * @param src_ - source factor.
+		 * @param dst_ - destination factor.
+		*/
+		void BlendFunc( const GLenum src_, const GLenum dst_ ) noexcept;
+
+		/*
+		 * Set sampler uniform of the current Shader Program to the Texture Unit.
+		 * Uniform values belong to Shader Program, so shadowed per program.
+		 *
+		 * @thread_safety - render-thread only.
+		 * @param location_ - uniform location, ignored if less than 0.
+		 * @param unit_ - Texture Unit index.
+		 * @throws - std::bad_alloc.
+		*/
+		void UniformSampler( const GLint location_, const GLint unit_ );
+
+		/*
+		 * Drops shadowed state of the Shader Program (deleted or reloaded, ID can be reused).
+		 *
+		 * @thread_safety - render-thread only.
+		 * @param program_ - OpenGL Shader Program ID.
+		*/
+		void ForgetProgram( const GLuint program_ ) noexcept;
+
+		/*
+		 * Drops shadowed binding of the VAO (deleted VAO unbound by OpenGL).
+		 *
+		 * @thread_safety - render-thread only.
+		 * @param vao_ - OpenGL Vertex Array Object ID.
+		*/
+		void ForgetVertexArray( const GLuint vao_ ) noexcept;
+
+		/*
+		 * Drops shadowed bindings of the Sampler Object (deleted Sampler Object unbound by OpenGL).
+		 *
+		 * @thread_safety - render-thread only.
+		 * @param sampler_ - OpenGL Sampler Object ID.
+		*/
+		void ForgetSampler( const GLuint sampler_ ) noexcept;
+
+		/*
+		 * Marks all state unknown, next calls issued.
+		 * Used after OpenGL calls outside cache & when context changed.
+		 *
+		 * @thread_safety - render-thread only.
+		*/
+		void Invalidate( ) noexcept;
+
+		/*
+		 * Resets issued & elided counters.
+		 *
+		 * @thread_safety - render-thread only.
+		*/
+		void ResetCounters( ) noexcept;
+
+		// -------------------------------------------------------- \\
+
+	private:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Types
+		// ===========================================================
+
+		/* Shadowed sampler uniform value */
+		struct SamplerValue final
+		{
+
+			/* OpenGL Shader Program ID */
+			GLuint program_;
+
+			/* Uniform location */
+			GLint location_;
+
+			/* Texture Unit index */
+			GLint unit_;
+
+		};
+
+		// ===========================================================
+		// Constants
+		// ===========================================================
+
+		/* Unknown object ID (never returned by OpenGL) */
+		static constexpr GLuint UNKNOWN_ID = 0xFFFFFFFF;
+
+		/* Unknown enum value */
+		static constexpr GLenum UNKNOWN_ENUM = 0xFFFFFFFF;
+
+		/* Unknown blending state */
+		static constexpr unsigned char BLEND_UNKNOWN = 2;
+
+		// ===========================================================
+		// Fields
+		// ===========================================================
+
+		/* Issued calls counters */
+		uint64_t mIssued[CALLS_COUNT];
+
+		/* Elided calls counters */
+		uint64_t mElided[CALLS_COUNT];
+
+		/* Bound Shader Program */
+		GLuint mProgram;
+
+		/* Bound VAO */
+		GLuint mVertexArray;
+
+		/* Active Texture Unit index, UNKNOWN_ID if unknown */
+		GLuint mActiveUnit;
+
+		/* Bound 2D-Textures per Texture Unit */
+		GLuint mTextures2D[MAX_TEXTURE_UNITS];
+
+		/* Bound 2D-Texture Arrays per Texture Unit */
+		GLuint mTextureArrays[MAX_TEXTURE_UNITS];
+
+		/* Bound Sampler Objects per Texture Unit */
+		GLuint mSamplerObjects[MAX_TEXTURE_UNITS];
+
+		/* Blending: 0 - disabled, 1 - enabled, BLEND_UNKNOWN */
+		unsigned char mBlend;
+
+		/* Blending source factor */
+		GLenum mBlendSrc;
+
+		/* Blending destination factor */
+		GLenum mBlendDst;
+
+		/* Shadowed sampler uniforms (few per frame, linear search) */
+		std::vector<SamplerValue> mSamplers;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Counts call.
+		 *
+		 * @param call_ - CALL_USE_PROGRAM, CALL_BIND_TEXTURE, etc.
+		 * @param issued_ - 'true' if issued, 'false' if elided.
+		 * @return - issued_.
+		*/
+		const bool count( const unsigned char call_, const bool issued_ ) noexcept;
+
+		// ===========================================================
+		// Deleted
+		// ===========================================================
+
+		/* @deleted GLStateCache const copy constructor */
+		GLStateCache( const GLStateCache & ) = delete;
+
+		/* @deleted GLStateCache const copy assignment operator */
+		GLStateCache & operator=( const GLStateCache & ) = delete;
+
+		/* @deleted GLStateCache move constructor */
+		GLStateCache( GLStateCache && ) = delete;
+
+		/* @deleted GLStateCache move assignment operator */
+		GLStateCache & operator=( GLStateCache && ) = delete;
+
+		// -------------------------------------------------------- \\
+
+	};
+
+}
+
+#endif // !__c0de4un_gl_state_cache_hpp__
\ No newline at end of file
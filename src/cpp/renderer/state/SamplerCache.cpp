@@ -0,0 +1,119 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+// HEADER
+#ifndef __c0de4un_sampler_cache_hpp__
+#include "SamplerCache.hpp"
+#endif // !__c0de4un_sampler_cache_hpp__
+
+// Include GLStateCache
+#ifndef __c0de4un_gl_state_cache_hpp__
+#include "GLStateCache.hpp"
+#endif // !__c0de4un_gl_state_cache_hpp__
+
+namespace c0de4un
+{
+
+	// -------------------------------------------------------- \\
+
+	// ===========================================================
+	// Constructor & destructor
+	// ===========================================================
+
+	/* SamplerCache constructor */
+	SamplerCache::SamplerCache( )
+		: mSamplers( )
+	{
+	}
+
+	/*
+	 * SamplerCache destructor
+	 * Sampler Objects must be deleted by Unload, while OpenGL context current.
+	*/
+	SamplerCache::~SamplerCache( )
+	{
+	}
+
+	// ===========================================================
+	// Getter & Setter
+	// ===========================================================
+
+	/*
+	 * Returns Sampler Object of the state, created on first use.
+	 *
+	 * @thread_safety - render-thread only.
+	 * @param state_ - filtering & wrapping.
+	 * @return - OpenGL Sampler Object ID.
+	 * @throws - std::bad_alloc.
+	*/
+	const GLuint SamplerCache::getSampler( const SamplerState & state_ )
+	{
+
+		// Search created Sampler Object
+		for ( const SamplerEntry & entry_ : mSamplers )
+		{
+			if ( entry_.state_.minFilter_ == state_.minFilter_ && entry_.state_.magFilter_ == state_.magFilter_
+				&& entry_.state_.wrapS_ == state_.wrapS_ && entry_.state_.wrapT_ == state_.wrapT_ )
+				return( entry_.sampler_ );
+		}
+
+		// Reserve entry before OpenGL object created, so not leaked on bad_alloc
+		mSamplers.reserve( mSamplers.size( ) + 1 );
+
+		// Create Sampler Object
+		GLuint sampler_( 0 );
+		glGenSamplers( 1, &sampler_ );
+
+		// Set filtering
+		glSamplerParameteri( sampler_, GL_TEXTURE_MIN_FILTER, static_cast<GLint>( state_.minFilter_ ) );
+		glSamplerParameteri( sampler_, GL_TEXTURE_MAG_FILTER, static_cast<GLint>( state_.magFilter_ ) );
+
+		// Set wrapping
+		glSamplerParameteri( sampler_, GL_TEXTURE_WRAP_S, static_cast<GLint>( state_.wrapS_ ) );
+		glSamplerParameteri( sampler_, GL_TEXTURE_WRAP_T, static_cast<GLint>( state_.wrapT_ ) );
+
+		// Add
+		mSamplers.push_back( SamplerEntry{ state_, sampler_ } );
+
+		// Return Sampler Object
+		return( sampler_ );
+
+	}
+
+	// ===========================================================
+	// Methods
+	// ===========================================================
+
+	/*
+	 * Deletes all Sampler Objects.
+	 *
+	 * @thread_safety - render-thread only.
+	 * @param stateCache_ - state cache to forget deleted bindings.
+	*/
+	void SamplerCache::Unload( GLStateCache & stateCache_ ) noexcept
+	{
+
+		// Delete Sampler Objects
+		for ( const SamplerEntry & entry_ : mSamplers )
+		{
+
+			// Forget bindings
+			stateCache_.ForgetSampler( entry_.sampler_ );
+
+			// Delete Sampler Object
+			glDeleteSamplers( 1, &entry_.sampler_ );
+
+		}
+
+		// Remove entries
+		mSamplers.clear( );
+
+	}
+
+	// -------------------------------------------------------- \\
+
+}
\ No newline at end of file
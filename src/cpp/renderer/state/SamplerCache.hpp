@@ -0,0 +1,169 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_sampler_cache_hpp__
+#define __c0de4un_sampler_cache_hpp__
+
+// Include opengl
+#ifndef __c0de4un_opengl_hpp__
+#include "../../cfg/opengl.hpp"
+#endif // !__c0de4un_opengl_hpp__
+
+// Include std::vector
+#ifndef __c0de4un_vector_hpp__
+#include "../../cfg/vector.hpp"
+#endif // !__c0de4un_vector_hpp__
+
+// Forward-declaration of GLStateCache
+#ifndef __c0de4un_gl_state_cache_decl__
+#define __c0de4un_gl_state_cache_decl__
+namespace c0de4un { class GLStateCache; }
+#endif // !__c0de4un_gl_state_cache_decl__
+
+// SamplerCache declared
+#define __c0de4un_sampler_cache_decl__
+
+namespace c0de4un
+{
+
+	/*
+	 * SamplerState - filtering & wrapping of the Sampler Object (key of the SamplerCache).
+	 *
+	 * @version 1.0
+	*/
+	struct SamplerState final
+	{
+
+		/* Min. filter (GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR, etc) */
+		GLenum minFilter_;
+
+		/* Mag. filter (GL_LINEAR or GL_NEAREST) */
+		GLenum magFilter_;
+
+		/* S (U/X) wrap mode */
+		GLenum wrapS_;
+
+		/* T (V/Y) wrap mode */
+		GLenum wrapT_;
+
+	};
+
+	/*
+	 * SamplerCache - shared OpenGL Sampler Objects, one per SamplerState.
+	 *
+	 * Filtering & wrapping set once per state, not per texture, so textures differ only
+	 * in storage (levels count, GL_TEXTURE_MAX_LEVEL). Sampler bound to the unit
+	 * overrides texture parameters.
+	 * Few states used, so linear search.
+	 *
+	 * @version 1.0
+	*/
+	class SamplerCache final
+	{
+
+	public:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Constants
+		// ===========================================================
+
+		/* Sprites: trilinear (mipmaps used if loaded, see GL_TEXTURE_MAX_LEVEL), clamped to edge */
+		static constexpr SamplerState SPRITE = { GL_LINEAR_MIPMAP_LINEAR, GL_LINEAR, GL_CLAMP_TO_EDGE, GL_CLAMP_TO_EDGE };
+
+		// ===========================================================
+		// Constructor & destructor
+		// ===========================================================
+
+		/* SamplerCache constructor */
+		explicit SamplerCache( );
+
+		/*
+		 * SamplerCache destructor
+		 * Sampler Objects must be deleted by Unload, while OpenGL context current.
+		*/
+		~SamplerCache( );
+
+		// ===========================================================
+		// Getter & Setter
+		// ===========================================================
+
+		/*
+		 * Returns Sampler Object of the state, created on first use.
+		 *
+		 * @thread_safety - render-thread only.
+		 * @param state_ - filtering & wrapping.
+		 * @return - OpenGL Sampler Object ID.
+		 * @throws - std::bad_alloc.
+		*/
+		const GLuint getSampler( const SamplerState & state_ );
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Deletes all Sampler Objects.
+		 *
+		 * @thread_safety - render-thread only.
+		 * @param stateCache_ - state cache to forget deleted bindings.
+		*/
+		void Unload( GLStateCache & stateCache_ ) noexcept;
+
+		// -------------------------------------------------------- \\
+
+	private:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Types
+		// ===========================================================
+
+		/* Created Sampler Object */
+		struct SamplerEntry final
+		{
+
+			/* State */
+			SamplerState state_;
+
+			/* OpenGL Sampler Object ID */
+			GLuint sampler_;
+
+		};
+
+		// ===========================================================
+		// Fields
+		// ===========================================================
+
+		/* Created Sampler Objects */
+		std::vector<SamplerEntry> mSamplers;
+
+		// ===========================================================
+		// Deleted
+		// ===========================================================
+
+		/* @deleted SamplerCache const copy constructor */
+		SamplerCache( const SamplerCache & ) = delete;
+
+		/* @deleted SamplerCache const copy assignment operator */
+		SamplerCache & operator=( const SamplerCache & ) = delete;
+
+		/* @deleted SamplerCache move constructor */
+		SamplerCache( SamplerCache && ) = delete;
+
+		/* @deleted SamplerCache move assignment operator */
+		SamplerCache & operator=( SamplerCache && ) = delete;
+
+		// -------------------------------------------------------- \\
+
+	};
+
+}
+
+#endif // !__c0de4un_sampler_cache_hpp__
\ No newline at end of file
@@ -0,0 +1,448 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+// HEADER
+#ifndef __c0de4un_gpu_timer_hpp__
+#include "GPUTimer.hpp"
+#endif // !__c0de4un_gpu_timer_hpp__
+
+// Include Log
+#ifndef __c0de4un_log_hpp__
+#include "../../utils/log/Log.hpp"
+#endif // !__c0de4un_log_hpp__
+
+// Include STL
+#include <algorithm> // sort, min
+#include <exception> // exception
+#include <cmath> // ceil
+
+namespace c0de4un
+{
+
+	// -------------------------------------------------------- \\
+
+	// ===========================================================
+	// Constructor & destructor
+	// ===========================================================
+
+	/* GPUTimer constructor */
+	GPUTimer::GPUTimer( )
+		: mFrames( ),
+		mFrame( 0 ),
+		mDroppedCount( 0 ),
+		mLoaded( false ),
+		mStarted( false ),
+		mHistory( ),
+		mFrameTimes( )
+	{
+	}
+
+	/*
+	 * GPUTimer destructor.
+	 * Query Objects must be deleted by Unload, while OpenGL context current.
+	*/
+	GPUTimer::~GPUTimer( )
+	{
+	}
+
+	// ===========================================================
+	// Getter & Setter
+	// ===========================================================
+
+	/* Returns 'true' if Query Objects created, frames measured */
+	const bool GPUTimer::isLoaded( ) const noexcept
+	{ return( mLoaded ); }
+
+	/* Returns count of the frames dropped (results not available on reuse, or truncated) */
+	const uint64_t GPUTimer::getDroppedCount( ) const noexcept
+	{ return( mDroppedCount ); }
+
+	/*
+	 * Returns measured passes, FRAME_PASS first.
+	 *
+	 * @thread_safety - render-thread only.
+	 * @throws - std::bad_alloc.
+	*/
+	std::vector<GLuint> GPUTimer::getPasses( ) const
+	{
+
+		// Sorted by ID, FRAME_PASS (0) first
+		std::vector<GLuint> passes_;
+		passes_.reserve( mHistory.size( ) );
+		for ( const std::pair<const GLuint, PassHistory> & pass_ : mHistory )
+			passes_.push_back( pass_.first );
+
+		// Return passes
+		return( passes_ );
+
+	}
+
+	/*
+	 * Returns rolling statistics of the pass.
+	 *
+	 * @thread_safety - render-thread only.
+	 * @param pass_ - FRAME_PASS or Shader Program.
+	 * @param timings_ - statistics.
+	 * @return - 'false' if the pass not measured.
+	 * @throws - std::bad_alloc.
+	*/
+	const bool GPUTimer::getTimings( const GLuint pass_, GPUTimings & timings_ ) const
+	{
+
+		// Search pass
+		const std::map<GLuint, PassHistory>::const_iterator pos_( mHistory.find( pass_ ) );
+		if ( pos_ == mHistory.cend( ) || pos_->second.count_ == 0 )
+			return( false );
+
+		// Sorted samples
+		const PassHistory & history_( pos_->second );
+		std::vector<double> samples_( history_.samples_, history_.samples_ + history_.count_ );
+		std::sort( samples_.begin( ), samples_.end( ) );
+		double sum_( 0.0 );
+		for ( const double sample_ : samples_ )
+			sum_ += sample_;
+
+		// Statistics
+		timings_.min_ = samples_.front( );
+		timings_.avg_ = sum_ / static_cast<double>( samples_.size( ) );
+		timings_.p99_ = samples_[std::min( samples_.size( ) - 1, static_cast<std::size_t>( std::ceil( 0.99 * static_cast<double>( samples_.size( ) ) ) ) - 1 )];
+		timings_.samples_ = history_.count_;
+
+		// Return TRUE
+		return( true );
+
+	}
+
+	// ===========================================================
+	// Methods
+	// ===========================================================
+
+	/*
+	 * Creates Query Objects, frames measured from now.
+	 *
+	 * @thread_safety - render-thread only.
+	*/
+	void GPUTimer::Load( ) noexcept
+	{
+
+		// Cancel, if loaded
+		if ( mLoaded )
+			return;
+
+		// Guarded-Block
+		try
+		{
+
+			// Pass times of the frame, no allocations per frame
+			mFrameTimes.reserve( TIMESTAMPS_COUNT );
+
+			// Query Objects
+			for ( FrameQueries & frame_ : mFrames )
+			{
+				glGenQueries( TIMESTAMPS_COUNT, frame_.queries_ );
+				frame_.count_ = 0;
+				frame_.pending_ = false;
+				frame_.truncated_ = false;
+			}
+
+			mFrame = 0;
+			mStarted = false;
+			mLoaded = true;
+
+		}
+		catch ( const std::exception & exception_ )
+		{ Log::printError( exception_.what( ) ); }
+
+	}
+
+	/*
+	 * Deletes Query Objects, statistics cleared.
+	 *
+	 * @thread_safety - render-thread only.
+	*/
+	void GPUTimer::Unload( ) noexcept
+	{
+
+		// Cancel, if not loaded
+		if ( !mLoaded )
+			return;
+
+		// Query Objects
+		for ( FrameQueries & frame_ : mFrames )
+		{
+			glDeleteQueries( TIMESTAMPS_COUNT, frame_.queries_ );
+			frame_.count_ = 0;
+			frame_.pending_ = false;
+			frame_.truncated_ = false;
+		}
+
+		// Statistics
+		mHistory.clear( );
+		mDroppedCount = 0;
+		mStarted = false;
+		mLoaded = false;
+
+	}
+
+	/*
+	 * Clears statistics, results of the frames in flight discarded (warmup).
+	 *
+	 * @thread_safety - render-thread only.
+	*/
+	void GPUTimer::Reset( ) noexcept
+	{
+
+		// Frames in flight
+		for ( FrameQueries & frame_ : mFrames )
+			frame_.pending_ = false;
+
+		// Statistics
+		mHistory.clear( );
+		mDroppedCount = 0;
+
+	}
+
+	/*
+	 * Reads available results, starts the frame (begin timestamp).
+	 *
+	 * @thread_safety - render-thread only.
+	*/
+	void GPUTimer::BeginFrame( ) noexcept
+	{
+
+		// Cancel, if not loaded
+		if ( !mLoaded )
+			return;
+
+		// Read finished frames
+		Poll( );
+
+		// Reuse Query Objects of the oldest frame, dropped if not available
+		FrameQueries & frame_( mFrames[mFrame % FRAMES_COUNT] );
+		if ( frame_.pending_ )
+		{
+			frame_.pending_ = false;
+			mDroppedCount++;
+		}
+
+		// Begin timestamp, restarted if the previous frame not ended (exception)
+		frame_.count_ = 0;
+		frame_.truncated_ = false;
+		mStarted = true;
+		writeTimestamp( FRAME_PASS );
+
+	}
+
+	/*
+	 * Starts the pass (timestamp), ends the previous one.
+	 * Frame truncated (dropped) if no timestamps left.
+	 *
+	 * @thread_safety - render-thread only.
+	 * @param pass_ - Shader Program.
+	*/
+	void GPUTimer::BeginPass( const GLuint pass_ ) noexcept
+	{
+
+		// Cancel, if not started or truncated
+		FrameQueries & frame_( mFrames[mFrame % FRAMES_COUNT] );
+		if ( !mStarted || frame_.truncated_ )
+			return;
+
+		// Truncate, if no timestamps left (end timestamp kept): time of this & later passes would be added to the current one
+		if ( frame_.count_ + 1 >= TIMESTAMPS_COUNT )
+		{
+			frame_.truncated_ = true;
+			return;
+		}
+
+		// Pass timestamp
+		writeTimestamp( pass_ );
+
+	}
+
+	/*
+	 * Ends the frame (end timestamp), results read by the next frames.
+	 *
+	 * @thread_safety - render-thread only.
+	*/
+	void GPUTimer::EndFrame( ) noexcept
+	{
+
+		// Cancel, if not started
+		if ( !mStarted )
+			return;
+
+		// End timestamp
+		writeTimestamp( FRAME_PASS );
+
+		// Read by the next frames
+		mFrames[mFrame % FRAMES_COUNT].pending_ = true;
+		mFrame++;
+		mStarted = false;
+
+	}
+
+	/*
+	 * Reads results of the finished frames, doesn't wait for the GPU.
+	 *
+	 * @thread_safety - render-thread only.
+	 * @return - 'true' if no frames in flight.
+	*/
+	const bool GPUTimer::Poll( ) noexcept
+	{
+
+		// Oldest first, GPU finishes frames in order
+		for ( uint32_t i = 0; i < FRAMES_COUNT; i++ )
+		{
+
+			FrameQueries & frame_( mFrames[( mFrame + i ) % FRAMES_COUNT] );
+			if ( frame_.pending_ && !readFrame( frame_, false ) )
+				return( false );
+
+		}
+
+		// Return TRUE if none in flight
+		return( true );
+
+	}
+
+	/*
+	 * Reads results of all frames in flight, waits for the GPU.
+	 *
+	 * @thread_safety - render-thread only.
+	*/
+	void GPUTimer::Wait( ) noexcept
+	{
+
+		// Oldest first
+		for ( uint32_t i = 0; i < FRAMES_COUNT; i++ )
+		{
+
+			FrameQueries & frame_( mFrames[( mFrame + i ) % FRAMES_COUNT] );
+			if ( frame_.pending_ )
+				readFrame( frame_, true );
+
+		}
+
+	}
+
+	/*
+	 * Writes timestamp of the current frame.
+	 *
+	 * @param pass_ - pass started.
+	*/
+	void GPUTimer::writeTimestamp( const GLuint pass_ ) noexcept
+	{
+
+		FrameQueries & frame_( mFrames[mFrame % FRAMES_COUNT] );
+		glQueryCounter( frame_.queries_[frame_.count_], GL_TIMESTAMP );
+		frame_.passes_[frame_.count_] = pass_;
+		frame_.count_++;
+
+	}
+
+	/*
+	 * Reads results of the frame, adds samples, truncated frame dropped.
+	 *
+	 * @param frame_ - ended frame.
+	 * @param wait_ - 'true' to wait for the GPU.
+	 * @return - 'false' if results not available.
+	*/
+	const bool GPUTimer::readFrame( FrameQueries & frame_, const bool wait_ ) noexcept
+	{
+
+		// Truncated, passes not measured
+		if ( frame_.truncated_ )
+		{
+			frame_.pending_ = false;
+			mDroppedCount++;
+			return( true );
+		}
+
+		// End timestamp available, so the earlier ones too
+		if ( !wait_ )
+		{
+			GLint available_( GL_FALSE );
+			glGetQueryObjectiv( frame_.queries_[frame_.count_ - 1], GL_QUERY_RESULT_AVAILABLE, &available_ );
+			if ( available_ == GL_FALSE )
+				return( false );
+		}
+
+		// Timestamps, nanoseconds
+		GLuint64 times_[TIMESTAMPS_COUNT];
+		for ( uint32_t i = 0; i < frame_.count_; i++ )
+			glGetQueryObjectui64v( frame_.queries_[i], GL_QUERY_RESULT, &times_[i] );
+		frame_.pending_ = false;
+
+		// Guarded-Block
+		try
+		{
+
+			// Passes, summed if repeated
+			mFrameTimes.clear( );
+			for ( uint32_t i = 0; i + 1 < frame_.count_; i++ )
+			{
+
+				// Not a pass (frame begin to the first pass)
+				const GLuint pass_( frame_.passes_[i] );
+				if ( pass_ == FRAME_PASS )
+					continue;
+
+				// Sum, timestamps not ordered by some drivers
+				const double time_( times_[i + 1] > times_[i] ? static_cast<double>( times_[i + 1] - times_[i] ) / 1000000.0 : 0.0 );
+				std::vector<std::pair<GLuint, double>>::iterator pos_( mFrameTimes.begin( ) );
+				while ( pos_ != mFrameTimes.end( ) && pos_->first != pass_ )
+					pos_++;
+				if ( pos_ != mFrameTimes.end( ) )
+					pos_->second += time_;
+				else
+					mFrameTimes.push_back( std::make_pair( pass_, time_ ) );
+
+			}
+
+			// Samples, frame time 0 if timestamps not ordered
+			const GLuint64 frameBegin_( times_[0] ), frameEnd_( times_[frame_.count_ - 1] );
+			addSample( FRAME_PASS, frameEnd_ > frameBegin_ ? static_cast<double>( frameEnd_ - frameBegin_ ) / 1000000.0 : 0.0 );
+			for ( const std::pair<GLuint, double> & passTime_ : mFrameTimes )
+				addSample( passTime_.first, passTime_.second );
+
+		}
+		catch ( const std::exception & exception_ )
+		{ Log::printError( exception_.what( ) ); }
+
+		// Return TRUE
+		return( true );
+
+	}
+
+	/*
+	 * Adds frame time of the pass.
+	 *
+	 * @param pass_ - FRAME_PASS or Shader Program.
+	 * @param time_ - milliseconds.
+	 * @throws - std::bad_alloc.
+	*/
+	void GPUTimer::addSample( const GLuint pass_, const double time_ )
+	{
+
+		// History, added on first sample
+		std::map<GLuint, PassHistory>::iterator pos_( mHistory.find( pass_ ) );
+		if ( pos_ == mHistory.end( ) )
+			pos_ = mHistory.insert( std::make_pair( pass_, PassHistory( ) ) ).first;
+
+		// Ring
+		PassHistory & history_( pos_->second );
+		history_.samples_[history_.next_] = time_;
+		history_.next_ = ( history_.next_ + 1 ) % HISTORY_FRAMES;
+		if ( history_.count_ < HISTORY_FRAMES )
+			history_.count_++;
+
+	}
+
+	// -------------------------------------------------------- \\
+
+}
\ No newline at end of file
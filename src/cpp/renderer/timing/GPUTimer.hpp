@@ -0,0 +1,320 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_gpu_timer_hpp__
+#define __c0de4un_gpu_timer_hpp__
+
+// Include opengl
+#ifndef __c0de4un_opengl_hpp__
+#include "../../cfg/opengl.hpp"
+#endif // !__c0de4un_opengl_hpp__
+
+// Include std::map
+#ifndef __c0de4un_map_hpp__
+#include "../../cfg/map.hpp"
+#endif // !__c0de4un_map_hpp__
+
+// Include std::vector
+#ifndef __c0de4un_vector_hpp__
+#include "../../cfg/vector.hpp"
+#endif // !__c0de4un_vector_hpp__
+
+// Include STL
+#include <cstdint> // uint32_t, uint64_t
+#include <utility> // pair
+
+// GPUTimer declared
+#define __c0de4un_gpu_timer_decl__
+
+namespace c0de4un
+{
+
+	/*
+	 * GPUTimings - GPU time of the pass over the last frames (GPUTimer::HISTORY_FRAMES), in milliseconds.
+	 *
+	 * @version 1.0
+	*/
+	struct GPUTimings final
+	{
+
+		/* Min. */
+		double min_;
+
+		/* Average */
+		double avg_;
+
+		/* 99th percentile */
+		double p99_;
+
+		/* Frames measured */
+		uint32_t samples_;
+
+	};
+
+	/*
+	 * GPUTimer - GPU time of the frame & passes (GL_TIMESTAMP queries).
+	 *
+	 * Timestamp written at the frame begin, each pass begin & the frame end,
+	 * pass time is the difference to the next timestamp, summed if the pass repeats in the frame.
+	 * Queries pooled per frame (FRAMES_COUNT frames in flight) & read when available,
+	 * so the CPU never waits for the GPU, frame dropped if still not available on reuse
+	 * or if its passes exceed the timestamps (truncated, time after the last one can't be attributed).
+	 * Timestamps instead of GL_TIME_ELAPSED, so passes measured inside the frame (elapsed queries can't nest).
+	 *
+	 * @version 1.0
+	*/
+	class GPUTimer final
+	{
+
+	public:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Constants
+		// ===========================================================
+
+		/* Frames in flight, results read up to FRAMES_COUNT - 1 frames later */
+		static constexpr uint32_t FRAMES_COUNT = 4;
+
+		/* Timestamps per frame (begin, passes, end), frame dropped if exceeded */
+		static constexpr uint32_t TIMESTAMPS_COUNT = 64;
+
+		/* Frames of the rolling statistics */
+		static constexpr uint32_t HISTORY_FRAMES = 240;
+
+		/* Pass of the whole frame (Shader Program 0 is never drawn) */
+		static constexpr GLuint FRAME_PASS = 0;
+
+		// ===========================================================
+		// Constructor & destructor
+		// ===========================================================
+
+		/* GPUTimer constructor */
+		explicit GPUTimer( );
+
+		/*
+		 * GPUTimer destructor.
+		 * Query Objects must be deleted by Unload, while OpenGL context current.
+		*/
+		~GPUTimer( );
+
+		// ===========================================================
+		// Getter & Setter
+		// ===========================================================
+
+		/* Returns 'true' if Query Objects created, frames measured */
+		const bool isLoaded( ) const noexcept;
+
+		/* Returns count of the frames dropped (results not available on reuse, or truncated) */
+		const uint64_t getDroppedCount( ) const noexcept;
+
+		/*
+		 * Returns measured passes, FRAME_PASS first.
+		 *
+		 * @thread_safety - render-thread only.
+		 * @throws - std::bad_alloc.
+		*/
+		std::vector<GLuint> getPasses( ) const;
+
+		/*
+		 * Returns rolling statistics of the pass.
+		 *
+		 * @thread_safety - render-thread only.
+		 * @param pass_ - FRAME_PASS or Shader Program.
+		 * @param timings_ - statistics.
+		 * @return - 'false' if the pass not measured.
+		 * @throws - std::bad_alloc.
+		*/
+		const bool getTimings( const GLuint pass_, GPUTimings & timings_ ) const;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Creates Query Objects, frames measured from now.
+		 *
+		 * @thread_safety - render-thread only.
+		*/
+		void Load( ) noexcept;
+
+		/*
+		 * Deletes Query Objects, statistics cleared.
+		 *
+		 * @thread_safety - render-thread only.
+		*/
+		void Unload( ) noexcept;
+
+		/*
+		 * Clears statistics, results of the frames in flight discarded (warmup).
+		 *
+		 * @thread_safety - render-thread only.
+		*/
+		void Reset( ) noexcept;
+
+		/*
+		 * Reads available results, starts the frame (begin timestamp).
+		 *
+		 * @thread_safety - render-thread only.
+		*/
+		void BeginFrame( ) noexcept;
+
+		/*
+		 * Starts the pass (timestamp), ends the previous one.
+		 * Frame truncated (dropped) if no timestamps left.
+		 *
+		 * @thread_safety - render-thread only.
+		 * @param pass_ - Shader Program.
+		*/
+		void BeginPass( const GLuint pass_ ) noexcept;
+
+		/*
+		 * Ends the frame (end timestamp), results read by the next frames.
+		 *
+		 * @thread_safety - render-thread only.
+		*/
+		void EndFrame( ) noexcept;
+
+		/*
+		 * Reads results of the finished frames, doesn't wait for the GPU.
+		 *
+		 * @thread_safety - render-thread only.
+		 * @return - 'true' if no frames in flight.
+		*/
+		const bool Poll( ) noexcept;
+
+		/*
+		 * Reads results of all frames in flight, waits for the GPU.
+		 *
+		 * @thread_safety - render-thread only.
+		*/
+		void Wait( ) noexcept;
+
+		// -------------------------------------------------------- \\
+
+	private:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Types
+		// ===========================================================
+
+		/* Query Objects of the frame */
+		struct FrameQueries final
+		{
+
+			/* GL_TIMESTAMP Query Objects */
+			GLuint queries_[TIMESTAMPS_COUNT];
+
+			/* Pass started by the timestamp */
+			GLuint passes_[TIMESTAMPS_COUNT];
+
+			/* Timestamps written */
+			uint32_t count_;
+
+			/* 'true' if ended, results not read */
+			bool pending_;
+
+			/* 'true' if passes exceeded TIMESTAMPS_COUNT, results discarded */
+			bool truncated_;
+
+		};
+
+		/* Last frames times of the pass, ring */
+		struct PassHistory final
+		{
+
+			/* Times, in milliseconds */
+			double samples_[HISTORY_FRAMES];
+
+			/* Next sample index */
+			uint32_t next_;
+
+			/* Samples count */
+			uint32_t count_;
+
+		};
+
+		// ===========================================================
+		// Fields
+		// ===========================================================
+
+		/* Frames Query Objects */
+		FrameQueries mFrames[FRAMES_COUNT];
+
+		/* Frames started, mFrames[mFrame % FRAMES_COUNT] is the current one */
+		uint64_t mFrame;
+
+		/* Dropped frames count */
+		uint64_t mDroppedCount;
+
+		/* 'true' if Query Objects created */
+		bool mLoaded;
+
+		/* 'true' between BeginFrame & EndFrame */
+		bool mStarted;
+
+		/* Statistics per pass */
+		std::map<GLuint, PassHistory> mHistory;
+
+		/* Pass times of the read frame, reused */
+		std::vector<std::pair<GLuint, double>> mFrameTimes;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Writes timestamp of the current frame.
+		 *
+		 * @param pass_ - pass started.
+		*/
+		void writeTimestamp( const GLuint pass_ ) noexcept;
+
+		/*
+		 * Reads results of the frame, adds samples, truncated frame dropped.
+		 *
+		 * @param frame_ - ended frame.
+		 * @param wait_ - 'true' to wait for the GPU.
+		 * @return - 'false' if results not available.
+		*/
+		const bool readFrame( FrameQueries & frame_, const bool wait_ ) noexcept;
+
+		/*
+		 * Adds frame time of the pass.
+		 *
+		 * @param pass_ - FRAME_PASS or Shader Program.
+		 * @param time_ - milliseconds.
+		 * @throws - std::bad_alloc.
+		*/
+		void addSample( const GLuint pass_, const double time_ );
+
+		// ===========================================================
+		// Deleted
+		// ===========================================================
+
+		/* @deleted GPUTimer const copy constructor */
+		GPUTimer( const GPUTimer & ) = delete;
+
+		/* @deleted GPUTimer const copy assignment operator */
+		GPUTimer & operator=( const GPUTimer & ) = delete;
+
+		/* @deleted GPUTimer move constructor */
+		GPUTimer( GPUTimer && ) = delete;
+
+		/* @deleted GPUTimer move assignment operator */
+		GPUTimer & operator=( GPUTimer && ) = delete;
+
+		// -------------------------------------------------------- \\
+
+	};
+
+}
+
+#endif // !__c0de4un_gpu_timer_hpp__
\ No newline at end of file
@@ -15,11 +15,6 @@
 #include "../utils/random/Random.hpp"
 #endif // !__c0de4un_random_hpp__
 
-// Include Sprite
-#ifndef __c0de4un_sprite_hpp__
-#include "../objects/sprite/Sprite.hpp"
-#endif // !__c0de4un_sprite_hpp__
-
 // Include GLShaderProgram
 #ifndef __c0de4un_gl_shader_program_hpp__
 #include "../assets/shader/GLShaderProgram.hpp"
@@ -30,18 +25,40 @@
 #include "../assets/texture/GLTexture2D.hpp"
 #endif // !__c0de4un_gl_texture_2D_hpp__
 
-// Include Position
-// Include Rotation
-// Include Scale
-// Include Velocity
-#ifndef __c0de4un_velocity_hpp__
-#include "../components/Velocity.hpp"
-#endif // !__c0de4un_velocity_hpp__
-
-// Include Components
-#ifndef __c0de4un_components_hpp__
-#include "../components/Components.hpp"
-#endif // !__c0de4un_components_hpp__
+// Include TextureArrayPool
+#ifndef __c0de4un_texture_array_pool_hpp__
+#include "../assets/texture/TextureArrayPool.hpp"
+#endif // !__c0de4un_texture_array_pool_hpp__
+
+// Include TextureAtlas
+#ifndef __c0de4un_texture_atlas_hpp__
+#include "../assets/atlas/TextureAtlas.hpp"
+#endif // !__c0de4un_texture_atlas_hpp__
+
+// Include MoveKernel
+#ifndef __c0de4un_move_kernel_hpp__
+#include "kernels/MoveKernel.hpp"
+#endif // !__c0de4un_move_kernel_hpp__
+
+// Include TransformKernel
+#ifndef __c0de4un_transform_kernel_hpp__
+#include "kernels/TransformKernel.hpp"
+#endif // !__c0de4un_transform_kernel_hpp__
+
+// Include JobSystem
+#ifndef __c0de4un_job_system_hpp__
+#include "../utils/jobs/JobSystem.hpp"
+#endif // !__c0de4un_job_system_hpp__
+
+// Include RenderSnapshot
+#ifndef __c0de4un_render_snapshot_hpp__
+#include "../renderer/snapshot/RenderSnapshot.hpp"
+#endif // !__c0de4un_render_snapshot_hpp__
+
+// Include BatchRequest
+#ifndef __c0de4un_batch_request_hpp__
+#include "../renderer/batch/BatchRequest.hpp"
+#endif // !__c0de4un_batch_request_hpp__
 
 // Include GLRenderer
 #ifndef __c0de4un_gl_renderer_hpp__
@@ -53,11 +70,50 @@
 #include "../utils/log/Log.hpp"
 #endif // !__c0de4un_log_hpp__
 
+// Include ProfileScope
+#ifndef __c0de4un_profile_scope_hpp__
+#include "../utils/profiler/ProfileScope.hpp"
+#endif // !__c0de4un_profile_scope_hpp__
+
+// Include STL
+#include <algorithm> // max
+#include <cassert> // assert
+
 namespace c0de4un
 {
 
+	// Changed bitmask words must match kernel blocks
+	static_assert( SpriteStore::CAPACITY_STEP == MoveKernel::BLOCK_SIZE, "SpriteSystem - SpriteStore capacity step must match MoveKernel block size !" );
+	static_assert( SpriteStore::CAPACITY_STEP == TransformKernel::BLOCK_SIZE, "SpriteSystem - SpriteStore capacity step must match TransformKernel block size !" );
+
 	// -------------------------------------------------------- \\
 
+	// ===========================================================
+	// Config
+	// ===========================================================
+
+	/* Min. Sprites per Job, smaller updates executed by calling thread */
+	static constexpr uint32_t MIN_CHUNK_SIZE = MoveKernel::BLOCK_SIZE * 16;
+
+	/* Jobs per worker, more Jobs - better balancing (stealing), more overhead */
+	static constexpr uint32_t CHUNKS_PER_WORKER = 4;
+
+	// ===========================================================
+	// Types
+	// ===========================================================
+
+	/* Update Job arguments */
+	struct UpdateArgs final
+	{
+
+		/* Move kernel arguments */
+		MoveArgs move_;
+
+		/* Transform kernel arguments */
+		TransformArgs transform_;
+
+	};
+
 	// ===========================================================
 	// Constructor & destructor
 	// ===========================================================
@@ -66,24 +122,29 @@ namespace c0de4un
 	 * SpriteSystem constructor
 	 *
 	 * @param pRandom_ - random numbers generator (wrapper).
+	 * @param pJobSystem_ - job system, can be null (Sprites updated by calling thread).
 	 * @param worldWidth_ - World Width.
 	 * @param worldHeight_ - World Height.
 	 * @param maxSprites_ - Sprites limit.
 	*/
-	SpriteSystem::SpriteSystem( Random *const pRandom_, const unsigned int & worldWidth_, const unsigned int & worldHeight_, const unsigned int & maxSprites_ )
+	SpriteSystem::SpriteSystem( Random *const pRandom_, JobSystem *const pJobSystem_, const unsigned int & worldWidth_, const unsigned int & worldHeight_, const unsigned int & maxSprites_ )
 		: mRandom( pRandom_ ),
-		mSprites( ),
+		mJobSystem( pJobSystem_ ),
 		mWorldWidth( worldWidth_ ),
 		mWorldHeight( worldHeight_ ),
 		mMaxSprites( maxSprites_ ),
-		mSpriteMaxSize( (unsigned int)( (float) worldWidth_ / (float) maxSprites_ ) ),
+		mSpriteMaxSize( std::max( (unsigned int)( (float) worldWidth_ / (float) maxSprites_ ), 2u ) ),
 		mSpriteMinSize( 1 ),
-		mMutex( ),
-		mLock( mMutex, std::defer_lock )
+		mStore( maxSprites_ ),
+		mRenderQueue( ),
+		mAtlasGeneration( 0 ),
+		mTextureLayers( )
 	{
 
 		// Log
-		Log::printDebug( "SpriteSystem::constructor" );
+		std::string logMsg( "SpriteSystem::constructor - move kernel: " );
+		logMsg += MoveKernel::getISAName( MoveKernel::getBestISA( ) );
+		Log::printDebug( logMsg.c_str( ) );
 
 	}
 
@@ -94,15 +155,6 @@ namespace c0de4un
 		// Log
 		Log::printDebug( "SpriteSystem::destructor" );
 
-		// Release Sprites ( delete[] )
-		for ( Sprite *const sprite_ : mSprites )
-		{
-
-			// Delete Sprite
-			delete sprite_;
-
-		}
-
 	}
 
 	// ===========================================================
@@ -180,136 +232,190 @@ namespace c0de4un
 	// Methods
 	// ===========================================================	
 
+	/*
+	 * Moves Sprites chunk & rebuilds transforms of its changed Sprites (Job function).
+	 *
+	 * @thread_safety - thread-safe, chunks must not overlap.
+	 * @param pData - MoveArgs & TransformArgs.
+	 * @param begin_ - first Sprite index, multiple of the MoveKernel::BLOCK_SIZE.
+	 * @param end_ - last Sprite index + 1.
+	*/
+	void SpriteSystem::updateChunk( void *const pData, const uint32_t begin_, const uint32_t end_ )
+	{
+
+		// Profile
+		C0DE4UN_PROFILE_SCOPE( "SpriteSystem::updateChunk" );
+
+		// Arguments
+		const UpdateArgs & args_ = *static_cast<const UpdateArgs*>( pData );
+
+		// Move Sprites (SIMD)
+		MoveKernel::Run( args_.move_, begin_, end_ );
+
+		// Rebuild transforms of rotated & scaled Sprites (SIMD), translation is the position
+		TransformKernel::Run( args_.transform_, begin_, end_ );
+
+	}
+
 	/*
 	 * Update Sprites.
+	 * Sprites split to chunks (multiple of cache-line & SIMD block) executed by JobSystem,
+	 * returns when all chunks finished.
 	 *
 	 * @param elapsedTime_ - time in seconds elapsed since previous frame (update-call).
 	*/
 	void SpriteSystem::Update( const double & elapsedTime_ )
 	{
 
-		// Update Sprites
-		for ( Sprite *const sprite_lp : mSprites )
-		{
+		// Profile
+		C0DE4UN_PROFILE_SCOPE( "SpriteSystem::Update" );
 
-			// Lock Sprite
-			sprite_lp->mLock.lock( );
+		// Lock SpriteStore
+		mStore.getLock( ).lock( );
 
-			// Position-vector
-			glm::vec3 & posVec_ = sprite_lp->mPosition.vec3_;
+		// 'changed' bits of this update phase
+		mStore.ClearChanged( );
 
-			// Velocity-vector
-			glm::vec3 & velVec_ = sprite_lp->mVelocity.vec3_;
+		// Kernels arguments
+		UpdateArgs args_{ MoveArgs{ mStore.getPosX( ), mStore.getPosY( ), mStore.getVelX( ), mStore.getVelY( ), mStore.getScaleX( ), mStore.getScaleY( ), mStore.getChanged( ), static_cast<float>( mWorldWidth ), static_cast<float>( mWorldHeight ) },
+			TransformArgs{ mStore.getScaleX( ), mStore.getScaleY( ), mStore.getRotation( ), mStore.getXAxisX( ), mStore.getXAxisY( ), mStore.getYAxisX( ), mStore.getYAxisY( ), mStore.getTransformChanged( ) } };
 
-			// Size-vector
-			glm::vec3 & sizeVec_ = sprite_lp->mScale.vec3_;
+		// Sprites count
+		const uint32_t size_( mStore.getSize( ) );
 
-			// X-axis
-			if ( velVec_.x > 0 )
-			{// +X
+		// Workers count
+		const uint32_t workersCount_( mJobSystem != nullptr ? mJobSystem->getWorkersCount( ) : 0 );
 
-				// Move right
-				if ( ( posVec_.x + velVec_.x ) < ( mWorldWidth - sizeVec_.x ) )
-				{
+		// Chunk size: multiple of the kernel block (one 'changed' word, cache-line aligned arrays), so chunks never share cache-lines
+		uint32_t chunkSize_( workersCount_ > 0 ? size_ / ( ( workersCount_ + 1 ) * CHUNKS_PER_WORKER ) : size_ );
+		chunkSize_ = ( chunkSize_ + MoveKernel::BLOCK_SIZE - 1 ) / MoveKernel::BLOCK_SIZE * MoveKernel::BLOCK_SIZE;
+		if ( chunkSize_ < MIN_CHUNK_SIZE )
+			chunkSize_ = MIN_CHUNK_SIZE;
 
-					// Translate (move) by X-axis
-					posVec_.x += velVec_.x;
+		// Move Sprites & rebuild transforms (SIMD)
+		if ( workersCount_ < 1 || size_ <= chunkSize_ )
+			updateChunk( &args_, 0, size_ );
+		else
+		{
 
-					// Request Sprite-update
-					sprite_lp->mDrawable.stateChanged_ = true;
+			// Chunks counter
+			JobCounter counter_;
 
-				}
-				else // Right Border Reached
-				{
+			// Guarded-Block
+			try
+			{
 
-					// Invert Velocity by X-axis
-					velVec_.x = velVec_.x * -1;
+				// Dispatch chunks
+				mJobSystem->Dispatch( counter_, &SpriteSystem::updateChunk, &args_, size_, chunkSize_ );
 
-				}
 			}
-			else
-			{// -X
+			catch ( ... )
+			{
+
+				// Wait for dispatched chunks, arguments are on the stack
+				mJobSystem->Wait( counter_ );
 
-				// Move left
-				if ( ( posVec_.x - velVec_.x ) > ( sizeVec_.x ) )
-				{
+				// Unlock SpriteStore
+				mStore.getLock( ).unlock( );
 
-					// Translate (move) by X-axis
-					posVec_.x += velVec_.x;
+				// Re-throw
+				throw;
 
-					// Request Sprite-update
-					sprite_lp->mDrawable.stateChanged_ = true;
+			}
 
-				}
-				else // Right Border Reached
-				{
+			// Help & wait for all chunks
+			mJobSystem->Wait( counter_ );
 
-					// Invert Velocity by X-axis
-					velVec_.x = velVec_.x * -1;
+		}
 
-				}
+		// Unlock SpriteStore
+		mStore.getLock( ).unlock( );
 
-			}
-			
-			// Y-axis
-			if ( velVec_.y > 0 )
-			{// +Y
+	}
 
-				// Move Up
-				if ( ( posVec_.y + velVec_.y ) < ( mWorldHeight - sizeVec_.y ) )
-				{
+	/*
+	 * Copy render state of all visible Sprites to the RenderSnapshot,
+	 * instances ordered by RenderQueue sort key (radix sort).
+	 *
+	 * @thread_safety - simulation-thread only.
+	 * @param snapshot_ - RenderSnapshot to write, previous content replaced.
+	 * @throws - std::bad_alloc.
+	*/
+	void SpriteSystem::Snapshot( RenderSnapshot & snapshot_ )
+	{
 
-					// Translate (move) by Y-axis
-					posVec_.y += velVec_.y;
+		// Profile
+		C0DE4UN_PROFILE_SCOPE( "SpriteSystem::Snapshot" );
 
-					// Request Sprite-update
-					sprite_lp->mDrawable.stateChanged_ = true;
+		// Lock SpriteStore
+		std::lock_guard<std::unique_lock<std::mutex>> lock_( mStore.getLock( ) );
 
-				}
-				else // Top Border Reached
-				{
+		// Sprites count
+		const uint32_t size_( mStore.getSize( ) );
 
-					// Invert Velocity by Y-axis
-					velVec_.y = velVec_.y * -1;
+		// Render instances (capacity kept between frames)
+		std::vector<RenderInstance> & instances_ = snapshot_.instances_;
+		instances_.clear( );
+		instances_.reserve( size_ );
 
-				}
-			}
-			else
-			{// -Y (Down)
+		// Render queue (capacity kept between frames)
+		mRenderQueue.Clear( );
+		mRenderQueue.Reserve( size_ );
 
-				// Move down
-				if ( ( posVec_.y - velVec_.y ) > ( sizeVec_.y ) )
-				{
+		// Submit visible Sprites
+		for ( uint32_t i = 0; i < size_; i++ )
+		{
 
-					// Translate (move) by Y-axis
-					posVec_.y += velVec_.y;
+			// Get Drawable
+			const Drawable & drawable_ = mStore.getDrawable( mStore.getHandle( i ) );
 
-					// Request Sprite-update
-					sprite_lp->mDrawable.stateChanged_ = true;
+			// Skip hidden Sprite
+			if ( drawable_.shaderProgram_ < 1 )
+				continue;
 
-				}
-				else // Bottom Border Reached
-				{
+			// Submit
+			mRenderQueue.Push( RenderQueue::MakeKey( drawable_.layer_, drawable_.blend_, drawable_.shaderProgram_, drawable_.textureObject_, drawable_.depth_ ), i );
 
-					// Invert Velocity by Y-axis
-					velVec_.y = velVec_.y * -1;
+		}
 
-				}
+		// Sort keys (radix, O(n))
+		mRenderQueue.Sort( );
 
-			}
+		// Sprites data
+		const float *const posX_( mStore.getPosX( ) );
+		const float *const posY_( mStore.getPosY( ) );
+		const float *const xAxisX_( mStore.getXAxisX( ) );
+		const float *const xAxisY_( mStore.getXAxisY( ) );
+		const float *const yAxisX_( mStore.getYAxisX( ) );
+		const float *const yAxisY_( mStore.getYAxisY( ) );
+
+		// Copy render state in submission order
+		for ( const RenderItem & item_ : mRenderQueue.getItems( ) )
+		{
+
+			// Sprite data index
+			const uint32_t i( item_.index_ );
 
-			// Unlock Sprite
-			sprite_lp->mLock.unlock( );
+			// Get Drawable
+			const Drawable & drawable_ = mStore.getDrawable( mStore.getHandle( i ) );
 
-		} // Update Sprites
+			// Copy render state, Model Matrix rows ( Xaxis, Yaxis, 0, position )
+			instances_.push_back( RenderInstance{ drawable_.shaderProgram_, drawable_.textureObject_, drawable_.texSamplerLoc_, item_.key_,
+				{ xAxisX_[i], yAxisX_[i], 0.0f, posX_[i], xAxisY_[i], yAxisY_[i], 0.0f, posY_[i] },
+				{ drawable_.color_[0], drawable_.color_[1], drawable_.color_[2], drawable_.color_[3] },
+				{ drawable_.uvRect_[0], drawable_.uvRect_[1], drawable_.uvRect_[2], drawable_.uvRect_[3] },
+				drawable_.textureLayer_ } );
+
+		}
 
 	}
 
 	/*
 	 * Stop this SpriteSystem.
-	 * Used to remove all Sprites from Sprite-Batching system.
+	 * Used to remove all Sprites from Sprite-Batching system,
+	 * releases 2D-Texture Array layers acquired by addSprite.
 	 *
-	 * @thread_safety - thread-safe.
+	 * @thread_safety - thread-safe, TextureArrayPools must not be used concurrently.
 	 * @param renderManager_ - Render system (OpenGL renderer, Sprite-Batching-System).
 	*/
 	void SpriteSystem::Stop( GLRenderer *const renderManager_ )
@@ -318,15 +424,29 @@ namespace c0de4un
 		// Log
 		Log::printDebug( "SpriteSystem::Stop" );
 
-		// Release Sprites ( delete[] )
-		for ( Sprite *const sprite_ : mSprites )
+		// Lock SpriteStore
+		mStore.getLock( ).lock( );
+
+		// Remove Sprites from Sprite-Batching system
+		for ( uint32_t i = 0; i < mStore.getSize( ); i++ )
 		{
 
-			// Hide Sprite
-			sprite_->Hide( renderManager_ );
+			// Get Drawable
+			const Drawable & drawable_ = mStore.getDrawable( mStore.getHandle( i ) );
+
+			// Remove Drawable
+			renderManager_->removeDrawable( &drawable_, drawable_.shaderProgram_, drawable_.textureObject_ );
 
 		}
 
+		// Release 2D-Texture Array layers
+		for ( const std::pair<TextureArrayPool*, std::string> & layer_ : mTextureLayers )
+			layer_.first->Release( layer_.second );
+		mTextureLayers.clear( );
+
+		// Unlock SpriteStore
+		mStore.getLock( ).unlock( );
+
 	}
 
 	/*
@@ -336,52 +456,375 @@ namespace c0de4un
 	 * when loading to GPU (OpenGL memory-space) using not render-thread (or main/ui/system).
 	 *
 	 * @thread_safety - thread-safe.
-	 * @param shaderProgram_ - Shader Program.
+	 * @param shaderProgram_ - loaded Shader Program.
 	 * @param texture2D_ - 2D-Texture.
 	 * @param renderSystem_ - Renderer (render manager/system).
 	*/
 	void SpriteSystem::addSprite( GLShaderProgram & shaderProgram_, GLTexture2D *const texture2D_, GLRenderer *const renderSystem_ )
 	{
 
-		// Lock
-		mLock.lock( );
+		// Cancel, if 2D-Texture not loaded yet (AssetLoader uploads on the render-thread)
+		if ( texture2D_ != nullptr && !texture2D_->isLoaded( ) )
+		{
+
+			// Log
+			Log::printDebug( "SpriteSystem::addSprite - 2D-Texture not loaded yet" );
+
+			// Cancel
+			return;
+
+		}
+
+		// Whole 2D-Texture
+		static const float uvRect_[4] = { 0.0f, 0.0f, 1.0f, 1.0f };
+
+		// Add Sprite
+		addSprite( shaderProgram_, texture2D_ != nullptr ? texture2D_->getTextureObject( ) : 0, uvRect_, 0, 0.0f, renderSystem_ );
+
+	}
+
+	/*
+	 * Add random sprite with random attributes (properties), textured by TextureAtlas region.
+	 * Sprites of all regions of the same page share one 2D-Texture (one batch).
+	 * UVs of the added Sprites refreshed first, if atlas defragmented (refreshAtlas).
+	 *
+	 * @thread_safety - thread-safe, TextureAtlas must not be modified concurrently.
+	 * @param shaderProgram_ - loaded Shader Program, with 2D-Texture region attribute.
+	 * @param atlas_ - TextureAtlas.
+	 * @param region_ - TextureAtlas region ID.
+	 * @param renderSystem_ - Renderer (render manager/system).
+	*/
+	void SpriteSystem::addSprite( GLShaderProgram & shaderProgram_, const TextureAtlas & atlas_, const uint32_t region_, GLRenderer *const renderSystem_ )
+	{
+
+		// UVs of the added Sprites, if atlas defragmented since
+		refreshAtlas( atlas_ );
+
+		// Get region
+		const AtlasRegion *const pRegion( atlas_.getRegion( region_ ) );
 
 		// Cancel
-		if ( mSprites.size( ) >= mMaxSprites )
+		if ( pRegion == nullptr )
 		{
 
 			// Log
-			Log::printDebug( "SpriteSystem::addSprite - limit reached !" );
+			Log::printDebug( "SpriteSystem::addSprite - TextureAtlas region not found" );
+
+			// Cancel
+			return;
+
+		}
+
+		// Add Sprite
+		addSprite( shaderProgram_, pRegion->textureObject_, pRegion->uvRect_, region_, 0.0f, renderSystem_ );
+
+	}
+
+	/*
+	 * Add random sprite with random attributes (properties), textured by whole OpenGL 2D-Texture
+	 * (created without GLTexture2D, e.g. generated by the benchmark).
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param shaderProgram_ - loaded Shader Program.
+	 * @param texture_ - OpenGL 2D Texture Object ID, #0 - no texture.
+	 * @param renderSystem_ - Renderer (render manager/system).
+	*/
+	void SpriteSystem::addSprite( GLShaderProgram & shaderProgram_, const GLuint texture_, GLRenderer *const renderSystem_ )
+	{
+
+		// Whole 2D-Texture
+		static const float uvRect_[4] = { 0.0f, 0.0f, 1.0f, 1.0f };
+
+		// Add Sprite
+		addSprite( shaderProgram_, texture_, uvRect_, 0, 0.0f, renderSystem_ );
+
+	}
+
+	/*
+	 * Add random sprite with random attributes (properties), textured by 2D-Texture Array layer.
+	 * Sprites of all layers of the same array share one batch (one draw for many textures).
+	 * Layer acquired from the TextureArrayPool, released by Stop.
+	 *
+	 * @thread_safety - thread with current OpenGL context only (layer upload).
+	 * @param shaderProgram_ - loaded Shader Program, sampling 2D-Texture Array (with texture layer attribute).
+	 * @param texturePool_ - 2D-Texture Arrays pool, must outlive Stop.
+	 * @param image_ - PNG-image file, or name of already acquired pixels.
+	 * @param renderSystem_ - Renderer (render manager/system).
+	 * @throws - can throw exception.
+	*/
+	void SpriteSystem::addSprite( GLShaderProgram & shaderProgram_, TextureArrayPool & texturePool_, const std::string & image_, GLRenderer *const renderSystem_ )
+	{
+
+		// Cancel, if Shader Program samples 2D-Texture
+		if ( shaderProgram_.getTextureTarget( ) != GL_TEXTURE_2D_ARRAY )
+		{
 
-			// Unlock
-			mLock.unlock( );
+			// Log
+			Log::printDebug( "SpriteSystem::addSprite - shader program doesn't sample 2D-Texture Array" );
+
+			// Cancel
+			return;
+
+		}
+
+		// Acquire layer
+		TextureLayer layer_{ 0, 0, 0, 0 };
+		if ( !texturePool_.Acquire( image_, layer_ ) )
+		{
 
-			// Return
+			// Log
+			std::string logMsg( "SpriteSystem::addSprite - failed to acquire 2D-Texture Array layer #" );
+			logMsg += image_;
+			Log::printDebug( logMsg.c_str( ) );
+
+			// Cancel
 			return;
 
 		}
 
-		// Create Sprite
-		const std::string spriteName_( "sprite_" + std::to_string( mSprites.size( ) ) );
-		Sprite *const sprite_( new Sprite( spriteName_, shaderProgram_, texture2D_ ) );
+		// Guarded-Block
+		try
+		{
+
+			// Lock SpriteStore
+			std::lock_guard<std::unique_lock<std::mutex>> lock_( mStore.getLock( ) );
+
+			// Keep layer, until Stop
+			mTextureLayers.push_back( std::pair<TextureArrayPool*, std::string>( &texturePool_, image_ ) );
+
+		}
+		catch ( ... )
+		{
+
+			// Release layer
+			texturePool_.Release( image_ );
+
+			// Re-throw
+			throw;
+
+		}
+
+		// Whole layer
+		static const float uvRect_[4] = { 0.0f, 0.0f, 1.0f, 1.0f };
+
+		// Add Sprite
+		if ( addSprite( shaderProgram_, layer_.textureObject_, uvRect_, 0, static_cast<float>( layer_.layer_ ), renderSystem_ ) )
+			return;
+
+		// Lock SpriteStore
+		mStore.getLock( ).lock( );
+
+		// Forget layer, last kept one (added concurrently after it)
+		for ( std::size_t i = mTextureLayers.size( ); i > 0; i-- )
+		{
+			if ( mTextureLayers[i - 1].first == &texturePool_ && mTextureLayers[i - 1].second == image_ )
+			{
+				mTextureLayers.erase( mTextureLayers.begin( ) + static_cast<std::ptrdiff_t>( i - 1 ) );
+				break;
+			}
+		}
+
+		// Unlock SpriteStore
+		mStore.getLock( ).unlock( );
+
+		// Release layer
+		texturePool_.Release( image_ );
+
+	}
+
+	/*
+	 * Copies TextureAtlas regions UVs to the Drawables, if atlas generation changed (defragmented by Insert).
+	 * Regions never move between pages, so 2D-Textures & batches not changed.
+	 * Called after each TextureAtlas::Insert & by addSprite, one TextureAtlas per SpriteSystem.
+	 *
+	 * @thread_safety - thread-safe, TextureAtlas must not be modified concurrently.
+	 * @param atlas_ - TextureAtlas.
+	*/
+	void SpriteSystem::refreshAtlas( const TextureAtlas & atlas_ )
+	{
+
+		// Lock SpriteStore
+		std::lock_guard<std::unique_lock<std::mutex>> lock_( mStore.getLock( ) );
+
+		// Cancel, if UVs not changed
+		if ( atlas_.getGeneration( ) == mAtlasGeneration )
+			return;
+		mAtlasGeneration = atlas_.getGeneration( );
+
+		// Sprites
+		for ( uint32_t i = 0; i < mStore.getSize( ); i++ )
+		{
+
+			// Get Drawable
+			Drawable & drawable_ = mStore.getDrawable( mStore.getHandle( i ) );
+
+			// Skip, if not in atlas
+			if ( drawable_.atlasRegion_ < 1 )
+				continue;
+
+			// Get region
+			const AtlasRegion *const pRegion( atlas_.getRegion( drawable_.atlasRegion_ ) );
+
+			// Copy UVs
+			if ( pRegion != nullptr )
+				std::memcpy( drawable_.uvRect_, pRegion->uvRect_, sizeof( drawable_.uvRect_ ) );
+
+		}
+
+	}
+
+	/*
+	 * Add random sprite with random attributes (properties).
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param shaderProgram_ - loaded Shader Program.
+	 * @param texture_ - OpenGL 2D Texture Object ID, #0 - no texture.
+	 * @param uvRect_ - 2D-Texture region ( u, v, width, height ).
+	 * @param atlasRegion_ - TextureAtlas region ID, #0 - not in atlas.
+	 * @param textureLayer_ - 2D-Texture Array layer, 0 for 2D-Texture.
+	 * @param renderSystem_ - Renderer (render manager/system).
+	 * @return - 'true' if added.
+	*/
+	const bool SpriteSystem::addSprite( GLShaderProgram & shaderProgram_, const GLuint texture_, const float *const uvRect_, const uint32_t atlasRegion_, const float textureLayer_, GLRenderer *const renderSystem_ )
+	{
+
+		// Lock SpriteStore
+		mStore.getLock( ).lock( );
+
+		// Cancel
+		if ( mStore.getSize( ) >= mMaxSprites )
+		{
+
+			// Log
+			Log::printDebug( "SpriteSystem::addSprite - limit reached !" );
+
+			// Unlock SpriteStore
+			mStore.getLock( ).unlock( );
+
+			// Return FALSE
+			return( false );
+
+		}
+
+		// Add Sprite data
+		const SpriteHandle handle_( mStore.Add( ) );
+
+		// Sprite data index
+		const uint32_t index_( mStore.getIndex( handle_ ) );
 
 		// Random Sprite size
-		sprite_->mScale.vec3_ = getRandomSize( );
+		const glm::vec3 size_( getRandomSize( ) );
+		mStore.getScaleX( )[index_] = size_.x;
+		mStore.getScaleY( )[index_] = size_.y;
 
 		// Random Sprite position
-		sprite_->mPosition.vec3_ = getRandomPosition( static_cast<const unsigned int>( sprite_->mScale.vec3_.x ) );
+		const glm::vec3 position_( getRandomPosition( static_cast<const unsigned int>( size_.x ) ) );
+		mStore.getPosX( )[index_] = position_.x;
+		mStore.getPosY( )[index_] = position_.y;
 
 		// Random Sprite velocity
-		sprite_->mVelocity.vec3_ = getRandomVelocity( );
+		const glm::vec3 velocity_( getRandomVelocity( ) );
+		mStore.getVelX( )[index_] = velocity_.x;
+		mStore.getVelY( )[index_] = velocity_.y;
 
-		// Add Sprite to the collection (Sprites container)
-		mSprites.push_back( sprite_ );
+		// Get Drawable
+		Drawable & drawable_ = mStore.getDrawable( handle_ );
 
-		// Unlock
-		mLock.unlock( );
+		// Set 2D-Texture region
+		std::memcpy( drawable_.uvRect_, uvRect_, sizeof( drawable_.uvRect_ ) );
+		drawable_.atlasRegion_ = atlasRegion_;
+		drawable_.textureLayer_ = textureLayer_;
+
+		// Unlock SpriteStore
+		mStore.getLock( ).unlock( );
 
 		// Add Sprite to the Sprite-Batching system
-		sprite_->Show( renderSystem_ );
+		if ( !showSprite( handle_, shaderProgram_, texture_, renderSystem_ ) )
+		{
+
+			// Lock SpriteStore
+			mStore.getLock( ).lock( );
+
+			// Remove Sprite data
+			mStore.Remove( handle_ );
+
+			// Unlock SpriteStore
+			mStore.getLock( ).unlock( );
+
+			// Return FALSE
+			return( false );
+
+		}
+
+		// Return TRUE
+		return( true );
+
+	}
+
+	/*
+	 * Adds Sprite Drawable to the Sprite-Batching system.
+	 * GL objects of the batch created by the render thread (GLRenderer::Draw).
+	 *
+	 * @thread_safety - main thread (addSprite callers), Shader Program must be already loaded.
+	 * @param handle_ - Sprite handle.
+	 * @param shaderProgram_ - loaded Shader Program.
+	 * @param texture_ - OpenGL 2D Texture Object ID (loaded), #0 - no texture.
+	 * @param renderSystem_ - Renderer (render manager/system).
+	 * @return - 'true' if OK.
+	 * @throws - can throw exception.
+	*/
+	const bool SpriteSystem::showSprite( const SpriteHandle & handle_, GLShaderProgram & shaderProgram_, const GLuint texture_, GLRenderer *const renderSystem_ )
+	{
+
+#ifdef DEBUG // DEBUG
+		assert( shaderProgram_.isLoaded( ) && "SpriteSystem::showSprite - Shader Program must be loaded by the render thread first" );
+#endif // DEBUG
+
+		// Cancel, if Shader Program not loaded (GL calls are render-thread only)
+		if ( !shaderProgram_.isLoaded( ) )
+		{
+
+			// Log
+			std::string logMsg( "SpriteSystem::showSprite - shader program not loaded#" );
+			logMsg += shaderProgram_.getName( );
+			Log::printDebug( logMsg.c_str( ) );
+
+			// Cancel
+			return( false );
+
+		}
+
+		// Lock SpriteStore
+		mStore.getLock( ).lock( );
+
+		// Get Drawable
+		Drawable & drawable_ = mStore.getDrawable( handle_ );
+
+		// Set OpenGL Texture Object ID
+		drawable_.textureObject_ = texture_;
+		drawable_.texSamplerLoc_ = drawable_.textureObject_ > 0 ? shaderProgram_.getTextureSamplerLocation( ) : -1;
+
+		// Set OpenGL Shader Program ID
+		drawable_.shaderProgram_ = shaderProgram_.getProgramObject( );
+
+		// Create BatchRequest, Shader Program locations
+		BatchRequest batchRequest_;
+		shaderProgram_.getBatchRequest( batchRequest_ );
+
+		// Set Texture Object ID
+		batchRequest_.textureObject_ = drawable_.textureObject_;
+
+		// Set Drawable
+		batchRequest_.drawable_ = &drawable_;
+
+		// Add Drawable to batching
+		renderSystem_->addDrawable( batchRequest_ );
+
+		// Unlock SpriteStore
+		mStore.getLock( ).unlock( );
+
+		// Return TRUE
+		return( true );
 
 	}
 
@@ -13,27 +13,40 @@
 #include "../cfg/vector.hpp"
 #endif // !__c0de4un_vector_hpp__
 
-// Include mutex
-#ifndef __c0de4un_mutex_hpp__
-#include "../cfg/mutex.hpp" // std::mutex, std::unique_lock
-#endif // !__c0de4un_mutex_hpp__
+// Include string
+#ifndef __c0de4un_string_hpp__
+#include "../cfg/string.hpp"
+#endif // !__c0de4un_string_hpp__
+
+// Include SpriteStore
+#ifndef __c0de4un_sprite_store_hpp__
+#include "../components/SpriteStore.hpp"
+#endif // !__c0de4un_sprite_store_hpp__
+
+// Include RenderQueue
+#ifndef __c0de4un_render_queue_hpp__
+#include "../renderer/queue/RenderQueue.hpp"
+#endif // !__c0de4un_render_queue_hpp__
 
 // Include glm
 #ifndef __c0de4un_glm_hpp__
 #include "../cfg/glm.hpp"
 #endif // !__c0de4un_glm_hpp__
 
+// Include STL
+#include <utility> // pair
+
 // Forward-declaration of Random
 #ifndef __c0de4un_random_decl__
 #define __c0de4un_random_decl__
 namespace c0de4un { class Random; }
 #endif // !__c0de4un_random_decl__
 
-// Forward-declaration of Sprite
-#ifndef __c0de4un_sprite_decl__
-#define __c0de4un_sprite_decl__
-namespace c0de4un { class Sprite; }
-#endif // !__c0de4un_sprite_decl__
+// Forward-declaration of JobSystem
+#ifndef __c0de4un_job_system_decl__
+#define __c0de4un_job_system_decl__
+namespace c0de4un { class JobSystem; }
+#endif // !__c0de4un_job_system_decl__
 
 // Forward-declare GLShaderProgram
 #ifndef __c0de4un_gl_shader_program_decl__
@@ -47,16 +60,30 @@ namespace c0de4un { class GLShaderProgram; }
 namespace c0de4un { class GLTexture2D; }
 #endif // !__c0de4un_gl_texture_2D_decl__
 
+// Forward-declaration of TextureAtlas
+#ifndef __c0de4un_texture_atlas_decl__
+#define __c0de4un_texture_atlas_decl__
+namespace c0de4un { class TextureAtlas; }
+#endif // !__c0de4un_texture_atlas_decl__
+
+// Forward-declaration of TextureArrayPool
+#ifndef __c0de4un_texture_array_pool_decl__
+#define __c0de4un_texture_array_pool_decl__
+namespace c0de4un { class TextureArrayPool; }
+#endif // !__c0de4un_texture_array_pool_decl__
+
+// Forward-declaration of RenderSnapshot
+#ifndef __c0de4un_render_snapshot_decl__
+#define __c0de4un_render_snapshot_decl__
+namespace c0de4un { struct RenderSnapshot; }
+#endif // !__c0de4un_render_snapshot_decl__
+
 // Forward-declaration of GLRenderer
 #ifndef __c0de4un_gl_renderer_decl__
 #define __c0de4un_gl_renderer_decl__
 namespace c0de4un { class GLRenderer; }
 #endif // !__c0de4un_gl_renderer_decl__
 
-// Forward-declaration of Position
-// Forward-declaration of Rotation
-// Forward-declaration of Scale
-
 // SpriteSystem declared
 #define __c0de4un_sprite_system_decl__
 
@@ -69,6 +96,9 @@ namespace c0de4un
 	 * @features
 	 * - rotation, move (translation), scale modifications ;
 	 * - simple 2D physics ;
+	 * - Sprites data stored in SpriteStore (Structure-of-Arrays) ;
+	 * - Sprites updated in parallel chunks by JobSystem ;
+	 * - render state published as RenderSnapshot for the render-thread ;
 	 *
 	 * @version 1.0.0
 	*/
@@ -87,11 +117,12 @@ namespace c0de4un
 		 * SpriteSystem constructor
 		 *
 		 * @param pRandom_ - random numbers generator (wrapper).
+		 * @param pJobSystem_ - job system, can be null (Sprites updated by calling thread).
 		 * @param worldWidth_ - World Width.
 		 * @param worldHeight_ - World Height.
 		 * @param maxSprites_ - Sprites limit.
 		*/
-		explicit SpriteSystem( Random *const pRandom_, const unsigned int & worldWidth_, const unsigned int & worldHeight_, const unsigned int & maxSprites_ );
+		explicit SpriteSystem( Random *const pRandom_, JobSystem *const pJobSystem_, const unsigned int & worldWidth_, const unsigned int & worldHeight_, const unsigned int & maxSprites_ );
 
 		/* SpriteSystem destructor */
 		~SpriteSystem( );
@@ -102,16 +133,29 @@ namespace c0de4un
 
 		/*
 		 * Update Sprites.
+		 * Sprites split to chunks (multiple of cache-line & SIMD block) executed by JobSystem,
+		 * returns when all chunks finished.
 		 *
 		 * @param elapsedTime_ - time in seconds elapsed since previous frame (update-call).
 		*/
 		void Update( const double & elapsedTime_ );
 
+		/*
+		 * Copy render state of all visible Sprites to the RenderSnapshot,
+		 * instances ordered by RenderQueue sort key (radix sort).
+		 *
+		 * @thread_safety - simulation-thread only.
+		 * @param snapshot_ - RenderSnapshot to write, previous content replaced.
+		 * @throws - std::bad_alloc.
+		*/
+		void Snapshot( RenderSnapshot & snapshot_ );
+
 		/*
 		 * Stop this SpriteSystem.
-		 * Used to remove all Sprites from Sprite-Batching system.
+		 * Used to remove all Sprites from Sprite-Batching system,
+		 * releases 2D-Texture Array layers acquired by addSprite.
 		 *
-		 * @thread_safety - thread-safe.
+		 * @thread_safety - thread-safe, TextureArrayPools must not be used concurrently.
 		 * @param renderManager_ - Render system (OpenGL renderer, Sprite-Batching-System).
 		*/
 		void Stop( GLRenderer *const renderManager_ );
@@ -123,12 +167,60 @@ namespace c0de4un
 		 * when loading to GPU (OpenGL memory-space) using not render-thread (or main/ui/system).
 		 *
 		 * @thread_safety - thread-safe.
-		 * @param shaderProgram_ - Shader Program.
+		 * @param shaderProgram_ - loaded Shader Program.
 		 * @param texture2D_ - 2D-Texture, can be null.
 		 * @param renderSystem_ - Renderer (render manager/system).
 		*/
 		void addSprite( GLShaderProgram & shaderProgram_, GLTexture2D *const texture2D_, GLRenderer *const renderSystem_ );
 
+		/*
+		 * Add random sprite with random attributes (properties), textured by TextureAtlas region.
+		 * Sprites of all regions of the same page share one 2D-Texture (one batch).
+		 * UVs of the added Sprites refreshed first, if atlas defragmented (refreshAtlas).
+		 *
+		 * @thread_safety - thread-safe, TextureAtlas must not be modified concurrently.
+		 * @param shaderProgram_ - loaded Shader Program, with 2D-Texture region attribute.
+		 * @param atlas_ - TextureAtlas.
+		 * @param region_ - TextureAtlas region ID.
+		 * @param renderSystem_ - Renderer (render manager/system).
+		*/
+		void addSprite( GLShaderProgram & shaderProgram_, const TextureAtlas & atlas_, const uint32_t region_, GLRenderer *const renderSystem_ );
+
+		/*
+		 * Add random sprite with random attributes (properties), textured by whole OpenGL 2D-Texture
+		 * (created without GLTexture2D, e.g. generated by the benchmark).
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param shaderProgram_ - loaded Shader Program.
+		 * @param texture_ - OpenGL 2D Texture Object ID, #0 - no texture.
+		 * @param renderSystem_ - Renderer (render manager/system).
+		*/
+		void addSprite( GLShaderProgram & shaderProgram_, const GLuint texture_, GLRenderer *const renderSystem_ );
+
+		/*
+		 * Add random sprite with random attributes (properties), textured by 2D-Texture Array layer.
+		 * Sprites of all layers of the same array share one batch (one draw for many textures).
+		 * Layer acquired from the TextureArrayPool, released by Stop.
+		 *
+		 * @thread_safety - thread with current OpenGL context only (layer upload).
+		 * @param shaderProgram_ - loaded Shader Program, sampling 2D-Texture Array (with texture layer attribute).
+		 * @param texturePool_ - 2D-Texture Arrays pool, must outlive Stop.
+		 * @param image_ - PNG-image file, or name of already acquired pixels.
+		 * @param renderSystem_ - Renderer (render manager/system).
+		 * @throws - can throw exception.
+		*/
+		void addSprite( GLShaderProgram & shaderProgram_, TextureArrayPool & texturePool_, const std::string & image_, GLRenderer *const renderSystem_ );
+
+		/*
+		 * Copies TextureAtlas regions UVs to the Drawables, if atlas generation changed (defragmented by Insert).
+		 * Regions never move between pages, so 2D-Textures & batches not changed.
+		 * Called after each TextureAtlas::Insert & by addSprite, one TextureAtlas per SpriteSystem.
+		 *
+		 * @thread_safety - thread-safe, TextureAtlas must not be modified concurrently.
+		 * @param atlas_ - TextureAtlas.
+		*/
+		void refreshAtlas( const TextureAtlas & atlas_ );
+
 		// -------------------------------------------------------- \\
 
 	private:
@@ -142,13 +234,16 @@ namespace c0de4un
 		/* Random-numbers generator (wrapper). */
 		Random *const mRandom;
 
+		/* Job system */
+		JobSystem *const mJobSystem;
+
 		/* World Width */
 		const unsigned int mWorldWidth;
 
 		/* World Height */
 		const unsigned int mWorldHeight;
 
-		/* Max. Sprite size, depends on world width. */
+		/* Max. Sprite size, depends on world width, at least 2 (many Sprites). */
 		const unsigned int mSpriteMaxSize;
 
 		/* Min. Sprite size, depends on world height. */
@@ -161,14 +256,17 @@ namespace c0de4un
 		// Fields
 		// ===========================================================
 
-		/* Sprites */
-		std::vector<Sprite*> mSprites;
+		/* Sprites data */
+		SpriteStore mStore;
+
+		/* Render queue, rebuilt by Snapshot */
+		RenderQueue mRenderQueue;
 
-		/* Mutex */
-		std::mutex mMutex;
+		/* TextureAtlas generation of the Drawables UVs */
+		uint32_t mAtlasGeneration;
 
-		/* Thread-lock to synchronize access to the Sprites collection (container) */
-		std::unique_lock<std::mutex> mLock;
+		/* 2D-Texture Array layers of the Sprites, pool & image, released by Stop */
+		std::vector<std::pair<TextureArrayPool*, std::string>> mTextureLayers;
 
 		// ===========================================================
 		// Deleted
@@ -218,6 +316,48 @@ namespace c0de4un
 		*/
 		const glm::vec3 getRandomVelocity( ) noexcept;
 
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Moves Sprites chunk & rebuilds transforms of its changed Sprites (Job function).
+		 *
+		 * @thread_safety - thread-safe, chunks must not overlap.
+		 * @param pData - MoveArgs & TransformArgs.
+		 * @param begin_ - first Sprite index, multiple of the MoveKernel::BLOCK_SIZE.
+		 * @param end_ - last Sprite index + 1.
+		*/
+		static void updateChunk( void *const pData, const uint32_t begin_, const uint32_t end_ );
+
+		/*
+		 * Add random sprite with random attributes (properties).
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param shaderProgram_ - loaded Shader Program.
+		 * @param texture_ - OpenGL 2D Texture Object ID, #0 - no texture.
+		 * @param uvRect_ - 2D-Texture region ( u, v, width, height ).
+		 * @param atlasRegion_ - TextureAtlas region ID, #0 - not in atlas.
+		 * @param textureLayer_ - 2D-Texture Array layer, 0 for 2D-Texture.
+		 * @param renderSystem_ - Renderer (render manager/system).
+		 * @return - 'true' if added.
+		*/
+		const bool addSprite( GLShaderProgram & shaderProgram_, const GLuint texture_, const float *const uvRect_, const uint32_t atlasRegion_, const float textureLayer_, GLRenderer *const renderSystem_ );
+
+		/*
+		 * Adds Sprite Drawable to the Sprite-Batching system.
+		 * GL objects of the batch created by the render thread (GLRenderer::Draw).
+		 *
+		 * @thread_safety - main thread (addSprite callers), Shader Program must be already loaded.
+		 * @param handle_ - Sprite handle.
+		 * @param shaderProgram_ - loaded Shader Program.
+		 * @param texture_ - OpenGL 2D Texture Object ID (loaded), #0 - no texture.
+		 * @param renderSystem_ - Renderer (render manager/system).
+		 * @return - 'true' if OK.
+		 * @throws - can throw exception.
+		*/
+		const bool showSprite( const SpriteHandle & handle_, GLShaderProgram & shaderProgram_, const GLuint texture_, GLRenderer *const renderSystem_ );
+
 		// -------------------------------------------------------- \\
 
 	};
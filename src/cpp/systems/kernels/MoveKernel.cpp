@@ -0,0 +1,545 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+// HEADER
+#ifndef __c0de4un_move_kernel_hpp__
+#include "MoveKernel.hpp"
+#endif // !__c0de4un_move_kernel_hpp__
+
+// Include simd
+#ifndef __c0de4un_simd_hpp__
+#include "../../cfg/simd.hpp"
+#endif // !__c0de4un_simd_hpp__
+
+// Include CPUInfo
+#ifndef __c0de4un_cpu_info_hpp__
+#include "../../utils/cpu/CPUInfo.hpp"
+#endif // !__c0de4un_cpu_info_hpp__
+
+// Include Log
+#ifndef __c0de4un_log_hpp__
+#include "../../utils/log/Log.hpp"
+#endif // !__c0de4un_log_hpp__
+
+// Include STL
+#include <algorithm> // min
+
+namespace c0de4un
+{
+
+	// -------------------------------------------------------- \\
+
+	// ===========================================================
+	// Utils
+	// ===========================================================
+
+	/*
+	 * Moves one Sprite along one axis (reference behavior).
+	 *
+	 * @param pos_ - position.
+	 * @param vel_ - velocity.
+	 * @param size_ - size.
+	 * @param world_ - world size.
+	 * @return - 'true' if moved, 'false' if velocity inverted.
+	*/
+	static inline const bool moveAxis( float & pos_, float & vel_, const float size_, const float world_ ) noexcept
+	{
+
+		// Border not reached: +Axis - right/top border, -Axis - left/bottom border
+		const bool move_( vel_ > 0.0f ? ( pos_ + vel_ ) < ( world_ - size_ ) : ( pos_ - vel_ ) > size_ );
+
+		// Translate (move)
+		if ( move_ )
+			pos_ += vel_;
+		else // Invert Velocity
+			vel_ = -vel_;
+
+		// Return result
+		return( move_ );
+
+	}
+
+	/*
+	 * Moves one Sprite along both axes.
+	 *
+	 * @param args_ - arrays & world size.
+	 * @param index_ - Sprite index.
+	 * @return - 1 if moved, 0 if not.
+	*/
+	static inline const uint64_t moveSprite( const MoveArgs & args_, const uint32_t index_ ) noexcept
+	{
+
+		// X-axis
+		const bool movedX_( moveAxis( args_.posX_[index_], args_.velX_[index_], args_.sizeX_[index_], args_.worldWidth_ ) );
+
+		// Y-axis
+		const bool movedY_( moveAxis( args_.posY_[index_], args_.velY_[index_], args_.sizeY_[index_], args_.worldHeight_ ) );
+
+		// Return changed bit
+		return( static_cast<uint64_t>( movedX_ || movedY_ ) );
+
+	}
+
+#ifdef __c0de4un_x86__
+
+	/*
+	 * Moves 4 Sprites along one axis (SSE2).
+	 *
+	 * @return - moved lanes bitmask.
+	*/
+	__c0de4un_target_sse2__ static inline int moveAxisSSE2( float *const pPos, float *const pVel, const float *const pSize, const __m128 world_ ) noexcept
+	{
+
+		// Load
+		const __m128 pos_( _mm_load_ps( pPos ) );
+		const __m128 vel_( _mm_load_ps( pVel ) );
+		const __m128 size_( _mm_load_ps( pSize ) );
+
+		// Moved position
+		const __m128 next_( _mm_add_ps( pos_, vel_ ) );
+
+		// +Axis lanes
+		const __m128 positive_( _mm_cmpgt_ps( vel_, _mm_setzero_ps( ) ) );
+
+		// Border not reached: ( pos + vel ) < ( world - size ) for +Axis, ( pos - vel ) > size for -Axis
+		const __m128 forward_( _mm_cmplt_ps( next_, _mm_sub_ps( world_, size_ ) ) );
+		const __m128 backward_( _mm_cmpgt_ps( _mm_sub_ps( pos_, vel_ ), size_ ) );
+		const __m128 move_( _mm_or_ps( _mm_and_ps( positive_, forward_ ), _mm_andnot_ps( positive_, backward_ ) ) );
+
+		// Select position
+		_mm_store_ps( pPos, _mm_or_ps( _mm_and_ps( move_, next_ ), _mm_andnot_ps( move_, pos_ ) ) );
+
+		// Invert velocity sign of not moved lanes
+		_mm_store_ps( pVel, _mm_xor_ps( vel_, _mm_andnot_ps( move_, _mm_set1_ps( -0.0f ) ) ) );
+
+		// Return moved lanes
+		return( _mm_movemask_ps( move_ ) );
+
+	}
+
+	/*
+	 * Moves 8 Sprites along one axis (AVX2).
+	 *
+	 * @return - moved lanes bitmask.
+	*/
+	__c0de4un_target_avx2__ static inline int moveAxisAVX2( float *const pPos, float *const pVel, const float *const pSize, const __m256 world_ ) noexcept
+	{
+
+		// Load
+		const __m256 pos_( _mm256_load_ps( pPos ) );
+		const __m256 vel_( _mm256_load_ps( pVel ) );
+		const __m256 size_( _mm256_load_ps( pSize ) );
+
+		// Moved position
+		const __m256 next_( _mm256_add_ps( pos_, vel_ ) );
+
+		// +Axis lanes
+		const __m256 positive_( _mm256_cmp_ps( vel_, _mm256_setzero_ps( ), _CMP_GT_OQ ) );
+
+		// Border not reached
+		const __m256 forward_( _mm256_cmp_ps( next_, _mm256_sub_ps( world_, size_ ), _CMP_LT_OQ ) );
+		const __m256 backward_( _mm256_cmp_ps( _mm256_sub_ps( pos_, vel_ ), size_, _CMP_GT_OQ ) );
+		const __m256 move_( _mm256_blendv_ps( backward_, forward_, positive_ ) );
+
+		// Select position
+		_mm256_store_ps( pPos, _mm256_blendv_ps( pos_, next_, move_ ) );
+
+		// Invert velocity sign of not moved lanes
+		_mm256_store_ps( pVel, _mm256_xor_ps( vel_, _mm256_andnot_ps( move_, _mm256_set1_ps( -0.0f ) ) ) );
+
+		// Return moved lanes
+		return( _mm256_movemask_ps( move_ ) );
+
+	}
+
+	/*
+	 * Moves 16 Sprites along one axis (AVX-512).
+	 *
+	 * @return - moved lanes bitmask.
+	*/
+	__c0de4un_target_avx512__ static inline int moveAxisAVX512( float *const pPos, float *const pVel, const float *const pSize, const __m512 world_ ) noexcept
+	{
+
+		// Load
+		const __m512 pos_( _mm512_load_ps( pPos ) );
+		const __m512 vel_( _mm512_load_ps( pVel ) );
+		const __m512 size_( _mm512_load_ps( pSize ) );
+
+		// Moved position
+		const __m512 next_( _mm512_add_ps( pos_, vel_ ) );
+
+		// +Axis lanes
+		const __mmask16 positive_( _mm512_cmp_ps_mask( vel_, _mm512_setzero_ps( ), _CMP_GT_OQ ) );
+
+		// Border not reached
+		const __mmask16 forward_( _mm512_cmp_ps_mask( next_, _mm512_sub_ps( world_, size_ ), _CMP_LT_OQ ) );
+		const __mmask16 backward_( _mm512_cmp_ps_mask( _mm512_sub_ps( pos_, vel_ ), size_, _CMP_GT_OQ ) );
+		const __mmask16 move_( static_cast<__mmask16>( ( positive_ & forward_ ) | ( ~positive_ & backward_ ) ) );
+
+		// Select position
+		_mm512_store_ps( pPos, _mm512_mask_blend_ps( move_, pos_, next_ ) );
+
+		// Invert velocity sign of not moved lanes
+		const __m512i velBits_( _mm512_castps_si512( vel_ ) );
+		_mm512_store_ps( pVel, _mm512_castsi512_ps( _mm512_mask_xor_epi32( velBits_, static_cast<__mmask16>( ~move_ ), velBits_, _mm512_set1_epi32( static_cast<int>( 0x80000000u ) ) ) ) );
+
+		// Return moved lanes
+		return( static_cast<int>( move_ ) );
+
+	}
+
+	/*
+	 * Moves Sprites [begin; end) (SSE2, 4 Sprites per iteration).
+	 *
+	 * @param args_ - arrays & world size.
+	 * @param begin_ - first Sprite index, multiple of BLOCK_SIZE.
+	 * @param end_ - last Sprite index + 1.
+	*/
+	__c0de4un_target_sse2__ static void moveSSE2( const MoveArgs & args_, const uint32_t begin_, const uint32_t end_ ) noexcept
+	{
+
+		// World size
+		const __m128 worldWidth_( _mm_set1_ps( args_.worldWidth_ ) );
+		const __m128 worldHeight_( _mm_set1_ps( args_.worldHeight_ ) );
+
+		// Blocks
+		for ( uint32_t block_ = begin_; block_ < end_; block_ += MoveKernel::BLOCK_SIZE )
+		{
+
+			// Block end
+			const uint32_t blockEnd_( std::min( block_ + MoveKernel::BLOCK_SIZE, end_ ) );
+
+			// Block changed bits
+			uint64_t changed_( 0 );
+
+			// Sprite index
+			uint32_t i( block_ );
+
+			// 4 Sprites
+			for ( ; i + 4 <= blockEnd_; i += 4 )
+			{
+
+				// X-axis
+				const int movedX_( moveAxisSSE2( args_.posX_ + i, args_.velX_ + i, args_.sizeX_ + i, worldWidth_ ) );
+
+				// Y-axis
+				const int movedY_( moveAxisSSE2( args_.posY_ + i, args_.velY_ + i, args_.sizeY_ + i, worldHeight_ ) );
+
+				// Changed bits
+				changed_ |= static_cast<uint64_t>( movedX_ | movedY_ ) << ( i - block_ );
+
+			}
+
+			// Tail
+			for ( ; i < blockEnd_; i++ )
+				changed_ |= moveSprite( args_, i ) << ( i - block_ );
+
+			// Write changed bits
+			args_.changed_[block_ / MoveKernel::BLOCK_SIZE] |= changed_;
+
+		}
+
+	}
+
+	/*
+	 * Moves Sprites [begin; end) (AVX2, 8 Sprites per iteration).
+	 *
+	 * @param args_ - arrays & world size.
+	 * @param begin_ - first Sprite index, multiple of BLOCK_SIZE.
+	 * @param end_ - last Sprite index + 1.
+	*/
+	__c0de4un_target_avx2__ static void moveAVX2( const MoveArgs & args_, const uint32_t begin_, const uint32_t end_ ) noexcept
+	{
+
+		// World size
+		const __m256 worldWidth_( _mm256_set1_ps( args_.worldWidth_ ) );
+		const __m256 worldHeight_( _mm256_set1_ps( args_.worldHeight_ ) );
+
+		// Blocks
+		for ( uint32_t block_ = begin_; block_ < end_; block_ += MoveKernel::BLOCK_SIZE )
+		{
+
+			// Block end
+			const uint32_t blockEnd_( std::min( block_ + MoveKernel::BLOCK_SIZE, end_ ) );
+
+			// Block changed bits
+			uint64_t changed_( 0 );
+
+			// Sprite index
+			uint32_t i( block_ );
+
+			// 8 Sprites
+			for ( ; i + 8 <= blockEnd_; i += 8 )
+			{
+
+				// X-axis
+				const int movedX_( moveAxisAVX2( args_.posX_ + i, args_.velX_ + i, args_.sizeX_ + i, worldWidth_ ) );
+
+				// Y-axis
+				const int movedY_( moveAxisAVX2( args_.posY_ + i, args_.velY_ + i, args_.sizeY_ + i, worldHeight_ ) );
+
+				// Changed bits
+				changed_ |= static_cast<uint64_t>( movedX_ | movedY_ ) << ( i - block_ );
+
+			}
+
+			// Tail
+			for ( ; i < blockEnd_; i++ )
+				changed_ |= moveSprite( args_, i ) << ( i - block_ );
+
+			// Write changed bits
+			args_.changed_[block_ / MoveKernel::BLOCK_SIZE] |= changed_;
+
+		}
+
+	}
+
+	/*
+	 * Moves Sprites [begin; end) (AVX-512, 16 Sprites per iteration).
+	 *
+	 * @param args_ - arrays & world size.
+	 * @param begin_ - first Sprite index, multiple of BLOCK_SIZE.
+	 * @param end_ - last Sprite index + 1.
+	*/
+	__c0de4un_target_avx512__ static void moveAVX512( const MoveArgs & args_, const uint32_t begin_, const uint32_t end_ ) noexcept
+	{
+
+		// World size
+		const __m512 worldWidth_( _mm512_set1_ps( args_.worldWidth_ ) );
+		const __m512 worldHeight_( _mm512_set1_ps( args_.worldHeight_ ) );
+
+		// Blocks
+		for ( uint32_t block_ = begin_; block_ < end_; block_ += MoveKernel::BLOCK_SIZE )
+		{
+
+			// Block end
+			const uint32_t blockEnd_( std::min( block_ + MoveKernel::BLOCK_SIZE, end_ ) );
+
+			// Block changed bits
+			uint64_t changed_( 0 );
+
+			// Sprite index
+			uint32_t i( block_ );
+
+			// 16 Sprites
+			for ( ; i + 16 <= blockEnd_; i += 16 )
+			{
+
+				// X-axis
+				const int movedX_( moveAxisAVX512( args_.posX_ + i, args_.velX_ + i, args_.sizeX_ + i, worldWidth_ ) );
+
+				// Y-axis
+				const int movedY_( moveAxisAVX512( args_.posY_ + i, args_.velY_ + i, args_.sizeY_ + i, worldHeight_ ) );
+
+				// Changed bits
+				changed_ |= static_cast<uint64_t>( movedX_ | movedY_ ) << ( i - block_ );
+
+			}
+
+			// Tail
+			for ( ; i < blockEnd_; i++ )
+				changed_ |= moveSprite( args_, i ) << ( i - block_ );
+
+			// Write changed bits
+			args_.changed_[block_ / MoveKernel::BLOCK_SIZE] |= changed_;
+
+		}
+
+	}
+
+#endif // __c0de4un_x86__
+
+	// ===========================================================
+	// Getter & Setter
+	// ===========================================================
+
+	/*
+	 * Returns best instruction set supported by CPU.
+	 *
+	 * @thread_safety - thread-safe.
+	*/
+	const unsigned char MoveKernel::getBestISA( ) noexcept
+	{
+
+#ifdef __c0de4un_x86__
+
+		// AVX-512
+		if ( CPUInfo::hasAVX512F( ) )
+			return( ISA_AVX512 );
+
+		// AVX2
+		if ( CPUInfo::hasAVX2( ) )
+			return( ISA_AVX2 );
+
+		// SSE2
+		if ( CPUInfo::hasSSE2( ) )
+			return( ISA_SSE2 );
+
+#endif // __c0de4un_x86__
+
+		// Scalar
+		return( ISA_SCALAR );
+
+	}
+
+	/*
+	 * Returns kernel function for the given instruction set.
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param isa_ - instruction set (ISA_SCALAR, ISA_SSE2, etc).
+	 * @return - kernel function, or scalar if not supported by build.
+	*/
+	const MoveKernel::function_t MoveKernel::getFunction( const unsigned char isa_ ) noexcept
+	{
+
+		// Select function
+		switch ( isa_ )
+		{
+		case ISA_SSE2:
+			return( &MoveKernel::SSE2 );
+		case ISA_AVX2:
+			return( &MoveKernel::AVX2 );
+		case ISA_AVX512:
+			return( &MoveKernel::AVX512 );
+		default:
+			return( &MoveKernel::Scalar );
+		}
+
+	}
+
+	/*
+	 * Returns instruction set name.
+	 *
+	 * @param isa_ - instruction set.
+	*/
+	const char * MoveKernel::getISAName( const unsigned char isa_ ) noexcept
+	{
+
+		// Select name
+		switch ( isa_ )
+		{
+		case ISA_SSE2:
+			return( "SSE2" );
+		case ISA_AVX2:
+			return( "AVX2" );
+		case ISA_AVX512:
+			return( "AVX-512" );
+		default:
+			return( "Scalar" );
+		}
+
+	}
+
+	// ===========================================================
+	// Methods
+	// ===========================================================
+
+	/*
+	 * Run best kernel for this CPU (selected once).
+	 *
+	 * @thread_safety - thread-safe, if ranges not overlap.
+	 * @param args_ - arrays & world size.
+	 * @param begin_ - first Sprite index, multiple of BLOCK_SIZE.
+	 * @param end_ - last Sprite index + 1.
+	*/
+	void MoveKernel::Run( const MoveArgs & args_, const uint32_t begin_, const uint32_t end_ ) noexcept
+	{
+
+		// Kernel function (C++ 11 guarantees thread-safe initialization)
+		static const function_t function_( getFunction( getBestISA( ) ) );
+
+		// Run
+		function_( args_, begin_, end_ );
+
+	}
+
+	/* Scalar (reference) kernel */
+	void MoveKernel::Scalar( const MoveArgs & args_, const uint32_t begin_, const uint32_t end_ ) noexcept
+	{
+
+#ifdef DEBUG // DEBUG
+		assert( begin_ % BLOCK_SIZE == 0 );
+#endif // DEBUG
+
+		// Blocks
+		for ( uint32_t block_ = begin_; block_ < end_; block_ += BLOCK_SIZE )
+		{
+
+			// Block end
+			const uint32_t blockEnd_( std::min( block_ + BLOCK_SIZE, end_ ) );
+
+			// Block changed bits
+			uint64_t changed_( 0 );
+
+			// Sprites
+			for ( uint32_t i = block_; i < blockEnd_; i++ )
+				changed_ |= moveSprite( args_, i ) << ( i - block_ );
+
+			// Write changed bits
+			args_.changed_[block_ / BLOCK_SIZE] |= changed_;
+
+		}
+
+	}
+
+	/* SSE2 kernel, 4 Sprites per iteration */
+	void MoveKernel::SSE2( const MoveArgs & args_, const uint32_t begin_, const uint32_t end_ ) noexcept
+	{
+
+#ifdef DEBUG // DEBUG
+		assert( begin_ % BLOCK_SIZE == 0 );
+#endif // DEBUG
+
+#ifdef __c0de4un_x86__
+		// Run
+		moveSSE2( args_, begin_, end_ );
+#else
+		// Not supported
+		Scalar( args_, begin_, end_ );
+#endif // __c0de4un_x86__
+
+	}
+
+	/* AVX2 kernel, 8 Sprites per iteration */
+	void MoveKernel::AVX2( const MoveArgs & args_, const uint32_t begin_, const uint32_t end_ ) noexcept
+	{
+
+#ifdef DEBUG // DEBUG
+		assert( begin_ % BLOCK_SIZE == 0 );
+#endif // DEBUG
+
+#ifdef __c0de4un_x86__
+		// Run
+		moveAVX2( args_, begin_, end_ );
+#else
+		// Not supported
+		Scalar( args_, begin_, end_ );
+#endif // __c0de4un_x86__
+
+	}
+
+	/* AVX-512 kernel, 16 Sprites per iteration */
+	void MoveKernel::AVX512( const MoveArgs & args_, const uint32_t begin_, const uint32_t end_ ) noexcept
+	{
+
+#ifdef DEBUG // DEBUG
+		assert( begin_ % BLOCK_SIZE == 0 );
+#endif // DEBUG
+
+#ifdef __c0de4un_x86__
+		// Run
+		moveAVX512( args_, begin_, end_ );
+#else
+		// Not supported
+		Scalar( args_, begin_, end_ );
+#endif // __c0de4un_x86__
+
+	}
+
+	// -------------------------------------------------------- \\
+
+}
\ No newline at end of file
@@ -0,0 +1,206 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_move_kernel_hpp__
+#define __c0de4un_move_kernel_hpp__
+
+// Include STL
+#include <cstdint> // uint32_t, uint64_t
+
+// MoveKernel declared
+#define __c0de4un_move_kernel_decl__
+
+// Enable structure-data (fields, variables) alignment (by compilator) to 1 byte
+#pragma pack( push, 1 )
+
+namespace c0de4un
+{
+
+	/*
+	 * MoveArgs - SpriteStore arrays & world size, passed to the MoveKernel.
+	 *
+	 * @version 1.0
+	*/
+	struct MoveArgs final
+	{
+
+		/* X-positions */
+		float * posX_;
+
+		/* Y-positions */
+		float * posY_;
+
+		/* X-velocities */
+		float * velX_;
+
+		/* Y-velocities */
+		float * velY_;
+
+		/* X-sizes (scales) */
+		const float * sizeX_;
+
+		/* Y-sizes (scales) */
+		const float * sizeY_;
+
+		/* Changed bitmask, one bit per Sprite (64 Sprites per word) */
+		uint64_t * changed_;
+
+		/* World Width */
+		float worldWidth_;
+
+		/* World Height */
+		float worldHeight_;
+
+	};
+
+}
+
+// Restore structure-data alignment to default (8-byte on MSVC)
+#pragma pack( pop )
+
+namespace c0de4un
+{
+
+	/*
+	 * MoveKernel - moves Sprites & inverts velocity when world border reached (bounce).
+	 *
+	 * Per axis: if velocity > 0, Sprite moves while ( pos + vel ) < ( world - size ),
+	 * else while ( pos - vel ) > size; otherwise velocity inverted.
+	 * Moved Sprites marked in the changed bitmask.
+	 *
+	 * @features
+	 * - scalar reference path ;
+	 * - SSE2 (4), AVX2 (8) & AVX-512 (16 Sprites per iteration) paths, masked selects ;
+	 * - run-time dispatch by CPU features ;
+	 * - all paths produce bit-identical results ;
+	 *
+	 * @version 1.0
+	*/
+	class MoveKernel final
+	{
+
+	public:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Constants
+		// ===========================================================
+
+		/* Scalar (reference) path */
+		static constexpr unsigned char ISA_SCALAR = 0;
+
+		/* SSE2 path */
+		static constexpr unsigned char ISA_SSE2 = 1;
+
+		/* AVX2 path */
+		static constexpr unsigned char ISA_AVX2 = 2;
+
+		/* AVX-512 path */
+		static constexpr unsigned char ISA_AVX512 = 3;
+
+		/* Sprites per changed bitmask word */
+		static constexpr uint32_t BLOCK_SIZE = 64;
+
+		// ===========================================================
+		// Types
+		// ===========================================================
+
+		/*
+		 * Kernel function.
+		 *
+		 * @param args_ - arrays & world size.
+		 * @param begin_ - first Sprite index, multiple of BLOCK_SIZE.
+		 * @param end_ - last Sprite index + 1.
+		*/
+		using function_t = void( * )( const MoveArgs & args_, const uint32_t begin_, const uint32_t end_ );
+
+		// ===========================================================
+		// Getter & Setter
+		// ===========================================================
+
+		/*
+		 * Returns best instruction set supported by CPU.
+		 *
+		 * @thread_safety - thread-safe.
+		*/
+		static const unsigned char getBestISA( ) noexcept;
+
+		/*
+		 * Returns kernel function for the given instruction set.
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param isa_ - instruction set (ISA_SCALAR, ISA_SSE2, etc).
+		 * @return - kernel function, or scalar if not supported by build.
+		*/
+		static const function_t getFunction( const unsigned char isa_ ) noexcept;
+
+		/*
+		 * Returns instruction set name.
+		 *
+		 * @param isa_ - instruction set.
+		*/
+		static const char * getISAName( const unsigned char isa_ ) noexcept;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Run best kernel for this CPU (selected once).
+		 *
+		 * @thread_safety - thread-safe, if ranges not overlap.
+		 * @param args_ - arrays & world size.
+		 * @param begin_ - first Sprite index, multiple of BLOCK_SIZE.
+		 * @param end_ - last Sprite index + 1.
+		*/
+		static void Run( const MoveArgs & args_, const uint32_t begin_, const uint32_t end_ ) noexcept;
+
+		/* Scalar (reference) kernel */
+		static void Scalar( const MoveArgs & args_, const uint32_t begin_, const uint32_t end_ ) noexcept;
+
+		/* SSE2 kernel, 4 Sprites per iteration */
+		static void SSE2( const MoveArgs & args_, const uint32_t begin_, const uint32_t end_ ) noexcept;
+
+		/* AVX2 kernel, 8 Sprites per iteration */
+		static void AVX2( const MoveArgs & args_, const uint32_t begin_, const uint32_t end_ ) noexcept;
+
+		/* AVX-512 kernel, 16 Sprites per iteration */
+		static void AVX512( const MoveArgs & args_, const uint32_t begin_, const uint32_t end_ ) noexcept;
+
+		// -------------------------------------------------------- \\
+
+	private:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Deleted
+		// ===========================================================
+
+		/* @deleted MoveKernel constructor */
+		MoveKernel( ) = delete;
+
+		/* @deleted MoveKernel const copy constructor */
+		MoveKernel( const MoveKernel & ) = delete;
+
+		/* @deleted MoveKernel const copy assignment operator */
+		MoveKernel & operator=( const MoveKernel & ) = delete;
+
+		/* @deleted MoveKernel move constructor */
+		MoveKernel( MoveKernel && ) = delete;
+
+		/* @deleted MoveKernel move assignment operator */
+		MoveKernel & operator=( MoveKernel && ) = delete;
+
+		// -------------------------------------------------------- \\
+
+	};
+
+}
+
+#endif // !__c0de4un_move_kernel_hpp__
\ No newline at end of file
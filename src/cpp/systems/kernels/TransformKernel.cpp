@@ -0,0 +1,523 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+// HEADER
+#ifndef __c0de4un_transform_kernel_hpp__
+#include "TransformKernel.hpp"
+#endif // !__c0de4un_transform_kernel_hpp__
+
+// Include MoveKernel
+#ifndef __c0de4un_move_kernel_hpp__
+#include "MoveKernel.hpp"
+#endif // !__c0de4un_move_kernel_hpp__
+
+// Include simd
+#ifndef __c0de4un_simd_hpp__
+#include "../../cfg/simd.hpp"
+#endif // !__c0de4un_simd_hpp__
+
+// Include STL
+#include <cassert> // assert
+#include <algorithm> // min
+#include <cstring> // memcpy
+#include <utility> // swap
+
+namespace c0de4un
+{
+
+	// -------------------------------------------------------- \\
+
+	// ===========================================================
+	// Config
+	// ===========================================================
+
+	/* Degrees to quadrants (1 / 90) */
+	static constexpr float INV_QUADRANT = 1.0f / 90.0f;
+
+	/* Degrees per quadrant */
+	static constexpr float QUADRANT = 90.0f;
+
+	/* Degrees to radians */
+	static constexpr float DEG_TO_RAD = 3.14159265358979323846f / 180.0f;
+
+	/* 1.5 * 2^23, adding & subtracting rounds to nearest integer, low mantissa bits hold integer */
+	static constexpr float ROUND_MAGIC = 12582912.0f;
+
+	/* sin(x) minimax coefficients on [-pi/4; pi/4] */
+	static constexpr float SIN_C1 = -1.6666654611e-1f;
+	static constexpr float SIN_C2 = 8.3321608736e-3f;
+	static constexpr float SIN_C3 = -1.9515295891e-4f;
+
+	/* cos(x) minimax coefficients on [-pi/4; pi/4] */
+	static constexpr float COS_C1 = 4.166664568298827e-2f;
+	static constexpr float COS_C2 = -1.388731625493765e-3f;
+	static constexpr float COS_C3 = 2.443315711809948e-5f;
+
+	// ===========================================================
+	// Utils
+	// ===========================================================
+
+	/*
+	 * Builds transform of one Sprite (reference behavior).
+	 *
+	 * @param args_ - arrays.
+	 * @param index_ - Sprite index.
+	*/
+	static inline void transformSprite( const TransformArgs & args_, const uint32_t index_ ) noexcept
+	{
+
+		// Nearest quadrant
+		const float biased_( args_.rotation_[index_] * INV_QUADRANT + ROUND_MAGIC );
+		const float quadrant_( biased_ - ROUND_MAGIC );
+
+		// Quadrant bits (integer in the low mantissa bits)
+		uint32_t bits_( 0 );
+		std::memcpy( &bits_, &biased_, sizeof( bits_ ) );
+
+		// Reduced angle in radians, [-pi/4; pi/4]
+		const float x_( ( args_.rotation_[index_] - quadrant_ * QUADRANT ) * DEG_TO_RAD );
+		const float x2_( x_ * x_ );
+
+		// Polynomials
+		float sin_( x_ + x_ * x2_ * ( SIN_C1 + x2_ * ( SIN_C2 + x2_ * SIN_C3 ) ) );
+		float cos_( ( 1.0f - 0.5f * x2_ ) + x2_ * x2_ * ( COS_C1 + x2_ * ( COS_C2 + x2_ * COS_C3 ) ) );
+
+		// Odd quadrant: swap sine & cosine
+		if ( bits_ & 1 )
+			std::swap( sin_, cos_ );
+
+		// Quadrants signs
+		if ( bits_ & 2 )
+			sin_ = -sin_;
+		if ( ( bits_ + 1 ) & 2 )
+			cos_ = -cos_;
+
+		// Linear part columns
+		args_.xAxisX_[index_] = cos_ * args_.scaleX_[index_];
+		args_.xAxisY_[index_] = sin_ * args_.scaleX_[index_];
+		args_.yAxisX_[index_] = -sin_ * args_.scaleY_[index_];
+		args_.yAxisY_[index_] = cos_ * args_.scaleY_[index_];
+
+	}
+
+#ifdef __c0de4un_x86__
+
+	/* Builds transforms of 4 Sprites (SSE2) */
+	__c0de4un_target_sse2__ static inline void transformSSE2( const TransformArgs & args_, const uint32_t i ) noexcept
+	{
+
+		// Load
+		const __m128 rotation_( _mm_load_ps( args_.rotation_ + i ) );
+		const __m128 scaleX_( _mm_load_ps( args_.scaleX_ + i ) );
+		const __m128 scaleY_( _mm_load_ps( args_.scaleY_ + i ) );
+
+		// Nearest quadrant
+		const __m128 biased_( _mm_add_ps( _mm_mul_ps( rotation_, _mm_set1_ps( INV_QUADRANT ) ), _mm_set1_ps( ROUND_MAGIC ) ) );
+		const __m128 quadrant_( _mm_sub_ps( biased_, _mm_set1_ps( ROUND_MAGIC ) ) );
+		const __m128i bits_( _mm_castps_si128( biased_ ) );
+
+		// Reduced angle in radians
+		const __m128 x_( _mm_mul_ps( _mm_sub_ps( rotation_, _mm_mul_ps( quadrant_, _mm_set1_ps( QUADRANT ) ) ), _mm_set1_ps( DEG_TO_RAD ) ) );
+		const __m128 x2_( _mm_mul_ps( x_, x_ ) );
+
+		// Sine polynomial
+		__m128 sinPoly_( _mm_add_ps( _mm_set1_ps( SIN_C2 ), _mm_mul_ps( x2_, _mm_set1_ps( SIN_C3 ) ) ) );
+		sinPoly_ = _mm_add_ps( _mm_set1_ps( SIN_C1 ), _mm_mul_ps( x2_, sinPoly_ ) );
+		const __m128 sin_( _mm_add_ps( x_, _mm_mul_ps( _mm_mul_ps( x_, x2_ ), sinPoly_ ) ) );
+
+		// Cosine polynomial
+		__m128 cosPoly_( _mm_add_ps( _mm_set1_ps( COS_C2 ), _mm_mul_ps( x2_, _mm_set1_ps( COS_C3 ) ) ) );
+		cosPoly_ = _mm_add_ps( _mm_set1_ps( COS_C1 ), _mm_mul_ps( x2_, cosPoly_ ) );
+		const __m128 cos_( _mm_add_ps( _mm_sub_ps( _mm_set1_ps( 1.0f ), _mm_mul_ps( _mm_set1_ps( 0.5f ), x2_ ) ), _mm_mul_ps( _mm_mul_ps( x2_, x2_ ), cosPoly_ ) ) );
+
+		// Odd quadrant: swap sine & cosine
+		const __m128i one_( _mm_set1_epi32( 1 ) );
+		const __m128 swap_( _mm_castsi128_ps( _mm_cmpeq_epi32( _mm_and_si128( bits_, one_ ), one_ ) ) );
+		__m128 resultSin_( _mm_or_ps( _mm_and_ps( swap_, cos_ ), _mm_andnot_ps( swap_, sin_ ) ) );
+		__m128 resultCos_( _mm_or_ps( _mm_and_ps( swap_, sin_ ), _mm_andnot_ps( swap_, cos_ ) ) );
+
+		// Quadrants signs (bit #1 moved to the sign bit)
+		const __m128i two_( _mm_set1_epi32( 2 ) );
+		resultSin_ = _mm_xor_ps( resultSin_, _mm_castsi128_ps( _mm_slli_epi32( _mm_and_si128( bits_, two_ ), 30 ) ) );
+		resultCos_ = _mm_xor_ps( resultCos_, _mm_castsi128_ps( _mm_slli_epi32( _mm_and_si128( _mm_add_epi32( bits_, one_ ), two_ ), 30 ) ) );
+
+		// Linear part columns
+		_mm_store_ps( args_.xAxisX_ + i, _mm_mul_ps( resultCos_, scaleX_ ) );
+		_mm_store_ps( args_.xAxisY_ + i, _mm_mul_ps( resultSin_, scaleX_ ) );
+		_mm_store_ps( args_.yAxisX_ + i, _mm_xor_ps( _mm_mul_ps( resultSin_, scaleY_ ), _mm_set1_ps( -0.0f ) ) );
+		_mm_store_ps( args_.yAxisY_ + i, _mm_mul_ps( resultCos_, scaleY_ ) );
+
+	}
+
+	/* Builds transforms of 8 Sprites (AVX2) */
+	__c0de4un_target_avx2__ static inline void transformAVX2( const TransformArgs & args_, const uint32_t i ) noexcept
+	{
+
+		// Load
+		const __m256 rotation_( _mm256_load_ps( args_.rotation_ + i ) );
+		const __m256 scaleX_( _mm256_load_ps( args_.scaleX_ + i ) );
+		const __m256 scaleY_( _mm256_load_ps( args_.scaleY_ + i ) );
+
+		// Nearest quadrant
+		const __m256 biased_( _mm256_add_ps( _mm256_mul_ps( rotation_, _mm256_set1_ps( INV_QUADRANT ) ), _mm256_set1_ps( ROUND_MAGIC ) ) );
+		const __m256 quadrant_( _mm256_sub_ps( biased_, _mm256_set1_ps( ROUND_MAGIC ) ) );
+		const __m256i bits_( _mm256_castps_si256( biased_ ) );
+
+		// Reduced angle in radians
+		const __m256 x_( _mm256_mul_ps( _mm256_sub_ps( rotation_, _mm256_mul_ps( quadrant_, _mm256_set1_ps( QUADRANT ) ) ), _mm256_set1_ps( DEG_TO_RAD ) ) );
+		const __m256 x2_( _mm256_mul_ps( x_, x_ ) );
+
+		// Sine polynomial
+		__m256 sinPoly_( _mm256_add_ps( _mm256_set1_ps( SIN_C2 ), _mm256_mul_ps( x2_, _mm256_set1_ps( SIN_C3 ) ) ) );
+		sinPoly_ = _mm256_add_ps( _mm256_set1_ps( SIN_C1 ), _mm256_mul_ps( x2_, sinPoly_ ) );
+		const __m256 sin_( _mm256_add_ps( x_, _mm256_mul_ps( _mm256_mul_ps( x_, x2_ ), sinPoly_ ) ) );
+
+		// Cosine polynomial
+		__m256 cosPoly_( _mm256_add_ps( _mm256_set1_ps( COS_C2 ), _mm256_mul_ps( x2_, _mm256_set1_ps( COS_C3 ) ) ) );
+		cosPoly_ = _mm256_add_ps( _mm256_set1_ps( COS_C1 ), _mm256_mul_ps( x2_, cosPoly_ ) );
+		const __m256 cos_( _mm256_add_ps( _mm256_sub_ps( _mm256_set1_ps( 1.0f ), _mm256_mul_ps( _mm256_set1_ps( 0.5f ), x2_ ) ), _mm256_mul_ps( _mm256_mul_ps( x2_, x2_ ), cosPoly_ ) ) );
+
+		// Odd quadrant: swap sine & cosine
+		const __m256i one_( _mm256_set1_epi32( 1 ) );
+		const __m256 swap_( _mm256_castsi256_ps( _mm256_cmpeq_epi32( _mm256_and_si256( bits_, one_ ), one_ ) ) );
+		__m256 resultSin_( _mm256_blendv_ps( sin_, cos_, swap_ ) );
+		__m256 resultCos_( _mm256_blendv_ps( cos_, sin_, swap_ ) );
+
+		// Quadrants signs (bit #1 moved to the sign bit)
+		const __m256i two_( _mm256_set1_epi32( 2 ) );
+		resultSin_ = _mm256_xor_ps( resultSin_, _mm256_castsi256_ps( _mm256_slli_epi32( _mm256_and_si256( bits_, two_ ), 30 ) ) );
+		resultCos_ = _mm256_xor_ps( resultCos_, _mm256_castsi256_ps( _mm256_slli_epi32( _mm256_and_si256( _mm256_add_epi32( bits_, one_ ), two_ ), 30 ) ) );
+
+		// Linear part columns
+		_mm256_store_ps( args_.xAxisX_ + i, _mm256_mul_ps( resultCos_, scaleX_ ) );
+		_mm256_store_ps( args_.xAxisY_ + i, _mm256_mul_ps( resultSin_, scaleX_ ) );
+		_mm256_store_ps( args_.yAxisX_ + i, _mm256_xor_ps( _mm256_mul_ps( resultSin_, scaleY_ ), _mm256_set1_ps( -0.0f ) ) );
+		_mm256_store_ps( args_.yAxisY_ + i, _mm256_mul_ps( resultCos_, scaleY_ ) );
+
+	}
+
+	/* Builds transforms of 16 Sprites (AVX-512) */
+	__c0de4un_target_avx512__ static inline void transformAVX512( const TransformArgs & args_, const uint32_t i ) noexcept
+	{
+
+		// Load
+		const __m512 rotation_( _mm512_load_ps( args_.rotation_ + i ) );
+		const __m512 scaleX_( _mm512_load_ps( args_.scaleX_ + i ) );
+		const __m512 scaleY_( _mm512_load_ps( args_.scaleY_ + i ) );
+
+		// Nearest quadrant
+		const __m512 biased_( _mm512_add_ps( _mm512_mul_ps( rotation_, _mm512_set1_ps( INV_QUADRANT ) ), _mm512_set1_ps( ROUND_MAGIC ) ) );
+		const __m512 quadrant_( _mm512_sub_ps( biased_, _mm512_set1_ps( ROUND_MAGIC ) ) );
+		const __m512i bits_( _mm512_castps_si512( biased_ ) );
+
+		// Reduced angle in radians
+		const __m512 x_( _mm512_mul_ps( _mm512_sub_ps( rotation_, _mm512_mul_ps( quadrant_, _mm512_set1_ps( QUADRANT ) ) ), _mm512_set1_ps( DEG_TO_RAD ) ) );
+		const __m512 x2_( _mm512_mul_ps( x_, x_ ) );
+
+		// Sine polynomial
+		__m512 sinPoly_( _mm512_add_ps( _mm512_set1_ps( SIN_C2 ), _mm512_mul_ps( x2_, _mm512_set1_ps( SIN_C3 ) ) ) );
+		sinPoly_ = _mm512_add_ps( _mm512_set1_ps( SIN_C1 ), _mm512_mul_ps( x2_, sinPoly_ ) );
+		const __m512 sin_( _mm512_add_ps( x_, _mm512_mul_ps( _mm512_mul_ps( x_, x2_ ), sinPoly_ ) ) );
+
+		// Cosine polynomial
+		__m512 cosPoly_( _mm512_add_ps( _mm512_set1_ps( COS_C2 ), _mm512_mul_ps( x2_, _mm512_set1_ps( COS_C3 ) ) ) );
+		cosPoly_ = _mm512_add_ps( _mm512_set1_ps( COS_C1 ), _mm512_mul_ps( x2_, cosPoly_ ) );
+		const __m512 cos_( _mm512_add_ps( _mm512_sub_ps( _mm512_set1_ps( 1.0f ), _mm512_mul_ps( _mm512_set1_ps( 0.5f ), x2_ ) ), _mm512_mul_ps( _mm512_mul_ps( x2_, x2_ ), cosPoly_ ) ) );
+
+		// Odd quadrant: swap sine & cosine
+		const __m512i one_( _mm512_set1_epi32( 1 ) );
+		const __mmask16 swap_( _mm512_test_epi32_mask( bits_, one_ ) );
+		__m512 resultSin_( _mm512_mask_blend_ps( swap_, sin_, cos_ ) );
+		__m512 resultCos_( _mm512_mask_blend_ps( swap_, cos_, sin_ ) );
+
+		// Quadrants signs (bit #1 moved to the sign bit), zero-masked shift: unmasked one merges into undefined vector (GCC -Wmaybe-uninitialized)
+		const __m512i two_( _mm512_set1_epi32( 2 ) );
+		const __mmask16 all_( static_cast<__mmask16>( 0xFFFF ) );
+		resultSin_ = _mm512_castsi512_ps( _mm512_xor_epi32( _mm512_castps_si512( resultSin_ ), _mm512_maskz_slli_epi32( all_, _mm512_and_epi32( bits_, two_ ), 30 ) ) );
+		resultCos_ = _mm512_castsi512_ps( _mm512_xor_epi32( _mm512_castps_si512( resultCos_ ), _mm512_maskz_slli_epi32( all_, _mm512_and_epi32( _mm512_add_epi32( bits_, one_ ), two_ ), 30 ) ) );
+
+		// Y-axis x-component sign
+		const __m512i negSin_( _mm512_xor_epi32( _mm512_castps_si512( _mm512_mul_ps( resultSin_, scaleY_ ) ), _mm512_set1_epi32( static_cast<int>( 0x80000000u ) ) ) );
+
+		// Linear part columns
+		_mm512_store_ps( args_.xAxisX_ + i, _mm512_mul_ps( resultCos_, scaleX_ ) );
+		_mm512_store_ps( args_.xAxisY_ + i, _mm512_mul_ps( resultSin_, scaleX_ ) );
+		_mm512_store_ps( args_.yAxisX_ + i, _mm512_castsi512_ps( negSin_ ) );
+		_mm512_store_ps( args_.yAxisY_ + i, _mm512_mul_ps( resultCos_, scaleY_ ) );
+
+	}
+
+	/*
+	 * Builds transforms of changed Sprites [begin; end) (SSE2, 4 Sprites per iteration).
+	 *
+	 * @param args_ - arrays.
+	 * @param begin_ - first Sprite index, multiple of BLOCK_SIZE.
+	 * @param end_ - last Sprite index + 1.
+	*/
+	__c0de4un_target_sse2__ static void transformBlocksSSE2( const TransformArgs & args_, const uint32_t begin_, const uint32_t end_ ) noexcept
+	{
+
+		// Blocks
+		for ( uint32_t block_ = begin_; block_ < end_; block_ += TransformKernel::BLOCK_SIZE )
+		{
+
+			// Block changed bits
+			uint64_t & changed_ = args_.changed_[block_ / TransformKernel::BLOCK_SIZE];
+
+			// Skip unchanged block
+			if ( changed_ == 0 )
+				continue;
+
+			// Block end
+			const uint32_t blockEnd_( std::min( block_ + TransformKernel::BLOCK_SIZE, end_ ) );
+
+			// Sprite index
+			uint32_t i( block_ );
+
+			// 4 Sprites
+			for ( ; i + 4 <= blockEnd_; i += 4 )
+				transformSSE2( args_, i );
+
+			// Tail
+			for ( ; i < blockEnd_; i++ )
+				transformSprite( args_, i );
+
+			// Clear changed bits
+			changed_ = 0;
+
+		}
+
+	}
+
+	/*
+	 * Builds transforms of changed Sprites [begin; end) (AVX2, 8 Sprites per iteration).
+	 *
+	 * @param args_ - arrays.
+	 * @param begin_ - first Sprite index, multiple of BLOCK_SIZE.
+	 * @param end_ - last Sprite index + 1.
+	*/
+	__c0de4un_target_avx2__ static void transformBlocksAVX2( const TransformArgs & args_, const uint32_t begin_, const uint32_t end_ ) noexcept
+	{
+
+		// Blocks
+		for ( uint32_t block_ = begin_; block_ < end_; block_ += TransformKernel::BLOCK_SIZE )
+		{
+
+			// Block changed bits
+			uint64_t & changed_ = args_.changed_[block_ / TransformKernel::BLOCK_SIZE];
+
+			// Skip unchanged block
+			if ( changed_ == 0 )
+				continue;
+
+			// Block end
+			const uint32_t blockEnd_( std::min( block_ + TransformKernel::BLOCK_SIZE, end_ ) );
+
+			// Sprite index
+			uint32_t i( block_ );
+
+			// 8 Sprites
+			for ( ; i + 8 <= blockEnd_; i += 8 )
+				transformAVX2( args_, i );
+
+			// Tail
+			for ( ; i < blockEnd_; i++ )
+				transformSprite( args_, i );
+
+			// Clear changed bits
+			changed_ = 0;
+
+		}
+
+	}
+
+	/*
+	 * Builds transforms of changed Sprites [begin; end) (AVX-512, 16 Sprites per iteration).
+	 *
+	 * @param args_ - arrays.
+	 * @param begin_ - first Sprite index, multiple of BLOCK_SIZE.
+	 * @param end_ - last Sprite index + 1.
+	*/
+	__c0de4un_target_avx512__ static void transformBlocksAVX512( const TransformArgs & args_, const uint32_t begin_, const uint32_t end_ ) noexcept
+	{
+
+		// Blocks
+		for ( uint32_t block_ = begin_; block_ < end_; block_ += TransformKernel::BLOCK_SIZE )
+		{
+
+			// Block changed bits
+			uint64_t & changed_ = args_.changed_[block_ / TransformKernel::BLOCK_SIZE];
+
+			// Skip unchanged block
+			if ( changed_ == 0 )
+				continue;
+
+			// Block end
+			const uint32_t blockEnd_( std::min( block_ + TransformKernel::BLOCK_SIZE, end_ ) );
+
+			// Sprite index
+			uint32_t i( block_ );
+
+			// 16 Sprites
+			for ( ; i + 16 <= blockEnd_; i += 16 )
+				transformAVX512( args_, i );
+
+			// Tail
+			for ( ; i < blockEnd_; i++ )
+				transformSprite( args_, i );
+
+			// Clear changed bits
+			changed_ = 0;
+
+		}
+
+	}
+
+#endif // __c0de4un_x86__
+
+	// ===========================================================
+	// Getter & Setter
+	// ===========================================================
+
+	/*
+	 * Returns kernel function for the given instruction set.
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param isa_ - instruction set (MoveKernel::ISA_SCALAR, MoveKernel::ISA_SSE2, etc).
+	 * @return - kernel function, or scalar if not supported by build.
+	*/
+	const TransformKernel::function_t TransformKernel::getFunction( const unsigned char isa_ ) noexcept
+	{
+
+		// Select function
+		switch ( isa_ )
+		{
+		case MoveKernel::ISA_SSE2:
+			return( &TransformKernel::SSE2 );
+		case MoveKernel::ISA_AVX2:
+			return( &TransformKernel::AVX2 );
+		case MoveKernel::ISA_AVX512:
+			return( &TransformKernel::AVX512 );
+		default:
+			return( &TransformKernel::Scalar );
+		}
+
+	}
+
+	// ===========================================================
+	// Methods
+	// ===========================================================
+
+	/*
+	 * Run best kernel for this CPU (selected once).
+	 *
+	 * @thread_safety - thread-safe, if ranges not overlap.
+	 * @param args_ - arrays.
+	 * @param begin_ - first Sprite index, multiple of BLOCK_SIZE.
+	 * @param end_ - last Sprite index + 1.
+	*/
+	void TransformKernel::Run( const TransformArgs & args_, const uint32_t begin_, const uint32_t end_ ) noexcept
+	{
+
+		// Kernel function (C++ 11 guarantees thread-safe initialization)
+		static const function_t function_( getFunction( MoveKernel::getBestISA( ) ) );
+
+		// Run
+		function_( args_, begin_, end_ );
+
+	}
+
+	/* Scalar (reference) kernel */
+	void TransformKernel::Scalar( const TransformArgs & args_, const uint32_t begin_, const uint32_t end_ ) noexcept
+	{
+
+#ifdef DEBUG // DEBUG
+		assert( begin_ % BLOCK_SIZE == 0 );
+#endif // DEBUG
+
+		// Blocks
+		for ( uint32_t block_ = begin_; block_ < end_; block_ += BLOCK_SIZE )
+		{
+
+			// Block changed bits
+			uint64_t & changed_ = args_.changed_[block_ / BLOCK_SIZE];
+
+			// Skip unchanged block
+			if ( changed_ == 0 )
+				continue;
+
+			// Block end
+			const uint32_t blockEnd_( std::min( block_ + BLOCK_SIZE, end_ ) );
+
+			// Sprites
+			for ( uint32_t i = block_; i < blockEnd_; i++ )
+				transformSprite( args_, i );
+
+			// Clear changed bits
+			changed_ = 0;
+
+		}
+
+	}
+
+	/* SSE2 kernel, 4 Sprites per iteration */
+	void TransformKernel::SSE2( const TransformArgs & args_, const uint32_t begin_, const uint32_t end_ ) noexcept
+	{
+
+#ifdef DEBUG // DEBUG
+		assert( begin_ % BLOCK_SIZE == 0 );
+#endif // DEBUG
+
+#ifdef __c0de4un_x86__
+		// Run
+		transformBlocksSSE2( args_, begin_, end_ );
+#else
+		// Not supported
+		Scalar( args_, begin_, end_ );
+#endif // __c0de4un_x86__
+
+	}
+
+	/* AVX2 kernel, 8 Sprites per iteration */
+	void TransformKernel::AVX2( const TransformArgs & args_, const uint32_t begin_, const uint32_t end_ ) noexcept
+	{
+
+#ifdef DEBUG // DEBUG
+		assert( begin_ % BLOCK_SIZE == 0 );
+#endif // DEBUG
+
+#ifdef __c0de4un_x86__
+		// Run
+		transformBlocksAVX2( args_, begin_, end_ );
+#else
+		// Not supported
+		Scalar( args_, begin_, end_ );
+#endif // __c0de4un_x86__
+
+	}
+
+	/* AVX-512 kernel, 16 Sprites per iteration */
+	void TransformKernel::AVX512( const TransformArgs & args_, const uint32_t begin_, const uint32_t end_ ) noexcept
+	{
+
+#ifdef DEBUG // DEBUG
+		assert( begin_ % BLOCK_SIZE == 0 );
+#endif // DEBUG
+
+#ifdef __c0de4un_x86__
+		// Run
+		transformBlocksAVX512( args_, begin_, end_ );
+#else
+		// Not supported
+		Scalar( args_, begin_, end_ );
+#endif // __c0de4un_x86__
+
+	}
+
+	// -------------------------------------------------------- \\
+
+}
\ No newline at end of file
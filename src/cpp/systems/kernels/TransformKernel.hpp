@@ -0,0 +1,179 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_transform_kernel_hpp__
+#define __c0de4un_transform_kernel_hpp__
+
+// Include STL
+#include <cstdint> // uint32_t, uint64_t
+
+// TransformKernel declared
+#define __c0de4un_transform_kernel_decl__
+
+// Enable structure-data (fields, variables) alignment (by compilator) to 1 byte
+#pragma pack( push, 1 )
+
+namespace c0de4un
+{
+
+	/*
+	 * TransformArgs - SpriteStore arrays, passed to the TransformKernel.
+	 *
+	 * @version 1.0
+	*/
+	struct TransformArgs final
+	{
+
+		/* X-scales */
+		const float * scaleX_;
+
+		/* Y-scales */
+		const float * scaleY_;
+
+		/* Z-rotations (degrees) */
+		const float * rotation_;
+
+		/* Model X-axis, x-components ( cos * scaleX ) */
+		float * xAxisX_;
+
+		/* Model X-axis, y-components ( sin * scaleX ) */
+		float * xAxisY_;
+
+		/* Model Y-axis, x-components ( -sin * scaleY ) */
+		float * yAxisX_;
+
+		/* Model Y-axis, y-components ( cos * scaleY ) */
+		float * yAxisY_;
+
+		/* Transform-changed bitmask, one bit per Sprite (64 Sprites per word), cleared by kernel */
+		uint64_t * changed_;
+
+	};
+
+}
+
+// Restore structure-data alignment to default (8-byte on MSVC)
+#pragma pack( pop )
+
+namespace c0de4un
+{
+
+	/*
+	 * TransformKernel - builds 2D affine Model transforms (Z-rotation & scale) in closed form.
+	 *
+	 * Model = Translate * RotateZ * Scale, so linear part columns are
+	 * X-axis ( cos * sx, sin * sx ) & Y-axis ( -sin * sy, cos * sy ),
+	 * translation is Sprite position, so moving Sprite never dirties its transform.
+	 * Only blocks (64 Sprites) with transform-changed bits are processed, bits cleared.
+	 * Sine & cosine: degrees reduced to [-45; 45] by quadrant, then minimax polynomials.
+	 *
+	 * @features
+	 * - scalar reference path ;
+	 * - SSE2 (4), AVX2 (8) & AVX-512 (16 Sprites per iteration) paths ;
+	 * - run-time dispatch by CPU features ;
+	 * - max. error ~1e-7 relative to glm::rotate, |rotation| < 2^22 * 90 degrees ;
+	 *
+	 * @version 1.0
+	*/
+	class TransformKernel final
+	{
+
+	public:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Constants
+		// ===========================================================
+
+		/* Sprites per changed bitmask word */
+		static constexpr uint32_t BLOCK_SIZE = 64;
+
+		// ===========================================================
+		// Types
+		// ===========================================================
+
+		/*
+		 * Kernel function.
+		 *
+		 * @param args_ - arrays.
+		 * @param begin_ - first Sprite index, multiple of BLOCK_SIZE.
+		 * @param end_ - last Sprite index + 1.
+		*/
+		using function_t = void( * )( const TransformArgs & args_, const uint32_t begin_, const uint32_t end_ );
+
+		// ===========================================================
+		// Getter & Setter
+		// ===========================================================
+
+		/*
+		 * Returns kernel function for the given instruction set.
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param isa_ - instruction set (MoveKernel::ISA_SCALAR, MoveKernel::ISA_SSE2, etc).
+		 * @return - kernel function, or scalar if not supported by build.
+		*/
+		static const function_t getFunction( const unsigned char isa_ ) noexcept;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Run best kernel for this CPU (selected once).
+		 *
+		 * @thread_safety - thread-safe, if ranges not overlap.
+		 * @param args_ - arrays.
+		 * @param begin_ - first Sprite index, multiple of BLOCK_SIZE.
+		 * @param end_ - last Sprite index + 1.
+		*/
+		static void Run( const TransformArgs & args_, const uint32_t begin_, const uint32_t end_ ) noexcept;
+
+		/* Scalar (reference) kernel */
+		static void Scalar( const TransformArgs & args_, const uint32_t begin_, const uint32_t end_ ) noexcept;
+
+		/* SSE2 kernel, 4 Sprites per iteration */
+		static void SSE2( const TransformArgs & args_, const uint32_t begin_, const uint32_t end_ ) noexcept;
+
+		/* AVX2 kernel, 8 Sprites per iteration */
+		static void AVX2( const TransformArgs & args_, const uint32_t begin_, const uint32_t end_ ) noexcept;
+
+		/* AVX-512 kernel, 16 Sprites per iteration */
+		static void AVX512( const TransformArgs & args_, const uint32_t begin_, const uint32_t end_ ) noexcept;
+
+		// -------------------------------------------------------- \\
+
+	private:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Deleted
+		// ===========================================================
+
+		/* @deleted TransformKernel constructor */
+		TransformKernel( ) = delete;
+
+		/* @deleted TransformKernel const copy constructor */
+		TransformKernel( const TransformKernel & ) = delete;
+
+		/* @deleted TransformKernel const copy assignment operator */
+		TransformKernel & operator=( const TransformKernel & ) = delete;
+
+		/* @deleted TransformKernel move constructor */
+		TransformKernel( TransformKernel && ) = delete;
+
+		/* @deleted TransformKernel move assignment operator */
+		TransformKernel & operator=( TransformKernel && ) = delete;
+
+		// -------------------------------------------------------- \\
+
+	};
+
+}
+
+#endif // !__c0de4un_transform_kernel_hpp__
\ No newline at end of file
@@ -0,0 +1,575 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+/*
+ * MoveKernel conformance test.
+ *
+ * SSE2, AVX2 & AVX-512 kernels (those supported by the CPU) run against the Scalar (reference) one
+ * on the same data, for every Sprites count in [0; MAX_SPRITES] (SIMD iterations, tails & partial blocks),
+ * several steps in a row (bounces), both in one range & split in ranges (job chunks).
+ * Positions, velocities & changed bitmask must be bit-identical (+0/-0 velocities included).
+ * Scalar kernel itself checked against the pre-SoA SpriteSystem::Update (glm::vec3 branches, copied below),
+ * Sprites exactly on the borders included.
+ *
+ * Usage: gl_sprite_move_kernel_test
+*/
+
+// Include STL
+#include <iostream> // cout
+#include <cstdlib> // EXIT_SUCCESS, EXIT_FAILURE
+#include <cstring> // memcmp, memcpy, memset
+#include <cstdint> // uint32_t, uint64_t
+#include <new> // align_val_t
+#include <string> // string, to_string
+#include <vector> // vector
+
+// Include MoveKernel
+#ifndef __c0de4un_move_kernel_hpp__
+#include "../systems/kernels/MoveKernel.hpp"
+#endif // !__c0de4un_move_kernel_hpp__
+
+// Include CPUInfo
+#ifndef __c0de4un_cpu_info_hpp__
+#include "../utils/cpu/CPUInfo.hpp"
+#endif // !__c0de4un_cpu_info_hpp__
+
+// Include glm
+#ifndef __c0de4un_glm_hpp__
+#include "../cfg/glm.hpp"
+#endif // !__c0de4un_glm_hpp__
+
+/* Max. Sprites count tested */
+static const uint32_t MAX_SPRITES = 4099;
+
+/* Steps per Sprites count */
+static const uint32_t STEPS_COUNT = 8;
+
+/* World size */
+static const float WORLD_WIDTH = 1280.0f, WORLD_HEIGHT = 720.0f;
+
+/* World size, as SpriteSystem stores it */
+static const unsigned int WORLD_WIDTH_UINT = 1280, WORLD_HEIGHT_UINT = 720;
+
+/* Arrays alignment in bytes (SpriteStore::ALIGNMENT) */
+static const std::size_t ALIGNMENT = 64;
+
+/* Sprites arrays, aligned as SpriteStore ones */
+struct MoveData final
+{
+
+	/* X-positions */
+	float * posX_;
+
+	/* Y-positions */
+	float * posY_;
+
+	/* X-velocities */
+	float * velX_;
+
+	/* Y-velocities */
+	float * velY_;
+
+	/* X-sizes */
+	float * sizeX_;
+
+	/* Y-sizes */
+	float * sizeY_;
+
+	/* Changed bitmask */
+	uint64_t * changed_;
+
+};
+
+/* Allocates aligned array */
+template <typename T>
+static T * allocateArray( const uint32_t count_ )
+{ return( static_cast<T*>( ::operator new( sizeof( T ) * ( count_ > 0 ? count_ : 1 ), std::align_val_t( ALIGNMENT ) ) ) ); }
+
+/* Releases aligned array */
+static void releaseArray( void *const pArray ) noexcept
+{ ::operator delete( pArray, std::align_val_t( ALIGNMENT ) ); }
+
+/* Allocates Sprites arrays */
+static void allocateData( MoveData & data_ )
+{
+
+	data_.posX_ = allocateArray<float>( MAX_SPRITES );
+	data_.posY_ = allocateArray<float>( MAX_SPRITES );
+	data_.velX_ = allocateArray<float>( MAX_SPRITES );
+	data_.velY_ = allocateArray<float>( MAX_SPRITES );
+	data_.sizeX_ = allocateArray<float>( MAX_SPRITES );
+	data_.sizeY_ = allocateArray<float>( MAX_SPRITES );
+	data_.changed_ = allocateArray<uint64_t>( MAX_SPRITES / c0de4un::MoveKernel::BLOCK_SIZE + 1 );
+
+}
+
+/* Releases Sprites arrays */
+static void releaseData( MoveData & data_ ) noexcept
+{
+
+	releaseArray( data_.posX_ );
+	releaseArray( data_.posY_ );
+	releaseArray( data_.velX_ );
+	releaseArray( data_.velY_ );
+	releaseArray( data_.sizeX_ );
+	releaseArray( data_.sizeY_ );
+	releaseArray( data_.changed_ );
+
+}
+
+/* Copies Sprites arrays */
+static void copyData( const MoveData & source_, MoveData & target_, const uint32_t count_ ) noexcept
+{
+
+	std::memcpy( target_.posX_, source_.posX_, sizeof( float ) * count_ );
+	std::memcpy( target_.posY_, source_.posY_, sizeof( float ) * count_ );
+	std::memcpy( target_.velX_, source_.velX_, sizeof( float ) * count_ );
+	std::memcpy( target_.velY_, source_.velY_, sizeof( float ) * count_ );
+	std::memcpy( target_.sizeX_, source_.sizeX_, sizeof( float ) * count_ );
+	std::memcpy( target_.sizeY_, source_.sizeY_, sizeof( float ) * count_ );
+
+}
+
+/* Deterministic random numbers (xorshift32), same data on every run */
+static uint32_t nextRandom( uint32_t & state_ ) noexcept
+{
+
+	state_ ^= state_ << 13;
+	state_ ^= state_ >> 17;
+	state_ ^= state_ << 5;
+
+	return( state_ );
+
+}
+
+/*
+ * Generates velocity, +0/-0 & border-sized ones included.
+ *
+ * @param state_ - random state.
+ * @param world_ - world size.
+*/
+static float generateVelocity( uint32_t & state_, const float world_ ) noexcept
+{
+
+	switch ( nextRandom( state_ ) % 8 )
+	{
+	case 0:
+		return( 0.0f );
+	case 1:
+		return( -0.0f );
+	case 2: // Crosses the world in one step
+		return( ( nextRandom( state_ ) % 2 == 0 ? 1.0f : -1.0f ) * world_ );
+	default: // [-16; 16), 1/16 steps
+		return( static_cast<float>( static_cast<int>( nextRandom( state_ ) % 512 ) - 256 ) / 16.0f );
+	}
+
+}
+
+/*
+ * Generates position, border-touching ones included.
+ *
+ * @param state_ - random state.
+ * @param vel_ - velocity.
+ * @param size_ - size.
+ * @param world_ - world size.
+*/
+static float generatePosition( uint32_t & state_, const float vel_, const float size_, const float world_ ) noexcept
+{
+
+	switch ( nextRandom( state_ ) % 10 )
+	{
+	case 0: // Right/top border reached exactly after the step
+		return( world_ - size_ - vel_ );
+	case 1: // Left/bottom border reached exactly after the step
+		return( size_ + vel_ );
+	case 2: // Outside of the world
+		return( nextRandom( state_ ) % 2 == 0 ? -size_ : world_ + size_ );
+	case 3: // On the right/top border
+		return( world_ - size_ );
+	case 4: // On the left/bottom border
+		return( size_ );
+	default: // Inside of the world
+		return( static_cast<float>( nextRandom( state_ ) % static_cast<uint32_t>( world_ * 4.0f ) ) / 4.0f );
+	}
+
+}
+
+/*
+ * Generates Sprites.
+ *
+ * @param data_ - Sprites arrays.
+ * @param count_ - Sprites count.
+ * @param seed_ - random seed, not 0.
+*/
+static void generateData( MoveData & data_, const uint32_t count_, uint32_t seed_ ) noexcept
+{
+
+	for ( uint32_t i = 0; i < count_; i++ )
+	{
+
+		data_.sizeX_[i] = static_cast<float>( 1 + nextRandom( seed_ ) % 256 ) / 4.0f;
+		data_.sizeY_[i] = static_cast<float>( 1 + nextRandom( seed_ ) % 256 ) / 4.0f;
+		data_.velX_[i] = generateVelocity( seed_, WORLD_WIDTH );
+		data_.velY_[i] = generateVelocity( seed_, WORLD_HEIGHT );
+		data_.posX_[i] = generatePosition( seed_, data_.velX_[i], data_.sizeX_[i], WORLD_WIDTH );
+		data_.posY_[i] = generatePosition( seed_, data_.velY_[i], data_.sizeY_[i], WORLD_HEIGHT );
+
+	}
+
+}
+
+/*
+ * Runs one step of the kernel.
+ *
+ * @param function_ - kernel function.
+ * @param data_ - Sprites arrays.
+ * @param count_ - Sprites count.
+ * @param rangeBlocks_ - blocks per range, 0 for one range.
+*/
+static void runStep( const c0de4un::MoveKernel::function_t function_, MoveData & data_, const uint32_t count_, const uint32_t rangeBlocks_ ) noexcept
+{
+
+	// Changed bitmask cleared each step (SpriteSystem::Update)
+	const uint32_t blocksCount_( ( count_ + c0de4un::MoveKernel::BLOCK_SIZE - 1 ) / c0de4un::MoveKernel::BLOCK_SIZE );
+	std::memset( data_.changed_, 0, sizeof( uint64_t ) * ( blocksCount_ > 0 ? blocksCount_ : 1 ) );
+
+	// Arguments
+	const c0de4un::MoveArgs args_{ data_.posX_, data_.posY_, data_.velX_, data_.velY_, data_.sizeX_, data_.sizeY_, data_.changed_, WORLD_WIDTH, WORLD_HEIGHT };
+
+	// One range
+	if ( rangeBlocks_ == 0 )
+	{
+		function_( args_, 0, count_ );
+		return;
+	}
+
+	// Ranges (job chunks)
+	const uint32_t rangeSize_( rangeBlocks_ * c0de4un::MoveKernel::BLOCK_SIZE );
+	for ( uint32_t begin_ = 0; begin_ < count_; begin_ += rangeSize_ )
+		function_( args_, begin_, count_ - begin_ < rangeSize_ ? count_ : begin_ + rangeSize_ );
+
+}
+
+/*
+ * Runs one step of the SpriteSystem::Update before SoA (SpriteStore) & kernels, copied as is:
+ * glm::vec3 per Sprite, unsigned world size, 'stateChanged_' per Sprite.
+ *
+ * @param data_ - Sprites arrays.
+ * @param count_ - Sprites count.
+ * @param mWorldWidth - world width.
+ * @param mWorldHeight - world height.
+ * @param stateChanged_ - output 'stateChanged_' flags.
+*/
+static void runBaselineStep( MoveData & data_, const uint32_t count_, const unsigned int mWorldWidth, const unsigned int mWorldHeight, std::vector<bool> & stateChanged_ )
+{
+
+	stateChanged_.assign( count_, false );
+
+	for ( uint32_t i = 0; i < count_; i++ )
+	{
+
+		// Sprite vectors
+		glm::vec3 posVec_( data_.posX_[i], data_.posY_[i], 0.0f );
+		glm::vec3 velVec_( data_.velX_[i], data_.velY_[i], 0.0f );
+		const glm::vec3 sizeVec_( data_.sizeX_[i], data_.sizeY_[i], 0.0f );
+
+		// X-axis
+		if ( velVec_.x > 0 )
+		{// +X
+
+			// Move right
+			if ( ( posVec_.x + velVec_.x ) < ( mWorldWidth - sizeVec_.x ) )
+			{
+				posVec_.x += velVec_.x;
+				stateChanged_[i] = true;
+			}
+			else // Right Border Reached
+				velVec_.x = velVec_.x * -1;
+
+		}
+		else
+		{// -X
+
+			// Move left
+			if ( ( posVec_.x - velVec_.x ) > ( sizeVec_.x ) )
+			{
+				posVec_.x += velVec_.x;
+				stateChanged_[i] = true;
+			}
+			else // Left Border Reached
+				velVec_.x = velVec_.x * -1;
+
+		}
+
+		// Y-axis
+		if ( velVec_.y > 0 )
+		{// +Y
+
+			// Move Up
+			if ( ( posVec_.y + velVec_.y ) < ( mWorldHeight - sizeVec_.y ) )
+			{
+				posVec_.y += velVec_.y;
+				stateChanged_[i] = true;
+			}
+			else // Top Border Reached
+				velVec_.y = velVec_.y * -1;
+
+		}
+		else
+		{// -Y (Down)
+
+			// Move down
+			if ( ( posVec_.y - velVec_.y ) > ( sizeVec_.y ) )
+			{
+				posVec_.y += velVec_.y;
+				stateChanged_[i] = true;
+			}
+			else // Bottom Border Reached
+				velVec_.y = velVec_.y * -1;
+
+		}
+
+		// Store
+		data_.posX_[i] = posVec_.x;
+		data_.posY_[i] = posVec_.y;
+		data_.velX_[i] = velVec_.x;
+		data_.velY_[i] = velVec_.y;
+
+	}
+
+}
+
+/*
+ * Compares 'changed' bitmask of the kernel with the baseline 'stateChanged_' flags.
+ *
+ * @param changed_ - kernel bitmask.
+ * @param stateChanged_ - baseline flags.
+ * @param error_ - description of the first mismatch.
+ * @return - 'true' if same.
+*/
+static bool compareChanged( const uint64_t *const changed_, const std::vector<bool> & stateChanged_, std::string & error_ )
+{
+
+	for ( uint32_t i = 0; i < stateChanged_.size( ); i++ )
+	{
+
+		const bool bit_( ( ( changed_[i / c0de4un::MoveKernel::BLOCK_SIZE] >> ( i % c0de4un::MoveKernel::BLOCK_SIZE ) ) & 1 ) != 0 );
+		if ( bit_ != stateChanged_[i] )
+		{
+
+			error_ = "changed[";
+			error_ += std::to_string( i );
+			error_ += "]: expected ";
+			error_ += stateChanged_[i] ? "1" : "0";
+
+			return( false );
+
+		}
+
+	}
+
+	return( true );
+
+}
+
+/*
+ * Compares array of the kernel with the reference one.
+ *
+ * @param name_ - array name.
+ * @param reference_ - Scalar kernel array.
+ * @param result_ - tested kernel array.
+ * @param count_ - elements count.
+ * @param error_ - description of the first mismatch.
+ * @return - 'true' if bit-identical.
+*/
+template <typename T>
+static bool compareArray( const char *const name_, const T *const reference_, const T *const result_, const uint32_t count_, std::string & error_ )
+{
+
+	// Identical
+	if ( count_ == 0 || std::memcmp( reference_, result_, sizeof( T ) * count_ ) == 0 )
+		return( true );
+
+	// First mismatch
+	for ( uint32_t i = 0; i < count_; i++ )
+	{
+
+		if ( std::memcmp( &reference_[i], &result_[i], sizeof( T ) ) != 0 )
+		{
+
+			error_ = name_;
+			error_ += "[";
+			error_ += std::to_string( i );
+			error_ += "]: expected ";
+			error_ += std::to_string( reference_[i] );
+			error_ += ", got ";
+			error_ += std::to_string( result_[i] );
+
+			return( false );
+
+		}
+
+	}
+
+	return( true );
+
+}
+
+/* Tested kernel: instruction set & range split */
+struct MoveVariant final
+{
+
+	/* Instruction set */
+	unsigned char isa_;
+
+	/* Kernel function */
+	c0de4un::MoveKernel::function_t function_;
+
+	/* Blocks per range, 0 for one range */
+	uint32_t rangeBlocks_;
+
+	/* Sprites arrays */
+	MoveData data_;
+
+	/* 'true' if failed, not run anymore */
+	bool failed_;
+
+};
+
+int main( int, char *[] )
+{
+
+	// Instruction sets supported by the CPU
+	const bool supported_[] = { c0de4un::CPUInfo::hasSSE2( ), c0de4un::CPUInfo::hasAVX2( ), c0de4un::CPUInfo::hasAVX512F( ) };
+	const unsigned char isas_[] = { c0de4un::MoveKernel::ISA_SSE2, c0de4un::MoveKernel::ISA_AVX2, c0de4un::MoveKernel::ISA_AVX512 };
+
+	// Ranges: one, 1 block & 3 blocks per range
+	const uint32_t rangesBlocks_[] = { 0, 1, 3 };
+
+	// Variants
+	std::vector<MoveVariant> variants_;
+	for ( uint32_t i = 0; i < sizeof( isas_ ) / sizeof( isas_[0] ); i++ )
+	{
+
+		if ( !supported_[i] )
+		{
+			std::cout << "move_kernel_test - " << c0de4un::MoveKernel::getISAName( isas_[i] ) << " not supported by CPU, skipped" << std::endl;
+			continue;
+		}
+
+		for ( const uint32_t rangeBlocks_ : rangesBlocks_ )
+		{
+			MoveVariant variant_{ isas_[i], c0de4un::MoveKernel::getFunction( isas_[i] ), rangeBlocks_, MoveData( ), false };
+			allocateData( variant_.data_ );
+			variants_.push_back( variant_ );
+		}
+
+	}
+
+	// Scalar (reference) arrays
+	MoveData reference_;
+	allocateData( reference_ );
+	const c0de4un::MoveKernel::function_t scalar_( c0de4un::MoveKernel::getFunction( c0de4un::MoveKernel::ISA_SCALAR ) );
+
+	// Baseline SpriteSystem::Update arrays & flags, Scalar checked against it
+	MoveData baseline_;
+	allocateData( baseline_ );
+	std::vector<bool> stateChanged_;
+	bool scalarFailed_( false );
+
+	// Sprites counts
+	for ( uint32_t count_ = 0; count_ <= MAX_SPRITES; count_++ )
+	{
+
+		const uint32_t blocksCount_( ( count_ + c0de4un::MoveKernel::BLOCK_SIZE - 1 ) / c0de4un::MoveKernel::BLOCK_SIZE );
+
+		// Same Sprites for all kernels
+		generateData( reference_, count_, 0x9E3779B9u ^ count_ );
+		copyData( reference_, baseline_, count_ );
+		for ( MoveVariant & variant_ : variants_ )
+			copyData( reference_, variant_.data_, count_ );
+
+		// Steps
+		for ( uint32_t step_ = 0; step_ < STEPS_COUNT; step_++ )
+		{
+
+			runStep( scalar_, reference_, count_, 0 );
+
+			// Scalar against the baseline
+			if ( !scalarFailed_ )
+			{
+
+				runBaselineStep( baseline_, count_, WORLD_WIDTH_UINT, WORLD_HEIGHT_UINT, stateChanged_ );
+
+				std::string error_;
+				if ( !compareArray( "posX", baseline_.posX_, reference_.posX_, count_, error_ )
+					|| !compareArray( "posY", baseline_.posY_, reference_.posY_, count_, error_ )
+					|| !compareArray( "velX", baseline_.velX_, reference_.velX_, count_, error_ )
+					|| !compareArray( "velY", baseline_.velY_, reference_.velY_, count_, error_ )
+					|| !compareChanged( reference_.changed_, stateChanged_, error_ ) )
+				{
+
+					std::cout << "move_kernel_test - Scalar FAILED against baseline Update: sprites " << count_
+						<< ", step " << step_ << ", " << error_ << std::endl;
+
+					scalarFailed_ = true;
+
+				}
+
+			}
+
+			for ( MoveVariant & variant_ : variants_ )
+			{
+
+				if ( variant_.failed_ )
+					continue;
+
+				runStep( variant_.function_, variant_.data_, count_, variant_.rangeBlocks_ );
+
+				std::string error_;
+				if ( !compareArray( "posX", reference_.posX_, variant_.data_.posX_, count_, error_ )
+					|| !compareArray( "posY", reference_.posY_, variant_.data_.posY_, count_, error_ )
+					|| !compareArray( "velX", reference_.velX_, variant_.data_.velX_, count_, error_ )
+					|| !compareArray( "velY", reference_.velY_, variant_.data_.velY_, count_, error_ )
+					|| !compareArray( "changed", reference_.changed_, variant_.data_.changed_, blocksCount_, error_ ) )
+				{
+
+					std::cout << "move_kernel_test - " << c0de4un::MoveKernel::getISAName( variant_.isa_ ) << " FAILED: sprites " << count_
+						<< ", blocks per range " << variant_.rangeBlocks_ << ", step " << step_ << ", " << error_ << std::endl;
+
+					variant_.failed_ = true;
+
+				}
+
+			}
+
+		}
+
+	}
+
+	// Result
+	bool result_( !scalarFailed_ );
+	if ( !scalarFailed_ )
+		std::cout << "move_kernel_test - Scalar, baseline Update OK" << std::endl;
+	for ( MoveVariant & variant_ : variants_ )
+	{
+
+		if ( !variant_.failed_ )
+			std::cout << "move_kernel_test - " << c0de4un::MoveKernel::getISAName( variant_.isa_ ) << ", blocks per range " << variant_.rangeBlocks_ << " OK" << std::endl;
+
+		result_ = result_ && !variant_.failed_;
+		releaseData( variant_.data_ );
+
+	}
+
+	releaseData( reference_ );
+	releaseData( baseline_ );
+
+	// Return
+	return( result_ ? EXIT_SUCCESS : EXIT_FAILURE );
+
+}
\ No newline at end of file
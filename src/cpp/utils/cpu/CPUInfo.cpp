@@ -0,0 +1,179 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+// HEADER
+#ifndef __c0de4un_cpu_info_hpp__
+#include "CPUInfo.hpp"
+#endif // !__c0de4un_cpu_info_hpp__
+
+// Include simd
+#ifndef __c0de4un_simd_hpp__
+#include "../../cfg/simd.hpp"
+#endif // !__c0de4un_simd_hpp__
+
+// Include STL
+#include <cstdint> // uint32_t, uint64_t
+
+namespace c0de4un
+{
+
+	// -------------------------------------------------------- \\
+
+#ifdef __c0de4un_x86__
+
+	// ===========================================================
+	// Utils
+	// ===========================================================
+
+	/*
+	 * Executes CPUID instruction.
+	 *
+	 * @param leaf_ - CPUID leaf (EAX).
+	 * @param subLeaf_ - CPUID sub-leaf (ECX).
+	 * @param pRegisters - EAX, EBX, ECX, EDX output.
+	 * @return - 'false' if leaf not supported.
+	*/
+	static const bool cpuid( const uint32_t leaf_, const uint32_t subLeaf_, uint32_t (&pRegisters)[4] ) noexcept
+	{
+
+#ifdef _MSC_VER // MSVC
+
+		// Max. supported leaf
+		int registers_[4];
+		__cpuid( registers_, static_cast<int>( leaf_ & 0x80000000 ) );
+		if ( static_cast<uint32_t>( registers_[0] ) < leaf_ )
+			return( false );
+
+		// Query leaf
+		__cpuidex( registers_, static_cast<int>( leaf_ ), static_cast<int>( subLeaf_ ) );
+		for ( unsigned char i = 0; i < 4; i++ )
+			pRegisters[i] = static_cast<uint32_t>( registers_[i] );
+
+		// Return OK
+		return( true );
+
+#else // GCC, Clang
+
+		// Query leaf (returns 0, if leaf not supported)
+		return( __get_cpuid_count( leaf_, subLeaf_, &pRegisters[0], &pRegisters[1], &pRegisters[2], &pRegisters[3] ) != 0 );
+
+#endif // _MSC_VER
+
+	}
+
+	/*
+	 * Returns XCR0 register (OS-enabled registers state).
+	 * OSXSAVE must be checked before call.
+	*/
+	static const uint64_t xgetbv0( ) noexcept
+	{
+
+#ifdef _MSC_VER // MSVC
+		return( _xgetbv( 0 ) );
+#else // GCC, Clang
+		uint32_t eax_( 0 ), edx_( 0 );
+		__asm__ volatile( "xgetbv" : "=a"( eax_ ), "=d"( edx_ ) : "c"( 0 ) );
+		return( ( static_cast<uint64_t>( edx_ ) << 32 ) | eax_ );
+#endif // _MSC_VER
+
+	}
+
+#endif // __c0de4un_x86__
+
+	// ===========================================================
+	// Constructor & destructor
+	// ===========================================================
+
+	/* CPUInfo constructor, detects instruction sets */
+	CPUInfo::CPUInfo( ) noexcept
+		: mSSE2( false ),
+		mAVX2( false ),
+		mAVX512F( false )
+	{
+
+#ifdef __c0de4un_x86__
+
+		// CPUID registers
+		uint32_t registers_[4]{ 0, 0, 0, 0 };
+
+		// Features leaf
+		if ( !cpuid( 1, 0, registers_ ) )
+			return;
+
+		// SSE2 (EDX bit 26)
+		mSSE2 = ( registers_[3] & ( 1u << 26 ) ) != 0;
+
+		// OSXSAVE (ECX bit 27) & AVX (ECX bit 28)
+		if ( ( registers_[2] & ( 1u << 27 ) ) == 0 || ( registers_[2] & ( 1u << 28 ) ) == 0 )
+			return;
+
+		// OS saves XMM & YMM registers
+		const uint64_t xcr0_( xgetbv0( ) );
+		if ( ( xcr0_ & 0x6 ) != 0x6 )
+			return;
+
+		// Extended features leaf
+		if ( !cpuid( 7, 0, registers_ ) )
+			return;
+
+		// AVX2 (EBX bit 5)
+		mAVX2 = ( registers_[1] & ( 1u << 5 ) ) != 0;
+
+		// AVX-512F (EBX bit 16), OS saves opmask & ZMM registers
+		mAVX512F = ( registers_[1] & ( 1u << 16 ) ) != 0 && ( xcr0_ & 0xE6 ) == 0xE6;
+
+#endif // __c0de4un_x86__
+
+	}
+
+	// ===========================================================
+	// Getter & Setter
+	// ===========================================================
+
+	/*
+	 * Returns CPUInfo instance, detected once.
+	 *
+	 * @thread_safety - thread-safe.
+	*/
+	const CPUInfo & CPUInfo::getInstance( ) noexcept
+	{
+
+		// Instance (C++ 11 guarantees thread-safe initialization)
+		static const CPUInfo instance_;
+
+		// Return instance
+		return( instance_ );
+
+	}
+
+	/*
+	 * Returns 'true' if SSE2 supported.
+	 *
+	 * @thread_safety - thread-safe.
+	*/
+	const bool CPUInfo::hasSSE2( ) noexcept
+	{ return( getInstance( ).mSSE2 ); }
+
+	/*
+	 * Returns 'true' if AVX2 supported.
+	 *
+	 * @thread_safety - thread-safe.
+	*/
+	const bool CPUInfo::hasAVX2( ) noexcept
+	{ return( getInstance( ).mAVX2 ); }
+
+	/*
+	 * Returns 'true' if AVX-512 Foundation supported.
+	 *
+	 * @thread_safety - thread-safe.
+	*/
+	const bool CPUInfo::hasAVX512F( ) noexcept
+	{ return( getInstance( ).mAVX512F ); }
+
+	// -------------------------------------------------------- \\
+
+}
\ No newline at end of file
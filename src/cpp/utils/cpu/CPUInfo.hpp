@@ -0,0 +1,114 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_cpu_info_hpp__
+#define __c0de4un_cpu_info_hpp__
+
+// CPUInfo declared
+#define __c0de4un_cpu_info_decl__
+
+namespace c0de4un
+{
+
+	/*
+	 * CPUInfo - utility-class to detect CPU instruction sets at run-time.
+	 * Checks both CPU support (CPUID) & OS support (XGETBV) of the extended registers.
+	 *
+	 * @version 1.0
+	*/
+	class CPUInfo final
+	{
+
+	public:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Getter & Setter
+		// ===========================================================
+
+		/*
+		 * Returns 'true' if SSE2 supported.
+		 *
+		 * @thread_safety - thread-safe.
+		*/
+		static const bool hasSSE2( ) noexcept;
+
+		/*
+		 * Returns 'true' if AVX2 supported.
+		 *
+		 * @thread_safety - thread-safe.
+		*/
+		static const bool hasAVX2( ) noexcept;
+
+		/*
+		 * Returns 'true' if AVX-512 Foundation supported.
+		 *
+		 * @thread_safety - thread-safe.
+		*/
+		static const bool hasAVX512F( ) noexcept;
+
+		// -------------------------------------------------------- \\
+
+	private:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Fields
+		// ===========================================================
+
+		/* SSE2 flag */
+		bool mSSE2;
+
+		/* AVX2 flag */
+		bool mAVX2;
+
+		/* AVX-512F flag */
+		bool mAVX512F;
+
+		// ===========================================================
+		// Constructor & destructor
+		// ===========================================================
+
+		/* CPUInfo constructor, detects instruction sets */
+		explicit CPUInfo( ) noexcept;
+
+		// ===========================================================
+		// Getter & Setter
+		// ===========================================================
+
+		/*
+		 * Returns CPUInfo instance, detected once.
+		 *
+		 * @thread_safety - thread-safe.
+		*/
+		static const CPUInfo & getInstance( ) noexcept;
+
+		// ===========================================================
+		// Deleted
+		// ===========================================================
+
+		/* @deleted CPUInfo const copy constructor */
+		CPUInfo( const CPUInfo & ) = delete;
+
+		/* @deleted CPUInfo const copy assignment operator */
+		CPUInfo & operator=( const CPUInfo & ) = delete;
+
+		/* @deleted CPUInfo move constructor */
+		CPUInfo( CPUInfo && ) = delete;
+
+		/* @deleted CPUInfo move assignment operator */
+		CPUInfo & operator=( CPUInfo && ) = delete;
+
+		// -------------------------------------------------------- \\
+
+	};
+
+}
+
+#endif // !__c0de4un_cpu_info_hpp__
\ No newline at end of file
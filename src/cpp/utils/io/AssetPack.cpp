@@ -0,0 +1,497 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+// HEADER
+#ifndef __c0de4un_asset_pack_hpp__
+#include "AssetPack.hpp"
+#endif // !__c0de4un_asset_pack_hpp__
+
+// Include InputFile
+#ifndef __c0de4un_input_file_hpp__
+#include "InputFile.hpp"
+#endif // !__c0de4un_input_file_hpp__
+
+// Include FileUtils
+#ifndef __c0de4un_file_utils_hpp__
+#include "FileUtils.hpp"
+#endif // !__c0de4un_file_utils_hpp__
+
+// Include Log
+#ifndef __c0de4un_log_hpp__
+#include "../log/Log.hpp"
+#endif // !__c0de4un_log_hpp__
+
+// Include zlib
+#include <zlib.h>
+
+// Include STL
+#include <algorithm> // sort, replace
+#include <atomic> // atomic
+#include <fstream> // ofstream
+
+namespace c0de4un
+{
+
+	// -------------------------------------------------------- \\
+
+	/* Mounted AssetPack */
+	static std::atomic<const AssetPack*> mountedPack_( nullptr );
+
+	// ===========================================================
+	// Constructor & destructor
+	// ===========================================================
+
+	/* AssetPack constructor */
+	AssetPack::AssetPack( ) noexcept
+		: mFile( ),
+		mRoot( ),
+		mEntries( nullptr ),
+		mEntriesCount( 0 ),
+		mNames( nullptr )
+	{
+	}
+
+	/* AssetPack destructor, must not be mounted */
+	AssetPack::~AssetPack( )
+	{
+
+#ifdef DEBUG // DEBUG
+		// Check mount
+		if ( mountedPack_.load( std::memory_order_acquire ) == this )
+			Log::printError( "AssetPack::destructor - still mounted !" );
+#endif // DEBUG
+
+		// Unmap
+		Close( );
+
+	}
+
+	// ===========================================================
+	// Getter & Setter
+	// ===========================================================
+
+	/*
+	 * Returns mounted AssetPack, or null.
+	 *
+	 * @thread_safety - thread-safe.
+	*/
+	const AssetPack *const AssetPack::getMounted( ) noexcept
+	{ return( mountedPack_.load( std::memory_order_acquire ) ); }
+
+	/*
+	 * Mounts AssetPack, used by all InputFile streams opened later.
+	 *
+	 * @thread_safety - thread-safe, pack must live until unmounted (null).
+	 * @param assetPack_ - opened AssetPack, or null to unmount.
+	*/
+	void AssetPack::Mount( const AssetPack *const assetPack_ ) noexcept
+	{ mountedPack_.store( assetPack_, std::memory_order_release ); }
+
+	/* Returns entries count */
+	const uint32_t AssetPack::getEntriesCount( ) const noexcept
+	{ return( mEntriesCount ); }
+
+	// ===========================================================
+	// Methods
+	// ===========================================================
+
+	/*
+	 * Returns pack directory of the pack file, with trailing '/'.
+	 *
+	 * @param packFile_ - pack file path.
+	 * @throws - std::bad_alloc.
+	*/
+	const std::string AssetPack::getRoot( const std::string & packFile_ )
+	{
+
+		// Normalize separators
+		std::string root_( packFile_ );
+		std::replace( root_.begin( ), root_.end( ), '\\', '/' );
+
+		// Directory, empty if current
+		const std::size_t separator_( root_.rfind( '/' ) );
+		root_.resize( separator_ == std::string::npos ? 0 : separator_ + 1 );
+
+		// Return directory
+		return( root_ );
+
+	}
+
+	/*
+	 * Returns entry name of the file: '/' separated, pack directory stripped.
+	 *
+	 * @param root_ - pack directory.
+	 * @param file_ - file path.
+	 * @throws - std::bad_alloc.
+	*/
+	const std::string AssetPack::getEntryName( const std::string & root_, const std::string & file_ )
+	{
+
+		// Normalize separators
+		std::string name_( file_ );
+		std::replace( name_.begin( ), name_.end( ), '\\', '/' );
+
+		// Strip pack directory
+		if ( !root_.empty( ) && name_.compare( 0, root_.size( ), root_ ) == 0 )
+			name_.erase( 0, root_.size( ) );
+
+		// Return name
+		return( name_ );
+
+	}
+
+	/*
+	 * Returns name hash (FNV-1a, 64 bits).
+	 *
+	 * @param name_ - entry name.
+	*/
+	const uint64_t AssetPack::hashName( const std::string & name_ ) noexcept
+	{ return( FileUtils::Hash( FileUtils::HASH_BASIS, name_.data( ), name_.size( ) ) ); }
+
+	/*
+	 * Maps pack file & validates table of contents.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @param file_ - pack file path.
+	 * @return - 'true' if OK.
+	 * @throws - std::bad_alloc.
+	*/
+	const bool AssetPack::Open( const std::string & file_ )
+	{
+
+		// Close previous pack
+		Close( );
+
+		// Map pack file
+		if ( !mFile.Open( file_ ) )
+			return( false );
+
+		// Pack bytes
+		const unsigned char *const data_( mFile.getData( ) );
+		const std::size_t size_( mFile.getSize( ) );
+
+		// Header
+		const PackHeader *const header_( reinterpret_cast<const PackHeader*>( data_ ) );
+
+		// Check header & table of contents bounds
+		if ( size_ < sizeof( PackHeader ) || header_->magic_ != MAGIC || header_->version_ != VERSION
+			|| header_->tocOffset_ > size_
+			|| ( size_ - header_->tocOffset_ ) < static_cast<uint64_t>( header_->entriesCount_ ) * sizeof( PackEntry ) + header_->namesSize_ )
+		{
+
+			// Log
+			std::string logMsg( "AssetPack::Open - invalid pack #" );
+			logMsg += file_;
+			Log::printWarning( logMsg.c_str( ) );
+
+			// Unmap
+			Close( );
+
+			// Return FALSE
+			return( false );
+
+		}
+
+		// Table of contents
+		mEntriesCount = header_->entriesCount_;
+		mEntries = reinterpret_cast<const PackEntry*>( data_ + header_->tocOffset_ );
+		mNames = reinterpret_cast<const char*>( mEntries + mEntriesCount );
+
+		// Check entries bounds
+		for ( uint32_t i = 0; i < mEntriesCount; i++ )
+		{
+
+			// Entry
+			const PackEntry & entry_ = mEntries[i];
+
+			// Check data & name
+			if ( entry_.offset_ > header_->tocOffset_ || header_->tocOffset_ - entry_.offset_ < entry_.size_
+				|| static_cast<uint64_t>( entry_.nameOffset_ ) + entry_.nameLength_ > header_->namesSize_ )
+			{
+
+				// Log
+				std::string logMsg( "AssetPack::Open - invalid entry in #" );
+				logMsg += file_;
+				Log::printWarning( logMsg.c_str( ) );
+
+				// Unmap
+				Close( );
+
+				// Return FALSE
+				return( false );
+
+			}
+
+		}
+
+		// Pack directory
+		mRoot = getRoot( file_ );
+
+		// Log
+		std::string logMsg( "AssetPack::Open - opened #" );
+		logMsg += file_;
+		Log::printDebug( logMsg.c_str( ) );
+
+		// Return TRUE
+		return( true );
+
+	}
+
+	/*
+	 * Unmaps pack file.
+	 *
+	 * @thread_safety - not thread-safe.
+	*/
+	void AssetPack::Close( ) noexcept
+	{
+
+		// Reset table of contents
+		mEntries = nullptr;
+		mEntriesCount = 0;
+		mNames = nullptr;
+
+		// Unmap
+		mFile.Close( );
+
+	}
+
+	/*
+	 * Returns entry of the file, or null.
+	 *
+	 * @param file_ - file path.
+	 * @throws - std::bad_alloc.
+	*/
+	const PackEntry * AssetPack::find( const std::string & file_ ) const
+	{
+
+		// Cancel, if not opened
+		if ( mEntriesCount == 0 )
+			return( nullptr );
+
+		// Entry name & hash
+		const std::string name_( getEntryName( mRoot, file_ ) );
+		const uint64_t hash_( hashName( name_ ) );
+
+		// Binary search of the first entry with hash
+		uint32_t first_( 0 );
+		uint32_t count_( mEntriesCount );
+		while ( count_ > 0 )
+		{
+			const uint32_t step_( count_ / 2 );
+			if ( mEntries[first_ + step_].nameHash_ < hash_ )
+			{
+				first_ += step_ + 1;
+				count_ -= step_ + 1;
+			}
+			else
+				count_ = step_;
+		}
+
+		// Compare names of entries with the same hash
+		for ( uint32_t i = first_; i < mEntriesCount && mEntries[i].nameHash_ == hash_; i++ )
+		{
+			if ( name_.compare( 0, std::string::npos, mNames + mEntries[i].nameOffset_, mEntries[i].nameLength_ ) == 0 )
+				return( mEntries + i );
+		}
+
+		// Return null
+		return( nullptr );
+
+	}
+
+	/*
+	 * Returns 'true' if the file packed.
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param file_ - file path.
+	 * @throws - std::bad_alloc.
+	*/
+	const bool AssetPack::Contains( const std::string & file_ ) const
+	{ return( find( file_ ) != nullptr ); }
+
+	/*
+	 * Opens packed file as the InputFile memory stream.
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param file_ - file path.
+	 * @param inputFile_ - closed InputFile.
+	 * @return - 'false' if not packed or inflate failed.
+	 * @throws - can throw exception.
+	*/
+	const bool AssetPack::OpenFile( const std::string & file_, InputFile & inputFile_ ) const
+	{
+
+		// Entry
+		const PackEntry *const entry_( find( file_ ) );
+
+		// Cancel, if not packed
+		if ( entry_ == nullptr )
+			return( false );
+
+		// Stored bytes
+		const char *const data_( reinterpret_cast<const char*>( mFile.getData( ) + entry_->offset_ ) );
+
+		// Stored, read in place
+		if ( entry_->compression_ == COMPRESSION_NONE )
+		{
+			inputFile_.openMemory_A( data_, entry_->size_, false );
+			return( true );
+		}
+
+		// Cancel, if compression not supported
+		if ( entry_->compression_ != COMPRESSION_ZLIB )
+			return( false );
+
+		// Inflate
+		char *const bytes_( new char[entry_->originalSize_ > 0 ? entry_->originalSize_ : 1] );
+		uLongf inflated_( entry_->originalSize_ );
+		if ( uncompress( reinterpret_cast<Bytef*>( bytes_ ), &inflated_, reinterpret_cast<const Bytef*>( data_ ), entry_->size_ ) != Z_OK
+			|| inflated_ != entry_->originalSize_ )
+		{
+
+			// Log
+			std::string logMsg( "AssetPack::OpenFile - failed to inflate #" );
+			logMsg += file_;
+			Log::printWarning( logMsg.c_str( ) );
+
+			// Release bytes
+			delete[] bytes_;
+
+			// Return FALSE
+			return( false );
+
+		}
+
+		// Open inflated bytes, deleted on close
+		inputFile_.openMemory_A( bytes_, entry_->originalSize_, true );
+
+		// Return TRUE
+		return( true );
+
+	}
+
+	/*
+	 * Writes pack file, entries compressed if smaller.
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param packFile_ - pack file path.
+	 * @param files_ - files to pack, in the pack directory.
+	 * @param compress_ - 'true' to try zlib compression.
+	 * @return - 'true' if OK.
+	 * @throws - std::bad_alloc.
+	*/
+	const bool AssetPack::Write( const std::string & packFile_, const std::vector<std::string> & files_, const bool compress_ )
+	{
+
+		// Pack directory
+		const std::string root_( getRoot( packFile_ ) );
+
+		// Open pack file
+		std::ofstream output_( packFile_, std::ios::binary | std::ios::trunc );
+		if ( !output_.is_open( ) )
+			return( false );
+
+		// Header placeholder
+		PackHeader header_{ MAGIC, VERSION, 0, 0, 0 };
+		output_.write( reinterpret_cast<const char*>( &header_ ), sizeof( PackHeader ) );
+
+		// Table of contents & names
+		std::vector<PackEntry> entries_;
+		entries_.reserve( files_.size( ) );
+		std::string names_;
+
+		// Padding
+		const char padding_[ALIGNMENT] = { 0 };
+
+		// Compression buffer
+		std::vector<unsigned char> compressed_;
+
+		// Write entries
+		for ( const std::string & file_ : files_ )
+		{
+
+			// Map file
+			MappedFile source_;
+			if ( !source_.Open( file_ ) )
+			{
+
+				// Log
+				std::string logMsg( "AssetPack::Write - failed to open #" );
+				logMsg += file_;
+				Log::printWarning( logMsg.c_str( ) );
+
+				// Return FALSE
+				return( false );
+
+			}
+
+			// Entry name
+			const std::string name_( getEntryName( root_, file_ ) );
+
+			// Align data
+			const uint64_t position_( static_cast<uint64_t>( output_.tellp( ) ) );
+			const uint32_t pad_( static_cast<uint32_t>( ( ALIGNMENT - position_ % ALIGNMENT ) % ALIGNMENT ) );
+			output_.write( padding_, pad_ );
+
+			// Entry
+			PackEntry entry_{ hashName( name_ ), position_ + pad_, static_cast<uint32_t>( source_.getSize( ) ), static_cast<uint32_t>( source_.getSize( ) ),
+				static_cast<uint32_t>( names_.size( ) ), static_cast<uint16_t>( name_.size( ) ), COMPRESSION_NONE, 0 };
+
+			// Compress, kept only if smaller (PNG already deflated)
+			const unsigned char * bytes_( source_.getData( ) );
+			if ( compress_ )
+			{
+
+				// Compress
+				uLongf compressedSize_( compressBound( static_cast<uLong>( source_.getSize( ) ) ) );
+				compressed_.resize( compressedSize_ );
+				if ( compress2( compressed_.data( ), &compressedSize_, source_.getData( ), static_cast<uLong>( source_.getSize( ) ), Z_BEST_COMPRESSION ) == Z_OK
+					&& compressedSize_ < source_.getSize( ) )
+				{
+					entry_.size_ = static_cast<uint32_t>( compressedSize_ );
+					entry_.compression_ = COMPRESSION_ZLIB;
+					bytes_ = compressed_.data( );
+				}
+
+			}
+
+			// Write data
+			output_.write( reinterpret_cast<const char*>( bytes_ ), entry_.size_ );
+
+			// Add entry & name
+			entries_.push_back( entry_ );
+			names_ += name_;
+
+		}
+
+		// Sort table of contents by name hash
+		std::sort( entries_.begin( ), entries_.end( ), []( const PackEntry & a_, const PackEntry & b_ ) { return( a_.nameHash_ < b_.nameHash_ ); } );
+
+		// Align table of contents
+		const uint64_t position_( static_cast<uint64_t>( output_.tellp( ) ) );
+		const uint32_t pad_( static_cast<uint32_t>( ( ALIGNMENT - position_ % ALIGNMENT ) % ALIGNMENT ) );
+		output_.write( padding_, pad_ );
+
+		// Write table of contents & names
+		header_.tocOffset_ = position_ + pad_;
+		header_.entriesCount_ = static_cast<uint32_t>( entries_.size( ) );
+		header_.namesSize_ = static_cast<uint32_t>( names_.size( ) );
+		output_.write( reinterpret_cast<const char*>( entries_.data( ) ), entries_.size( ) * sizeof( PackEntry ) );
+		output_.write( names_.data( ), names_.size( ) );
+
+		// Write header
+		output_.seekp( 0 );
+		output_.write( reinterpret_cast<const char*>( &header_ ), sizeof( PackHeader ) );
+
+		// Return TRUE if written
+		return( output_.good( ) );
+
+	}
+
+	// -------------------------------------------------------- \\
+
+}
\ No newline at end of file
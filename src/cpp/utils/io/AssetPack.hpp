@@ -0,0 +1,312 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_asset_pack_hpp__
+#define __c0de4un_asset_pack_hpp__
+
+// Include string
+#ifndef __c0de4un_string_hpp__
+#include "../../cfg/string.hpp"
+#endif // !__c0de4un_string_hpp__
+
+// Include std::vector
+#ifndef __c0de4un_vector_hpp__
+#include "../../cfg/vector.hpp"
+#endif // !__c0de4un_vector_hpp__
+
+// Include MappedFile
+#ifndef __c0de4un_mapped_file_hpp__
+#include "MappedFile.hpp"
+#endif // !__c0de4un_mapped_file_hpp__
+
+// Include STL
+#include <cstdint> // uint32_t, uint64_t
+
+// Forward-declared InputFile
+#ifndef __c0de4un_input_file_decl__
+#define __c0de4un_input_file_decl__
+namespace c0de4un { class InputFile; }
+#endif // !__c0de4un_input_file_decl__
+
+// AssetPack declared
+#define __c0de4un_asset_pack_decl__
+
+// Enable structure-data (fields, variables) alignment (by compilator) to 1 byte
+#pragma pack( push, 1 )
+
+namespace c0de4un
+{
+
+	/*
+	 * PackHeader - header of the asset pack file.
+	 *
+	 * @version 1.0
+	*/
+	struct PackHeader final
+	{
+
+		/* File type, AssetPack::MAGIC */
+		uint32_t magic_;
+
+		/* Format version, AssetPack::VERSION */
+		uint32_t version_;
+
+		/* Entries count */
+		uint32_t entriesCount_;
+
+		/* Names block size in bytes */
+		uint32_t namesSize_;
+
+		/* Table of contents offset, entries (sorted by name hash) followed by names */
+		uint64_t tocOffset_;
+
+	};
+
+	/*
+	 * PackEntry - table of contents entry of the asset pack.
+	 *
+	 * @version 1.0
+	*/
+	struct PackEntry final
+	{
+
+		/* Name hash (FNV-1a) */
+		uint64_t nameHash_;
+
+		/* Data offset, aligned to AssetPack::ALIGNMENT */
+		uint64_t offset_;
+
+		/* Stored bytes count */
+		uint32_t size_;
+
+		/* Original bytes count */
+		uint32_t originalSize_;
+
+		/* Name offset in the names block */
+		uint32_t nameOffset_;
+
+		/* Name length */
+		uint16_t nameLength_;
+
+		/* Compression, AssetPack::COMPRESSION_NONE or COMPRESSION_ZLIB */
+		uint8_t compression_;
+
+		/* Reserved */
+		uint8_t reserved_;
+
+	};
+
+	/*
+	 * AssetPack - archive of asset files, read from the memory-mapped pack.
+	 *
+	 * One file opened & mapped for all packed assets. Stored entries read in place
+	 * (InputFile memory stream, no copy & no syscalls per asset), compressed entries
+	 * inflated to the memory on open. Names are paths relative to the pack directory,
+	 * '/' separated.
+	 *
+	 * Mounted pack used by InputFile::openStream_A, files not in the pack read from disk.
+	 *
+	 * @version 1.0
+	*/
+	class AssetPack final
+	{
+
+	public:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Constants
+		// ===========================================================
+
+		/* Pack file type, "CPAK" */
+		static constexpr uint32_t MAGIC = 0x4B415043;
+
+		/* Pack format version */
+		static constexpr uint32_t VERSION = 1;
+
+		/* Entries data alignment in bytes */
+		static constexpr uint32_t ALIGNMENT = 16;
+
+		/* Entry stored as is */
+		static constexpr uint8_t COMPRESSION_NONE = 0;
+
+		/* Entry compressed by zlib */
+		static constexpr uint8_t COMPRESSION_ZLIB = 1;
+
+		// ===========================================================
+		// Constructor & destructor
+		// ===========================================================
+
+		/* AssetPack constructor */
+		explicit AssetPack( ) noexcept;
+
+		/* AssetPack destructor, must not be mounted */
+		~AssetPack( );
+
+		// ===========================================================
+		// Getter & Setter
+		// ===========================================================
+
+		/*
+		 * Returns mounted AssetPack, or null.
+		 *
+		 * @thread_safety - thread-safe.
+		*/
+		static const AssetPack *const getMounted( ) noexcept;
+
+		/*
+		 * Mounts AssetPack, used by all InputFile streams opened later.
+		 *
+		 * @thread_safety - thread-safe, pack must live until unmounted (null).
+		 * @param assetPack_ - opened AssetPack, or null to unmount.
+		*/
+		static void Mount( const AssetPack *const assetPack_ ) noexcept;
+
+		/* Returns entries count */
+		const uint32_t getEntriesCount( ) const noexcept;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Maps pack file & validates table of contents.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param file_ - pack file path.
+		 * @return - 'true' if OK.
+		 * @throws - std::bad_alloc.
+		*/
+		const bool Open( const std::string & file_ );
+
+		/*
+		 * Unmaps pack file.
+		 *
+		 * @thread_safety - not thread-safe.
+		*/
+		void Close( ) noexcept;
+
+		/*
+		 * Returns 'true' if the file packed.
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param file_ - file path.
+		 * @throws - std::bad_alloc.
+		*/
+		const bool Contains( const std::string & file_ ) const;
+
+		/*
+		 * Opens packed file as the InputFile memory stream.
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param file_ - file path.
+		 * @param inputFile_ - closed InputFile.
+		 * @return - 'false' if not packed or inflate failed.
+		 * @throws - can throw exception.
+		*/
+		const bool OpenFile( const std::string & file_, InputFile & inputFile_ ) const;
+
+		/*
+		 * Writes pack file, entries compressed if smaller.
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param packFile_ - pack file path.
+		 * @param files_ - files to pack, in the pack directory.
+		 * @param compress_ - 'true' to try zlib compression.
+		 * @return - 'true' if OK.
+		 * @throws - std::bad_alloc.
+		*/
+		static const bool Write( const std::string & packFile_, const std::vector<std::string> & files_, const bool compress_ );
+
+		// -------------------------------------------------------- \\
+
+	private:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Fields
+		// ===========================================================
+
+		/* Mapped pack file */
+		MappedFile mFile;
+
+		/* Pack directory, prefix stripped from file paths */
+		std::string mRoot;
+
+		/* Table of contents, sorted by name hash */
+		const PackEntry * mEntries;
+
+		/* Entries count */
+		uint32_t mEntriesCount;
+
+		/* Names block */
+		const char * mNames;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Returns pack directory of the pack file, with trailing '/'.
+		 *
+		 * @param packFile_ - pack file path.
+		 * @throws - std::bad_alloc.
+		*/
+		static const std::string getRoot( const std::string & packFile_ );
+
+		/*
+		 * Returns entry name of the file: '/' separated, pack directory stripped.
+		 *
+		 * @param root_ - pack directory.
+		 * @param file_ - file path.
+		 * @throws - std::bad_alloc.
+		*/
+		static const std::string getEntryName( const std::string & root_, const std::string & file_ );
+
+		/*
+		 * Returns name hash (FNV-1a, 64 bits).
+		 *
+		 * @param name_ - entry name.
+		*/
+		static const uint64_t hashName( const std::string & name_ ) noexcept;
+
+		/*
+		 * Returns entry of the file, or null.
+		 *
+		 * @param file_ - file path.
+		 * @throws - std::bad_alloc.
+		*/
+		const PackEntry * find( const std::string & file_ ) const;
+
+		// ===========================================================
+		// Deleted
+		// ===========================================================
+
+		/* @deleted AssetPack const copy constructor */
+		AssetPack( const AssetPack & ) = delete;
+
+		/* @deleted AssetPack const copy assignment operator */
+		AssetPack & operator=( const AssetPack & ) = delete;
+
+		/* @deleted AssetPack move constructor */
+		AssetPack( AssetPack && ) = delete;
+
+		/* @deleted AssetPack move assignment operator */
+		AssetPack & operator=( AssetPack && ) = delete;
+
+		// -------------------------------------------------------- \\
+
+	};
+
+}
+
+// Restore structure-data alignment to default (8-byte on MSVC)
+#pragma pack( pop )
+
+#endif // !__c0de4un_asset_pack_hpp__
\ No newline at end of file
@@ -0,0 +1,79 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+// HEADER
+#ifndef __c0de4un_file_utils_hpp__
+#include "FileUtils.hpp"
+#endif // !__c0de4un_file_utils_hpp__
+
+// Include STL
+#include <cstdio> // rename, remove
+
+namespace c0de4un
+{
+
+	// -------------------------------------------------------- \\
+
+	// ===========================================================
+	// Methods
+	// ===========================================================
+
+	/*
+	 * Continues FNV-1a hash (64 bits).
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param hash_ - hash of the previous bytes, HASH_BASIS for first.
+	 * @param bytes_ - bytes.
+	 * @param count_ - bytes count.
+	 * @return - hash.
+	*/
+	const uint64_t FileUtils::Hash( uint64_t hash_, const void *const bytes_, const std::size_t count_ ) noexcept
+	{
+
+		// FNV-1a
+		const unsigned char *const data_( static_cast<const unsigned char*>( bytes_ ) );
+		for ( std::size_t i = 0; i < count_; i++ )
+		{
+			hash_ ^= data_[i];
+			hash_ *= 0x100000001B3ull;
+		}
+
+		// Return hash
+		return( hash_ );
+
+	}
+
+	/*
+	 * Replaces file by the written temp. file, temp. file removed on fail.
+	 * Temp. file renamed, so readers never see partial file.
+	 *
+	 * @thread_safety - thread-safe, not for the same file.
+	 * @param tempFile_ - temp. file path.
+	 * @param file_ - replaced file path.
+	 * @return - 'true' if OK.
+	*/
+	const bool FileUtils::ReplaceFile( const std::string & tempFile_, const std::string & file_ ) noexcept
+	{
+
+		// Remove old file (rename fails on Windows if exists)
+		std::remove( file_.c_str( ) );
+
+		// Rename
+		if ( std::rename( tempFile_.c_str( ), file_.c_str( ) ) != 0 )
+		{
+			std::remove( tempFile_.c_str( ) );
+			return( false );
+		}
+
+		// Return TRUE
+		return( true );
+
+	}
+
+	// -------------------------------------------------------- \\
+
+}
\ No newline at end of file
@@ -0,0 +1,102 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_file_utils_hpp__
+#define __c0de4un_file_utils_hpp__
+
+// Include string
+#ifndef __c0de4un_string_hpp__
+#include "../../cfg/string.hpp"
+#endif // !__c0de4un_string_hpp__
+
+// Include STL
+#include <cstddef> // size_t
+#include <cstdint> // uint64_t
+
+// FileUtils declared
+#define __c0de4un_file_utils_decl__
+
+namespace c0de4un
+{
+
+	/*
+	 * FileUtils - hashing & replacing of the cache files (cooked textures, program binaries, asset packs).
+	 *
+	 * @version 1.0
+	*/
+	class FileUtils final
+	{
+
+	public:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Constants
+		// ===========================================================
+
+		/* FNV-1a (64 bits) offset basis, hash of no bytes */
+		static constexpr uint64_t HASH_BASIS = 0xCBF29CE484222325ull;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Continues FNV-1a hash (64 bits).
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param hash_ - hash of the previous bytes, HASH_BASIS for first.
+		 * @param bytes_ - bytes.
+		 * @param count_ - bytes count.
+		 * @return - hash.
+		*/
+		static const uint64_t Hash( uint64_t hash_, const void *const bytes_, const std::size_t count_ ) noexcept;
+
+		/*
+		 * Replaces file by the written temp. file, temp. file removed on fail.
+		 * Temp. file renamed, so readers never see partial file.
+		 *
+		 * @thread_safety - thread-safe, not for the same file.
+		 * @param tempFile_ - temp. file path.
+		 * @param file_ - replaced file path.
+		 * @return - 'true' if OK.
+		*/
+		static const bool ReplaceFile( const std::string & tempFile_, const std::string & file_ ) noexcept;
+
+		// -------------------------------------------------------- \\
+
+	private:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Deleted
+		// ===========================================================
+
+		/* @deleted FileUtils constructor */
+		FileUtils( ) = delete;
+
+		/* @deleted FileUtils const copy constructor */
+		FileUtils( const FileUtils & ) = delete;
+
+		/* @deleted FileUtils const copy assignment operator */
+		FileUtils & operator=( const FileUtils & ) = delete;
+
+		/* @deleted FileUtils move constructor */
+		FileUtils( FileUtils && ) = delete;
+
+		/* @deleted FileUtils move assignment operator */
+		FileUtils & operator=( FileUtils && ) = delete;
+
+		// -------------------------------------------------------- \\
+
+	};
+
+}
+
+#endif // !__c0de4un_file_utils_hpp__
\ No newline at end of file
@@ -15,6 +15,15 @@
 #include "../log/Log.hpp"
 #endif // !__c0de4un_log_hpp__
 
+// Include AssetPack
+#ifndef __c0de4un_asset_pack_hpp__
+#include "AssetPack.hpp"
+#endif // !__c0de4un_asset_pack_hpp__
+
+// Include STL
+#include <cstring> // memcpy
+#include <stdexcept> // runtime_error
+
 namespace c0de4un
 {
 
@@ -30,7 +39,10 @@ namespace c0de4un
 		inputStream_( nullptr ),
 		readedTotal_( 0 ),
 		readedCount_( 0 ),
-		bufferSize_( 0 )
+		bufferSize_( 0 ),
+		memory_( nullptr ),
+		memorySize_( 0 ),
+		memoryOwned_( false )
 	{
 
 		// Log
@@ -143,7 +155,7 @@ namespace c0de4un
 	// ===========================================================
 
 	/*
-	 * Open input stream to the given file with given params.
+	 * Open input stream to the given file with given params, from the mounted AssetPack if packed.
 	 *
 	 * @thread_safety - not thread-safe.
 	 * @param filePath_ - path to the file.
@@ -157,8 +169,8 @@ namespace c0de4un
 	{
 
 		// Cancel
-		if ( inputStream_ != nullptr )
-			throw std::exception( "InputFile::openStream_A - already opened !" );
+		if ( inputStream_ != nullptr || memory_ != nullptr )
+			throw std::runtime_error( "InputFile::openStream_A - already opened !" );
 
 		// Log
 		std::string logMsg( "InputFile::openStream_A - file path=" );
@@ -172,23 +184,32 @@ namespace c0de4un
 		try
 		{
 
-			// Open ifstream
-			inputStream_ = new std::ifstream( filePath_.c_str( ), mode_ );
+			// Mounted AssetPack
+			const AssetPack *const assetPack_( AssetPack::getMounted( ) );
+
+			// Open packed file, or ifstream
+			if ( assetPack_ == nullptr || !assetPack_->OpenFile( filePath_, *this ) )
+			{
 
-			// Check stream status
-			if ( !inputStream_->is_open( ) )
-			{// Failed to open
+				// Open ifstream
+				inputStream_ = new std::ifstream( filePath_.c_str( ), static_cast<std::ios_base::openmode>( mode_ ) );
 
-				// Log
-				logMsg = "InputFile::openStream_A - failed to open file #";
-				logMsg += filePath_;
-				Log::printWarning( logMsg.c_str( ) );
-				
-				// Close
-				this->close( );
+				// Check stream status
+				if ( !inputStream_->is_open( ) )
+				{// Failed to open
 
-				// Return FALSE
-				return( false );
+					// Log
+					logMsg = "InputFile::openStream_A - failed to open file #";
+					logMsg += filePath_;
+					Log::printWarning( logMsg.c_str( ) );
+
+					// Close
+					this->close( );
+
+					// Return FALSE
+					return( false );
+
+				}
 
 			}
 
@@ -230,7 +251,7 @@ namespace c0de4un
 			this->close( );
 
 			// Throw
-			throw std::exception( "InputFile::openStream_A - unknown error !" );
+			throw std::runtime_error( "InputFile::openStream_A - unknown error !" );
 
 		}
 
@@ -239,6 +260,30 @@ namespace c0de4un
 
 	}
 
+	/*
+	 * Open input stream to the memory, bytes read by copy & pointer advance.
+	 * Used by the AssetPack (mapped entries), openStream_A uses mounted AssetPack first.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @param data_ - bytes, must live until closed if not owned.
+	 * @param size_ - bytes count.
+	 * @param owned_ - 'true' if bytes allocated by new[] & deleted on close.
+	 * @throws - can throw exception.
+	*/
+	void InputFile::openMemory_A( const char *const data_, const std::uint32_t size_, const bool owned_ )
+	{
+
+		// Cancel
+		if ( inputStream_ != nullptr || memory_ != nullptr )
+			throw std::runtime_error( "InputFile::openMemory_A - already opened !" );
+
+		// Set memory stream
+		memory_ = data_;
+		memorySize_ = size_;
+		memoryOwned_ = owned_;
+
+	}
+
 	/*
 	 * Read bytes (signed or unsigned chars, 1-2 or 2-4 bytes each).
 	 *
@@ -255,8 +300,8 @@ namespace c0de4un
 	{
 
 		// Check input-stream state
-		if ( inputStream_ == nullptr )
-			throw std::exception( "InputFile::readBytes_A - not even opened !" );
+		if ( inputStream_ == nullptr && memory_ == nullptr )
+			throw std::runtime_error( "InputFile::readBytes_A - not even opened !" );
 
 		// Bytes to read
 		if ( buffer_ != nullptr )
@@ -273,7 +318,24 @@ namespace c0de4un
 
 		// Check byte to read
 		if ( pCount_ < 1 )
-			throw std::exception( "InputFile::readBytes_A - Illegal arguments, can't read 0 bytes !" );
+			throw std::runtime_error( "InputFile::readBytes_A - Illegal arguments, can't read 0 bytes !" );
+
+		// Read from the memory
+		if ( memory_ != nullptr )
+		{
+
+			// Bytes left
+			const std::uint32_t left_( memorySize_ - static_cast<std::uint32_t>( readedTotal_ ) );
+
+			// Copy bytes & advance
+			readedCount_ = pCount_ < left_ ? pCount_ : left_;
+			std::memcpy( pBuffer_, memory_ + readedTotal_, readedCount_ );
+			readedTotal_ += readedCount_;
+
+			// Return FALSE if end of memory
+			return( readedCount_ == pCount_ );
+
+		}
 
 		// Try-catch Block
 		try
@@ -329,7 +391,7 @@ namespace c0de4un
 			this->close( );
 
 			// Throw
-			throw std::exception( "InputFile::readBytes_A - unknown error !" );
+			throw std::runtime_error( "InputFile::readBytes_A - unknown error !" );
 
 		}
 
@@ -362,6 +424,13 @@ namespace c0de4un
 
 		}
 
+		// Release memory stream
+		if ( memoryOwned_ )
+			delete[] memory_;
+		memory_ = nullptr;
+		memorySize_ = 0;
+		memoryOwned_ = false;
+
 		// Release Buffer
 		if ( buffer_ != nullptr )
 		{
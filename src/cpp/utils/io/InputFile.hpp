@@ -77,7 +77,7 @@ namespace c0de4un
 		// ===========================================================
 
 		/*
-		 * Open input stream to the given file with given params.
+		 * Open input stream to the given file with given params, from the mounted AssetPack if packed.
 		 *
 		 * @thread_safety - not thread-safe.
 		 * @param filePath_ - path to the file.
@@ -89,6 +89,18 @@ namespace c0de4un
 		*/
 		const bool openStream_A( const std::string & filePath_, const unsigned char pMode, const std::uint32_t & buffSize );
 
+		/*
+		 * Open input stream to the memory, bytes read by copy & pointer advance.
+		 * Used by the AssetPack (mapped entries), openStream_A uses mounted AssetPack first.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param data_ - bytes, must live until closed if not owned.
+		 * @param size_ - bytes count.
+		 * @param owned_ - 'true' if bytes allocated by new[] & deleted on close.
+		 * @throws - can throw exception.
+		*/
+		void openMemory_A( const char *const data_, const std::uint32_t size_, const bool owned_ );
+
 		/*
 		 * Read bytes (signed or unsigned chars, 1-2 or 2-4 bytes each).
 		 *
@@ -136,6 +148,15 @@ namespace c0de4un
 		/* Last call readed */
 		std::uint32_t readedCount_;
 
+		/* Memory stream bytes, null if file stream */
+		const char * memory_;
+
+		/* Memory stream bytes count */
+		std::uint32_t memorySize_;
+
+		/* Memory stream bytes deleted on close */
+		bool memoryOwned_;
+
 		// ===========================================================
 		// Deleted
 		// ===========================================================
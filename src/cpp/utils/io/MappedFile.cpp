@@ -0,0 +1,195 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+// HEADER
+#ifndef __c0de4un_mapped_file_hpp__
+#include "MappedFile.hpp"
+#endif // !__c0de4un_mapped_file_hpp__
+
+// Include OS API
+#ifdef WIN32 // WIN32
+#ifndef WIN32_LEAN_AND_MEAN
+#define WIN32_LEAN_AND_MEAN
+#endif // !WIN32_LEAN_AND_MEAN
+#include <windows.h> // CreateFileA, CreateFileMappingA, MapViewOfFile
+#else // !WIN32
+#include <fcntl.h> // open
+#include <sys/mman.h> // mmap, munmap
+#include <sys/stat.h> // fstat
+#include <unistd.h> // close
+#endif // WIN32
+
+namespace c0de4un
+{
+
+	// -------------------------------------------------------- \\
+
+	// ===========================================================
+	// Constructor & destructor
+	// ===========================================================
+
+	/* MappedFile constructor */
+	MappedFile::MappedFile( ) noexcept
+		: mData( nullptr ),
+		mSize( 0 ),
+#ifdef WIN32 // WIN32
+		mFile( INVALID_HANDLE_VALUE ),
+		mMapping( nullptr )
+#else // !WIN32
+		mFile( -1 )
+#endif // WIN32
+	{
+	}
+
+	/* MappedFile destructor, closes file */
+	MappedFile::~MappedFile( )
+	{
+
+		// Close file
+		Close( );
+
+	}
+
+	// ===========================================================
+	// Getter & Setter
+	// ===========================================================
+
+	/* Returns mapped bytes, or null */
+	const unsigned char *const MappedFile::getData( ) const noexcept
+	{ return( mData ); }
+
+	/* Returns mapped bytes count */
+	const std::size_t MappedFile::getSize( ) const noexcept
+	{ return( mSize ); }
+
+	/* Returns 'true' if file mapped */
+	const bool MappedFile::isOpen( ) const noexcept
+	{ return( mData != nullptr ); }
+
+	// ===========================================================
+	// Methods
+	// ===========================================================
+
+	/*
+	 * Maps file to the memory, previous file closed.
+	 *
+	 * @thread_safety - not thread-safe.
+	 * @param file_ - file path.
+	 * @return - 'true' if OK, 'false' if not found, empty or mapping failed.
+	*/
+	const bool MappedFile::Open( const std::string & file_ ) noexcept
+	{
+
+		// Close previous file
+		Close( );
+
+#ifdef WIN32 // WIN32
+		// Open file
+		mFile = CreateFileA( file_.c_str( ), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL | FILE_FLAG_SEQUENTIAL_SCAN, nullptr );
+		if ( mFile == INVALID_HANDLE_VALUE )
+			return( false );
+
+		// File size, empty file can not be mapped
+		LARGE_INTEGER size_;
+		if ( !GetFileSizeEx( mFile, &size_ ) || size_.QuadPart <= 0 )
+		{
+			Close( );
+			return( false );
+		}
+
+		// Create mapping
+		mMapping = CreateFileMappingA( mFile, nullptr, PAGE_READONLY, 0, 0, nullptr );
+		if ( mMapping == nullptr )
+		{
+			Close( );
+			return( false );
+		}
+
+		// Map view of the whole file
+		mData = static_cast<const unsigned char*>( MapViewOfFile( mMapping, FILE_MAP_READ, 0, 0, 0 ) );
+		if ( mData == nullptr )
+		{
+			Close( );
+			return( false );
+		}
+
+		// Set size
+		mSize = static_cast<std::size_t>( size_.QuadPart );
+#else // !WIN32
+		// Open file
+		mFile = open( file_.c_str( ), O_RDONLY );
+		if ( mFile < 0 )
+			return( false );
+
+		// File size, empty file can not be mapped
+		struct stat stat_;
+		if ( fstat( mFile, &stat_ ) != 0 || stat_.st_size <= 0 )
+		{
+			Close( );
+			return( false );
+		}
+
+		// Map whole file
+		void *const data_( mmap( nullptr, static_cast<std::size_t>( stat_.st_size ), PROT_READ, MAP_PRIVATE, mFile, 0 ) );
+		if ( data_ == MAP_FAILED )
+		{
+			Close( );
+			return( false );
+		}
+
+		// Set data & size
+		mData = static_cast<const unsigned char*>( data_ );
+		mSize = static_cast<std::size_t>( stat_.st_size );
+#endif // WIN32
+
+		// Return TRUE
+		return( true );
+
+	}
+
+	/*
+	 * Unmaps & closes file.
+	 *
+	 * @thread_safety - not thread-safe.
+	*/
+	void MappedFile::Close( ) noexcept
+	{
+
+#ifdef WIN32 // WIN32
+		// Unmap view
+		if ( mData != nullptr )
+			UnmapViewOfFile( mData );
+
+		// Close mapping
+		if ( mMapping != nullptr )
+			CloseHandle( mMapping );
+		mMapping = nullptr;
+
+		// Close file
+		if ( mFile != INVALID_HANDLE_VALUE )
+			CloseHandle( mFile );
+		mFile = INVALID_HANDLE_VALUE;
+#else // !WIN32
+		// Unmap
+		if ( mData != nullptr )
+			munmap( const_cast<unsigned char*>( mData ), mSize );
+
+		// Close file
+		if ( mFile >= 0 )
+			close( mFile );
+		mFile = -1;
+#endif // WIN32
+
+		// Reset
+		mData = nullptr;
+		mSize = 0;
+
+	}
+
+	// -------------------------------------------------------- \\
+
+}
\ No newline at end of file
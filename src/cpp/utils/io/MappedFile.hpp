@@ -0,0 +1,137 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_mapped_file_hpp__
+#define __c0de4un_mapped_file_hpp__
+
+// Include platform
+#ifndef __c0de4un_platform_hpp__
+#include "../../cfg/platform.hpp"
+#endif // !__c0de4un_platform_hpp__
+
+// Include string
+#ifndef __c0de4un_string_hpp__
+#include "../../cfg/string.hpp"
+#endif // !__c0de4un_string_hpp__
+
+// Include STL
+#include <cstddef> // size_t
+
+// MappedFile declared
+#define __c0de4un_mapped_file_decl__
+
+namespace c0de4un
+{
+
+	/*
+	 * MappedFile - read-only file mapped to the memory.
+	 *
+	 * Pages loaded by the OS on access, no copy to the user buffer,
+	 * so big binary files (cooked textures, etc) can be used in place.
+	 *
+	 * @version 1.0
+	*/
+	class MappedFile final
+	{
+
+	public:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Constructor & destructor
+		// ===========================================================
+
+		/* MappedFile constructor */
+		explicit MappedFile( ) noexcept;
+
+		/* MappedFile destructor, closes file */
+		~MappedFile( );
+
+		// ===========================================================
+		// Getter & Setter
+		// ===========================================================
+
+		/* Returns mapped bytes, or null */
+		const unsigned char *const getData( ) const noexcept;
+
+		/* Returns mapped bytes count */
+		const std::size_t getSize( ) const noexcept;
+
+		/* Returns 'true' if file mapped */
+		const bool isOpen( ) const noexcept;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Maps file to the memory, previous file closed.
+		 *
+		 * @thread_safety - not thread-safe.
+		 * @param file_ - file path.
+		 * @return - 'true' if OK, 'false' if not found, empty or mapping failed.
+		*/
+		const bool Open( const std::string & file_ ) noexcept;
+
+		/*
+		 * Unmaps & closes file.
+		 *
+		 * @thread_safety - not thread-safe.
+		*/
+		void Close( ) noexcept;
+
+		// -------------------------------------------------------- \\
+
+	private:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Fields
+		// ===========================================================
+
+		/* Mapped bytes */
+		const unsigned char * mData;
+
+		/* Mapped bytes count */
+		std::size_t mSize;
+
+#ifdef WIN32 // WIN32
+		/* File handle */
+		void * mFile;
+
+		/* File mapping handle */
+		void * mMapping;
+#else // !WIN32
+		/* File descriptor */
+		int mFile;
+#endif // WIN32
+
+		// ===========================================================
+		// Deleted
+		// ===========================================================
+
+		/* @deleted MappedFile const copy constructor */
+		MappedFile( const MappedFile & ) = delete;
+
+		/* @deleted MappedFile const copy assignment operator */
+		MappedFile & operator=( const MappedFile & ) = delete;
+
+		/* @deleted MappedFile move constructor */
+		MappedFile( MappedFile && ) = delete;
+
+		/* @deleted MappedFile move assignment operator */
+		MappedFile & operator=( MappedFile && ) = delete;
+
+		// -------------------------------------------------------- \\
+
+	};
+
+}
+
+#endif // !__c0de4un_mapped_file_hpp__
\ No newline at end of file
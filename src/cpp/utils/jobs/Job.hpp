@@ -0,0 +1,63 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_job_hpp__
+#define __c0de4un_job_hpp__
+
+// Include STL
+#include <cstdint> // uint32_t
+
+// Forward-declaration of JobCounter
+#ifndef __c0de4un_job_counter_decl__
+#define __c0de4un_job_counter_decl__
+namespace c0de4un { class JobCounter; }
+#endif // !__c0de4un_job_counter_decl__
+
+// Job declared
+#define __c0de4un_job_decl__
+
+namespace c0de4un
+{
+
+	/*
+	 * Job function.
+	 *
+	 * @param pData - user-data.
+	 * @param begin_ - first item index.
+	 * @param end_ - last item index + 1.
+	*/
+	using job_function_t = void( * )( void *const pData, const uint32_t begin_, const uint32_t end_ );
+
+	/*
+	 * Job - range of items [begin; end) processed by job function.
+	 * Plain data, copied into JobSystem queues without allocations.
+	 *
+	 * @version 1.0
+	*/
+	struct Job final
+	{
+
+		/* Function */
+		job_function_t function_;
+
+		/* User-data */
+		void * data_;
+
+		/* First item index */
+		uint32_t begin_;
+
+		/* Last item index + 1 */
+		uint32_t end_;
+
+		/* Counter, decremented when Job finished */
+		JobCounter * counter_;
+
+	};
+
+}
+
+#endif // !__c0de4un_job_hpp__
\ No newline at end of file
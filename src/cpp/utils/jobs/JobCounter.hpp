@@ -0,0 +1,113 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_job_counter_hpp__
+#define __c0de4un_job_counter_hpp__
+
+// Include STL
+#include <atomic> // atomic
+#include <cstdint> // uint32_t
+
+// JobCounter declared
+#define __c0de4un_job_counter_decl__
+
+namespace c0de4un
+{
+
+	/*
+	 * JobCounter - handle of dispatched Jobs group.
+	 * Counts not finished Jobs, used to wait for them.
+	 *
+	 * @version 1.0
+	*/
+	class JobCounter final
+	{
+
+	public:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Constructor & destructor
+		// ===========================================================
+
+		/* JobCounter constructor */
+		explicit JobCounter( ) noexcept
+			: mPending( 0 )
+		{
+		}
+
+		/* JobCounter destructor */
+		~JobCounter( )
+		{
+		}
+
+		// ===========================================================
+		// Getter & Setter
+		// ===========================================================
+
+		/*
+		 * Returns 'true' if all Jobs finished.
+		 *
+		 * @thread_safety - thread-safe.
+		*/
+		const bool isDone( ) const noexcept
+		{ return( mPending.load( std::memory_order_acquire ) == 0 ); }
+
+		/*
+		 * Add Jobs.
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param count_ - number of Jobs.
+		*/
+		void Add( const uint32_t count_ ) noexcept
+		{ mPending.fetch_add( count_, std::memory_order_relaxed ); }
+
+		/*
+		 * Mark Job as finished.
+		 *
+		 * @thread_safety - thread-safe.
+		*/
+		void Done( ) noexcept
+		{ mPending.fetch_sub( 1, std::memory_order_release ); }
+
+		// -------------------------------------------------------- \\
+
+	private:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Fields
+		// ===========================================================
+
+		/* Not finished Jobs */
+		std::atomic<uint32_t> mPending;
+
+		// ===========================================================
+		// Deleted
+		// ===========================================================
+
+		/* @deleted JobCounter const copy constructor */
+		JobCounter( const JobCounter & ) = delete;
+
+		/* @deleted JobCounter const copy assignment operator */
+		JobCounter & operator=( const JobCounter & ) = delete;
+
+		/* @deleted JobCounter move constructor */
+		JobCounter( JobCounter && ) = delete;
+
+		/* @deleted JobCounter move assignment operator */
+		JobCounter & operator=( JobCounter && ) = delete;
+
+		// -------------------------------------------------------- \\
+
+	};
+
+}
+
+#endif // !__c0de4un_job_counter_hpp__
\ No newline at end of file
@@ -0,0 +1,172 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_job_queue_hpp__
+#define __c0de4un_job_queue_hpp__
+
+// Include mutex
+#ifndef __c0de4un_mutex_hpp__
+#include "../../cfg/mutex.hpp" // std::mutex, std::unique_lock
+#endif // !__c0de4un_mutex_hpp__
+
+// Include Job
+#ifndef __c0de4un_job_hpp__
+#include "Job.hpp"
+#endif // !__c0de4un_job_hpp__
+
+// Include STL
+#include <deque> // deque
+
+// JobQueue declared
+#define __c0de4un_job_queue_decl__
+
+namespace c0de4un
+{
+
+	/*
+	 * JobQueue - per-worker Jobs deque.
+	 * Owner pushes & pops at the back (LIFO, cache-warm),
+	 * other workers steal from the front (FIFO, oldest & largest work first).
+	 *
+	 * @version 1.0
+	*/
+	class JobQueue final
+	{
+
+	public:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Constructor & destructor
+		// ===========================================================
+
+		/* JobQueue constructor */
+		explicit JobQueue( )
+			: mJobs( ),
+			mMutex( )
+		{
+		}
+
+		/* JobQueue destructor */
+		~JobQueue( )
+		{
+		}
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Push Job to the back.
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param job_ - Job.
+		 * @throws - std::bad_alloc.
+		*/
+		void Push( const Job & job_ )
+		{
+
+			// Lock
+			std::lock_guard<std::mutex> lock_( mMutex );
+
+			// Push
+			mJobs.push_back( job_ );
+
+		}
+
+		/*
+		 * Pop Job from the back (owner).
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param job_ - output Job.
+		 * @return - 'false' if empty.
+		*/
+		const bool Pop( Job & job_ ) noexcept
+		{
+
+			// Lock
+			std::lock_guard<std::mutex> lock_( mMutex );
+
+			// Cancel
+			if ( mJobs.empty( ) )
+				return( false );
+
+			// Pop
+			job_ = mJobs.back( );
+			mJobs.pop_back( );
+
+			// Return OK
+			return( true );
+
+		}
+
+		/*
+		 * Steal Job from the front (other workers).
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param job_ - output Job.
+		 * @return - 'false' if empty.
+		*/
+		const bool Steal( Job & job_ ) noexcept
+		{
+
+			// Lock
+			std::lock_guard<std::mutex> lock_( mMutex );
+
+			// Cancel
+			if ( mJobs.empty( ) )
+				return( false );
+
+			// Steal
+			job_ = mJobs.front( );
+			mJobs.pop_front( );
+
+			// Return OK
+			return( true );
+
+		}
+
+		// -------------------------------------------------------- \\
+
+	private:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Fields
+		// ===========================================================
+
+		/* Jobs */
+		std::deque<Job> mJobs;
+
+		/* Mutex */
+		std::mutex mMutex;
+
+		// ===========================================================
+		// Deleted
+		// ===========================================================
+
+		/* @deleted JobQueue const copy constructor */
+		JobQueue( const JobQueue & ) = delete;
+
+		/* @deleted JobQueue const copy assignment operator */
+		JobQueue & operator=( const JobQueue & ) = delete;
+
+		/* @deleted JobQueue move constructor */
+		JobQueue( JobQueue && ) = delete;
+
+		/* @deleted JobQueue move assignment operator */
+		JobQueue & operator=( JobQueue && ) = delete;
+
+		// -------------------------------------------------------- \\
+
+	};
+
+}
+
+#endif // !__c0de4un_job_queue_hpp__
\ No newline at end of file
@@ -0,0 +1,302 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+// HEADER
+#ifndef __c0de4un_job_system_hpp__
+#include "JobSystem.hpp"
+#endif // !__c0de4un_job_system_hpp__
+
+// Include Log
+#ifndef __c0de4un_log_hpp__
+#include "../log/Log.hpp"
+#endif // !__c0de4un_log_hpp__
+
+// Include ProfileScope
+#ifndef __c0de4un_profile_scope_hpp__
+#include "../profiler/ProfileScope.hpp"
+#endif // !__c0de4un_profile_scope_hpp__
+
+// Include STL
+#include <string> // to_string
+
+namespace c0de4un
+{
+
+	// -------------------------------------------------------- \\
+
+	// ===========================================================
+	// Config
+	// ===========================================================
+
+	/* Not worker thread queue index */
+	static constexpr uint32_t NOT_WORKER = UINT32_MAX;
+
+	/* Empty-queue tries before worker goes to sleep */
+	static constexpr uint32_t SPIN_COUNT = 64;
+
+	/* Queue index of the current worker thread */
+	static thread_local uint32_t tQueueIndex = NOT_WORKER;
+
+	/* JobSystem of the current worker thread, queue index is invalid in other instances */
+	static thread_local const JobSystem * tOwner = nullptr;
+
+	// ===========================================================
+	// Constructor & destructor
+	// ===========================================================
+
+	/*
+	 * JobSystem constructor, starts worker threads.
+	 *
+	 * @param workersCount_ - number of worker threads, 0 - Jobs executed by waiting thread only.
+	 * @throws - std::bad_alloc, std::system_error.
+	*/
+	JobSystem::JobSystem( const uint32_t workersCount_ )
+		: mQueues( ),
+		mWorkers( ),
+		mQueued( 0 ),
+		mNextQueue( 0 ),
+		mRunning( true ),
+		mMutex( ),
+		mCondition( )
+	{
+
+		// Create queues (last one for not worker threads)
+		mQueues.reserve( workersCount_ + 1 );
+		for ( uint32_t i = 0; i <= workersCount_; i++ )
+			mQueues.push_back( std::unique_ptr<JobQueue>( new JobQueue( ) ) );
+
+		// Start workers
+		mWorkers.reserve( workersCount_ );
+		for ( uint32_t i = 0; i < workersCount_; i++ )
+			mWorkers.push_back( std::thread( &JobSystem::workerLoop, this, i ) );
+
+		// Log
+		std::string logMsg( "JobSystem::constructor - workers: " );
+		logMsg += std::to_string( workersCount_ );
+		Log::printInfo( logMsg.c_str( ) );
+
+	}
+
+	/* JobSystem destructor, stops & joins worker threads */
+	JobSystem::~JobSystem( )
+	{
+
+		// Stop workers
+		{
+			std::lock_guard<std::mutex> lock_( mMutex );
+			mRunning.store( false, std::memory_order_release );
+		}
+
+		// Wake workers
+		mCondition.notify_all( );
+
+		// Join workers
+		for ( std::thread & worker_ : mWorkers )
+			worker_.join( );
+
+	}
+
+	// ===========================================================
+	// Getter & Setter
+	// ===========================================================
+
+	/* Returns number of worker threads */
+	const uint32_t JobSystem::getWorkersCount( ) const noexcept
+	{ return( static_cast<uint32_t>( mWorkers.size( ) ) ); }
+
+	/*
+	 * Returns default number of workers: hardware threads - 1 (main thread).
+	 *
+	 * @thread_safety - thread-safe.
+	*/
+	const uint32_t JobSystem::getDefaultWorkersCount( ) noexcept
+	{
+
+		// Hardware threads (0 if unknown)
+		const uint32_t hardwareThreads_( std::thread::hardware_concurrency( ) );
+
+		// Return workers count
+		return( hardwareThreads_ > 1 ? hardwareThreads_ - 1 : 0 );
+
+	}
+
+	// ===========================================================
+	// Methods
+	// ===========================================================
+
+	/*
+	 * Split items [0; count) to chunks & dispatch Job per chunk.
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param counter_ - counter, incremented by number of Jobs.
+	 * @param function_ - Job function.
+	 * @param pData - Job user-data.
+	 * @param count_ - number of items.
+	 * @param chunkSize_ - items per Job.
+	 * @throws - std::bad_alloc.
+	*/
+	void JobSystem::Dispatch( JobCounter & counter_, job_function_t function_, void *const pData, const uint32_t count_, const uint32_t chunkSize_ )
+	{
+
+#ifdef DEBUG // DEBUG
+		assert( function_ != nullptr && chunkSize_ > 0 );
+#endif // DEBUG
+
+		// Cancel
+		if ( count_ < 1 )
+			return;
+
+		// Queues count
+		const uint32_t queuesCount_( static_cast<uint32_t>( mQueues.size( ) ) );
+
+		// Job
+		Job job_{ function_, pData, 0, 0, &counter_ };
+
+		// Split to chunks
+		for ( uint32_t begin_ = 0; begin_ < count_; begin_ += chunkSize_ )
+		{
+
+			// Chunk range
+			job_.begin_ = begin_;
+			job_.end_ = count_ - begin_ > chunkSize_ ? begin_ + chunkSize_ : count_;
+
+			// Queue: own queue for worker thread of this JobSystem, round-robin otherwise
+			const uint32_t queueIndex_( tOwner == this ? tQueueIndex : mNextQueue.fetch_add( 1, std::memory_order_relaxed ) % queuesCount_ );
+
+			// Count Job before it can be executed
+			counter_.Add( 1 );
+
+			// Push
+			mQueues[queueIndex_]->Push( job_ );
+
+			// Count queued
+			mQueued.fetch_add( 1, std::memory_order_release );
+
+		}
+
+		// Wake sleeping workers (lock, so worker can't miss notification between check & wait)
+		{
+			std::lock_guard<std::mutex> lock_( mMutex );
+		}
+		mCondition.notify_all( );
+
+	}
+
+	/*
+	 * Wait until all Jobs of the counter finished.
+	 * Calling thread executes queued Jobs while waiting.
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param counter_ - counter.
+	*/
+	void JobSystem::Wait( JobCounter & counter_ ) noexcept
+	{
+
+		// Own queue, external queue for other threads (including workers of other JobSystems)
+		const uint32_t queueIndex_( tOwner == this ? tQueueIndex : static_cast<uint32_t>( mQueues.size( ) - 1 ) );
+
+		// Help until done
+		while ( !counter_.isDone( ) )
+		{
+
+			// Nothing to run, remaining Jobs executed by other threads
+			if ( !runJob( queueIndex_ ) )
+				std::this_thread::yield( );
+
+		}
+
+	}
+
+	/*
+	 * Pop Job from own queue, or steal from other queues, & execute it.
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param queueIndex_ - own queue index.
+	 * @return - 'false' if no Jobs found.
+	*/
+	const bool JobSystem::runJob( const uint32_t queueIndex_ ) noexcept
+	{
+
+		// Job
+		Job job_;
+
+		// Pop own Job
+		bool found_( mQueues[queueIndex_]->Pop( job_ ) );
+
+		// Steal, starting from the next queue
+		const uint32_t queuesCount_( static_cast<uint32_t>( mQueues.size( ) ) );
+		for ( uint32_t i = 1; !found_ && i < queuesCount_; i++ )
+			found_ = mQueues[( queueIndex_ + i ) % queuesCount_]->Steal( job_ );
+
+		// Cancel
+		if ( !found_ )
+			return( false );
+
+		// Not queued anymore
+		mQueued.fetch_sub( 1, std::memory_order_relaxed );
+
+		// Execute
+		job_.function_( job_.data_, job_.begin_, job_.end_ );
+
+		// Finished
+		job_.counter_->Done( );
+
+		// Return OK
+		return( true );
+
+	}
+
+	/*
+	 * Worker thread main loop.
+	 *
+	 * @param queueIndex_ - own queue index.
+	*/
+	void JobSystem::workerLoop( const uint32_t queueIndex_ ) noexcept
+	{
+
+		// Profile
+		C0DE4UN_PROFILE_THREAD( "Worker" );
+
+		// Set own queue
+		tQueueIndex = queueIndex_;
+		tOwner = this;
+
+		// Empty-queue tries
+		uint32_t spins_( 0 );
+
+		// Loop
+		while ( mRunning.load( std::memory_order_acquire ) )
+		{
+
+			// Run Job
+			if ( runJob( queueIndex_ ) )
+			{
+				spins_ = 0;
+				continue;
+			}
+
+			// Spin
+			if ( ++spins_ < SPIN_COUNT )
+			{
+				std::this_thread::yield( );
+				continue;
+			}
+
+			// Sleep until Jobs dispatched or stopped
+			std::unique_lock<std::mutex> lock_( mMutex );
+			mCondition.wait( lock_, [this]( ) { return( !mRunning.load( std::memory_order_acquire ) || mQueued.load( std::memory_order_acquire ) > 0 ); } );
+
+			// Reset tries
+			spins_ = 0;
+
+		}
+
+	}
+
+	// -------------------------------------------------------- \\
+
+}
\ No newline at end of file
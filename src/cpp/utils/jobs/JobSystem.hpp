@@ -0,0 +1,189 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_job_system_hpp__
+#define __c0de4un_job_system_hpp__
+
+// Include std::vector
+#ifndef __c0de4un_vector_hpp__
+#include "../../cfg/vector.hpp"
+#endif // !__c0de4un_vector_hpp__
+
+// Include std::memory
+#ifndef __c0de4un_memory_hpp__
+#include "../../cfg/memory.hpp"
+#endif // !__c0de4un_memory_hpp__
+
+// Include Job
+#ifndef __c0de4un_job_hpp__
+#include "Job.hpp"
+#endif // !__c0de4un_job_hpp__
+
+// Include JobCounter
+#ifndef __c0de4un_job_counter_hpp__
+#include "JobCounter.hpp"
+#endif // !__c0de4un_job_counter_hpp__
+
+// Include JobQueue
+#ifndef __c0de4un_job_queue_hpp__
+#include "JobQueue.hpp"
+#endif // !__c0de4un_job_queue_hpp__
+
+// Include STL
+#include <thread> // thread
+#include <condition_variable> // condition_variable
+
+// JobSystem declared
+#define __c0de4un_job_system_decl__
+
+namespace c0de4un
+{
+
+	/*
+	 * JobSystem - fixed pool of worker threads with work stealing.
+	 *
+	 * Each worker owns JobQueue, idle workers steal Jobs from other queues.
+	 * Thread waiting for JobCounter executes Jobs too, instead of blocking.
+	 *
+	 * @version 1.0
+	*/
+	class JobSystem final
+	{
+
+	public:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Constructor & destructor
+		// ===========================================================
+
+		/*
+		 * JobSystem constructor, starts worker threads.
+		 *
+		 * @param workersCount_ - number of worker threads, 0 - Jobs executed by waiting thread only.
+		 * @throws - std::bad_alloc, std::system_error.
+		*/
+		explicit JobSystem( const uint32_t workersCount_ );
+
+		/* JobSystem destructor, stops & joins worker threads */
+		~JobSystem( );
+
+		// ===========================================================
+		// Getter & Setter
+		// ===========================================================
+
+		/* Returns number of worker threads */
+		const uint32_t getWorkersCount( ) const noexcept;
+
+		/*
+		 * Returns default number of workers: hardware threads - 1 (main thread).
+		 *
+		 * @thread_safety - thread-safe.
+		*/
+		static const uint32_t getDefaultWorkersCount( ) noexcept;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Split items [0; count) to chunks & dispatch Job per chunk.
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param counter_ - counter, incremented by number of Jobs.
+		 * @param function_ - Job function.
+		 * @param pData - Job user-data.
+		 * @param count_ - number of items.
+		 * @param chunkSize_ - items per Job.
+		 * @throws - std::bad_alloc.
+		*/
+		void Dispatch( JobCounter & counter_, job_function_t function_, void *const pData, const uint32_t count_, const uint32_t chunkSize_ );
+
+		/*
+		 * Wait until all Jobs of the counter finished.
+		 * Calling thread executes queued Jobs while waiting.
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param counter_ - counter.
+		*/
+		void Wait( JobCounter & counter_ ) noexcept;
+
+		// -------------------------------------------------------- \\
+
+	private:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Fields
+		// ===========================================================
+
+		/* Per-worker queues (+1 for not worker threads) */
+		std::vector<std::unique_ptr<JobQueue>> mQueues;
+
+		/* Worker threads */
+		std::vector<std::thread> mWorkers;
+
+		/* Queued (not started) Jobs */
+		std::atomic<uint32_t> mQueued;
+
+		/* Round-robin queue index for not worker threads */
+		std::atomic<uint32_t> mNextQueue;
+
+		/* Running flag */
+		std::atomic<bool> mRunning;
+
+		/* Mutex for sleeping workers */
+		std::mutex mMutex;
+
+		/* Wakes sleeping workers */
+		std::condition_variable mCondition;
+
+		// ===========================================================
+		// Deleted
+		// ===========================================================
+
+		/* @deleted JobSystem const copy constructor */
+		JobSystem( const JobSystem & ) = delete;
+
+		/* @deleted JobSystem const copy assignment operator */
+		JobSystem & operator=( const JobSystem & ) = delete;
+
+		/* @deleted JobSystem move constructor */
+		JobSystem( JobSystem && ) = delete;
+
+		/* @deleted JobSystem move assignment operator */
+		JobSystem & operator=( JobSystem && ) = delete;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Worker thread main loop.
+		 *
+		 * @param queueIndex_ - own queue index.
+		*/
+		void workerLoop( const uint32_t queueIndex_ ) noexcept;
+
+		/*
+		 * Pop Job from own queue, or steal from other queues, & execute it.
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param queueIndex_ - own queue index.
+		 * @return - 'false' if no Jobs found.
+		*/
+		const bool runJob( const uint32_t queueIndex_ ) noexcept;
+
+		// -------------------------------------------------------- \\
+
+	};
+
+}
+
+#endif // !__c0de4un_job_system_hpp__
\ No newline at end of file
@@ -12,15 +12,26 @@
 
 // Include STL
 #include <iostream> // cout, cin, cin.get
+#include <atomic> // atomic
+
+// Include platform
+#ifndef __c0de4un_platform_hpp__
+#include "../../cfg/platform.hpp"
+#endif // !__c0de4un_platform_hpp__
 
 // Include Windows
+#ifdef WIN32 // WIN32
 #include <Windows.h> // OutputDebugStringA, OutputDebugStringW
+#endif // WIN32
 
 namespace c0de4un
 {
 
 	// -------------------------------------------------------- \\
 
+	/* 'true' if DEBUG-level messages printed */
+	static std::atomic<bool> debugEnabled_( true );
+
 	// ===========================================================
 	// Methods
 	// ===========================================================
@@ -44,11 +55,13 @@ namespace c0de4un
 		// Print to the console
 		std::cout << logMsg.c_str( ) << std::endl;
 
+#ifdef WIN32 // WIN32
 		// Append endl (Visual Studio Debug-Output Bag)
 		logMsg += "\n";
 
 		// Print to the Visual Studio || VSCode Debug-Output
 		OutputDebugStringA( logMsg.c_str( ) );
+#endif // WIN32
 
 	}
 
@@ -62,6 +75,10 @@ namespace c0de4un
 	void Log::printDebug( const char *const pMessage ) noexcept
 	{
 
+		// Cancel
+		if ( !debugEnabled_.load( std::memory_order_relaxed ) )
+			return;
+
 		// String
 		std::string logMsg( "DEBUG: " );
 
@@ -71,11 +88,13 @@ namespace c0de4un
 		// Print to the console
 		std::cout << logMsg.c_str( ) << std::endl;
 
+#ifdef WIN32 // WIN32
 		// Append endl (Visual Studio Debug-Output Bag)
 		logMsg += "\n";
 
 		// Print to the Visual Studio || VSCode Debug-Output
 		OutputDebugStringA( logMsg.c_str( ) );
+#endif // WIN32
 
 	}
 
@@ -98,11 +117,13 @@ namespace c0de4un
 		// Print to the console
 		std::cout << logMsg.c_str( ) << std::endl;
 
+#ifdef WIN32 // WIN32
 		// Append endl (Visual Studio Debug-Output Bag)
 		logMsg += "\n";
 
 		// Print to the Visual Studio || VSCode Debug-Output
 		OutputDebugStringA( logMsg.c_str( ) );
+#endif // WIN32
 
 	}
 
@@ -125,14 +146,26 @@ namespace c0de4un
 		// Print to the console
 		std::cout << logMsg.c_str( ) << std::endl;
 
+#ifdef WIN32 // WIN32
 		// Append endl (Visual Studio Debug-Output Bag)
 		logMsg += "\n";
 
 		// Print to the Visual Studio || VSCode Debug-Output
 		OutputDebugStringA( logMsg.c_str( ) );
+#endif // WIN32
 
 	}
 
+	/*
+	 * Enables or disables DEBUG-level messages, enabled by default.
+	 * Benchmarks disable them, so console output not measured.
+	 *
+	 * @thread_safety - thread-safe.
+	 * @param enabled_ - 'false' to drop DEBUG-level messages.
+	*/
+	void Log::setDebugEnabled( const bool enabled_ ) noexcept
+	{ debugEnabled_.store( enabled_, std::memory_order_relaxed ); }
+
 	// -------------------------------------------------------- \\
 
 }
\ No newline at end of file
@@ -90,6 +90,15 @@ namespace c0de4un
 		*/
 		static void printError( const char *const pMessage ) noexcept;
 
+		/*
+		 * Enables or disables DEBUG-level messages, enabled by default.
+		 * Benchmarks disable them, so console output not measured.
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param enabled_ - 'false' to drop DEBUG-level messages.
+		*/
+		static void setDebugEnabled( const bool enabled_ ) noexcept;
+
 		// -------------------------------------------------------- \\
 
 	};
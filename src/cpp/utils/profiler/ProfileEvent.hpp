@@ -0,0 +1,41 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_profile_event_hpp__
+#define __c0de4un_profile_event_hpp__
+
+// Include STL
+#include <cstdint> // uint64_t
+
+// ProfileEvent declared
+#define __c0de4un_profile_event_decl__
+
+namespace c0de4un
+{
+
+	/*
+	 * ProfileEvent - timed zone, recorded by ProfileScope.
+	 *
+	 * @version 1.0
+	*/
+	struct ProfileEvent final
+	{
+
+		/* Zone name, string literal */
+		const char * name_;
+
+		/* Zone begin, nanoseconds (steady clock) */
+		uint64_t begin_;
+
+		/* Zone end, nanoseconds (steady clock) */
+		uint64_t end_;
+
+	};
+
+}
+
+#endif // !__c0de4un_profile_event_hpp__
\ No newline at end of file
@@ -0,0 +1,118 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_profile_scope_hpp__
+#define __c0de4un_profile_scope_hpp__
+
+#ifdef _C0DE4UN_PROFILER_ENABLED_ // PROFILER
+
+// Include Profiler
+#ifndef __c0de4un_profiler_hpp__
+#include "Profiler.hpp"
+#endif // !__c0de4un_profiler_hpp__
+
+// ProfileScope declared
+#define __c0de4un_profile_scope_decl__
+
+namespace c0de4un
+{
+
+	/*
+	 * ProfileScope - times the enclosing scope (C0DE4UN_PROFILE_SCOPE).
+	 * Zone recorded if started within the captured frame range.
+	 *
+	 * @version 1.0
+	*/
+	class ProfileScope final
+	{
+
+	public:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Constructor & destructor
+		// ===========================================================
+
+		/*
+		 * ProfileScope constructor.
+		 *
+		 * @param name_ - zone name, string literal.
+		*/
+		explicit ProfileScope( const char *const name_ ) noexcept
+			: mName( profilerRecording.load( std::memory_order_relaxed ) ? name_ : nullptr ),
+			mBegin( mName != nullptr ? Profiler::getTime( ) : 0 )
+		{
+		}
+
+		/* ProfileScope destructor, records zone */
+		~ProfileScope( ) noexcept
+		{
+			if ( mName != nullptr )
+				Profiler::Record( mName, mBegin, Profiler::getTime( ) );
+		}
+
+		// -------------------------------------------------------- \\
+
+	private:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Fields
+		// ===========================================================
+
+		/* Zone name, null if not recorded */
+		const char *const mName;
+
+		/* Zone begin */
+		const uint64_t mBegin;
+
+		// ===========================================================
+		// Deleted
+		// ===========================================================
+
+		/* @deleted ProfileScope const copy constructor */
+		ProfileScope( const ProfileScope & ) = delete;
+
+		/* @deleted ProfileScope const copy assignment operator */
+		ProfileScope & operator=( const ProfileScope & ) = delete;
+
+		/* @deleted ProfileScope move constructor */
+		ProfileScope( ProfileScope && ) = delete;
+
+		/* @deleted ProfileScope move assignment operator */
+		ProfileScope & operator=( ProfileScope && ) = delete;
+
+		// -------------------------------------------------------- \\
+
+	};
+
+}
+
+#define C0DE4UN_PROFILE_CONCAT_( a, b ) a##b
+#define C0DE4UN_PROFILE_VARIABLE_( line ) C0DE4UN_PROFILE_CONCAT_( profileScope_, line )
+
+/* Times the enclosing scope, name is a string literal */
+#define C0DE4UN_PROFILE_SCOPE( name ) const c0de4un::ProfileScope C0DE4UN_PROFILE_VARIABLE_( __LINE__ )( name )
+
+/* Ends frame (Main-Loop) */
+#define C0DE4UN_PROFILE_FRAME( ) c0de4un::Profiler::NextFrame( )
+
+/* Names the calling thread */
+#define C0DE4UN_PROFILE_THREAD( name ) c0de4un::Profiler::setThreadName( name )
+
+#else // !PROFILER
+
+// Compiled out
+#define C0DE4UN_PROFILE_SCOPE( name ) ( (void)0 )
+#define C0DE4UN_PROFILE_FRAME( ) ( (void)0 )
+#define C0DE4UN_PROFILE_THREAD( name ) ( (void)0 )
+
+#endif // PROFILER
+
+#endif // !__c0de4un_profile_scope_hpp__
\ No newline at end of file
@@ -0,0 +1,397 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifdef _C0DE4UN_PROFILER_ENABLED_ // PROFILER
+
+// HEADER
+#ifndef __c0de4un_profiler_hpp__
+#include "Profiler.hpp"
+#endif // !__c0de4un_profiler_hpp__
+
+// Include Log
+#ifndef __c0de4un_log_hpp__
+#include "../log/Log.hpp"
+#endif // !__c0de4un_log_hpp__
+
+// Include std::string
+#ifndef __c0de4un_string_hpp__
+#include "../../cfg/string.hpp"
+#endif // !__c0de4un_string_hpp__
+
+// Include STL
+#include <chrono> // steady_clock
+#include <fstream> // ofstream
+#include <new> // nothrow
+#include <cstring> // strncpy
+#include <algorithm> // min
+#include <exception> // exception
+#include <vector> // vector
+
+namespace c0de4un
+{
+
+	// -------------------------------------------------------- \\
+
+	/*
+	 * ThreadBuffer - zones of one thread, ring buffer.
+	 * Written by its thread only, read by writeChromeTrace.
+	*/
+	struct ThreadBuffer final
+	{
+
+		/* Recorded zones, events_[written_ % EVENTS_PER_THREAD] is the next one */
+		ProfileEvent events_[Profiler::EVENTS_PER_THREAD];
+
+		/* Zones recorded in epoch_, published with release */
+		std::atomic<uint64_t> written_;
+
+		/* Capture epoch of written_, reset by its thread on a new Capture */
+		std::atomic<uint32_t> epoch_;
+
+		/* Thread ID in the trace, from 1 */
+		uint32_t id_;
+
+		/* Thread name, empty if not set */
+		char name_[Profiler::THREAD_NAME_LENGTH];
+
+		/* Next buffer */
+		ThreadBuffer * next_;
+
+	};
+
+	/* 'true' while the captured frame range runs */
+	std::atomic<bool> profilerRecording( false );
+
+	/* Buffers of all threads, pushed lock-free, kept until exit (zones of finished threads exported) */
+	static std::atomic<ThreadBuffer*> buffers_( nullptr );
+
+	/* Buffers count, ThreadBuffer::id_ */
+	static std::atomic<uint32_t> buffersCount_( 0 );
+
+	/* Buffer of the calling thread, null until the first record */
+	static thread_local ThreadBuffer * threadBuffer_( nullptr );
+
+	/* Current frame */
+	static std::atomic<uint64_t> frame_( 0 );
+
+	/* Capture epoch, incremented by Capture, 0 until the first one */
+	static std::atomic<uint32_t> captureEpoch_( 0 );
+
+	/* 'true' if Capture called */
+	static std::atomic<bool> captureStarted_( false );
+
+	/* First captured frame */
+	static std::atomic<uint64_t> captureFirst_( 0 );
+
+	/* Frame after the captured range */
+	static std::atomic<uint64_t> captureEnd_( 0 );
+
+	/* Current frame begin, Main-Thread only */
+	static uint64_t frameBegin_( 0 );
+
+	/* Deletes buffers on exit */
+	static struct BuffersDeleter final
+	{
+		~BuffersDeleter( )
+		{
+			ThreadBuffer * buffer_( buffers_.exchange( nullptr ) );
+			while ( buffer_ != nullptr )
+			{
+				ThreadBuffer *const next_( buffer_->next_ );
+				delete buffer_;
+				buffer_ = next_;
+			}
+		}
+	} buffersDeleter_;
+
+	/*
+	 * Returns buffer of the calling thread, allocates it on the first call.
+	 *
+	 * @return - buffer, null if out of memory.
+	*/
+	static ThreadBuffer * getThreadBuffer( ) noexcept
+	{
+
+		// Allocated
+		if ( threadBuffer_ != nullptr )
+			return( threadBuffer_ );
+
+		// Allocate, zeroed
+		ThreadBuffer *const buffer_( new( std::nothrow ) ThreadBuffer( ) );
+		if ( buffer_ == nullptr )
+			return( nullptr );
+		buffer_->id_ = buffersCount_.fetch_add( 1, std::memory_order_relaxed ) + 1;
+
+		// Push, lock-free
+		buffer_->next_ = buffers_.load( std::memory_order_relaxed );
+		while ( !buffers_.compare_exchange_weak( buffer_->next_, buffer_, std::memory_order_release, std::memory_order_relaxed ) )
+			;
+
+		// Return buffer
+		threadBuffer_ = buffer_;
+		return( buffer_ );
+
+	}
+
+	/*
+	 * Returns zones recorded by the buffer in the current capture epoch,
+	 * 0 if its thread has not recorded since the last Capture.
+	 * Events below the count are published (acquire).
+	*/
+	static const uint64_t getWritten( const ThreadBuffer *const buffer_ ) noexcept
+	{
+		if ( buffer_->epoch_.load( std::memory_order_acquire ) != captureEpoch_.load( std::memory_order_acquire ) )
+			return( 0 );
+		return( buffer_->written_.load( std::memory_order_acquire ) );
+	}
+
+	/* Updates profilerRecording for the current frame */
+	static void updateRecording( ) noexcept
+	{
+		const uint64_t currentFrame_( frame_.load( std::memory_order_relaxed ) );
+		profilerRecording.store( captureStarted_.load( std::memory_order_relaxed )
+			&& currentFrame_ >= captureFirst_.load( std::memory_order_relaxed )
+			&& currentFrame_ < captureEnd_.load( std::memory_order_relaxed ), std::memory_order_relaxed );
+	}
+
+	/* Writes JSON string, quotes & backslashes escaped */
+	static void writeString( std::ofstream & output_, const char * string_ )
+	{
+		output_ << '"';
+		for ( ; *string_ != '\0'; string_++ )
+		{
+			if ( *string_ == '"' || *string_ == '\\' )
+				output_ << '\\';
+			output_ << *string_;
+		}
+		output_ << '"';
+	}
+
+	// ===========================================================
+	// Getter & Setter
+	// ===========================================================
+
+	/* Returns current frame index */
+	const uint64_t Profiler::getFrame( ) noexcept
+	{ return( frame_.load( std::memory_order_relaxed ) ); }
+
+	/* Returns 'true' if the captured frame range is over */
+	const bool Profiler::isCaptured( ) noexcept
+	{ return( captureStarted_.load( std::memory_order_relaxed ) && frame_.load( std::memory_order_relaxed ) >= captureEnd_.load( std::memory_order_relaxed ) ); }
+
+	/* Returns count of the events overwritten (ring buffers full) since Capture */
+	const uint64_t Profiler::getDroppedCount( ) noexcept
+	{
+
+		// Sum of all threads
+		uint64_t dropped_( 0 );
+		for ( const ThreadBuffer * buffer_ = buffers_.load( std::memory_order_acquire ); buffer_ != nullptr; buffer_ = buffer_->next_ )
+		{
+			const uint64_t written_( getWritten( buffer_ ) );
+			if ( written_ > EVENTS_PER_THREAD )
+				dropped_ += written_ - EVENTS_PER_THREAD;
+		}
+
+		// Return count
+		return( dropped_ );
+
+	}
+
+	/* Sets name of the calling thread, shown by the trace viewer */
+	void Profiler::setThreadName( const char *const name_ ) noexcept
+	{
+
+		// Buffer of the thread
+		ThreadBuffer *const buffer_( getThreadBuffer( ) );
+		if ( buffer_ == nullptr )
+			return;
+
+		// Copy, cut
+		std::strncpy( buffer_->name_, name_, THREAD_NAME_LENGTH - 1 );
+		buffer_->name_[THREAD_NAME_LENGTH - 1] = '\0';
+
+	}
+
+	// ===========================================================
+	// Methods
+	// ===========================================================
+
+	/* Starts capture of the frame range, previous events cleared */
+	void Profiler::Capture( const uint64_t firstFrame_, const uint64_t framesCount_ ) noexcept
+	{
+
+		// Clear, each thread resets its buffer on the next record
+		captureEpoch_.fetch_add( 1, std::memory_order_release );
+
+		// Range
+		captureFirst_.store( firstFrame_, std::memory_order_relaxed );
+		captureEnd_.store( firstFrame_ + framesCount_, std::memory_order_relaxed );
+		captureStarted_.store( true, std::memory_order_relaxed );
+
+		// Record current frame if in range
+		frameBegin_ = getTime( );
+		updateRecording( );
+
+	}
+
+	/* Ends frame, "Frame" zone recorded on the calling thread */
+	void Profiler::NextFrame( ) noexcept
+	{
+
+		// Frame zone
+		const uint64_t time_( getTime( ) );
+		if ( profilerRecording.load( std::memory_order_relaxed ) )
+			Record( "Frame", frameBegin_, time_ );
+		frameBegin_ = time_;
+
+		// Next
+		frame_.fetch_add( 1, std::memory_order_relaxed );
+		updateRecording( );
+
+	}
+
+	/* Records zone to the calling thread ring buffer */
+	void Profiler::Record( const char *const name_, const uint64_t begin_, const uint64_t end_ ) noexcept
+	{
+
+		// Buffer of the thread
+		ThreadBuffer *const buffer_( getThreadBuffer( ) );
+		if ( buffer_ == nullptr )
+			return;
+
+		// Reset on a new Capture: count cleared before the epoch published
+		const uint32_t epoch_( captureEpoch_.load( std::memory_order_acquire ) );
+		uint64_t written_( 0 );
+		if ( buffer_->epoch_.load( std::memory_order_relaxed ) != epoch_ )
+		{
+			buffer_->written_.store( 0, std::memory_order_relaxed );
+			buffer_->epoch_.store( epoch_, std::memory_order_release );
+		}
+		else
+			written_ = buffer_->written_.load( std::memory_order_relaxed );
+
+		// Write, then publish (single writer)
+		ProfileEvent & event_( buffer_->events_[written_ % EVENTS_PER_THREAD] );
+		event_.name_ = name_;
+		event_.begin_ = begin_;
+		event_.end_ = end_;
+		buffer_->written_.store( written_ + 1, std::memory_order_release );
+
+	}
+
+	/* Returns steady clock time, in nanoseconds */
+	const uint64_t Profiler::getTime( ) noexcept
+	{ return( static_cast<uint64_t>( std::chrono::duration_cast<std::chrono::nanoseconds>( std::chrono::steady_clock::now( ).time_since_epoch( ) ).count( ) ) ); }
+
+	/* Writes captured zones as Chrome trace JSON */
+	const bool Profiler::writeChromeTrace( const char *const file_ ) noexcept
+	{
+
+		// Guarded-Block
+		try
+		{
+
+			// Open
+			std::ofstream output_( file_, std::ios_base::out | std::ios_base::trunc );
+			if ( !output_.is_open( ) )
+			{
+				std::string logMsg( "Profiler::writeChromeTrace - failed to open " );
+				logMsg += file_;
+				Log::printError( logMsg.c_str( ) );
+				return( false );
+			}
+
+			// Published zones of each thread, counted once (scopes ending after the range still record)
+			const ThreadBuffer *const first_( buffers_.load( std::memory_order_acquire ) );
+			std::vector<uint64_t> writtenCounts_;
+			for ( const ThreadBuffer * buffer_ = first_; buffer_ != nullptr; buffer_ = buffer_->next_ )
+				writtenCounts_.push_back( getWritten( buffer_ ) );
+
+			// Trace begin, the earliest zone
+			uint64_t origin_( UINT64_MAX );
+			size_t bufferIndex_( 0 );
+			for ( const ThreadBuffer * buffer_ = first_; buffer_ != nullptr; buffer_ = buffer_->next_ )
+			{
+				const uint64_t written_( writtenCounts_[bufferIndex_++] );
+				const uint64_t count_( std::min<uint64_t>( written_, EVENTS_PER_THREAD ) );
+				for ( uint64_t i = written_ - count_; i < written_; i++ )
+					origin_ = std::min( origin_, buffer_->events_[i % EVENTS_PER_THREAD].begin_ );
+			}
+
+			// Events, complete ("X") zones in microseconds
+			output_.setf( std::ios_base::fixed );
+			output_.precision( 3 );
+			output_ << "{\n\"traceEvents\": [\n";
+			uint64_t eventsCount_( 0 );
+			bufferIndex_ = 0;
+			for ( const ThreadBuffer * buffer_ = first_; buffer_ != nullptr; buffer_ = buffer_->next_ )
+			{
+
+				// Thread name
+				output_ << "{ \"name\": \"thread_name\", \"ph\": \"M\", \"pid\": 1, \"tid\": " << buffer_->id_ << ", \"args\": { \"name\": ";
+				if ( buffer_->name_[0] != '\0' )
+					writeString( output_, buffer_->name_ );
+				else
+					output_ << "\"Thread " << buffer_->id_ << '"';
+				output_ << " } }";
+
+				// Zones, oldest first
+				const uint64_t written_( writtenCounts_[bufferIndex_++] );
+				const uint64_t count_( std::min<uint64_t>( written_, EVENTS_PER_THREAD ) );
+				for ( uint64_t i = written_ - count_; i < written_; i++ )
+				{
+					const ProfileEvent & event_( buffer_->events_[i % EVENTS_PER_THREAD] );
+					output_ << ",\n{ \"name\": ";
+					writeString( output_, event_.name_ );
+					output_ << ", \"cat\": \"cpu\", \"ph\": \"X\", \"pid\": 1, \"tid\": " << buffer_->id_
+						<< ", \"ts\": " << static_cast<double>( event_.begin_ - origin_ ) / 1000.0
+						<< ", \"dur\": " << static_cast<double>( event_.end_ - event_.begin_ ) / 1000.0 << " }";
+				}
+				eventsCount_ += count_;
+
+				output_ << ( buffer_->next_ != nullptr ? ",\n" : "\n" );
+
+			}
+
+			// Capture info
+			output_ << "],\n\"displayTimeUnit\": \"ms\",\n\"otherData\": { \"first_frame\": " << captureFirst_.load( std::memory_order_relaxed )
+				<< ", \"frames\": " << captureEnd_.load( std::memory_order_relaxed ) - captureFirst_.load( std::memory_order_relaxed )
+				<< ", \"dropped_events\": " << getDroppedCount( ) << " }\n}\n";
+
+			// Failed
+			if ( !output_.good( ) )
+			{
+				std::string logMsg( "Profiler::writeChromeTrace - failed to write " );
+				logMsg += file_;
+				Log::printError( logMsg.c_str( ) );
+				return( false );
+			}
+
+			// Print to the Log
+			std::string logMsg( "Profiler::writeChromeTrace - " );
+			logMsg += std::to_string( eventsCount_ );
+			logMsg += " zones written to ";
+			logMsg += file_;
+			Log::printInfo( logMsg.c_str( ) );
+
+			// Return TRUE
+			return( true );
+
+		}
+		catch ( const std::exception & exception_ )
+		{ Log::printError( exception_.what( ) ); }
+
+		// Return FALSE
+		return( false );
+
+	}
+
+	// -------------------------------------------------------- \\
+
+}
+
+#endif // PROFILER
\ No newline at end of file
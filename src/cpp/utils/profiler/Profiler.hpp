@@ -0,0 +1,168 @@
+/*
+ * Copyright  2018 Denis Zyamaev. Email: (code4un@yandex.ru)
+ * License: see "LICENSE" file
+ * Author: Denis Zyamaev (code4un@yandex.ru)
+ * API: C++ 11
+*/
+
+#ifndef __c0de4un_profiler_hpp__
+#define __c0de4un_profiler_hpp__
+
+// Include ProfileEvent
+#ifndef __c0de4un_profile_event_hpp__
+#include "ProfileEvent.hpp"
+#endif // !__c0de4un_profile_event_hpp__
+
+// Include STL
+#include <atomic> // atomic
+#include <cstdint> // uint32_t, uint64_t
+
+// Profiler declared
+#define __c0de4un_profiler_decl__
+
+namespace c0de4un
+{
+
+	/* 'true' while the captured frame range runs, checked by each ProfileScope */
+	extern std::atomic<bool> profilerRecording;
+
+	/*
+	 * Profiler - scoped CPU timing zones (_C0DE4UN_PROFILER_ENABLED_ builds).
+	 *
+	 * Zones (C0DE4UN_PROFILE_SCOPE) recorded only within the captured frame range,
+	 * each thread into its own ring buffer (single writer, no locks),
+	 * exported as Chrome trace JSON (about:tracing, ui.perfetto.dev).
+	 * Frames counted by NextFrame (Main-Loop), loading is frame 0.
+	 *
+	 * @version 1.0
+	*/
+	class Profiler final
+	{
+
+	public:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Constants
+		// ===========================================================
+
+		/* Events per thread ring buffer, oldest overwritten */
+		static constexpr uint32_t EVENTS_PER_THREAD = 64 * 1024;
+
+		/* Thread name max. length, longer names cut */
+		static constexpr uint32_t THREAD_NAME_LENGTH = 32;
+
+		// ===========================================================
+		// Getter & Setter
+		// ===========================================================
+
+		/*
+		 * Returns current frame index.
+		 *
+		 * @thread_safety - thread-safe.
+		*/
+		static const uint64_t getFrame( ) noexcept;
+
+		/*
+		 * Returns 'true' if the captured frame range is over.
+		 *
+		 * @thread_safety - thread-safe.
+		*/
+		static const bool isCaptured( ) noexcept;
+
+		/*
+		 * Returns count of the events overwritten (ring buffers full) since Capture.
+		 *
+		 * @thread_safety - thread-safe.
+		*/
+		static const uint64_t getDroppedCount( ) noexcept;
+
+		/*
+		 * Sets name of the calling thread, shown by the trace viewer.
+		 *
+		 * @thread_safety - thread-safe.
+		 * @param name_ - thread name.
+		*/
+		static void setThreadName( const char *const name_ ) noexcept;
+
+		// ===========================================================
+		// Methods
+		// ===========================================================
+
+		/*
+		 * Starts capture of the frame range, previous events cleared
+		 * (each thread resets its buffer on its next record, see captureEpoch_).
+		 *
+		 * @thread_safety - Main-Thread only, other threads may record.
+		 * @param firstFrame_ - first frame, 0 to capture loading.
+		 * @param framesCount_ - frames captured.
+		*/
+		static void Capture( const uint64_t firstFrame_, const uint64_t framesCount_ ) noexcept;
+
+		/*
+		 * Ends frame, "Frame" zone recorded on the calling thread.
+		 *
+		 * @thread_safety - Main-Thread only.
+		*/
+		static void NextFrame( ) noexcept;
+
+		/*
+		 * Records zone to the calling thread ring buffer.
+		 * Buffer allocated on the first record of the thread.
+		 *
+		 * @thread_safety - thread-safe, lock-free after the first record.
+		 * @param name_ - zone name, must live until exported (string literal).
+		 * @param begin_ - zone begin (getTime).
+		 * @param end_ - zone end (getTime).
+		*/
+		static void Record( const char *const name_, const uint64_t begin_, const uint64_t end_ ) noexcept;
+
+		/*
+		 * Returns steady clock time, in nanoseconds.
+		 *
+		 * @thread_safety - thread-safe.
+		*/
+		static const uint64_t getTime( ) noexcept;
+
+		/*
+		 * Writes captured zones as Chrome trace JSON.
+		 *
+		 * @thread_safety - not thread-safe, call after the captured range (isCaptured).
+		 * @param file_ - trace file.
+		 * @return - 'true' if written.
+		*/
+		static const bool writeChromeTrace( const char *const file_ ) noexcept;
+
+		// -------------------------------------------------------- \\
+
+	private:
+
+		// -------------------------------------------------------- \\
+
+		// ===========================================================
+		// Deleted
+		// ===========================================================
+
+		/* @deleted Profiler constructor */
+		Profiler( ) = delete;
+
+		/* @deleted Profiler const copy constructor */
+		Profiler( const Profiler & ) = delete;
+
+		/* @deleted Profiler const copy assignment operator */
+		Profiler & operator=( const Profiler & ) = delete;
+
+		/* @deleted Profiler move constructor */
+		Profiler( Profiler && ) = delete;
+
+		/* @deleted Profiler move assignment operator */
+		Profiler & operator=( Profiler && ) = delete;
+
+		// -------------------------------------------------------- \\
+
+	};
+
+}
+
+#endif // !__c0de4un_profiler_hpp__
\ No newline at end of file
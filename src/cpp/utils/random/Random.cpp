@@ -10,6 +10,9 @@
 #include "Random.hpp"
 #endif // !__c0de4un_random_hpp__
 
+// Include STL
+#include <stdexcept> // runtime_error
+
 namespace c0de4un
 {
 
@@ -43,7 +46,7 @@ namespace c0de4un
 
 		// Check range
 		if ( pMin >= pMax )
-			throw std::exception( "Random::getUint32 - min >= max !" );
+			throw std::runtime_error( "Random::getUint32 - min >= max !" );
 
 		// Change number distribution range (same as creating new instance)
 		mUID.param( std::uniform_int_distribution<int>::param_type( pMin, pMax ) );
@@ -61,7 +64,7 @@ namespace c0de4un
 
 		// Check range
 		if ( pMin >= pMax )
-			throw std::exception( "Random::getUint32 - min >= max !" );
+			throw std::runtime_error( "Random::getUint32 - min >= max !" );
 
 		//return( pMin );
 		return( std::uniform_real_distribution<float>{ pMin, pMax }( mGenerator ) );